@@ -1,7 +1,7 @@
 #include "argv.h"
 #include "typing.h"
 
-static bool strcmp(const char *restrict left, const char *restrict right) {
+bool argv_equals(const char *left, const char *right) {
   // compare each character
   while (*left != '\0' && *right != '\0') {
     if (*left != *right) return FALSE;
@@ -25,7 +25,7 @@ i64 argv_match(u32 argc, const char **argv, const char **commands, u64 *selected
 
   // try to match each command
   while (commands[idx] != NULL) {
-    if (strcmp(argv[1], commands[idx]) == TRUE) {
+    if (argv_equals(argv[1], commands[idx]) == TRUE) {
       *selected = idx;
       return 0;
     }
@@ -35,3 +35,36 @@ i64 argv_match(u32 argc, const char **argv, const char **commands, u64 *selected
 
   return ARGV_ERROR_NO_MATCH;
 }
+
+bool argv_flag(u32 argc, const char **argv, const char *name) {
+  u32 idx;
+
+  // try to find the flag among all arguments
+  for (idx = 0; idx < argc; idx++) {
+    if (argv_equals(argv[idx], name) == TRUE) return TRUE;
+  }
+
+  return FALSE;
+}
+
+const char *argv_value(u32 argc, const char **argv, const char *name) {
+  u32 idx;
+
+  // the value is the argument right after the flag
+  for (idx = 0; idx + 1 < argc; idx++) {
+    if (argv_equals(argv[idx], name) == TRUE) return argv[idx + 1];
+  }
+
+  return NULL;
+}
+
+const char *argv_operand(u32 argc, const char **argv) {
+  u32 idx;
+
+  // the first argument not starting with a dash
+  for (idx = 0; idx < argc; idx++) {
+    if (argv[idx][0] != '-') return argv[idx];
+  }
+
+  return NULL;
+}
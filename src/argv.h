@@ -15,6 +15,12 @@ enum argv_error {
 /// @return 0 on success, or a negative error code on failure.
 typedef i32 (*argv_match_fn)(u32 argc, const char **argv);
 
+/// @brief Compares two NUL-terminated strings, e.g. an argument with a flag or a schema name with a path segment.
+/// @param left First string to compare.
+/// @param right Second string to compare.
+/// @return TRUE if both strings have the same characters and length, FALSE otherwise.
+extern bool argv_equals(const char *left, const char *right);
+
 /// @brief Matches command-line arguments against a list of known commands.
 /// @param argc Number of command-line arguments.
 /// @param argv Array of command-line argument strings.
@@ -22,3 +28,23 @@ typedef i32 (*argv_match_fn)(u32 argc, const char **argv);
 /// @param selected Pointer to a variable where the index of the matched command will be stored.
 /// @return 0 on success, or a negative error code on failure.
 extern i64 argv_match(u32 argc, const char **argv, const char **commands, u64 *selected);
+
+/// @brief Checks whether a flag is present among command-line arguments.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @param name Name of the flag, including its dashes.
+/// @return TRUE if the flag is present, FALSE otherwise.
+extern bool argv_flag(u32 argc, const char **argv, const char *name);
+
+/// @brief Finds the value following a flag among command-line arguments.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @param name Name of the flag, including its dashes.
+/// @return The argument following the flag, or NULL if the flag is missing or has no value.
+extern const char *argv_value(u32 argc, const char **argv, const char *name);
+
+/// @brief Finds the first command-line argument which is not a flag, such as a file path.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return The first argument not starting with a dash, or NULL if there is none.
+extern const char *argv_operand(u32 argc, const char **argv);
@@ -0,0 +1,139 @@
+#include "codec.base.h"
+#include "runner.h"
+#include "typing.h"
+
+// sixteen bytes, loaded and stored without any alignment requirement
+typedef u8 codec_bytes __attribute__((vector_size(16), aligned(1)));
+
+void codec_copy_wild(char *target, const char *source, u64 size) {
+  u64 offset;
+
+  // whole chunks, the last one may spill into the slack
+  for (offset = 0; offset < size; offset += sizeof(codec_bytes)) {
+    *(codec_bytes *)(target + offset) = *(const codec_bytes *)(source + offset);
+  }
+}
+
+void codec_copy_exact(char *target, const char *source, u64 size) {
+  // copy 8 bytes at a time
+  while (size >= 8) {
+    *(u64 *)target = *(const u64 *)source;
+    target += 8;
+    source += 8;
+    size -= 8;
+  }
+
+  // and the remaining bytes
+  while (size-- > 0) {
+    *target++ = *source++;
+  }
+}
+
+void codec_copy_match(char *target, u64 distance, u64 size) {
+  i64 remaining;
+  const char *source;
+
+  // defaults
+  source = target - distance;
+  remaining = size;
+
+  // a short distance is widened by repeating the pattern, each store doubles it
+  while (target - source < 8 && remaining > 0) {
+    *(u64 *)target = *(const u64 *)source;
+    remaining -= target - source;
+    target += target - source;
+  }
+
+  // sources at least 16 bytes behind never overlap a single chunk
+  if (target - source >= (i64)sizeof(codec_bytes)) {
+    for (; remaining > 0; remaining -= sizeof(codec_bytes)) {
+      *(codec_bytes *)target = *(const codec_bytes *)source;
+      target += sizeof(codec_bytes);
+      source += sizeof(codec_bytes);
+    }
+  }
+
+  // otherwise 8 bytes at a time
+  for (; remaining > 0; remaining -= 8) {
+    *(u64 *)target = *(const u64 *)source;
+    target += 8;
+    source += 8;
+  }
+}
+
+#if defined(I13C_TESTS)
+
+static void can_copy_wild_within_slack() {
+  u32 index;
+  char source[64], target[64];
+
+  // distinct source bytes and a marked target
+  for (index = 0; index < 64; index++) {
+    source[index] = (char)(index + 1);
+    target[index] = 0;
+  }
+
+  // copy a size which is not a multiple of 16
+  codec_copy_wild(target, source, 21);
+
+  // assert the copied bytes and the untouched bytes past the slack
+  for (index = 0; index < 21; index++) {
+    assert(target[index] == source[index], "byte should be copied");
+  }
+
+  for (index = 21 + CODEC_SLACK; index < 64; index++) {
+    assert(target[index] == 0, "byte past the slack should be untouched");
+  }
+}
+
+static void can_copy_exact_bytes() {
+  u32 index;
+  char source[32], target[32];
+
+  // distinct source bytes and a marked target
+  for (index = 0; index < 32; index++) {
+    source[index] = (char)(index + 1);
+    target[index] = 0;
+  }
+
+  // copy a size which is not a multiple of 8
+  codec_copy_exact(target, source, 13);
+
+  // assert nothing past the size was touched
+  for (index = 0; index < 32; index++) {
+    assert(target[index] == (index < 13 ? source[index] : 0), "only 13 bytes should be copied");
+  }
+}
+
+static void can_copy_match_overlapping() {
+  u32 index, distance;
+  char buffer[128];
+
+  for (distance = 1; distance <= 20; distance++) {
+    // a pattern followed by a marked area
+    for (index = 0; index < 128; index++) {
+      buffer[index] = index < distance ? (char)(index + 1) : 0;
+    }
+
+    // repeat the pattern
+    codec_copy_match(buffer + distance, distance, 77);
+
+    // assert the pattern was repeated
+    for (index = 0; index < distance + 77; index++) {
+      assert(buffer[index] == (char)(index % distance + 1), "byte should repeat the pattern");
+    }
+
+    // assert the slack was respected
+    for (index = distance + 77 + CODEC_SLACK; index < 128; index++) {
+      assert(buffer[index] == 0, "byte past the slack should be untouched");
+    }
+  }
+}
+
+void codec_test_cases_base(struct runner_context *ctx) {
+  test_case(ctx, "can copy wild within slack", can_copy_wild_within_slack);
+  test_case(ctx, "can copy exact bytes", can_copy_exact_bytes);
+  test_case(ctx, "can copy match overlapping", can_copy_match_overlapping);
+}
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "error.h"
+#include "runner.h"
+#include "typing.h"
+
+#define CODEC_SLACK 16 // writable bytes a decompressor may touch past the end of its output
+
+enum codec_error {
+  // indicates that the compressed stream is malformed
+  CODEC_ERROR_INVALID_INPUT = CODEC_ERROR_BASE - 0x01,
+
+  // indicates that the decompressed data does not fit into the output
+  CODEC_ERROR_OUTPUT_OVERFLOW = CODEC_ERROR_BASE - 0x02,
+
+  // indicates that the decompressed data is shorter than announced
+  CODEC_ERROR_OUTPUT_UNDERFLOW = CODEC_ERROR_BASE - 0x03,
+
+  // indicates that the stream uses a feature which is not supported
+  CODEC_ERROR_UNSUPPORTED = CODEC_ERROR_BASE - 0x04,
+
+  // indicates that the decompressed data does not match its checksum
+  CODEC_ERROR_CHECKSUM_MISMATCH = CODEC_ERROR_BASE - 0x05,
+};
+
+/// @brief Copies bytes between non-overlapping buffers, 16 bytes at a time.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param source Pointer to the input, followed by at least CODEC_SLACK readable bytes.
+/// @param size Number of bytes to copy.
+extern void codec_copy_wild(char *target, const char *source, u64 size);
+
+/// @brief Copies bytes between non-overlapping buffers, touching nothing past their ends.
+/// @param target Pointer to the output.
+/// @param source Pointer to the input.
+/// @param size Number of bytes to copy.
+extern void codec_copy_exact(char *target, const char *source, u64 size);
+
+/// @brief Repeats previously written output, the source may overlap the bytes being written.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param distance Distance back to the first repeated byte, at least 1.
+/// @param size Number of bytes to write.
+extern void codec_copy_match(char *target, u64 distance, u64 size);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers codec base test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void codec_test_cases_base(struct runner_context *ctx);
+
+#endif
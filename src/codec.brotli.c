@@ -0,0 +1,1479 @@
+#include "codec.brotli.h"
+#include "codec.base.h"
+#include "codec.brotli.dict.h"
+#include "malloc.h"
+#include "runner.h"
+#include "typing.h"
+
+#define CODEC_BROTLI_ROOT_BITS 8      // bits indexing the root of every prefix code table
+#define CODEC_BROTLI_CODE_MAX 15      // longest code
+#define CODEC_BROTLI_LENGTHS_CODES 18 // code length symbols
+#define CODEC_BROTLI_TABLE_SIZE 1080  // entries of the largest table with its subtables, for 704 symbols
+
+#define CODEC_BROTLI_LITERAL_SYMBOLS 256 // literals
+#define CODEC_BROTLI_COMMAND_SYMBOLS 704 // insert-and-copy length codes
+#define CODEC_BROTLI_COUNT_SYMBOLS 26    // block count codes
+#define CODEC_BROTLI_TYPES_MAX 256       // block types of each category, also trees of each group
+
+#define CODEC_BROTLI_LITERAL_CONTEXTS 64 // literal contexts of each block type
+#define CODEC_BROTLI_DISTANCE_CONTEXTS 4 // distance contexts of each block type
+#define CODEC_BROTLI_TRANSFORMS 121      // transforms of the static dictionary words
+
+#define CODEC_BROTLI_LITERALS 0 // category of the literal blocks
+#define CODEC_BROTLI_COMMANDS 1 // category of the insert-and-copy blocks
+#define CODEC_BROTLI_DISTANCES 2 // category of the distance blocks
+
+#define CODEC_BROTLI_IDENTITY 0         // transform keeping the word
+#define CODEC_BROTLI_OMIT_LAST 0        // transforms dropping 1 to 9 last bytes, added to their count
+#define CODEC_BROTLI_UPPERCASE_FIRST 10 // transform uppercasing the first character
+#define CODEC_BROTLI_UPPERCASE_ALL 11   // transform uppercasing all characters
+#define CODEC_BROTLI_OMIT_FIRST 11      // transforms dropping 1 to 9 first bytes, added to their count
+
+#define CODEC_BROTLI_SYMBOL 0x00   // entry decoding a symbol
+#define CODEC_BROTLI_SUBTABLE 0x01 // entry pointing to a subtable of longer codes
+
+#define CODEC_BROTLI_TABLES (1 << 19) // bytes of the tables of all prefix codes of a single meta-block
+
+struct codec_brotli_entry {
+  u16 value; // symbol or subtable offset
+  u8 bits;   // bits consumed by the code
+  u8 tag;    // kind of the entry
+};
+
+struct codec_brotli_bits {
+  const char *ptr; // next byte to load
+  const char *end; // end of the input
+  u64 container;   // loaded bits, the next one lowest
+  u32 count;       // number of loaded bits
+  u32 overrun;     // zero bytes loaded past the end of the input
+};
+
+struct codec_brotli_category {
+  u32 types;     // number of block types
+  u32 type;      // current block type
+  u32 previous;  // block type before the current one
+  u32 remaining; // symbols left in the current block
+
+  struct codec_brotli_entry type_table[CODEC_BROTLI_TABLE_SIZE];  // block type codes
+  struct codec_brotli_entry count_table[CODEC_BROTLI_TABLE_SIZE]; // block count codes
+};
+
+struct codec_brotli_transform {
+  char prefix[6]; // bytes written before the word
+  u8 type;        // how the word itself is changed
+  char suffix[9]; // bytes written after the word
+};
+
+struct codec_brotli_state {
+  u64 window;    // longest distance within the output
+  u32 ring[4];   // last distances, the next one is stored at the index
+  u32 index;     // position in the distance ring
+  u32 postfix;   // lowest distance bits coded in the symbol
+  u32 direct;    // distances coded directly in the symbol
+  u32 used;      // entries used in the tables of the current meta-block
+  u32 capacity;  // entries available for the tables
+
+  struct codec_brotli_entry *tables;                                    // tables of all prefix codes
+  struct codec_brotli_category categories[3];                           // literal, insert-and-copy and distance blocks
+  struct codec_brotli_entry lengths_table[1 << CODEC_BROTLI_ROOT_BITS]; // code length table
+
+  u8 modes[CODEC_BROTLI_TYPES_MAX];                                         // context mode of every literal type
+  u8 literal_map[CODEC_BROTLI_TYPES_MAX * CODEC_BROTLI_LITERAL_CONTEXTS];   // literal tree of every context
+  u8 distance_map[CODEC_BROTLI_TYPES_MAX * CODEC_BROTLI_DISTANCE_CONTEXTS]; // distance tree of every context
+  u32 literal_trees[CODEC_BROTLI_TYPES_MAX];                                // offsets of the literal tables
+  u32 command_trees[CODEC_BROTLI_TYPES_MAX];                                // offsets of the insert-and-copy tables
+  u32 distance_trees[CODEC_BROTLI_TYPES_MAX];                               // offsets of the distance tables
+  u8 lengths[CODEC_BROTLI_COMMAND_SYMBOLS];                                 // code lengths being read
+};
+
+// order in which the code length code lengths are stored
+static const u8 CODEC_BROTLI_LENGTHS_ORDER[CODEC_BROTLI_LENGTHS_CODES] = {
+  1, 2, 3, 4, 0, 5, 17, 6, 16, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+};
+
+// the fixed code of the code length code lengths, indexed by the next 4 bits
+static const u8 CODEC_BROTLI_LENGTHS_VALUE[16] = {0, 4, 3, 2, 0, 4, 3, 1, 0, 4, 3, 2, 0, 4, 3, 5};
+static const u8 CODEC_BROTLI_LENGTHS_SIZE[16] = {2, 2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 3, 2, 2, 2, 4};
+
+// code lengths of the simple codes with 1 to 4 symbols, the last row is the second shape of 4 symbols
+static const u8 CODEC_BROTLI_SIMPLE[6][4] = {
+  {0, 0, 0, 0}, {0, 0, 0, 0}, {1, 1, 0, 0}, {1, 2, 2, 0}, {2, 2, 2, 2}, {1, 2, 3, 3},
+};
+
+// base and extra bits of the block counts
+static const u32 CODEC_BROTLI_COUNT_BASE[CODEC_BROTLI_COUNT_SYMBOLS] = {
+  1,   5,   9,   13,  17,  25,   33,   41,   49,   65,   81,   97,    113,
+  145, 177, 209, 241, 305, 369, 497, 753, 1265, 2289, 4337, 8433, 16625,
+};
+
+static const u8 CODEC_BROTLI_COUNT_EXTRA[CODEC_BROTLI_COUNT_SYMBOLS] = {
+  2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 7, 8, 9, 10, 11, 12, 13, 24,
+};
+
+// base and extra bits of the insert lengths
+static const u32 CODEC_BROTLI_INSERT_BASE[24] = {
+  0, 1, 2, 3, 4, 5, 6, 8, 10, 14, 18, 26, 34, 50, 66, 98, 130, 194, 322, 578, 1090, 2114, 6210, 22594,
+};
+
+static const u8 CODEC_BROTLI_INSERT_EXTRA[24] = {
+  0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10, 12, 14, 24,
+};
+
+// base and extra bits of the copy lengths
+static const u32 CODEC_BROTLI_COPY_BASE[24] = {
+  2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 18, 22, 30, 38, 54, 70, 102, 134, 198, 326, 582, 1094, 2118,
+};
+
+static const u8 CODEC_BROTLI_COPY_EXTRA[24] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10, 24,
+};
+
+// first insert and copy length codes of every cell of 64 insert-and-copy codes
+static const u8 CODEC_BROTLI_CELL_INSERT[11] = {0, 0, 0, 0, 8, 8, 0, 16, 8, 16, 16};
+static const u8 CODEC_BROTLI_CELL_COPY[11] = {0, 8, 0, 8, 0, 8, 16, 0, 16, 8, 16};
+
+// position in the distance ring and the change of the first 16 distance codes
+static const u8 CODEC_BROTLI_SHORT_INDEX[16] = {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1};
+static const i8 CODEC_BROTLI_SHORT_DELTA[16] = {0, 0, 0, 0, -1, 1, -2, 2, -3, 3, -1, 1, -2, 2, -3, 3};
+
+// context of the last two bytes for every context mode, the first half for the last byte
+static const u8 CODEC_BROTLI_CONTEXT[4][512] = {
+  {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+    4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+    8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11,
+    12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+    16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19,
+    20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23,
+    24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27,
+    28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31,
+    32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35, 35, 35,
+    36, 36, 36, 36, 37, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39,
+    40, 40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 42, 43, 43, 43, 43,
+    44, 44, 44, 44, 45, 45, 45, 45, 46, 46, 46, 46, 47, 47, 47, 47,
+    48, 48, 48, 48, 49, 49, 49, 49, 50, 50, 50, 50, 51, 51, 51, 51,
+    52, 52, 52, 52, 53, 53, 53, 53, 54, 54, 54, 54, 55, 55, 55, 55,
+    56, 56, 56, 56, 57, 57, 57, 57, 58, 58, 58, 58, 59, 59, 59, 59,
+    60, 60, 60, 60, 61, 61, 61, 61, 62, 62, 62, 62, 63, 63, 63, 63,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 12, 16, 12, 12, 20, 12, 16, 24, 28, 12, 12, 32, 12, 36, 12,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 32, 32, 24, 40, 28, 12,
+    12, 48, 52, 52, 52, 48, 52, 52, 52, 48, 52, 52, 52, 52, 52, 48,
+    52, 52, 52, 52, 52, 48, 52, 52, 52, 52, 52, 24, 12, 28, 12, 12,
+    12, 56, 60, 60, 60, 56, 60, 60, 60, 56, 60, 60, 60, 60, 60, 56,
+    60, 60, 60, 60, 60, 56, 60, 60, 60, 60, 60, 24, 12, 28, 12, 0,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+    2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+    2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+    2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  },
+  {
+    0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+  },
+};
+
+// transforms of the static dictionary words, as listed in RFC 7932 appendix B
+static const struct codec_brotli_transform CODEC_BROTLI_TRANSFORM[CODEC_BROTLI_TRANSFORMS] = {
+  {"", CODEC_BROTLI_IDENTITY, ""},
+  {"", CODEC_BROTLI_IDENTITY, " "},
+  {" ", CODEC_BROTLI_IDENTITY, " "},
+  {"", CODEC_BROTLI_OMIT_FIRST + 1, ""},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, " "},
+  {"", CODEC_BROTLI_IDENTITY, " the "},
+  {" ", CODEC_BROTLI_IDENTITY, ""},
+  {"s ", CODEC_BROTLI_IDENTITY, " "},
+  {"", CODEC_BROTLI_IDENTITY, " of "},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, ""},
+  {"", CODEC_BROTLI_IDENTITY, " and "},
+  {"", CODEC_BROTLI_OMIT_FIRST + 2, ""},
+  {"", CODEC_BROTLI_OMIT_LAST + 1, ""},
+  {", ", CODEC_BROTLI_IDENTITY, " "},
+  {"", CODEC_BROTLI_IDENTITY, ", "},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, " "},
+  {"", CODEC_BROTLI_IDENTITY, " in "},
+  {"", CODEC_BROTLI_IDENTITY, " to "},
+  {"e ", CODEC_BROTLI_IDENTITY, " "},
+  {"", CODEC_BROTLI_IDENTITY, "\""},
+  {"", CODEC_BROTLI_IDENTITY, "."},
+  {"", CODEC_BROTLI_IDENTITY, "\">"},
+  {"", CODEC_BROTLI_IDENTITY, "\n"},
+  {"", CODEC_BROTLI_OMIT_LAST + 3, ""},
+  {"", CODEC_BROTLI_IDENTITY, "]"},
+  {"", CODEC_BROTLI_IDENTITY, " for "},
+  {"", CODEC_BROTLI_OMIT_FIRST + 3, ""},
+  {"", CODEC_BROTLI_OMIT_LAST + 2, ""},
+  {"", CODEC_BROTLI_IDENTITY, " a "},
+  {"", CODEC_BROTLI_IDENTITY, " that "},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, ""},
+  {"", CODEC_BROTLI_IDENTITY, ". "},
+  {".", CODEC_BROTLI_IDENTITY, ""},
+  {" ", CODEC_BROTLI_IDENTITY, ", "},
+  {"", CODEC_BROTLI_OMIT_FIRST + 4, ""},
+  {"", CODEC_BROTLI_IDENTITY, " with "},
+  {"", CODEC_BROTLI_IDENTITY, "'"},
+  {"", CODEC_BROTLI_IDENTITY, " from "},
+  {"", CODEC_BROTLI_IDENTITY, " by "},
+  {"", CODEC_BROTLI_OMIT_FIRST + 5, ""},
+  {"", CODEC_BROTLI_OMIT_FIRST + 6, ""},
+  {" the ", CODEC_BROTLI_IDENTITY, ""},
+  {"", CODEC_BROTLI_OMIT_LAST + 4, ""},
+  {"", CODEC_BROTLI_IDENTITY, ". The "},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, ""},
+  {"", CODEC_BROTLI_IDENTITY, " on "},
+  {"", CODEC_BROTLI_IDENTITY, " as "},
+  {"", CODEC_BROTLI_IDENTITY, " is "},
+  {"", CODEC_BROTLI_OMIT_LAST + 7, ""},
+  {"", CODEC_BROTLI_OMIT_LAST + 1, "ing "},
+  {"", CODEC_BROTLI_IDENTITY, "\n\t"},
+  {"", CODEC_BROTLI_IDENTITY, ":"},
+  {" ", CODEC_BROTLI_IDENTITY, ". "},
+  {"", CODEC_BROTLI_IDENTITY, "ed "},
+  {"", CODEC_BROTLI_OMIT_FIRST + 9, ""},
+  {"", CODEC_BROTLI_OMIT_FIRST + 7, ""},
+  {"", CODEC_BROTLI_OMIT_LAST + 6, ""},
+  {"", CODEC_BROTLI_IDENTITY, "("},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, ", "},
+  {"", CODEC_BROTLI_OMIT_LAST + 8, ""},
+  {"", CODEC_BROTLI_IDENTITY, " at "},
+  {"", CODEC_BROTLI_IDENTITY, "ly "},
+  {" the ", CODEC_BROTLI_IDENTITY, " of "},
+  {"", CODEC_BROTLI_OMIT_LAST + 5, ""},
+  {"", CODEC_BROTLI_OMIT_LAST + 9, ""},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, ", "},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "\""},
+  {".", CODEC_BROTLI_IDENTITY, "("},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, " "},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "\">"},
+  {"", CODEC_BROTLI_IDENTITY, "=\""},
+  {" ", CODEC_BROTLI_IDENTITY, "."},
+  {".com/", CODEC_BROTLI_IDENTITY, ""},
+  {" the ", CODEC_BROTLI_IDENTITY, " of the "},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "'"},
+  {"", CODEC_BROTLI_IDENTITY, ". This "},
+  {"", CODEC_BROTLI_IDENTITY, ","},
+  {".", CODEC_BROTLI_IDENTITY, " "},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "("},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "."},
+  {"", CODEC_BROTLI_IDENTITY, " not "},
+  {" ", CODEC_BROTLI_IDENTITY, "=\""},
+  {"", CODEC_BROTLI_IDENTITY, "er "},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, " "},
+  {"", CODEC_BROTLI_IDENTITY, "al "},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, ""},
+  {"", CODEC_BROTLI_IDENTITY, "='"},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "\""},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, ". "},
+  {" ", CODEC_BROTLI_IDENTITY, "("},
+  {"", CODEC_BROTLI_IDENTITY, "ful "},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, ". "},
+  {"", CODEC_BROTLI_IDENTITY, "ive "},
+  {"", CODEC_BROTLI_IDENTITY, "less "},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "'"},
+  {"", CODEC_BROTLI_IDENTITY, "est "},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, "."},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "\">"},
+  {" ", CODEC_BROTLI_IDENTITY, "='"},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, ","},
+  {"", CODEC_BROTLI_IDENTITY, "ize "},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "."},
+  {"\xc2\xa0", CODEC_BROTLI_IDENTITY, ""},
+  {" ", CODEC_BROTLI_IDENTITY, ","},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "=\""},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "=\""},
+  {"", CODEC_BROTLI_IDENTITY, "ous "},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, ", "},
+  {"", CODEC_BROTLI_UPPERCASE_FIRST, "='"},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, ","},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, "=\""},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, ", "},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, ","},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "("},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, ". "},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, "."},
+  {"", CODEC_BROTLI_UPPERCASE_ALL, "='"},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, ". "},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, "=\""},
+  {" ", CODEC_BROTLI_UPPERCASE_ALL, "='"},
+  {" ", CODEC_BROTLI_UPPERCASE_FIRST, "='"},
+};
+
+static inline void codec_brotli_refill(struct codec_brotli_bits *bits) {
+  // far from the end, load 8 bytes and keep the whole ones, the rest is loaded again next time
+  if (bits->end - bits->ptr >= 8) {
+    bits->container |= *(const u64 *)bits->ptr << bits->count;
+    bits->ptr += (63 - bits->count) >> 3;
+    bits->count |= 56;
+    return;
+  }
+
+  // near the end byte by byte, zeros past the end are counted to detect truncation
+  while (bits->count <= 56) {
+    if (bits->ptr < bits->end) {
+      bits->container |= (u64)(u8)*bits->ptr++ << bits->count;
+    } else {
+      bits->overrun++;
+    }
+
+    bits->count += 8;
+  }
+}
+
+static inline void codec_brotli_consume(struct codec_brotli_bits *bits, u32 count) {
+  // drop the lowest bits
+  bits->container >>= count;
+  bits->count -= count;
+}
+
+static inline u32 codec_brotli_take(struct codec_brotli_bits *bits, u32 count) {
+  u32 value;
+
+  // at most 24 bits, always available after a refill
+  codec_brotli_refill(bits);
+
+  value = bits->container & ((1u << count) - 1);
+  codec_brotli_consume(bits, count);
+
+  return value;
+}
+
+static inline u32 codec_brotli_decode(const struct codec_brotli_entry *table, struct codec_brotli_bits *bits) {
+  struct codec_brotli_entry entry;
+
+  // the caller refilled enough bits for the longest code
+  entry = table[bits->container & ((1 << CODEC_BROTLI_ROOT_BITS) - 1)];
+
+  // longer codes continue in a subtable
+  if (entry.tag == CODEC_BROTLI_SUBTABLE) {
+    codec_brotli_consume(bits, CODEC_BROTLI_ROOT_BITS);
+    entry = table[entry.value + (bits->container & ((1 << entry.bits) - 1))];
+  }
+
+  codec_brotli_consume(bits, entry.bits);
+  return entry.value;
+}
+
+static bool codec_brotli_truncated(const struct codec_brotli_bits *bits) {
+  // some of the zeros past the end were consumed
+  return bits->count < bits->overrun * 8;
+}
+
+static u32 codec_brotli_reverse(u32 code, u32 length) {
+  u32 index, reversed;
+
+  // codes are stored starting with their highest bit
+  for (index = 0, reversed = 0; index < length; index++) {
+    reversed = (reversed << 1) | ((code >> index) & 0x01);
+  }
+
+  return reversed;
+}
+
+static i64 codec_brotli_build(
+  struct codec_brotli_entry *table, u32 capacity, u32 root, const u8 *lengths, u32 symbols) {
+  i32 left;
+  u32 index, length, longest, code, symbol, position, prefix, base, bits, used;
+  u16 counts[CODEC_BROTLI_CODE_MAX + 1], offsets[CODEC_BROTLI_CODE_MAX + 2], sorted[CODEC_BROTLI_COMMAND_SYMBOLS];
+  struct codec_brotli_entry entry;
+
+  // count the codes of each length
+  for (length = 0; length <= CODEC_BROTLI_CODE_MAX; length++) {
+    counts[length] = 0;
+  }
+
+  for (symbol = 0, longest = 0; symbol < symbols; symbol++) {
+    counts[lengths[symbol]]++;
+    longest = lengths[symbol] > longest ? lengths[symbol] : longest;
+  }
+
+  // the lengths must describe a complete code
+  for (length = 1, left = 1; length <= CODEC_BROTLI_CODE_MAX; length++) {
+    left = (left << 1) - counts[length];
+    if (left < 0) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  if (left != 0) return CODEC_ERROR_INVALID_INPUT;
+  if ((1u << root) > capacity) return CODEC_ERROR_UNSUPPORTED;
+
+  // sort the symbols by their lengths, then by their values
+  for (length = 1, offsets[1] = 0; length <= CODEC_BROTLI_CODE_MAX; length++) {
+    offsets[length + 1] = offsets[length] + counts[length];
+  }
+
+  for (symbol = 0; symbol < symbols; symbol++) {
+    if (lengths[symbol] > 0) sorted[offsets[lengths[symbol]]++] = symbol;
+  }
+
+  // assign the canonical codes in order, longer codes go into subtables behind their first root bits
+  entry.tag = CODEC_BROTLI_SYMBOL;
+  used = 1 << root;
+  prefix = (u32)-1;
+  base = 0;
+  bits = 0;
+  position = 0;
+
+  for (length = 1, code = 0; length <= CODEC_BROTLI_CODE_MAX; length++, code <<= 1) {
+    while (counts[length] > 0) {
+      entry.value = sorted[position++];
+
+      if (length <= root) {
+        entry.bits = length;
+
+        for (index = codec_brotli_reverse(code, length); index < (1u << root); index += 1 << length) {
+          table[index] = entry;
+        }
+      } else {
+        // a new prefix opens a subtable wide enough for all remaining codes sharing it
+        if ((index = codec_brotli_reverse(code >> (length - root), root)) != prefix) {
+          prefix = index;
+          bits = length - root;
+          left = 1 << bits;
+
+          while (bits + root < longest) {
+            left -= counts[bits + root];
+            if (left <= 0) break;
+
+            bits++;
+            left <<= 1;
+          }
+
+          if (used + (1 << bits) > capacity) return CODEC_ERROR_UNSUPPORTED;
+
+          table[prefix].value = used;
+          table[prefix].bits = bits;
+          table[prefix].tag = CODEC_BROTLI_SUBTABLE;
+
+          base = used;
+          used += 1 << bits;
+        }
+
+        // the remaining bits of the code index the subtable
+        entry.bits = length - root;
+        index = codec_brotli_reverse(code & ((1 << entry.bits) - 1), entry.bits);
+
+        for (; index < (1u << bits); index += 1 << entry.bits) {
+          table[base + index] = entry;
+        }
+      }
+
+      counts[length]--;
+      code++;
+    }
+  }
+
+  // success
+  return used;
+}
+
+static i64 codec_brotli_single(struct codec_brotli_entry *table, u32 capacity, u32 root, u32 symbol) {
+  u32 index;
+  struct codec_brotli_entry entry;
+
+  // a lone symbol is decoded without consuming any bits
+  entry.value = symbol;
+  entry.bits = 0;
+  entry.tag = CODEC_BROTLI_SYMBOL;
+
+  if ((1u << root) > capacity) return CODEC_ERROR_UNSUPPORTED;
+
+  for (index = 0; index < (1u << root); index++) {
+    table[index] = entry;
+  }
+
+  // success
+  return 1 << root;
+}
+
+static i64 codec_brotli_simple(struct codec_brotli_state *state,
+                               struct codec_brotli_bits *bits,
+                               u32 symbols,
+                               struct codec_brotli_entry *table,
+                               u32 capacity) {
+  u32 index, other, count, width, shape;
+  u16 values[4];
+
+  // the symbols are stored with just enough bits for the alphabet
+  for (width = 0; (1u << width) < symbols; width++) {
+  }
+
+  count = codec_brotli_take(bits, 2) + 1;
+
+  for (index = 0; index < count; index++) {
+    values[index] = codec_brotli_take(bits, width);
+    if (values[index] >= symbols) return CODEC_ERROR_INVALID_INPUT;
+
+    // and must be distinct
+    for (other = 0; other < index; other++) {
+      if (values[other] == values[index]) return CODEC_ERROR_INVALID_INPUT;
+    }
+  }
+
+  if (count == 1) return codec_brotli_single(table, capacity, CODEC_BROTLI_ROOT_BITS, values[0]);
+
+  // four symbols come in two shapes
+  shape = count == 4 && codec_brotli_take(bits, 1) ? 5 : count;
+
+  for (index = 0; index < symbols; index++) {
+    state->lengths[index] = 0;
+  }
+
+  for (index = 0; index < count; index++) {
+    state->lengths[values[index]] = CODEC_BROTLI_SIMPLE[shape][index];
+  }
+
+  return codec_brotli_build(table, capacity, CODEC_BROTLI_ROOT_BITS, state->lengths, symbols);
+}
+
+static i64 codec_brotli_code(struct codec_brotli_state *state,
+                             struct codec_brotli_bits *bits,
+                             u32 symbols,
+                             struct codec_brotli_entry *table,
+                             u32 capacity) {
+  i64 result;
+  i32 space;
+  u32 index, skip, count, value, peek, previous, repeat, last, extra, delta;
+  u8 lengths[CODEC_BROTLI_LENGTHS_CODES];
+
+  // two bits select a simple code or tell how many code length code lengths are skipped
+  skip = codec_brotli_take(bits, 2);
+  if (skip == 1) return codec_brotli_simple(state, bits, symbols, table, capacity);
+
+  for (index = 0; index < CODEC_BROTLI_LENGTHS_CODES; index++) {
+    lengths[index] = 0;
+  }
+
+  // the code length code lengths have their own fixed code, and stop once the code is complete
+  for (index = skip, space = 32, count = 0, last = 0; index < CODEC_BROTLI_LENGTHS_CODES; index++) {
+    codec_brotli_refill(bits);
+
+    peek = bits->container & 0x0f;
+    value = CODEC_BROTLI_LENGTHS_VALUE[peek];
+    codec_brotli_consume(bits, CODEC_BROTLI_LENGTHS_SIZE[peek]);
+
+    lengths[CODEC_BROTLI_LENGTHS_ORDER[index]] = value;
+    if (value == 0) continue;
+
+    last = CODEC_BROTLI_LENGTHS_ORDER[index];
+    space -= 32 >> value;
+    count++;
+
+    if (space <= 0) break;
+  }
+
+  // a single code length code takes no bits, otherwise the code must be complete
+  if (count == 1) {
+    result = codec_brotli_single(state->lengths_table, 1 << CODEC_BROTLI_ROOT_BITS, CODEC_BROTLI_ROOT_BITS, last);
+  } else if (space == 0) {
+    result = codec_brotli_build(state->lengths_table, 1 << CODEC_BROTLI_ROOT_BITS, CODEC_BROTLI_ROOT_BITS, lengths,
+                                CODEC_BROTLI_LENGTHS_CODES);
+  } else {
+    result = CODEC_ERROR_INVALID_INPUT;
+  }
+
+  if (result < 0) return result;
+
+  // the code lengths with repeats, which stop once the code is complete
+  previous = 8;
+  repeat = 0;
+  last = 0;
+  space = 1 << CODEC_BROTLI_CODE_MAX;
+
+  for (index = 0; index < symbols && space > 0;) {
+    codec_brotli_refill(bits);
+    value = codec_brotli_decode(state->lengths_table, bits);
+
+    // lengths themselves
+    if (value < 16) {
+      state->lengths[index++] = value;
+      repeat = 0;
+
+      if (value != 0) {
+        previous = value;
+        space -= (1 << CODEC_BROTLI_CODE_MAX) >> value;
+      }
+
+      continue;
+    }
+
+    // or repeats of the previous non-zero length or of zero, consecutive repeats multiply
+    extra = value == 16 ? 2 : 3;
+    value = value == 16 ? previous : 0;
+
+    if (last != value) {
+      repeat = 0;
+      last = value;
+    }
+
+    delta = repeat;
+    repeat = (repeat > 0 ? (repeat - 2) << extra : 0) + codec_brotli_take(bits, extra) + 3;
+    delta = repeat - delta;
+
+    if (delta > symbols - index) return CODEC_ERROR_INVALID_INPUT;
+
+    while (delta-- > 0) {
+      state->lengths[index++] = value;
+      if (value != 0) space -= (1 << CODEC_BROTLI_CODE_MAX) >> value;
+    }
+  }
+
+  // the code must be complete, the remaining symbols have no code
+  if (space != 0 || codec_brotli_truncated(bits)) return CODEC_ERROR_INVALID_INPUT;
+
+  for (; index < symbols; index++) {
+    state->lengths[index] = 0;
+  }
+
+  return codec_brotli_build(table, capacity, CODEC_BROTLI_ROOT_BITS, state->lengths, symbols);
+}
+
+static u32 codec_brotli_count(const struct codec_brotli_entry *table, struct codec_brotli_bits *bits) {
+  u32 symbol;
+
+  // a block count code followed by its extra bits
+  codec_brotli_refill(bits);
+  symbol = codec_brotli_decode(table, bits);
+
+  return CODEC_BROTLI_COUNT_BASE[symbol] + codec_brotli_take(bits, CODEC_BROTLI_COUNT_EXTRA[symbol]);
+}
+
+static u32 codec_brotli_varint(struct codec_brotli_bits *bits) {
+  u32 width;
+
+  // a value from 1 to 256, one bit for 1, otherwise the width of the rest
+  if (codec_brotli_take(bits, 1) == 0) return 1;
+
+  width = codec_brotli_take(bits, 3);
+  if (width == 0) return 2;
+
+  return (1 << width) + codec_brotli_take(bits, width) + 1;
+}
+
+static i64 codec_brotli_category(struct codec_brotli_state *state,
+                                 struct codec_brotli_bits *bits,
+                                 struct codec_brotli_category *category) {
+  i64 result;
+
+  // the first block type is zero and the one before it is one
+  category->types = codec_brotli_varint(bits);
+  category->type = 0;
+  category->previous = 1;
+  category->remaining = 1 << 24;
+
+  // a single block type spans the whole meta-block
+  if (category->types < 2) return 0;
+
+  result = codec_brotli_code(state, bits, category->types + 2, category->type_table, CODEC_BROTLI_TABLE_SIZE);
+  if (result < 0) return result;
+
+  result = codec_brotli_code(state, bits, CODEC_BROTLI_COUNT_SYMBOLS, category->count_table, CODEC_BROTLI_TABLE_SIZE);
+  if (result < 0) return result;
+
+  // followed by the count of the first block
+  category->remaining = codec_brotli_count(category->count_table, bits);
+
+  // success
+  return 0;
+}
+
+static void codec_brotli_switch(struct codec_brotli_category *category, struct codec_brotli_bits *bits) {
+  u32 symbol, type;
+
+  // the new type is the previous one, the next one or given explicitly
+  codec_brotli_refill(bits);
+  symbol = codec_brotli_decode(category->type_table, bits);
+
+  type = symbol == 0 ? category->previous : symbol == 1 ? category->type + 1 : symbol - 2;
+  type = type >= category->types ? type - category->types : type;
+
+  category->previous = category->type;
+  category->type = type;
+
+  // followed by the count of the new block
+  category->remaining = codec_brotli_count(category->count_table, bits);
+}
+
+static i64 codec_brotli_map(struct codec_brotli_state *state, struct codec_brotli_bits *bits, u8 *map, u32 size) {
+  i64 result;
+  u32 index, trees, runs, symbol, run, position;
+  u8 value, order[CODEC_BROTLI_TYPES_MAX];
+
+  struct codec_brotli_entry *table;
+
+  // a single tree needs no map
+  trees = codec_brotli_varint(bits);
+
+  if (trees < 2) {
+    for (index = 0; index < size; index++) {
+      map[index] = 0;
+    }
+
+    return trees;
+  }
+
+  // runs of zeros have their own symbols
+  runs = codec_brotli_take(bits, 1) ? codec_brotli_take(bits, 4) + 1 : 0;
+
+  // the code is only needed while reading the map, so it borrows the free tables
+  table = state->tables + state->used;
+
+  result = codec_brotli_code(state, bits, trees + runs, table, state->capacity - state->used);
+  if (result < 0) return result;
+
+  for (index = 0; index < size;) {
+    codec_brotli_refill(bits);
+    symbol = codec_brotli_decode(table, bits);
+
+    // trees themselves
+    if (symbol == 0 || symbol > runs) {
+      map[index++] = symbol == 0 ? 0 : symbol - runs;
+      continue;
+    }
+
+    // or runs of zeros
+    run = (1 << symbol) + codec_brotli_take(bits, symbol);
+    if (run > size - index) return CODEC_ERROR_INVALID_INPUT;
+
+    while (run-- > 0) {
+      map[index++] = 0;
+    }
+  }
+
+  // the map may be stored with a move-to-front transform
+  if (codec_brotli_take(bits, 1)) {
+    for (index = 0; index < CODEC_BROTLI_TYPES_MAX; index++) {
+      order[index] = index;
+    }
+
+    for (index = 0; index < size; index++) {
+      position = map[index];
+      value = order[position];
+      map[index] = value;
+
+      for (; position > 0; position--) {
+        order[position] = order[position - 1];
+      }
+
+      order[0] = value;
+    }
+  }
+
+  // success
+  return trees;
+}
+
+static i64 codec_brotli_group(
+  struct codec_brotli_state *state, struct codec_brotli_bits *bits, u32 *trees, u32 count, u32 symbols) {
+  i64 result;
+  u32 index;
+
+  // every tree of the group is appended to the tables
+  for (index = 0; index < count; index++) {
+    trees[index] = state->used;
+
+    result = codec_brotli_code(state, bits, symbols, state->tables + state->used, state->capacity - state->used);
+    if (result < 0) return result;
+
+    state->used += result;
+  }
+
+  // success
+  return 0;
+}
+
+static void codec_brotli_uppercase(char *target, i64 size) {
+  u8 byte;
+
+  // ascii letters, and the second or third byte of longer utf-8 sequences is flipped
+  while (size > 0) {
+    byte = target[0];
+
+    if (byte < 0xc0) {
+      if (byte >= 'a' && byte <= 'z') target[0] ^= 0x20;
+      target += 1;
+      size -= 1;
+    } else if (byte < 0xe0) {
+      target[1] ^= 0x20;
+      target += 2;
+      size -= 2;
+    } else {
+      target[2] ^= 0x05;
+      target += 3;
+      size -= 3;
+    }
+  }
+}
+
+static i64 codec_brotli_word(char *target, u64 available, u32 length, u32 word) {
+  u32 bits, index, transform, type, prefix, suffix, skip, size;
+  const char *source;
+
+  // the word index within its length and the transform above it
+  bits = CODEC_BROTLI_DICTIONARY_BITS[length];
+  index = word & ((1 << bits) - 1);
+  transform = word >> bits;
+
+  if (transform >= CODEC_BROTLI_TRANSFORMS) return CODEC_ERROR_INVALID_INPUT;
+  type = CODEC_BROTLI_TRANSFORM[transform].type;
+
+  // the transform may drop bytes from either end of the word
+  source = CODEC_BROTLI_DICTIONARY + CODEC_BROTLI_DICTIONARY_OFFSETS[length] + index * length;
+  skip = type > CODEC_BROTLI_OMIT_FIRST ? type - CODEC_BROTLI_OMIT_FIRST : 0;
+  size = length;
+
+  if (type > CODEC_BROTLI_OMIT_LAST && type < CODEC_BROTLI_UPPERCASE_FIRST) {
+    size = type < length ? length - type : 0;
+  }
+
+  skip = skip < size ? skip : size;
+  size -= skip;
+
+  for (prefix = 0; CODEC_BROTLI_TRANSFORM[transform].prefix[prefix] != 0; prefix++) {
+  }
+
+  for (suffix = 0; CODEC_BROTLI_TRANSFORM[transform].suffix[suffix] != 0; suffix++) {
+  }
+
+  // the transformed word must fit
+  if (prefix + size + suffix > available) return CODEC_ERROR_INVALID_INPUT;
+
+  codec_copy_exact(target, CODEC_BROTLI_TRANSFORM[transform].prefix, prefix);
+  codec_copy_exact(target + prefix, source + skip, size);
+
+  if (type == CODEC_BROTLI_UPPERCASE_FIRST) codec_brotli_uppercase(target + prefix, size > 0);
+  if (type == CODEC_BROTLI_UPPERCASE_ALL) codec_brotli_uppercase(target + prefix, size);
+
+  codec_copy_exact(target + prefix + size, CODEC_BROTLI_TRANSFORM[transform].suffix, suffix);
+
+  // success
+  return prefix + size + suffix;
+}
+
+static i64 codec_brotli_commands(struct codec_brotli_state *state,
+                                 struct codec_brotli_bits *bits,
+                                 char *target,
+                                 u64 *produced,
+                                 u64 length) {
+  i64 result;
+  u8 first, second;
+  u32 symbol, cell, insert, copy, code, value, extra, context;
+  u64 position, end, limit, distance;
+
+  const u8 *lookup, *map;
+  struct codec_brotli_category *literals, *commands, *distances;
+
+  // defaults
+  literals = &state->categories[CODEC_BROTLI_LITERALS];
+  commands = &state->categories[CODEC_BROTLI_COMMANDS];
+  distances = &state->categories[CODEC_BROTLI_DISTANCES];
+
+  lookup = CODEC_BROTLI_CONTEXT[state->modes[literals->type]];
+  map = state->literal_map + literals->type * CODEC_BROTLI_LITERAL_CONTEXTS;
+
+  position = *produced;
+  end = position + length;
+
+  while (position < end) {
+    // each command starts with its insert-and-copy length code
+    if (commands->remaining == 0) codec_brotli_switch(commands, bits);
+    commands->remaining--;
+
+    codec_brotli_refill(bits);
+    symbol = codec_brotli_decode(state->tables + state->command_trees[commands->type], bits);
+
+    // which splits into cells of 8 insert and 8 copy length codes
+    cell = symbol >> 6;
+    insert = CODEC_BROTLI_CELL_INSERT[cell] + ((symbol >> 3) & 0x07);
+    copy = CODEC_BROTLI_CELL_COPY[cell] + (symbol & 0x07);
+
+    insert = CODEC_BROTLI_INSERT_BASE[insert] + codec_brotli_take(bits, CODEC_BROTLI_INSERT_EXTRA[insert]);
+    copy = CODEC_BROTLI_COPY_BASE[copy] + codec_brotli_take(bits, CODEC_BROTLI_COPY_EXTRA[copy]);
+
+    // the literals must fit into the meta-block
+    if (insert > end - position) return CODEC_ERROR_INVALID_INPUT;
+
+    first = position > 0 ? target[position - 1] : 0;
+    second = position > 1 ? target[position - 2] : 0;
+
+    for (; insert > 0; insert--) {
+      if (literals->remaining == 0) {
+        codec_brotli_switch(literals, bits);
+
+        lookup = CODEC_BROTLI_CONTEXT[state->modes[literals->type]];
+        map = state->literal_map + literals->type * CODEC_BROTLI_LITERAL_CONTEXTS;
+      }
+
+      literals->remaining--;
+
+      // the tree depends on the last two bytes
+      context = lookup[first] | lookup[256 + second];
+
+      codec_brotli_refill(bits);
+      second = first;
+      first = codec_brotli_decode(state->tables + state->literal_trees[map[context]], bits);
+
+      target[position++] = first;
+    }
+
+    // the last command may end without a copy
+    if (position == end) break;
+
+    if (symbol < 128) {
+      // the lowest cells repeat the last distance
+      code = 0;
+      distance = state->ring[(state->index - 1) & 0x03];
+    } else {
+      if (distances->remaining == 0) codec_brotli_switch(distances, bits);
+      distances->remaining--;
+
+      // the tree depends on the copy length
+      context = copy > 4 ? 3 : copy - 2;
+      context = state->distance_map[distances->type * CODEC_BROTLI_DISTANCE_CONTEXTS + context];
+
+      codec_brotli_refill(bits);
+      code = codec_brotli_decode(state->tables + state->distance_trees[context], bits);
+
+      if (code < 16) {
+        // the last distances, possibly slightly changed
+        distance = state->ring[(state->index - 1 - CODEC_BROTLI_SHORT_INDEX[code]) & 0x03];
+        distance += CODEC_BROTLI_SHORT_DELTA[code];
+
+        if ((i64)distance <= 0) return CODEC_ERROR_INVALID_INPUT;
+      } else if (code < 16 + state->direct) {
+        // small distances coded directly
+        distance = code - 15;
+      } else {
+        // otherwise the symbol holds the lowest bits and the width of the extra bits
+        value = code - 16 - state->direct;
+        extra = 1 + (value >> (state->postfix + 1));
+
+        distance = ((2 + ((value >> state->postfix) & 0x01)) << extra) - 4;
+        distance = (distance + codec_brotli_take(bits, extra)) << state->postfix;
+        distance += (value & ((1 << state->postfix) - 1)) + state->direct + 1;
+      }
+    }
+
+    // distances beyond the window or the output address the static dictionary
+    limit = position < state->window ? position : state->window;
+
+    if (distance > limit) {
+      if (copy < CODEC_BROTLI_WORD_MIN || copy > CODEC_BROTLI_WORD_MAX) return CODEC_ERROR_INVALID_INPUT;
+      if (distance - limit - 1 > 0xffffffff) return CODEC_ERROR_INVALID_INPUT;
+
+      result = codec_brotli_word(target + position, end - position, copy, distance - limit - 1);
+      if (result < 0) return result;
+
+      position += result;
+      continue;
+    }
+
+    // the copy must fit into the meta-block
+    if (copy > end - position) return CODEC_ERROR_INVALID_INPUT;
+
+    codec_copy_match(target + position, distance, copy);
+    position += copy;
+
+    // all but the repeated last distance are remembered
+    if (code > 0) {
+      state->ring[state->index++ & 0x03] = distance;
+    }
+  }
+
+  // the meta-block must not read past the input
+  if (codec_brotli_truncated(bits)) return CODEC_ERROR_INVALID_INPUT;
+
+  // success
+  *produced = position;
+  return 0;
+}
+
+static i64 codec_brotli_compressed(struct codec_brotli_state *state,
+                                   struct codec_brotli_bits *bits,
+                                   char *target,
+                                   u64 *produced,
+                                   u64 length) {
+  i64 result;
+  u32 index, literal_trees, distance_trees;
+
+  // block types and counts of literals, insert-and-copy lengths and distances
+  for (index = 0; index < 3; index++) {
+    result = codec_brotli_category(state, bits, &state->categories[index]);
+    if (result < 0) return result;
+  }
+
+  // the distance parameters
+  state->postfix = codec_brotli_take(bits, 2);
+  state->direct = codec_brotli_take(bits, 4) << state->postfix;
+
+  // a context mode for every literal block type
+  for (index = 0; index < state->categories[CODEC_BROTLI_LITERALS].types; index++) {
+    state->modes[index] = codec_brotli_take(bits, 2);
+  }
+
+  // both context maps, their codes borrow the tables before any tree is stored
+  state->used = 0;
+
+  result = codec_brotli_map(state, bits, state->literal_map,
+                            state->categories[CODEC_BROTLI_LITERALS].types * CODEC_BROTLI_LITERAL_CONTEXTS);
+  if (result < 0) return result;
+  literal_trees = result;
+
+  result = codec_brotli_map(state, bits, state->distance_map,
+                            state->categories[CODEC_BROTLI_DISTANCES].types * CODEC_BROTLI_DISTANCE_CONTEXTS);
+  if (result < 0) return result;
+  distance_trees = result;
+
+  // then all trees of all three groups
+  result = codec_brotli_group(state, bits, state->literal_trees, literal_trees, CODEC_BROTLI_LITERAL_SYMBOLS);
+  if (result < 0) return result;
+
+  result = codec_brotli_group(state, bits, state->command_trees, state->categories[CODEC_BROTLI_COMMANDS].types,
+                              CODEC_BROTLI_COMMAND_SYMBOLS);
+  if (result < 0) return result;
+
+  result = codec_brotli_group(state, bits, state->distance_trees, distance_trees,
+                              16 + state->direct + (48 << state->postfix));
+  if (result < 0) return result;
+
+  // followed by the commands
+  return codec_brotli_commands(state, bits, target, produced, length);
+}
+
+static i64 codec_brotli_align(struct codec_brotli_bits *bits) {
+  // the padding up to the next byte must be zero
+  codec_brotli_refill(bits);
+  if (bits->container & ((1 << (bits->count & 0x07)) - 1)) return CODEC_ERROR_INVALID_INPUT;
+
+  codec_brotli_consume(bits, bits->count & 0x07);
+  if (codec_brotli_truncated(bits)) return CODEC_ERROR_INVALID_INPUT;
+
+  // the bytes follow the loaded ones, which are given back
+  bits->ptr -= (bits->count >> 3) - bits->overrun;
+  bits->container = 0;
+  bits->count = 0;
+  bits->overrun = 0;
+
+  // success
+  return 0;
+}
+
+static i64 codec_brotli_window(struct codec_brotli_bits *bits) {
+  u32 width;
+
+  // 16 bits in a single bit, 18 to 24 bits in four, 10 to 17 bits in seven
+  if (codec_brotli_take(bits, 1) == 0) return 16;
+
+  width = codec_brotli_take(bits, 3);
+  if (width != 0) return 17 + width;
+
+  width = codec_brotli_take(bits, 3);
+  if (width == 1) return CODEC_ERROR_UNSUPPORTED;
+
+  return width == 0 ? 17 : 8 + width;
+}
+
+i64 codec_brotli_decompress(
+  const char *source, u64 source_size, char *target, u64 target_size, struct malloc_pool *pool) {
+  i64 result;
+  u32 index, nibbles, nibble, skip;
+  u64 length, produced;
+  bool last;
+
+  struct malloc_lease lease, tables;
+  struct codec_brotli_state *state;
+  struct codec_brotli_bits bits;
+
+  // the decoding state
+  lease.size = malloc_fit(sizeof(struct codec_brotli_state));
+
+  result = malloc_acquire(pool, &lease);
+  if (result < 0) return result;
+
+  // and the tables of the prefix codes
+  tables.size = CODEC_BROTLI_TABLES;
+  result = malloc_acquire(pool, &tables);
+  if (result < 0) goto cleanup_lease;
+
+  state = lease.ptr;
+  state->tables = tables.ptr;
+  state->capacity = tables.size / sizeof(struct codec_brotli_entry);
+
+  // the distance ring starts with fixed distances
+  state->ring[0] = 16;
+  state->ring[1] = 15;
+  state->ring[2] = 11;
+  state->ring[3] = 4;
+  state->index = 0;
+
+  bits.ptr = source;
+  bits.end = source + source_size;
+  bits.container = 0;
+  bits.count = 0;
+  bits.overrun = 0;
+  produced = 0;
+
+  // the stream starts with the window size
+  result = codec_brotli_window(&bits);
+  if (result < 0) goto cleanup_tables;
+  state->window = (1ull << result) - 16;
+
+  do {
+    // each meta-block starts with its length, the last one may be empty
+    last = codec_brotli_take(&bits, 1);
+    if (last && codec_brotli_take(&bits, 1)) break;
+
+    nibbles = codec_brotli_take(&bits, 2);
+
+    if (nibbles == 3) {
+      // metadata is skipped
+      result = CODEC_ERROR_INVALID_INPUT;
+      if (codec_brotli_take(&bits, 1)) goto cleanup_tables;
+
+      nibbles = codec_brotli_take(&bits, 2);
+
+      for (index = 0, skip = 0; index < nibbles; index++) {
+        nibble = codec_brotli_take(&bits, 8);
+        if (index > 0 && index == nibbles - 1 && nibble == 0) goto cleanup_tables;
+        skip |= nibble << (index * 8);
+      }
+
+      skip += nibbles > 0;
+
+      result = codec_brotli_align(&bits);
+      if (result < 0) goto cleanup_tables;
+
+      result = CODEC_ERROR_INVALID_INPUT;
+      if (skip > (u64)(bits.end - bits.ptr)) goto cleanup_tables;
+
+      bits.ptr += skip;
+      continue;
+    }
+
+    // otherwise 4 to 6 nibbles, the last one not zero unless it is the fourth
+    for (index = 0, length = 0; index < nibbles + 4; index++) {
+      nibble = codec_brotli_take(&bits, 4);
+
+      result = CODEC_ERROR_INVALID_INPUT;
+      if (index > 3 && index == nibbles + 3 && nibble == 0) goto cleanup_tables;
+
+      length |= (u64)nibble << (index * 4);
+    }
+
+    // the meta-block must fit
+    length += 1;
+
+    result = CODEC_ERROR_OUTPUT_OVERFLOW;
+    if (length > target_size - produced) goto cleanup_tables;
+
+    if (!last && codec_brotli_take(&bits, 1)) {
+      // uncompressed meta-blocks are copied as they are
+      result = codec_brotli_align(&bits);
+      if (result < 0) goto cleanup_tables;
+
+      result = CODEC_ERROR_INVALID_INPUT;
+      if (length > (u64)(bits.end - bits.ptr)) goto cleanup_tables;
+
+      codec_copy_exact(target + produced, bits.ptr, length);
+      bits.ptr += length;
+      produced += length;
+    } else {
+      result = codec_brotli_compressed(state, &bits, target, &produced, length);
+      if (result < 0) goto cleanup_tables;
+    }
+  } while (!last);
+
+  // nothing may follow the last meta-block besides its padding
+  result = CODEC_ERROR_INVALID_INPUT;
+  if (codec_brotli_truncated(&bits)) goto cleanup_tables;
+  if ((u64)(bits.ptr - source) - ((bits.count >> 3) - bits.overrun) != source_size) goto cleanup_tables;
+
+  // success
+  result = produced;
+
+cleanup_tables:
+  malloc_release(pool, &tables);
+
+cleanup_lease:
+  malloc_release(pool, &lease);
+  return result;
+}
+
+#if defined(I13C_TESTS)
+
+static void can_decompress_brotli_compressed_block() {
+  i64 result;
+  u32 index;
+  char target[23 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // literals and a repeated match in a single compressed meta-block
+  const u8 source[] = {
+    0x1b, 0x16, 0x00, 0xf8, 0x8d, 0x94, 0x6e, 0xde, 0x44, 0x55,
+    0x86, 0x96, 0x6c, 0x20, 0x6f, 0x21, 0x4f, 0x1c, 0xe0, 0x38,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_brotli_decompress((const char *)source, sizeof(source), target, 23, &pool);
+  assert(result == 23, "should decompress 23 bytes");
+
+  // assert the output
+  for (index = 0; index < 23; index++) {
+    assert(target[index] == "hello hello hello hello"[index], "byte should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_brotli_dictionary_words() {
+  i64 result;
+  u32 index;
+  char target[68 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // the sentence is mostly made of transformed static dictionary words
+  const u8 source[] = {
+    0x1b, 0x43, 0x00, 0xf8, 0x25, 0x00, 0x0a, 0x18, 0x61, 0x9a, 0x04,
+    0x6f, 0x36, 0x9a, 0xc9, 0xe1, 0x7c, 0xdf, 0x2c, 0x19, 0x0a,
+  };
+
+  // the expected sentence
+  const char *expected = "information about the government of the United States and the people";
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_brotli_decompress((const char *)source, sizeof(source), target, 68, &pool);
+  assert(result == 68, "should decompress 68 bytes");
+
+  // assert the output
+  for (index = 0; index < 68; index++) {
+    assert(target[index] == expected[index], "byte should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_brotli_context_maps() {
+  i64 result;
+  u32 index;
+  char target[128 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // 64 little-endian int16 values with signed literal contexts mapped to several trees
+  const u8 source[] = {
+    0x1b, 0x7f, 0x00, 0xf8, 0xbf, 0x15, 0xd0, 0x71, 0x75, 0x5f, 0x01, 0x92, 0x03, 0x07, 0xa9, 0x7a, 0xae, 0xd8,
+    0x47, 0x7a, 0xa1, 0x00, 0x05, 0x28, 0x06, 0x5c, 0xf7, 0xfd, 0x4e, 0x25, 0x40, 0xc8, 0x7f, 0x47, 0x10, 0xa5,
+    0x41, 0xaa, 0x5c, 0xf2, 0x02, 0x4a, 0xca, 0x38, 0x42, 0xd2, 0x0a, 0xce, 0x4e, 0x88, 0x04, 0x82, 0xf8, 0xef,
+    0x00, 0x01, 0x80, 0xf0, 0x9d, 0x41, 0x12, 0x03, 0xa4, 0xa3, 0xc8, 0xf2, 0x20, 0x55, 0x2a, 0x71, 0xbc, 0x15,
+    0x4f, 0xb8, 0x5a, 0xc3, 0xc6, 0xf6, 0xd3, 0x94, 0x11, 0x60, 0x69, 0x25,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_brotli_decompress((const char *)source, sizeof(source), target, 128, &pool);
+  assert(result == 128, "should decompress 128 bytes");
+
+  // assert the values were drawn by the same formula
+  for (index = 0; index < 64; index++) {
+    assert((i16)((u8)target[2 * index] | ((u8)target[2 * index + 1] << 8)) == (i16)((index % 32) * (index % 32) - 256),
+           "value should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_brotli_uncompressed_block() {
+  i64 result;
+  char target[5 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // a metadata block of xyz, an uncompressed meta-block of hello and an empty last one
+  const u8 source[] = {0x2c, 0x01, 'x', 'y', 'z', 0x20, 0x00, 0x08, 'h', 'e', 'l', 'l', 'o', 0x03};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_brotli_decompress((const char *)source, sizeof(source), target, 5, &pool);
+  assert(result == 5, "should decompress 5 bytes");
+  assert(target[0] == 'h' && target[4] == 'o', "should skip the metadata");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_brotli_truncated_stream() {
+  i64 result;
+  char target[23 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // the compressed meta-block misses its tail
+  const u8 source[] = {0x1b, 0x16, 0x00, 0xf8, 0x8d, 0x94, 0x6e, 0xde, 0x44, 0x55, 0x86};
+
+  // the uncompressed meta-block is followed by garbage
+  const u8 trailing[] = {0x2c, 0x01, 'x', 'y', 'z', 0x20, 0x00, 0x08, 'h', 'e', 'l', 'l', 'o', 0x03, 0x00};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_brotli_decompress((const char *)source, sizeof(source), target, 23, &pool);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+
+  // decompress the other one
+  result = codec_brotli_decompress((const char *)trailing, sizeof(trailing), target, 23, &pool);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_brotli_output_overflow() {
+  i64 result;
+  char target[16 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // the meta-block declares 23 bytes
+  const u8 source[] = {
+    0x1b, 0x16, 0x00, 0xf8, 0x8d, 0x94, 0x6e, 0xde, 0x44, 0x55,
+    0x86, 0x96, 0x6c, 0x20, 0x6f, 0x21, 0x4f, 0x1c, 0xe0, 0x38,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_brotli_decompress((const char *)source, sizeof(source), target, 16, &pool);
+  assert(result == CODEC_ERROR_OUTPUT_OVERFLOW, "should fail with CODEC_ERROR_OUTPUT_OVERFLOW");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+void codec_test_cases_brotli(struct runner_context *ctx) {
+  test_case(ctx, "can decompress brotli compressed block", can_decompress_brotli_compressed_block);
+  test_case(ctx, "can decompress brotli dictionary words", can_decompress_brotli_dictionary_words);
+  test_case(ctx, "can decompress brotli context maps", can_decompress_brotli_context_maps);
+  test_case(ctx, "can decompress brotli uncompressed block", can_decompress_brotli_uncompressed_block);
+  test_case(ctx, "can detect brotli truncated stream", can_detect_brotli_truncated_stream);
+  test_case(ctx, "can detect brotli output overflow", can_detect_brotli_output_overflow);
+}
+
+#endif
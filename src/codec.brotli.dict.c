@@ -0,0 +1,1747 @@
+#include "codec.brotli.dict.h"
+#include "typing.h"
+
+// bits of the word index for every length, lengths without words have none
+const u8 CODEC_BROTLI_DICTIONARY_BITS[CODEC_BROTLI_WORD_MAX + 1] = {
+  0, 0, 0, 0, 10, 10, 11, 11, 10, 10, 10, 10, 10, 9, 9, 8, 7, 7, 8, 7, 7, 6, 6, 5, 5,
+};
+
+// offset of the first word of every length
+const u32 CODEC_BROTLI_DICTIONARY_OFFSETS[CODEC_BROTLI_WORD_MAX + 1] = {
+  0, 0, 0, 0, 0, 4096, 9216, 21504, 35840, 44032, 53248, 63488, 74752,
+  87040, 93696, 100864, 104704, 106752, 108928, 113536, 115968, 118528, 119872, 121280, 122016,
+};
+
+// the words of RFC 7932 appendix A, grouped by their lengths
+const char CODEC_BROTLI_DICTIONARY[CODEC_BROTLI_DICTIONARY_SIZE] =
+  "timedownlifeleftbackcodedatashowonlysitecityopenjustlikefreeworktextyearoverbodyloveformbookplaylivelinehelphomesi"
+  "demorewordlongthemviewfindpagedaysfullheadtermeachareafromtruemarkableuponhighdatelandnewsevennextcasebothpostused"
+  "madehandherewhatnameLinkblogsizebaseheldmakemainuser') +holdendswithNewsreadweresigntakehavegameseencallpathwellpl"
+  "usmenufilmpartjointhislistgoodneedwayswestjobsmindalsologorichuseslastteamarmyfoodkingwilleastwardbestfirePageknow"
+  "away.pngmovethanloadgiveselfnotemuchfeedmanyrockicononcelookhidediedHomerulehostajaxinfoclublawslesshalfsomesuchzo"
+  "ne100%onescareTimeracebluefourweekfacehopegavehardlostwhenparkkeptpassshiproomHTMLplanTypedonesavekeepflaglinksold"
+  "fivetookratetownjumpthusdarkcardfilefearstaykillthatfallautoever.comtalkshopvotedeepmoderestturnbornbandfellroseur"
+  "l(skinrolecomeactsagesmeetgold.jpgitemvaryfeltthensenddropViewcopy1.0\"</a>stopelseliestourpack.gifpastcss\077gray"
+  "mean&gt;rideshotlatesaidroadvar feeljohnrickportfast'UA-dead</b>poorbilltypeU.S.woodmust2px;Inforankwidewantwallle"
+  "ad[0];paulwavesure$('#waitmassarmsgoesgainlangpaid!-- lockunitrootwalkfirmwifexml\"songtest20pxkindrowstoolfontmai"
+  "lsafestarmapscorerainflowbabyspansays4px;6px;artsfootrealwikiheatsteptriporg/lakeweaktoldFormcastfansbankveryrunsj"
+  "ulytask1px;goalgrewslowedgeid=\"sets5px;.js\07740pxif (soonseatnonetubezerosentreedfactintogiftharm18pxcamehillbol"
+  "dzoomvoideasyringfillpeakinitcost3px;jacktagsbitsrolleditknewnear<!--growJSONdutyNamesaleyou lotspainjazzcoldeyesf"
+  "ishwww.risktabsprev10pxrise25pxBlueding300,ballfordearnwildbox.fairlackverspairjunetechif(!pickevil$(\"#warmlorddo"
+  "espull,000ideadrawhugespotfundburnhrefcellkeystickhourlossfuel12pxsuitdealRSS\"agedgreyGET\"easeaimsgirlaids8px;na"
+  "vygridtips#999warsladycars); }php\077helltallwhomzh:\345*/\015\012 100hall.\012\012A7px;pushchat0px;crew*/</hash75"
+  "pxflatrare && tellcampontolaidmissskiptentfinemalegetsplot400,\015\012\015\012coolfeet.php<br>ericmostguidbelldesc"
+  "hairmathatom/img&#82luckcent000;tinygonehtmlselldrugFREEnodenick\077id=losenullvastwindRSS wearrelybeensamedukenas"
+  "acapewishgulfT23:hitsslotgatekickblurthey15px''););\">msiewinsbirdsortbetaseekT18:ordstreemall60pxfarm\342\200\231"
+  "sboys[0].');\"POSTbearkids);}}marytend(UK)quadzh:\346-siz----prop');\015liftT19:viceandydebt>RSSpoolneckblowT16:do"
+  "orevalT17:letsfailoralpollnovacolsgene \342\200\224softrometillross<h3>pourfadepink<tr>mini)|!(minezh:\350barshear"
+  "00);milk -->ironfreddiskwentsoilputs/js/holyT22:ISBNT20:adamsees<h2>json', 'contT21: RSSloopasiamoon</p>soulLINEfo"
+  "rtcartT14:<h1>80px!--<9px;T04:mike:46ZniceinchYorkricezh:\344'));puremageparatonebond:37Z_of_']);000,zh:\347tankya"
+  "rdbowlbush:56ZJava30px\012|}\012%C3%:34ZjeffEXPIcashvisagolfsnowzh:\351quer.csssickmeatmin.binddellhirepicsrent:36"
+  "ZHTTP-201fotowolfEND xbox:54ZBODYdick;\012}\012exit:35Zvarsbeat'});diet999;anne}}</[i].Langkm\302\262wiretoysaddss"
+  "ealalex;\012\011}echonine.org005)tonyjewssandlegsroof000) 200winegeardogsbootgarycutstyletemption.xmlcockgang$('.5"
+  "0pxPh.Dmiscalanloandeskmileryanunixdisc);}\012dustclip).\012\01270px-200DVDs7]><tapedemoi++)wageeurophiloptsholeFA"
+  "Qsasin-26TlabspetsURL bulkcook;}\015\012HEAD[0])abbrjuan(198leshtwin</i>sonyguysfuckpipe|-\012!002)ndow[1];[];\012"
+  "Log salt\015\012\011\011bangtrimbath){\015\01200px\012});ko:\354feesad>\015s:// [];tollplug(){\012{\015\012 .js'20"
+  "0pdualboat.JPG);\012}quot);\012\012');\012\015\012}\01520142015201620172018201920202021202220232024202520262027202"
+  "820292030203120322033203420352036203720132012201120102009200820072006200520042003200220012000199919981997199619951"
+  "994199319921991199019891988198719861985198419831982198119801979197819771976197519741973197219711970196919681967196"
+  "6196519641963196219611960195919581957195619551954195319521951195010001024139400009999comom\303\241sesteestaperotod"
+  "ohacecadaa\303\261obiend\303\255aas\303\255vidacasootroforosolootracualdijosidograntipotemadebealgoqu\303\251eston"
+  "adatrespococasabajotodasinoaguapuesunosantediceluisellamayozonaamorpisoobraclicellodioshoracasi\320\267\320\260"
+  "\320\275\320\260\320\276\320\274\321\200\320\260\321\200\321\203\321\202\320\260\320\275\320\265\320\277\320\276"
+  "\320\276\321\202\320\270\320\267\320\275\320\276\320\264\320\276\321\202\320\276\320\266\320\265\320\276\320\275"
+  "\320\270\321\205\320\235\320\260\320\265\320\265\320\261\321\213\320\274\321\213\320\222\321\213\321\201\320\276"
+  "\320\262\321\213\320\262\320\276\320\235\320\276\320\276\320\261\320\237\320\276\320\273\320\270\320\275\320\270"
+  "\320\240\320\244\320\235\320\265\320\234\321\213\321\202\321\213\320\236\320\275\320\270\320\274\320\264\320\260"
+  "\320\227\320\260\320\224\320\260\320\235\321\203\320\236\320\261\321\202\320\265\320\230\320\267\320\265\320\271"
+  "\320\275\321\203\320\274\320\274\320\242\321\213\321\203\320\266\331\201\331\212\330\243\331\206\331\205\330\247"
+  "\331\205\330\271\331\203\331\204\330\243\331\210\330\261\330\257\331\212\330\247\331\201\331\211\331\207\331\210"
+  "\331\204\331\205\331\204\331\203\330\247\331\210\331\204\331\207\330\250\330\263\330\247\331\204\330\245\331\206"
+  "\331\207\331\212\330\243\331\212\331\202\330\257\331\207\331\204\330\253\331\205\330\250\331\207\331\204\331\210"
+  "\331\204\331\212\330\250\331\204\330\247\331\212\330\250\331\203\330\264\331\212\330\247\331\205\330\243\331\205"
+  "\331\206\330\252\330\250\331\212\331\204\331\206\330\255\330\250\331\207\331\205\331\205\330\264\331\210\330\264fi"
+  "rstvideolightworldmediawhitecloseblackrightsmallbooksplacemusicfieldorderpointvalueleveltableboardhousegroupworksy"
+  "earsstatetodaywaterstartstyledeathpowerphonenighterrorinputabouttermstitletoolseventlocaltimeslargewordsgamesshort"
+  "spacefocusclearmodelblockguideradiosharewomenagainmoneyimagenamesyounglineslatercolorgreenfront&amp;watchforcepric"
+  "erulesbeginaftervisitissueareasbelowindextotalhourslabelprintpressbuiltlinksspeedstudytradefoundsenseundershownfor"
+  "msrangeaddedstillmovedtakenaboveflashfixedoftenotherviewschecklegalriveritemsquickshapehumanexistgoingmoviethirdba"
+  "sicpeacestagewidthloginideaswrotepagesusersdrivestorebreaksouthvoicesitesmonthwherebuildwhichearthforumthreesportp"
+  "artyClicklowerlivesclasslayerentrystoryusagesoundcourtyour birthpopuptypesapplyImagebeinguppernoteseveryshowsmeans"
+  "extramatchtrackknownearlybegansuperpapernorthlearngivennamedendedTermspartsGroupbrandusingwomanfalsereadyaudiotake"
+  "swhile.com/livedcasesdailychildgreatjudgethoseunitsneverbroadcoastcoverapplefilescyclesceneplansclickwritequeenpie"
+  "ceemailframeolderphotolimitcachecivilscaleenterthemetheretouchboundroyalaskedwholesincestock namefaithheartemptyof"
+  "ferscopeownedmightalbumthinkbloodarraymajortrustcanonunioncountvalidstoneStyleLoginhappyoccurleft:freshquitefilmsg"
+  "radeneedsurbanfightbasishoverauto;route.htmlmixedfinalYour slidetopicbrownalonedrawnsplitreachRightdatesmarchquote"
+  "goodsLinksdoubtasyncthumballowchiefyouthnovel10px;serveuntilhandsCheckSpacequeryjamesequaltwice0,000Startpanelsong"
+  "sroundeightshiftworthpostsleadsweeksavoidthesemilesplanesmartalphaplantmarksratesplaysclaimsalestextsstarswrong</h"
+  "3>thing.org/multiheardPowerstandtokensolid(thisbringshipsstafftriedcallsfullyfactsagentThis //-->adminegyptEvent15"
+  "px;Emailtrue\"crossspentblogsbox\">notedleavechinasizesguest</h4>robotheavytrue,sevengrandcrimesignsawaredancephas"
+  "e><!--en_US&#39;200px_namelatinenjoyajax.ationsmithU.S. holdspeterindianav\">chainscorecomesdoingpriorShare1990sro"
+  "manlistsjapanfallstrialowneragree</h2>abusealertopera\"-//WcardshillsteamsPhototruthclean.php\077saintmetallouisme"
+  "antproofbriefrow\">genretrucklooksValueFrame.net/-->\012<try {\012var makescostsplainadultquesttrainlaborhelpscaus"
+  "emagicmotortheir250pxleaststepsCountcouldglasssidesfundshotelawardmouthmovesparisgivesdutchtexasfruitnull,||[];top"
+  "\">\012<!--POST\"ocean<br/>floorspeakdepth sizebankscatchchart20px;aligndealswould50px;url=\"parksmouseMost ...</a"
+  "mongbrainbody none;basedcarrydraftreferpage_home.meterdelaydreamprovejoint</tr>drugs<!-- aprilidealallenexactforth"
+  "codeslogicView seemsblankports (200saved_linkgoalsgrantgreekhomesringsrated30px;whoseparse();\" Blocklinuxjonespix"
+  "el');\">);if(-leftdavidhorseFocusraiseboxesTrackement</em>bar\">.src=toweralt=\"cablehenry24px;setupitalysharpmino"
+  "rtastewantsthis.resetwheelgirls/css/100%;clubsstuffbiblevotes 1000korea});\015\012bandsqueue= {};80px;cking{\015"
+  "\012\011\011aheadclockirishlike ratiostatsForm\"yahoo)[0];Aboutfinds</h1>debugtasksURL =cells})();12px;primetellst"
+  "urns0x600.jpg\"spainbeachtaxesmicroangel--></giftssteve-linkbody.});\012\011mount (199FAQ</rogerfrankClass28px;fee"
+  "ds<h1><scotttests22px;drink) || lewisshall#039; for lovedwaste00px;ja:\343\202simon<fontreplymeetsuntercheaptightB"
+  "rand) != dressclipsroomsonkeymobilmain.Name platefunnytreescom/\"1.jpgwmodeparamSTARTleft idden, 201);\012}\012for"
+  "m.viruschairtransworstPagesitionpatch<!--\012o-cacfirmstours,000 asiani++){adobe')[0]id=10both;menu .2.mi.png\"kev"
+  "incoachChildbruce2.jpgURL)+.jpg|suitesliceharry120\" sweettr>\015\012name=diegopage swiss-->\012\012#fff;\">Log.co"
+  "m\"treatsheet) && 14px;sleepntentfiledja:\343\203id=\"cName\"worseshots-box-delta\012&lt;bears:48Z<data-rural</a> "
+  "spendbakershops= \"\";php\">ction13px;brianhellosize=o=%2F joinmaybe<img img\">, fjsimg\" \")[0]MTopBType\"newlyDa"
+  "nskczechtrailknows</h5>faq\">zh-cn10);\012-1\");type=bluestrulydavis.js';>\015\012<!steel you h2>\015\012form jesu"
+  "s100% menu.\015\012\011\015\012walesrisksumentddingb-likteachgif\" vegasdanskeestishqipsuomisobredesdeentretodospu"
+  "edea\303\261osest\303\241tienehastaotrospartedondenuevohacerformamismomejormundoaqu\303\255d\303\255ass\303\263loa"
+  "yudafechatodastantomenosdatosotrassitiomuchoahoralugarmayorestoshorastenerantesfotosestaspa\303\255snuevasaludforo"
+  "smedioquienmesespoderchileser\303\241vecesdecirjos\303\251estarventagrupohechoellostengoamigocosasnivelgentemismaa"
+  "iresjuliotemashaciafavorjuniolibrepuntobuenoautorabrilbuenatextomarzosaberlistaluegoc\303\263moenerojuegoper\303"
+  "\272haberestoynuncamujervalorfueralibrogustaigualvotoscasosgu\303\255apuedosomosavisousteddebennochebuscafaltaeuro"
+  "sseriedichocursoclavecasasle\303\263nplazolargoobrasvistaapoyojuntotratavistocrearcampohemoscincocargopisosordenha"
+  "cen\303\241readiscopedrocercapuedapapelmenor\303\272tilclarojorgecalleponertardenadiemarcasigueellassiglocochemoto"
+  "smadreclaserestoni\303\261oquedapasarbancohijosviajepablo\303\251stevienereinodejarfondocanalnorteletracausatomarm"
+  "anoslunesautosvillavendopesartipostengamarcollevapadreunidovamoszonasambosbandamariaabusomuchasubirriojavivirgrado"
+  "chicaall\303\255jovendichaestantalessalirsuelopesosfinesllamabusco\303\251stalleganegroplazahumorpagarjuntadobleis"
+  "lasbolsaba\303\261ohablalucha\303\201readicenjugarnotasvalleall\303\241cargadolorabajoest\303\251gustomentemariofi"
+  "rmacostofichaplatahogarartesleyesaquelmuseobasespocosmitadcielochicomiedoganarsantoetapadebesplayaredessietecortec"
+  "oreadudasdeseoviejodeseaaguas&quot;domaincommonstatuseventsmastersystemactionbannerremovescrollupdateglobalmediumf"
+  "ilternumberchangeresultpublicscreenchoosenormaltravelissuessourcetargetspringmodulemobileswitchphotosborderregioni"
+  "tselfsocialactivecolumnrecordfollowtitle>eitherlengthfamilyfriendlayoutauthorcreatereviewsummerserverplayedplayere"
+  "xpandpolicyformatdoublepointsseriespersonlivingdesignmonthsforcesuniqueweightpeopleenergynaturesearchfigurehavingc"
+  "ustomoffsetletterwindowsubmitrendergroupsuploadhealthmethodvideosschoolfutureshadowdebatevaluesObjectothersrightsl"
+  "eaguechromesimplenoticesharedendingseasonreportonlinesquarebuttonimagesenablemovinglatestwinterFranceperiodstrongr"
+  "epeatLondondetailformeddemandsecurepassedtoggleplacesdevicestaticcitiesstreamyellowattackstreetflighthiddeninfo\">"
+  "openedusefulvalleycausesleadersecretseconddamagesportsexceptratingsignedthingseffectfieldsstatesofficevisualeditor"
+  "volumeReportmuseummoviesparentaccessmostlymother\" id=\"marketgroundchancesurveybeforesymbolmomentspeechmotioninsi"
+  "dematterCenterobjectexistsmiddleEuropegrowthlegacymannerenoughcareeransweroriginportalclientselectrandomclosedtopi"
+  "cscomingfatheroptionsimplyraisedescapechosenchurchdefinereasoncorneroutputmemoryiframepolicemodelsNumberduringoffe"
+  "rsstyleskilledlistedcalledsilvermargindeletebetterbrowselimitsGlobalsinglewidgetcenterbudgetnowrapcreditclaimsengi"
+  "nesafetychoicespirit-stylespreadmakingneededrussiapleaseextentScriptbrokenallowschargedividefactormember-basedtheo"
+  "ryconfigaroundworkedhelpedChurchimpactshouldalwayslogo\" bottomlist\">){var prefixorangeHeader.push(couplegardenbr"
+  "idgelaunchReviewtakingvisionlittledatingButtonbeautythemesforgotSearchanchoralmostloadedChangereturnstringreloadMo"
+  "bileincomesupplySourceordersviewed&nbsp;courseAbout island<html cookiename=\"amazonmodernadvicein</a>: The dialogh"
+  "ousesBEGIN MexicostartscentreheightaddingIslandassetsEmpireSchooleffortdirectnearlymanualSelect.\012\012Onejoinedm"
+  "enu\">PhilipawardshandleimportOfficeregardskillsnationSportsdegreeweekly (e.g.behinddoctorloggedunited</b></begins"
+  "plantsassistartistissued300px|canadaagencyschemeremainBrazilsamplelogo\">beyond-scaleacceptservedmarineFootercamer"
+  "a</h1>\012_form\"leavesstress\" />\015\012.gif\" onloadloaderOxfordsistersurvivlistenfemaleDesignsize=\"appealtext"
+  "\">levelsthankshigherforcedanimalanyoneAfricaagreedrecentPeople<br />wonderpricesturned|| {};main\">inlinesundaywr"
+  "ap\">failedcensusminutebeaconquotes150px|estateremoteemail\"linkedright;signalformal1.htmlsignupprincefloat:.png\""
+  " forum.AccesspaperssoundsextendHeightsliderUTF-8\"&amp; Before. WithstudioownersmanageprofitjQueryannualparamsboug"
+  "htfamousgooglelongeri++) {israelsayingdecidehome\">headerensurebranchpiecesblock;statedtop\"><racingresize--&gt;pa"
+  "citysexualbureau.jpg\" 10,000obtaintitlesamount, Inc.comedymenu\" lyricstoday.indeedcounty_logo.FamilylookedMarket"
+  "lse ifPlayerturkey);var forestgivingerrorsDomain}else{insertBlog</footerlogin.fasteragents<body 10px 0pragmafriday"
+  "juniordollarplacedcoversplugin5,000 page\">boston.test(avatartested_countforumsschemaindex,filledsharesreaderalert"
+  "(appearSubmitline\">body\">\012* TheThoughseeingjerseyNews</verifyexpertinjurywidth=CookieSTART across_imagethread"
+  "nativepocketbox\">\012System DavidcancertablesprovedApril reallydriveritem\">more\">boardscolorscampusfirst || [];"
+  "media.guitarfinishwidth:showedOther .php\" assumelayerswilsonstoresreliefswedenCustomeasily your String\012\012Whi"
+  "ltaylorclear:resortfrenchthough\") + \"<body>buyingbrandsMembername\">oppingsector5px;\">vspacepostermajor coffeem"
+  "artinmaturehappen</nav>kansaslink\">Images=falsewhile hspace0&amp; \012\012In  powerPolski-colorjordanBottomStart "
+  "-count2.htmlnews\">01.jpgOnline-rightmillerseniorISBN 00,000 guidesvalue)ectionrepair.xml\"  rights.html-blockregE"
+  "xp:hoverwithinvirginphones</tr>\015using \012\011var >');\012\011</td>\012</tr>\012bahasabrasilgalegomagyarpolskis"
+  "rpski\330\261\330\257\331\210\344\270\255\346\226\207\347\256\200\344\275\223\347\271\201\351\253\224\344\277\241"
+  "\346\201\257\344\270\255\345\233\275\346\210\221\344\273\254\344\270\200\344\270\252\345\205\254\345\217\270\347"
+  "\256\241\347\220\206\350\256\272\345\235\233\345\217\257\344\273\245\346\234\215\345\212\241\346\227\266\351\227"
+  "\264\344\270\252\344\272\272\344\272\247\345\223\201\350\207\252\345\267\261\344\274\201\344\270\232\346\237\245"
+  "\347\234\213\345\267\245\344\275\234\350\201\224\347\263\273\346\262\241\346\234\211\347\275\221\347\253\231\346"
+  "\211\200\346\234\211\350\257\204\350\256\272\344\270\255\345\277\203\346\226\207\347\253\240\347\224\250\346\210"
+  "\267\351\246\226\351\241\265\344\275\234\350\200\205\346\212\200\346\234\257\351\227\256\351\242\230\347\233\270"
+  "\345\205\263\344\270\213\350\275\275\346\220\234\347\264\242\344\275\277\347\224\250\350\275\257\344\273\266\345"
+  "\234\250\347\272\277\344\270\273\351\242\230\350\265\204\346\226\231\350\247\206\351\242\221\345\233\236\345\244"
+  "\215\346\263\250\345\206\214\347\275\221\347\273\234\346\224\266\350\227\217\345\206\205\345\256\271\346\216\250"
+  "\350\215\220\345\270\202\345\234\272\346\266\210\346\201\257\347\251\272\351\227\264\345\217\221\345\270\203\344"
+  "\273\200\344\271\210\345\245\275\345\217\213\347\224\237\346\264\273\345\233\276\347\211\207\345\217\221\345\261"
+  "\225\345\246\202\346\236\234\346\211\213\346\234\272\346\226\260\351\227\273\346\234\200\346\226\260\346\226\271"
+  "\345\274\217\345\214\227\344\272\254\346\217\220\344\276\233\345\205\263\344\272\216\346\233\264\345\244\232\350"
+  "\277\231\344\270\252\347\263\273\347\273\237\347\237\245\351\201\223\346\270\270\346\210\217\345\271\277\345\221"
+  "\212\345\205\266\344\273\226\345\217\221\350\241\250\345\256\211\345\205\250\347\254\254\344\270\200\344\274\232"
+  "\345\221\230\350\277\233\350\241\214\347\202\271\345\207\273\347\211\210\346\235\203\347\224\265\345\255\220\344"
+  "\270\226\347\225\214\350\256\276\350\256\241\345\205\215\350\264\271\346\225\231\350\202\262\345\212\240\345\205"
+  "\245\346\264\273\345\212\250\344\273\226\344\273\254\345\225\206\345\223\201\345\215\232\345\256\242\347\216\260"
+  "\345\234\250\344\270\212\346\265\267\345\246\202\344\275\225\345\267\262\347\273\217\347\225\231\350\250\200\350"
+  "\257\246\347\273\206\347\244\276\345\214\272\347\231\273\345\275\225\346\234\254\347\253\231\351\234\200\350\246"
+  "\201\344\273\267\346\240\274\346\224\257\346\214\201\345\233\275\351\231\205\351\223\276\346\216\245\345\233\275"
+  "\345\256\266\345\273\272\350\256\276\346\234\213\345\217\213\351\230\205\350\257\273\346\263\225\345\276\213\344"
+  "\275\215\347\275\256\347\273\217\346\265\216\351\200\211\346\213\251\350\277\231\346\240\267\345\275\223\345\211"
+  "\215\345\210\206\347\261\273\346\216\222\350\241\214\345\233\240\344\270\272\344\272\244\346\230\223\346\234\200"
+  "\345\220\216\351\237\263\344\271\220\344\270\215\350\203\275\351\200\232\350\277\207\350\241\214\344\270\232\347"
+  "\247\221\346\212\200\345\217\257\350\203\275\350\256\276\345\244\207\345\220\210\344\275\234\345\244\247\345\256"
+  "\266\347\244\276\344\274\232\347\240\224\347\251\266\344\270\223\344\270\232\345\205\250\351\203\250\351\241\271"
+  "\347\233\256\350\277\231\351\207\214\350\277\230\346\230\257\345\274\200\345\247\213\346\203\205\345\206\265\347"
+  "\224\265\350\204\221\346\226\207\344\273\266\345\223\201\347\211\214\345\270\256\345\212\251\346\226\207\345\214"
+  "\226\350\265\204\346\272\220\345\244\247\345\255\246\345\255\246\344\271\240\345\234\260\345\235\200\346\265\217"
+  "\350\247\210\346\212\225\350\265\204\345\267\245\347\250\213\350\246\201\346\261\202\346\200\216\344\271\210\346"
+  "\227\266\345\200\231\345\212\237\350\203\275\344\270\273\350\246\201\347\233\256\345\211\215\350\265\204\350\256"
+  "\257\345\237\216\345\270\202\346\226\271\346\263\225\347\224\265\345\275\261\346\213\233\350\201\230\345\243\260"
+  "\346\230\216\344\273\273\344\275\225\345\201\245\345\272\267\346\225\260\346\215\256\347\276\216\345\233\275\346"
+  "\261\275\350\275\246\344\273\213\347\273\215\344\275\206\346\230\257\344\272\244\346\265\201\347\224\237\344\272"
+  "\247\346\211\200\344\273\245\347\224\265\350\257\235\346\230\276\347\244\272\344\270\200\344\272\233\345\215\225"
+  "\344\275\215\344\272\272\345\221\230\345\210\206\346\236\220\345\234\260\345\233\276\346\227\205\346\270\270\345"
+  "\267\245\345\205\267\345\255\246\347\224\237\347\263\273\345\210\227\347\275\221\345\217\213\345\270\226\345\255"
+  "\220\345\257\206\347\240\201\351\242\221\351\201\223\346\216\247\345\210\266\345\234\260\345\214\272\345\237\272"
+  "\346\234\254\345\205\250\345\233\275\347\275\221\344\270\212\351\207\215\350\246\201\347\254\254\344\272\214\345"
+  "\226\234\346\254\242\350\277\233\345\205\245\345\217\213\346\203\205\350\277\231\344\272\233\350\200\203\350\257"
+  "\225\345\217\221\347\216\260\345\237\271\350\256\255\344\273\245\344\270\212\346\224\277\345\272\234\346\210\220"
+  "\344\270\272\347\216\257\345\242\203\351\246\231\346\270\257\345\220\214\346\227\266\345\250\261\344\271\220\345"
+  "\217\221\351\200\201\344\270\200\345\256\232\345\274\200\345\217\221\344\275\234\345\223\201\346\240\207\345\207"
+  "\206\346\254\242\350\277\216\350\247\243\345\206\263\345\234\260\346\226\271\344\270\200\344\270\213\344\273\245"
+  "\345\217\212\350\264\243\344\273\273\346\210\226\350\200\205\345\256\242\346\210\267\344\273\243\350\241\250\347"
+  "\247\257\345\210\206\345\245\263\344\272\272\346\225\260\347\240\201\351\224\200\345\224\256\345\207\272\347\216"
+  "\260\347\246\273\347\272\277\345\272\224\347\224\250\345\210\227\350\241\250\344\270\215\345\220\214\347\274\226"
+  "\350\276\221\347\273\237\350\256\241\346\237\245\350\257\242\344\270\215\350\246\201\346\234\211\345\205\263\346"
+  "\234\272\346\236\204\345\276\210\345\244\232\346\222\255\346\224\276\347\273\204\347\273\207\346\224\277\347\255"
+  "\226\347\233\264\346\216\245\350\203\275\345\212\233\346\235\245\346\272\220\346\231\202\351\226\223\347\234\213"
+  "\345\210\260\347\203\255\351\227\250\345\205\263\351\224\256\344\270\223\345\214\272\351\235\236\345\270\270\350"
+  "\213\261\350\257\255\347\231\276\345\272\246\345\270\214\346\234\233\347\276\216\345\245\263\346\257\224\350\276"
+  "\203\347\237\245\350\257\206\350\247\204\345\256\232\345\273\272\350\256\256\351\203\250\351\227\250\346\204\217"
+  "\350\247\201\347\262\276\345\275\251\346\227\245\346\234\254\346\217\220\351\253\230\345\217\221\350\250\200\346"
+  "\226\271\351\235\242\345\237\272\351\207\221\345\244\204\347\220\206\346\235\203\351\231\220\345\275\261\347\211"
+  "\207\351\223\266\350\241\214\350\277\230\346\234\211\345\210\206\344\272\253\347\211\251\345\223\201\347\273\217"
+  "\350\220\245\346\267\273\345\212\240\344\270\223\345\256\266\350\277\231\347\247\215\350\257\235\351\242\230\350"
+  "\265\267\346\235\245\344\270\232\345\212\241\345\205\254\345\221\212\350\256\260\345\275\225\347\256\200\344\273"
+  "\213\350\264\250\351\207\217\347\224\267\344\272\272\345\275\261\345\223\215\345\274\225\347\224\250\346\212\245"
+  "\345\221\212\351\203\250\345\210\206\345\277\253\351\200\237\345\222\250\350\257\242\346\227\266\345\260\232\346"
+  "\263\250\346\204\217\347\224\263\350\257\267\345\255\246\346\240\241\345\272\224\350\257\245\345\216\206\345\217"
+  "\262\345\217\252\346\230\257\350\277\224\345\233\236\350\264\255\344\271\260\345\220\215\347\247\260\344\270\272"
+  "\344\272\206\346\210\220\345\212\237\350\257\264\346\230\216\344\276\233\345\272\224\345\255\251\345\255\220\344"
+  "\270\223\351\242\230\347\250\213\345\272\217\344\270\200\350\210\254\346\234\203\345\223\241\345\217\252\346\234"
+  "\211\345\205\266\345\256\203\344\277\235\346\212\244\350\200\214\344\270\224\344\273\212\345\244\251\347\252\227"
+  "\345\217\243\345\212\250\346\200\201\347\212\266\346\200\201\347\211\271\345\210\253\350\256\244\344\270\272\345"
+  "\277\205\351\241\273\346\233\264\346\226\260\345\260\217\350\257\264\346\210\221\345\200\221\344\275\234\344\270"
+  "\272\345\252\222\344\275\223\345\214\205\346\213\254\351\202\243\344\271\210\344\270\200\346\240\267\345\233\275"
+  "\345\206\205\346\230\257\345\220\246\346\240\271\346\215\256\347\224\265\350\247\206\345\255\246\351\231\242\345"
+  "\205\267\346\234\211\350\277\207\347\250\213\347\224\261\344\272\216\344\272\272\346\211\215\345\207\272\346\235"
+  "\245\344\270\215\350\277\207\346\255\243\345\234\250\346\230\216\346\230\237\346\225\205\344\272\213\345\205\263"
+  "\347\263\273\346\240\207\351\242\230\345\225\206\345\212\241\350\276\223\345\205\245\344\270\200\347\233\264\345"
+  "\237\272\347\241\200\346\225\231\345\255\246\344\272\206\350\247\243\345\273\272\347\255\221\347\273\223\346\236"
+  "\234\345\205\250\347\220\203\351\200\232\347\237\245\350\256\241\345\210\222\345\257\271\344\272\216\350\211\272"
+  "\346\234\257\347\233\270\345\206\214\345\217\221\347\224\237\347\234\237\347\232\204\345\273\272\347\253\213\347"
+  "\255\211\347\272\247\347\261\273\345\236\213\347\273\217\351\252\214\345\256\236\347\216\260\345\210\266\344\275"
+  "\234\346\235\245\350\207\252\346\240\207\347\255\276\344\273\245\344\270\213\345\216\237\345\210\233\346\227\240"
+  "\346\263\225\345\205\266\344\270\255\345\200\213\344\272\272\344\270\200\345\210\207\346\214\207\345\215\227\345"
+  "\205\263\351\227\255\351\233\206\345\233\242\347\254\254\344\270\211\345\205\263\346\263\250\345\233\240\346\255"
+  "\244\347\205\247\347\211\207\346\267\261\345\234\263\345\225\206\344\270\232\345\271\277\345\267\236\346\227\245"
+  "\346\234\237\351\253\230\347\272\247\346\234\200\350\277\221\347\273\274\345\220\210\350\241\250\347\244\272\344"
+  "\270\223\350\276\221\350\241\214\344\270\272\344\272\244\351\200\232\350\257\204\344\273\267\350\247\211\345\276"
+  "\227\347\262\276\345\215\216\345\256\266\345\272\255\345\256\214\346\210\220\346\204\237\350\247\211\345\256\211"
+  "\350\243\205\345\276\227\345\210\260\351\202\256\344\273\266\345\210\266\345\272\246\351\243\237\345\223\201\350"
+  "\231\275\347\204\266\350\275\254\350\275\275\346\212\245\344\273\267\350\256\260\350\200\205\346\226\271\346\241"
+  "\210\350\241\214\346\224\277\344\272\272\346\260\221\347\224\250\345\223\201\344\270\234\350\245\277\346\217\220"
+  "\345\207\272\351\205\222\345\272\227\347\204\266\345\220\216\344\273\230\346\254\276\347\203\255\347\202\271\344"
+  "\273\245\345\211\215\345\256\214\345\205\250\345\217\221\345\270\226\350\256\276\347\275\256\351\242\206\345\257"
+  "\274\345\267\245\344\270\232\345\214\273\351\231\242\347\234\213\347\234\213\347\273\217\345\205\270\345\216\237"
+  "\345\233\240\345\271\263\345\217\260\345\220\204\347\247\215\345\242\236\345\212\240\346\235\220\346\226\231\346"
+  "\226\260\345\242\236\344\271\213\345\220\216\350\201\214\344\270\232\346\225\210\346\236\234\344\273\212\345\271"
+  "\264\350\256\272\346\226\207\346\210\221\345\233\275\345\221\212\350\257\211\347\211\210\344\270\273\344\277\256"
+  "\346\224\271\345\217\202\344\270\216\346\211\223\345\215\260\345\277\253\344\271\220\346\234\272\346\242\260\350"
+  "\247\202\347\202\271\345\255\230\345\234\250\347\262\276\347\245\236\350\216\267\345\276\227\345\210\251\347\224"
+  "\250\347\273\247\347\273\255\344\275\240\344\273\254\350\277\231\344\271\210\346\250\241\345\274\217\350\257\255"
+  "\350\250\200\350\203\275\345\244\237\351\233\205\350\231\216\346\223\215\344\275\234\351\243\216\346\240\274\344"
+  "\270\200\350\265\267\347\247\221\345\255\246\344\275\223\350\202\262\347\237\255\344\277\241\346\235\241\344\273"
+  "\266\346\262\273\347\226\227\350\277\220\345\212\250\344\272\247\344\270\232\344\274\232\350\256\256\345\257\274"
+  "\350\210\252\345\205\210\347\224\237\350\201\224\347\233\237\345\217\257\346\230\257\345\225\217\351\241\214\347"
+  "\273\223\346\236\204\344\275\234\347\224\250\350\260\203\346\237\245\350\263\207\346\226\231\350\207\252\345\212"
+  "\250\350\264\237\350\264\243\345\206\234\344\270\232\350\256\277\351\227\256\345\256\236\346\226\275\346\216\245"
+  "\345\217\227\350\256\250\350\256\272\351\202\243\344\270\252\345\217\215\351\246\210\345\212\240\345\274\272\345"
+  "\245\263\346\200\247\350\214\203\345\233\264\346\234\215\345\213\231\344\274\221\351\227\262\344\273\212\346\227"
+  "\245\345\256\242\346\234\215\350\247\200\347\234\213\345\217\202\345\212\240\347\232\204\350\257\235\344\270\200"
+  "\347\202\271\344\277\235\350\257\201\345\233\276\344\271\246\346\234\211\346\225\210\346\265\213\350\257\225\347"
+  "\247\273\345\212\250\346\211\215\350\203\275\345\206\263\345\256\232\350\202\241\347\245\250\344\270\215\346\226"
+  "\255\351\234\200\346\261\202\344\270\215\345\276\227\345\212\236\346\263\225\344\271\213\351\227\264\351\207\207"
+  "\347\224\250\350\220\245\351\224\200\346\212\225\350\257\211\347\233\256\346\240\207\347\210\261\346\203\205\346"
+  "\221\204\345\275\261\346\234\211\344\272\233\350\244\207\350\243\275\346\226\207\345\255\246\346\234\272\344\274"
+  "\232\346\225\260\345\255\227\350\243\205\344\277\256\350\264\255\347\211\251\345\206\234\346\235\221\345\205\250"
+  "\351\235\242\347\262\276\345\223\201\345\205\266\345\256\236\344\272\213\346\203\205\346\260\264\345\271\263\346"
+  "\217\220\347\244\272\344\270\212\345\270\202\350\260\242\350\260\242\346\231\256\351\200\232\346\225\231\345\270"
+  "\210\344\270\212\344\274\240\347\261\273\345\210\253\346\255\214\346\233\262\346\213\245\346\234\211\345\210\233"
+  "\346\226\260\351\205\215\344\273\266\345\217\252\350\246\201\346\227\266\344\273\243\350\263\207\350\250\212\350"
+  "\276\276\345\210\260\344\272\272\347\224\237\350\256\242\351\230\205\350\200\201\345\270\210\345\261\225\347\244"
+  "\272\345\277\203\347\220\206\350\264\264\345\255\220\347\266\262\347\253\231\344\270\273\351\241\214\350\207\252"
+  "\347\204\266\347\272\247\345\210\253\347\256\200\345\215\225\346\224\271\351\235\251\351\202\243\344\272\233\346"
+  "\235\245\350\257\264\346\211\223\345\274\200\344\273\243\347\240\201\345\210\240\351\231\244\350\257\201\345\210"
+  "\270\350\212\202\347\233\256\351\207\215\347\202\271\346\254\241\346\225\270\345\244\232\345\260\221\350\247\204"
+  "\345\210\222\350\265\204\351\207\221\346\211\276\345\210\260\344\273\245\345\220\216\345\244\247\345\205\250\344"
+  "\270\273\351\241\265\346\234\200\344\275\263\345\233\236\347\255\224\345\244\251\344\270\213\344\277\235\351\232"
+  "\234\347\216\260\344\273\243\346\243\200\346\237\245\346\212\225\347\245\250\345\260\217\346\227\266\346\262\222"
+  "\346\234\211\346\255\243\345\270\270\347\224\232\350\207\263\344\273\243\347\220\206\347\233\256\345\275\225\345"
+  "\205\254\345\274\200\345\244\215\345\210\266\351\207\221\350\236\215\345\271\270\347\246\217\347\211\210\346\234"
+  "\254\345\275\242\346\210\220\345\207\206\345\244\207\350\241\214\346\203\205\345\233\236\345\210\260\346\200\235"
+  "\346\203\263\346\200\216\346\240\267\345\215\217\350\256\256\350\256\244\350\257\201\346\234\200\345\245\275\344"
+  "\272\247\347\224\237\346\214\211\347\205\247\346\234\215\350\243\205\345\271\277\344\270\234\345\212\250\346\274"
+  "\253\351\207\207\350\264\255\346\226\260\346\211\213\347\273\204\345\233\276\351\235\242\346\235\277\345\217\202"
+  "\350\200\203\346\224\277\346\262\273\345\256\271\346\230\223\345\244\251\345\234\260\345\212\252\345\212\233\344"
+  "\272\272\344\273\254\345\215\207\347\272\247\351\200\237\345\272\246\344\272\272\347\211\251\350\260\203\346\225"
+  "\264\346\265\201\350\241\214\351\200\240\346\210\220\346\226\207\345\255\227\351\237\251\345\233\275\350\264\270"
+  "\346\230\223\345\274\200\345\261\225\347\233\270\351\227\234\350\241\250\347\216\260\345\275\261\350\247\206\345"
+  "\246\202\346\255\244\347\276\216\345\256\271\345\244\247\345\260\217\346\212\245\351\201\223\346\235\241\346\254"
+  "\276\345\277\203\346\203\205\350\256\270\345\244\232\346\263\225\350\247\204\345\256\266\345\261\205\344\271\246"
+  "\345\272\227\350\277\236\346\216\245\347\253\213\345\215\263\344\270\276\346\212\245\346\212\200\345\267\247\345"
+  "\245\245\350\277\220\347\231\273\345\205\245\344\273\245\346\235\245\347\220\206\350\256\272\344\272\213\344\273"
+  "\266\350\207\252\347\224\261\344\270\255\345\215\216\345\212\236\345\205\254\345\246\210\345\246\210\347\234\237"
+  "\346\255\243\344\270\215\351\224\231\345\205\250\346\226\207\345\220\210\345\220\214\344\273\267\345\200\274\345"
+  "\210\253\344\272\272\347\233\221\347\235\243\345\205\267\344\275\223\344\270\226\347\272\252\345\233\242\351\230"
+  "\237\345\210\233\344\270\232\346\211\277\346\213\205\345\242\236\351\225\277\346\234\211\344\272\272\344\277\235"
+  "\346\214\201\345\225\206\345\256\266\347\273\264\344\277\256\345\217\260\346\271\276\345\267\246\345\217\263\350"
+  "\202\241\344\273\275\347\255\224\346\241\210\345\256\236\351\231\205\347\224\265\344\277\241\347\273\217\347\220"
+  "\206\347\224\237\345\221\275\345\256\243\344\274\240\344\273\273\345\212\241\346\255\243\345\274\217\347\211\271"
+  "\350\211\262\344\270\213\346\235\245\345\215\217\344\274\232\345\217\252\350\203\275\345\275\223\347\204\266\351"
+  "\207\215\346\226\260\345\205\247\345\256\271\346\214\207\345\257\274\350\277\220\350\241\214\346\227\245\345\277"
+  "\227\350\263\243\345\256\266\350\266\205\350\277\207\345\234\237\345\234\260\346\265\231\346\261\237\346\224\257"
+  "\344\273\230\346\216\250\345\207\272\347\253\231\351\225\277\346\235\255\345\267\236\346\211\247\350\241\214\345"
+  "\210\266\351\200\240\344\271\213\344\270\200\346\216\250\345\271\277\347\216\260\345\234\272\346\217\217\350\277"
+  "\260\345\217\230\345\214\226\344\274\240\347\273\237\346\255\214\346\211\213\344\277\235\351\231\251\350\257\276"
+  "\347\250\213\345\214\273\347\226\227\347\273\217\350\277\207\350\277\207\345\216\273\344\271\213\345\211\215\346"
+  "\224\266\345\205\245\345\271\264\345\272\246\346\235\202\345\277\227\347\276\216\344\270\275\346\234\200\351\253"
+  "\230\347\231\273\351\231\206\346\234\252\346\235\245\345\212\240\345\267\245\345\205\215\350\264\243\346\225\231"
+  "\347\250\213\347\211\210\345\235\227\350\272\253\344\275\223\351\207\215\345\272\206\345\207\272\345\224\256\346"
+  "\210\220\346\234\254\345\275\242\345\274\217\345\234\237\350\261\206\345\207\272\345\203\271\344\270\234\346\226"
+  "\271\351\202\256\347\256\261\345\215\227\344\272\254\346\261\202\350\201\214\345\217\226\345\276\227\350\201\214"
+  "\344\275\215\347\233\270\344\277\241\351\241\265\351\235\242\345\210\206\351\222\237\347\275\221\351\241\265\347"
+  "\241\256\345\256\232\345\233\276\344\276\213\347\275\221\345\235\200\347\247\257\346\236\201\351\224\231\350\257"
+  "\257\347\233\256\347\232\204\345\256\235\350\264\235\346\234\272\345\205\263\351\243\216\351\231\251\346\216\210"
+  "\346\235\203\347\227\205\346\257\222\345\256\240\347\211\251\351\231\244\344\272\206\350\251\225\350\253\226\347"
+  "\226\276\347\227\205\345\217\212\346\227\266\346\261\202\350\264\255\347\253\231\347\202\271\345\204\277\347\253"
+  "\245\346\257\217\345\244\251\344\270\255\345\244\256\350\256\244\350\257\206\346\257\217\344\270\252\345\244\251"
+  "\346\264\245\345\255\227\344\275\223\345\217\260\347\201\243\347\273\264\346\212\244\346\234\254\351\241\265\344"
+  "\270\252\346\200\247\345\256\230\346\226\271\345\270\270\350\247\201\347\233\270\346\234\272\346\210\230\347\225"
+  "\245\345\272\224\345\275\223\345\276\213\345\270\210\346\226\271\344\276\277\346\240\241\345\233\255\350\202\241"
+  "\345\270\202\346\210\277\345\261\213\346\240\217\347\233\256\345\221\230\345\267\245\345\257\274\350\207\264\347"
+  "\252\201\347\204\266\351\201\223\345\205\267\346\234\254\347\275\221\347\273\223\345\220\210\346\241\243\346\241"
+  "\210\345\212\263\345\212\250\345\217\246\345\244\226\347\276\216\345\205\203\345\274\225\350\265\267\346\224\271"
+  "\345\217\230\347\254\254\345\233\233\344\274\232\350\256\241\350\252\252\346\230\216\351\232\220\347\247\201\345"
+  "\256\235\345\256\235\350\247\204\350\214\203\346\266\210\350\264\271\345\205\261\345\220\214\345\277\230\350\256"
+  "\260\344\275\223\347\263\273\345\270\246\346\235\245\345\220\215\345\255\227\347\231\274\350\241\250\345\274\200"
+  "\346\224\276\345\212\240\347\233\237\345\217\227\345\210\260\344\272\214\346\211\213\345\244\247\351\207\217\346"
+  "\210\220\344\272\272\346\225\260\351\207\217\345\205\261\344\272\253\345\214\272\345\237\237\345\245\263\345\255"
+  "\251\345\216\237\345\210\231\346\211\200\345\234\250\347\273\223\346\235\237\351\200\232\344\277\241\350\266\205"
+  "\347\272\247\351\205\215\347\275\256\345\275\223\346\227\266\344\274\230\347\247\200\346\200\247\346\204\237\346"
+  "\210\277\344\272\247\351\201\212\346\210\262\345\207\272\345\217\243\346\217\220\344\272\244\345\260\261\344\270"
+  "\232\344\277\235\345\201\245\347\250\213\345\272\246\345\217\202\346\225\260\344\272\213\344\270\232\346\225\264"
+  "\344\270\252\345\261\261\344\270\234\346\203\205\346\204\237\347\211\271\346\256\212\345\210\206\351\241\236\346"
+  "\220\234\345\260\213\345\261\236\344\272\216\351\227\250\346\210\267\350\264\242\345\212\241\345\243\260\351\237"
+  "\263\345\217\212\345\205\266\350\264\242\347\273\217\345\235\232\346\214\201\345\271\262\351\203\250\346\210\220"
+  "\347\253\213\345\210\251\347\233\212\350\200\203\350\231\221\346\210\220\351\203\275\345\214\205\350\243\205\347"
+  "\224\250\346\210\266\346\257\224\350\265\233\346\226\207\346\230\216\346\213\233\345\225\206\345\256\214\346\225"
+  "\264\347\234\237\346\230\257\347\234\274\347\235\233\344\274\231\344\274\264\345\250\201\346\234\233\351\242\206"
+  "\345\237\237\345\215\253\347\224\237\344\274\230\346\203\240\350\253\226\345\243\207\345\205\254\345\205\261\350"
+  "\211\257\345\245\275\345\205\205\345\210\206\347\254\246\345\220\210\351\231\204\344\273\266\347\211\271\347\202"
+  "\271\344\270\215\345\217\257\350\213\261\346\226\207\350\265\204\344\272\247\346\240\271\346\234\254\346\230\216"
+  "\346\230\276\345\257\206\347\242\274\345\205\254\344\274\227\346\260\221\346\227\217\346\233\264\345\212\240\344"
+  "\272\253\345\217\227\345\220\214\345\255\246\345\220\257\345\212\250\351\200\202\345\220\210\345\216\237\346\235"
+  "\245\351\227\256\347\255\224\346\234\254\346\226\207\347\276\216\351\243\237\347\273\277\350\211\262\347\250\263"
+  "\345\256\232\347\273\210\344\272\216\347\224\237\347\211\251\344\276\233\346\261\202\346\220\234\347\213\220\345"
+  "\212\233\351\207\217\344\270\245\351\207\215\346\260\270\350\277\234\345\206\231\347\234\237\346\234\211\351\231"
+  "\220\347\253\236\344\272\211\345\257\271\350\261\241\350\264\271\347\224\250\344\270\215\345\245\275\347\273\235"
+  "\345\257\271\345\215\201\345\210\206\344\277\203\350\277\233\347\202\271\350\257\204\345\275\261\351\237\263\344"
+  "\274\230\345\212\277\344\270\215\345\260\221\346\254\243\350\265\217\345\271\266\344\270\224\346\234\211\347\202"
+  "\271\346\226\271\345\220\221\345\205\250\346\226\260\344\277\241\347\224\250\350\256\276\346\226\275\345\275\242"
+  "\350\261\241\350\265\204\346\240\274\347\252\201\347\240\264\351\232\217\347\235\200\351\207\215\345\244\247\344"
+  "\272\216\346\230\257\346\257\225\344\270\232\346\231\272\350\203\275\345\214\226\345\267\245\345\256\214\347\276"
+  "\216\345\225\206\345\237\216\347\273\237\344\270\200\345\207\272\347\211\210\346\211\223\351\200\240\347\224\242"
+  "\345\223\201\346\246\202\345\206\265\347\224\250\344\272\216\344\277\235\347\225\231\345\233\240\347\264\240\344"
+  "\270\255\345\234\213\345\255\230\345\202\250\350\264\264\345\233\276\346\234\200\346\204\233\351\225\277\346\234"
+  "\237\345\217\243\344\273\267\347\220\206\350\264\242\345\237\272\345\234\260\345\256\211\346\216\222\346\255\246"
+  "\346\261\211\351\207\214\351\235\242\345\210\233\345\273\272\345\244\251\347\251\272\351\246\226\345\205\210\345"
+  "\256\214\345\226\204\351\251\261\345\212\250\344\270\213\351\235\242\344\270\215\345\206\215\350\257\232\344\277"
+  "\241\346\204\217\344\271\211\351\230\263\345\205\211\350\213\261\345\233\275\346\274\202\344\272\256\345\206\233"
+  "\344\272\213\347\216\251\345\256\266\347\276\244\344\274\227\345\206\234\346\260\221\345\215\263\345\217\257\345"
+  "\220\215\347\250\261\345\256\266\345\205\267\345\212\250\347\224\273\346\203\263\345\210\260\346\263\250\346\230"
+  "\216\345\260\217\345\255\246\346\200\247\350\203\275\350\200\203\347\240\224\347\241\254\344\273\266\350\247\202"
+  "\347\234\213\346\270\205\346\245\232\346\220\236\347\254\221\351\246\226\351\240\201\351\273\204\351\207\221\351"
+  "\200\202\347\224\250\346\261\237\350\213\217\347\234\237\345\256\236\344\270\273\347\256\241\351\230\266\346\256"
+  "\265\350\250\273\345\206\212\347\277\273\350\257\221\346\235\203\345\210\251\345\201\232\345\245\275\344\274\274"
+  "\344\271\216\351\200\232\350\256\257\346\226\275\345\267\245\347\213\200\346\205\213\344\271\237\350\256\270\347"
+  "\216\257\344\277\235\345\237\271\345\205\273\346\246\202\345\277\265\345\244\247\345\236\213\346\234\272\347\245"
+  "\250\347\220\206\350\247\243\345\214\277\345\220\215cuandoenviarmadridbuscariniciotiempoporquecuentaestadopuedenju"
+  "egoscontraest\303\241nnombretienenperfilmaneraamigosciudadcentroaunquepuedesdentroprimerprecioseg\303\272nbuenosvo"
+  "lverpuntossemanahab\303\255aagostonuevosunidoscarlosequiponi\303\261osmuchosalgunacorreoimagenpartirarribamar\303"
+  "\255ahombreempleoverdadcambiomuchasfueronpasadol\303\255neaparecenuevascursosestabaquierolibroscuantoaccesomiguelv"
+  "arioscuatrotienesgruposser\303\241neuropamediosfrenteacercadem\303\241sofertacochesmodeloitalialetrasalg\303\272nc"
+  "ompracualesexistecuerposiendoprensallegarviajesdineromurciapodr\303\241puestodiariopuebloquieremanuelpropiocrisisc"
+  "iertoseguromuertefuentecerrargrandeefectopartesmedidapropiaofrecetierrae-mailvariasformasfuturoobjetoseguirriesgon"
+  "ormasmismos\303\272nicocaminositiosraz\303\263ndebidopruebatoledoten\303\255ajes\303\272sesperococinaorigentiendac"
+  "ientoc\303\241dizhablarser\303\255alatinafuerzaestiloguerraentrar\303\251xitol\303\263pezagendav\303\255deoevitarp"
+  "aginametrosjavierpadresf\303\241cilcabeza\303\241reassalidaenv\303\255ojap\303\263nabusosbienestextosllevarpuedanf"
+  "uertecom\303\272nclaseshumanotenidobilbaounidadest\303\241seditarcreado\320\264\320\273\321\217\321\207\321\202"
+  "\320\276\320\272\320\260\320\272\320\270\320\273\320\270\321\215\321\202\320\276\320\262\321\201\320\265\320\265"
+  "\320\263\320\276\320\277\321\200\320\270\321\202\320\260\320\272\320\265\321\211\320\265\321\203\320\266\320\265"
+  "\320\232\320\260\320\272\320\261\320\265\320\267\320\261\321\213\320\273\320\276\320\275\320\270\320\222\321\201"
+  "\320\265\320\277\320\276\320\264\320\255\321\202\320\276\321\202\320\276\320\274\321\207\320\265\320\274\320\275"
+  "\320\265\321\202\320\273\320\265\321\202\321\200\320\260\320\267\320\276\320\275\320\260\320\263\320\264\320\265"
+  "\320\274\320\275\320\265\320\224\320\273\321\217\320\237\321\200\320\270\320\275\320\260\321\201\320\275\320\270"
+  "\321\205\321\202\320\265\320\274\320\272\321\202\320\276\320\263\320\276\320\264\320\262\320\276\321\202\321\202"
+  "\320\260\320\274\320\241\320\250\320\220\320\274\320\260\321\217\320\247\321\202\320\276\320\262\320\260\321\201"
+  "\320\262\320\260\320\274\320\265\320\274\321\203\320\242\320\260\320\272\320\264\320\262\320\260\320\275\320\260"
+  "\320\274\321\215\321\202\320\270\321\215\321\202\321\203\320\222\320\260\320\274\321\202\320\265\321\205\320\277"
+  "\321\200\320\276\321\202\321\203\321\202\320\275\320\260\320\264\320\264\320\275\321\217\320\222\320\276\321\202"
+  "\321\202\321\200\320\270\320\275\320\265\320\271\320\222\320\260\321\201\320\275\320\270\320\274\321\201\320\260"
+  "\320\274\321\202\320\276\321\202\321\200\321\203\320\261\320\236\320\275\320\270\320\274\320\270\321\200\320\275"
+  "\320\265\320\265\320\236\320\236\320\236\320\273\320\270\321\206\321\215\321\202\320\260\320\236\320\275\320\260"
+  "\320\275\320\265\320\274\320\264\320\276\320\274\320\274\320\276\320\271\320\264\320\262\320\265\320\276\320\275"
+  "\320\276\321\201\321\203\320\264\340\244\225\340\245\207\340\244\271\340\245\210\340\244\225\340\245\200\340\244"
+  "\270\340\245\207\340\244\225\340\244\276\340\244\225\340\245\213\340\244\224\340\244\260\340\244\252\340\244\260"
+  "\340\244\250\340\245\207\340\244\217\340\244\225\340\244\225\340\244\277\340\244\255\340\245\200\340\244\207\340"
+  "\244\270\340\244\225\340\244\260\340\244\244\340\245\213\340\244\271\340\245\213\340\244\206\340\244\252\340\244"
+  "\271\340\245\200\340\244\257\340\244\271\340\244\257\340\244\276\340\244\244\340\244\225\340\244\245\340\244\276ja"
+  "gran\340\244\206\340\244\234\340\244\234\340\245\213\340\244\205\340\244\254\340\244\246\340\245\213\340\244\227"
+  "\340\244\210\340\244\234\340\244\276\340\244\227\340\244\217\340\244\271\340\244\256\340\244\207\340\244\250\340"
+  "\244\265\340\244\271\340\244\257\340\245\207\340\244\245\340\245\207\340\244\245\340\245\200\340\244\230\340\244"
+  "\260\340\244\234\340\244\254\340\244\246\340\245\200\340\244\225\340\244\210\340\244\234\340\245\200\340\244\265"
+  "\340\245\207\340\244\250\340\244\210\340\244\250\340\244\217\340\244\271\340\244\260\340\244\211\340\244\270\340"
+  "\244\256\340\245\207\340\244\225\340\244\256\340\244\265\340\245\213\340\244\262\340\245\207\340\244\270\340\244"
+  "\254\340\244\256\340\244\210\340\244\246\340\245\207\340\244\223\340\244\260\340\244\206\340\244\256\340\244\254"
+  "\340\244\270\340\244\255\340\244\260\340\244\254\340\244\250\340\244\232\340\244\262\340\244\256\340\244\250\340"
+  "\244\206\340\244\227\340\244\270\340\245\200\340\244\262\340\245\200\330\271\331\204\331\211\330\245\331\204\331"
+  "\211\331\207\330\260\330\247\330\242\330\256\330\261\330\271\330\257\330\257\330\247\331\204\331\211\331\207\330"
+  "\260\331\207\330\265\331\210\330\261\330\272\331\212\330\261\331\203\330\247\331\206\331\210\331\204\330\247\330"
+  "\250\331\212\331\206\330\271\330\261\330\266\330\260\331\204\331\203\331\207\331\206\330\247\331\212\331\210\331"
+  "\205\331\202\330\247\331\204\330\271\331\204\331\212\330\247\331\206\330\247\331\204\331\203\331\206\330\255\330"
+  "\252\331\211\331\202\330\250\331\204\331\210\330\255\330\251\330\247\330\256\330\261\331\201\331\202\330\267\330"
+  "\271\330\250\330\257\330\261\331\203\331\206\330\245\330\260\330\247\331\203\331\205\330\247\330\247\330\255\330"
+  "\257\330\245\331\204\330\247\331\201\331\212\331\207\330\250\330\271\330\266\331\203\331\212\331\201\330\250\330"
+  "\255\330\253\331\210\331\205\331\206\331\210\331\207\331\210\330\243\331\206\330\247\330\254\330\257\330\247\331"
+  "\204\331\207\330\247\330\263\331\204\331\205\330\271\331\206\330\257\331\204\331\212\330\263\330\271\330\250\330"
+  "\261\330\265\331\204\331\211\331\205\331\206\330\260\330\250\331\207\330\247\330\243\331\206\331\207\331\205\330"
+  "\253\331\204\331\203\331\206\330\252\330\247\331\204\330\247\330\255\331\212\330\253\331\205\330\265\330\261\330"
+  "\264\330\261\330\255\330\255\331\210\331\204\331\210\331\201\331\212\330\247\330\260\330\247\331\204\331\203\331"
+  "\204\331\205\330\261\330\251\330\247\331\206\330\252\330\247\331\204\331\201\330\243\330\250\331\210\330\256\330"
+  "\247\330\265\330\243\331\206\330\252\330\247\331\206\331\207\330\247\331\204\331\212\330\271\330\266\331\210\331"
+  "\210\331\202\330\257\330\247\330\250\331\206\330\256\331\212\330\261\330\250\331\206\330\252\331\204\331\203\331"
+  "\205\330\264\330\247\330\241\331\210\331\207\331\212\330\247\330\250\331\210\331\202\330\265\330\265\331\210\331"
+  "\205\330\247\330\261\331\202\331\205\330\243\330\255\330\257\331\206\330\255\331\206\330\271\330\257\331\205\330"
+  "\261\330\243\331\212\330\247\330\255\330\251\331\203\330\252\330\250\330\257\331\210\331\206\331\212\330\254\330"
+  "\250\331\205\331\206\331\207\330\252\330\255\330\252\330\254\331\207\330\251\330\263\331\206\330\251\331\212\330"
+  "\252\331\205\331\203\330\261\330\251\330\272\330\262\330\251\331\206\331\201\330\263\330\250\331\212\330\252\331"
+  "\204\331\204\331\207\331\204\331\206\330\247\330\252\331\204\331\203\331\202\331\204\330\250\331\204\331\205\330"
+  "\247\330\271\331\206\331\207\330\243\331\210\331\204\330\264\331\212\330\241\331\206\331\210\330\261\330\243\331"
+  "\205\330\247\331\201\331\212\331\203\330\250\331\203\331\204\330\260\330\247\330\252\330\261\330\252\330\250\330"
+  "\250\330\243\331\206\331\207\331\205\330\263\330\247\331\206\331\203\330\250\331\212\330\271\331\201\331\202\330"
+  "\257\330\255\330\263\331\206\331\204\331\207\331\205\330\264\330\271\330\261\330\243\331\207\331\204\330\264\331"
+  "\207\330\261\331\202\330\267\330\261\330\267\331\204\330\250profileservicedefaulthimselfdetailscontentsupportstart"
+  "edmessagesuccessfashion<title>countryaccountcreatedstoriesresultsrunningprocesswritingobjectsvisiblewelcomearticle"
+  "unknownnetworkcompanydynamicbrowserprivacyproblemServicerespectdisplayrequestreservewebsitehistoryfriendsoptionswo"
+  "rkingversionmillionchannelwindow.addressvisitedweathercorrectproductedirectforwardyou canremovedsubjectcontrolarch"
+  "ivecurrentreadinglibrarylimitedmanagerfurthersummarymachineminutesprivatecontextprogramsocietynumberswrittenenable"
+  "dtriggersourcesloadingelementpartnerfinallyperfectmeaningsystemskeepingculture&quot;,journalprojectsurfaces&quot;e"
+  "xpiresreviewsbalanceEnglishContentthroughPlease opinioncontactaverageprimaryvillageSpanishgallerydeclinemeetingmis"
+  "sionpopularqualitymeasuregeneralspeciessessionsectionwriterscounterinitialreportsfiguresmembersholdingdisputeearli"
+  "erexpressdigitalpictureAnothermarriedtrafficleadingchangedcentralvictoryimages/reasonsstudiesfeaturelistingmust be"
+  "schoolsVersionusuallyepisodeplayinggrowingobviousoverlaypresentactions</ul>\015\012wrapperalreadycertainrealitysto"
+  "rageanotherdesktopofferedpatternunusualDigitalcapitalWebsitefailureconnectreducedAndroiddecadesregular &amp; anima"
+  "lsreleaseAutomatgettingmethodsnothingPopularcaptionletterscapturesciencelicensechangesEngland=1&amp;History = new "
+  "CentralupdatedSpecialNetworkrequirecommentwarningCollegetoolbarremainsbecauseelectedDeutschfinanceworkersquicklybe"
+  "tweenexactlysettingdiseaseSocietyweaponsexhibit&lt;!--Controlclassescoveredoutlineattacksdevices(windowpurposetitl"
+  "e=\"Mobile killingshowingItaliandroppedheavilyeffects-1']);\012confirmCurrentadvancesharingopeningdrawingbillionor"
+  "deredGermanyrelated</form>includewhetherdefinedSciencecatalogArticlebuttonslargestuniformjourneysidebarChicagoholi"
+  "dayGeneralpassage,&quot;animatefeelingarrivedpassingnaturalroughly.\012\012The but notdensityBritainChineselack of"
+  "tributeIreland\" data-factorsreceivethat isLibraryhusbandin factaffairsCharlesradicalbroughtfindinglanding:lang=\""
+  "return leadersplannedpremiumpackageAmericaEdition]&quot;Messageneed tovalue=\"complexlookingstationbelievesmaller-"
+  "mobilerecordswant tokind ofFirefoxyou aresimilarstudiedmaximumheadingrapidlyclimatekingdomemergedamountsfoundedpio"
+  "neerformuladynastyhow to SupportrevenueeconomyResultsbrothersoldierlargelycalling.&quot;AccountEdward segmentRober"
+  "t effortsPacificlearnedup withheight:we haveAngelesnations_searchappliedacquiremassivegranted: falsetreatedbiggest"
+  "benefitdrivingStudiesminimumperhapsmorningsellingis usedreversevariant role=\"missingachievepromotestudentsomeonee"
+  "xtremerestorebottom:evolvedall thesitemapenglishway to  AugustsymbolsCompanymattersmusicalagainstserving})();\015"
+  "\012paymenttroubleconceptcompareparentsplayersregionsmonitor ''The winningexploreadaptedGalleryproduceabilityenhan"
+  "cecareers). The collectSearch ancientexistedfooter handlerprintedconsoleEasternexportswindowsChannelillegalneutral"
+  "suggest_headersigning.html\">settledwesterncausing-webkitclaimedJusticechaptervictimsThomas mozillapromisepartiese"
+  "ditionoutside:false,hundredOlympic_buttonauthorsreachedchronicdemandssecondsprotectadoptedprepareneithergreatlygre"
+  "ateroverallimprovecommandspecialsearch.worshipfundingthoughthighestinsteadutilityquarterCulturetestingclearlyexpos"
+  "edBrowserliberal} catchProjectexamplehide();FloridaanswersallowedEmperordefenseseriousfreedomSeveral-buttonFurther"
+  "out of != nulltrainedDenmarkvoid(0)/all.jspreventRequestStephen\012\012When observe</h2>\015\012Modern provide\" a"
+  "lt=\"borders.\012\012For \012\012Many artistspoweredperformfictiontype ofmedicalticketsopposedCouncilwitnessjustic"
+  "eGeorge Belgium...</a>twitternotablywaitingwarfare Other rankingphrasesmentionsurvivescholar</p>\015\012 Countryig"
+  "noredloss ofjust asGeorgiastrange<head><stopped1']);\015\012islandsnotableborder:list ofcarried100,000</h3>\012 se"
+  "veralbecomesselect wedding00.htmlmonarchoff theteacherhighly biologylife ofor evenrise of&raquo;plusonehunting(tho"
+  "ughDouglasjoiningcirclesFor theAncientVietnamvehiclesuch ascrystalvalue =Windowsenjoyeda smallassumed<a id=\"forei"
+  "gn All rihow theDisplayretiredhoweverhidden;battlesseekingcabinetwas notlook atconductget theJanuaryhappensturning"
+  "a:hoverOnline French lackingtypicalextractenemieseven ifgeneratdecidedare not/searchbeliefs-image:locatedstatic.lo"
+  "gin\">convertviolententeredfirst\">circuitFinlandchemistshe was10px;\">as suchdivided</span>will beline ofa greatm"
+  "ystery/index.fallingdue to railwaycollegemonsterdescentit withnuclearJewish protestBritishflowerspredictreformsbut"
+  "ton who waslectureinstantsuicidegenericperiodsmarketsSocial fishingcombinegraphicwinners<br /><by the NaturalPriva"
+  "cycookiesoutcomeresolveSwedishbrieflyPersianso muchCenturydepictscolumnshousingscriptsnext tobearingmappingrevised"
+  "jQuery(-width:title\">tooltipSectiondesignsTurkishyounger.match(})();\012\012burningoperatedegreessource=Richardcl"
+  "oselyplasticentries</tr>\015\012color:#ul id=\"possessrollingphysicsfailingexecutecontestlink toDefault<br />\012:"
+  " true,chartertourismclassicproceedexplain</h1>\015\012online.\077xml vehelpingdiamonduse theairlineend -->).attr(r"
+  "eadershosting#ffffffrealizeVincentsignals src=\"/ProductdespitediversetellingPublic held inJoseph theatreaffects<s"
+  "tyle>a largedoesn'tlater, ElementfaviconcreatorHungaryAirportsee theso thatMichaelSystemsPrograms, and  width=e&qu"
+  "ot;tradingleft\">\012personsGolden Affairsgrammarformingdestroyidea ofcase ofoldest this is.src = cartoonregistrCo"
+  "mmonsMuslimsWhat isin manymarkingrevealsIndeed,equally/show_aoutdoorescape(Austriageneticsystem,In the sittingHe a"
+  "lsoIslandsAcademy\012\011\011<!--Daniel bindingblock\">imposedutilizeAbraham(except{width:putting).html(|| [];\012"
+  "DATA[ *kitchenmountedactual dialectmainly _blank'installexpertsif(typeIt also&copy; \">Termsborn inOptionseasternt"
+  "alkingconcerngained ongoingjustifycriticsfactoryits ownassaultinvitedlastinghis ownhref=\"/\" rel=\"developconcert"
+  "diagramdollarsclusterphp\077id=alcohol);})();using a><span>vesselsrevivalAddressamateurandroidallegedillnesswalkin"
+  "gcentersqualifymatchesunifiedextinctDefensedied in\012\011<!-- customslinkingLittle Book ofeveningmin.js\077are th"
+  "ekontakttoday's.html\" target=wearingAll Rig;\012})();raising Also, crucialabout\">declare-->\012<scfirefoxas much"
+  "appliesindex, s, but type = \012\015\012<!--towardsRecordsPrivateForeignPremierchoicesVirtualreturnsCommentPowered"
+  "inline;povertychamberLiving volumesAnthonylogin\" RelatedEconomyreachescuttinggravitylife inChapter-shadowNotable<"
+  "/td>\015\012 returnstadiumwidgetsvaryingtravelsheld bywho arework infacultyangularwho hadairporttown of\012\012Som"
+  "e 'click'chargeskeywordit willcity of(this);Andrew unique checkedor more300px; return;rsion=\"pluginswithin hersel"
+  "fStationFederalventurepublishsent totensionactresscome tofingersDuke ofpeople,exploitwhat isharmonya major\":\"htt"
+  "pin his menu\">\012monthlyofficercouncilgainingeven inSummarydate ofloyaltyfitnessand wasemperorsupremeSecond hear"
+  "ingRussianlongestAlbertalateralset of small\">.appenddo withfederalbank ofbeneathDespiteCapitalgrounds), and perce"
+  "ntit fromclosingcontainInsteadfifteenas well.yahoo.respondfighterobscurereflectorganic= Math.editingonline padding"
+  "a wholeonerroryear ofend of barrierwhen itheader home ofresumedrenamedstrong>heatingretainscloudfrway of March 1kn"
+  "owingin partBetweenlessonsclosestvirtuallinks\">crossedEND -->famous awardedLicenseHealth fairly wealthyminimalAfr"
+  "icancompetelabel\">singingfarmersBrasil)discussreplaceGregoryfont copursuedappearsmake uproundedboth ofblockedsaw "
+  "theofficescoloursif(docuwhen heenforcepush(fuAugust UTF-8\">Fantasyin mostinjuredUsuallyfarmingclosureobject defen"
+  "ceuse of Medical<body>\012evidentbe usedkeyCodesixteenIslamic#000000entire widely active (typeofone cancolor =spea"
+  "kerextendsPhysicsterrain<tbody>funeralviewingmiddle cricketprophetshifteddoctorsRussell targetcompactalgebrasocial"
+  "-bulk ofman and</td>\012 he left).val()false);logicalbankinghome tonaming Arizonacredits);\012});\012founderin tur"
+  "nCollinsbefore But thechargedTitle\">CaptainspelledgoddessTag -->Adding:but wasRecent patientback in=false&Lincoln"
+  "we knowCounterJudaismscript altered']);\012  has theunclearEvent',both innot all\012\012<!-- placinghard to center"
+  "sort ofclientsstreetsBernardassertstend tofantasydown inharbourFreedomjewelry/about..searchlegendsis mademodern on"
+  "ly ononly toimage\" linear painterand notrarely acronymdelivershorter00&amp;as manywidth=\"/* <![Ctitle =of the lo"
+  "west picked escapeduses ofpeoples PublicMatthewtacticsdamagedway forlaws ofeasy to windowstrong  simple}catch(seve"
+  "nthinfoboxwent topaintedcitizenI don'tretreat. Some ww.\");\012bombingmailto:made in. Many carries||{};wiwork ofsy"
+  "nonymdefeatsfavoredopticalpageTraunless sendingleft\"><comScorAll thejQuery.touristClassicfalse\" Wilhelmsuburbsge"
+  "nuinebishops.split(global followsbody ofnominalContactsecularleft tochiefly-hidden-banner</li>\012\012. When in bo"
+  "thdismissExplorealways via thespa\303\261olwelfareruling arrangecaptainhis sonrule ofhe tookitself,=0&amp;(calleds"
+  "amplesto makecom/pagMartin Kennedyacceptsfull ofhandledBesides//--></able totargetsessencehim to its by common.min"
+  "eralto takeways tos.org/ladvisedpenaltysimple:if theyLettersa shortHerbertstrikes groups.lengthflightsoverlapslowl"
+  "y lesser social </p>\012\011\011it intoranked rate oful>\015\012  attemptpair ofmake itKontaktAntoniohaving rating"
+  "s activestreamstrapped\").css(hostilelead tolittle groups,Picture-->\015\012\015\012 rows=\" objectinverse<footerC"
+  "ustomV><\\/scrsolvingChamberslaverywoundedwhereas!= 'undfor allpartly -right:Arabianbacked centuryunit ofmobile-Eu"
+  "rope,is homerisk ofdesiredClintoncost ofage of become none ofp&quot;Middle ead')[0Criticsstudios>&copy;group\">ass"
+  "emblmaking pressedwidget.ps:\" \077 rebuiltby someFormer editorsdelayedCanonichad thepushingclass=\"but arepartial"
+  "Babylonbottom carrierCommandits useAs withcoursesa thirddenotesalso inHouston20px;\">accuseddouble goal ofFamous )"
+  ".bind(priests Onlinein Julyst + \"gconsultdecimalhelpfulrevivedis veryr'+'iptlosing femalesis alsostringsdays ofar"
+  "rivalfuture <objectforcingString(\" />\012\011\011here isencoded.  The balloondone by/commonbgcolorlaw of Indianaa"
+  "voidedbut the2px 3pxjquery.after apolicy.men andfooter-= true;for usescreen.Indian image =family,http:// &nbsp;dri"
+  "verseternalsame asnoticedviewers})();\012 is moreseasonsformer the newis justconsent Searchwas thewhy theshippedbr"
+  "><br>width: height=made ofcuisineis thata very Admiral fixed;normal MissionPress, ontariocharsettry to invaded=\"t"
+  "rue\"spacingis mosta more totallyfall of});\015\012  immensetime inset outsatisfyto finddown tolot of Playersin Ju"
+  "nequantumnot thetime todistantFinnishsrc = (single help ofGerman law andlabeledforestscookingspace\">header-well a"
+  "sStanleybridges/globalCroatia About [0];\012  it, andgroupedbeing a){throwhe madelighterethicalFFFFFF\"bottom\"lik"
+  "e a employslive inas seenprintermost ofub-linkrejectsand useimage\">succeedfeedingNuclearinformato helpWomen'sNeit"
+  "herMexicanprotein<table by manyhealthylawsuitdevised.push({sellerssimply Through.cookie Image(older\">us.js\"> Sin"
+  "ce universlarger open to!-- endlies in']);\015\012  marketwho is (\"DOMComanagedone fortypeof Kingdomprofitspropos"
+  "eto showcenter;made itdressedwere inmixtureprecisearisingsrc = 'make a securedBaptistvoting \012\011\011var March "
+  "2grew upClimate.removeskilledway the</head>face ofacting right\">to workreduceshas haderectedshow();action=book of"
+  "an area== \"htt<header\012<html>conformfacing cookie.rely onhosted .customhe wentbut forspread Family a meansout t"
+  "heforums.footage\">MobilClements\" id=\"as highintense--><!--female is seenimpliedset thea stateand hisfastestbesi"
+  "desbutton_bounded\"><img Infoboxevents,a youngand areNative cheaperTimeoutand hasengineswon the(mostlyright: find "
+  "a -bottomPrince area ofmore ofsearch_nature,legallyperiod,land ofor withinducedprovingmissilelocallyAgainstthe way"
+  "k&quot;px;\">\015\012pushed abandonnumeralCertainIn thismore inor somename isand, incrownedISBN 0-createsOctoberma"
+  "y notcenter late inDefenceenactedwish tobroadlycoolingonload=it. TherecoverMembersheight assumes<html>\012people.i"
+  "n one =windowfooter_a good reklamaothers,to this_cookiepanel\">London,definescrushedbaptismcoastalstatus title\" m"
+  "ove tolost inbetter impliesrivalryservers SystemPerhapses and contendflowinglasted rise inGenesisview ofrising see"
+  "m tobut in backinghe willgiven agiving cities.flow of Later all butHighwayonly bysign ofhe doesdiffersbattery&amp;"
+  "lasinglesthreatsintegertake onrefusedcalled =US&ampSee thenativesby thissystem.head of:hover,lesbiansurnameand all"
+  "common/header__paramsHarvard/pixel.removalso longrole ofjointlyskyscraUnicodebr />\015\012AtlantanucleusCounty,pur"
+  "ely count\">easily build aonclicka givenpointerh&quot;events else {\012ditionsnow the, with man whoorg/Webone andc"
+  "avalryHe diedseattle00,000 {windowhave toif(windand itssolely m&quot;renewedDetroitamongsteither them inSenatorUs<"
+  "/a><King ofFrancis-produche usedart andhim andused byscoringat hometo haverelatesibilityfactionBuffalolink\"><what"
+  " hefree toCity ofcome insectorscountedone daynervoussquare };if(goin whatimg\" alis onlysearch/tuesdaylooselySolom"
+  "onsexual - <a hrmedium\"DO NOT France,with a war andsecond take a >\015\012\015\012\015\012market.highwaydone inct"
+  "ivity\"last\">obligedrise to\"undefimade to Early praisedin its for hisathleteJupiterYahoo! termed so manyreally s"
+  ". The a woman\077value=direct right\" bicycleacing=\"day andstatingRather,higher Office are nowtimes, when a pay f"
+  "oron this-link\">;borderaround annual the Newput the.com\" takin toa brief(in thegroups.; widthenzymessimple in la"
+  "te{returntherapya pointbanninginks\">\012();\" rea place\\u003Caabout atr>\015\012\011\011ccount gives a<SCRIPTRai"
+  "lwaythemes/toolboxById(\"xhumans,watchesin some if (wicoming formats Under but hashanded made bythan infear ofdeno"
+  "ted/iframeleft involtagein eacha&quot;base ofIn manyundergoregimesaction </p>\015\012<ustomVa;&gt;</importsor that"
+  "mostly &amp;re size=\"</a></ha classpassiveHost = WhetherfertileVarious=[];(fucameras/></td>acts asIn some>\015"
+  "\012\015\012<!organis <br />Beijingcatal\303\240deutscheuropeueuskaragaeilgesvenskaespa\303\261amensajeusuariotrab"
+  "ajom\303\251xicop\303\241ginasiempresistemaoctubredurantea\303\261adirempresamomentonuestroprimeratrav\303\251sgra"
+  "ciasnuestraprocesoestadoscalidadpersonan\303\272meroacuerdom\303\272sicamiembroofertasalgunospa\303\255sesejemplod"
+  "erechoadem\303\241sprivadoagregarenlacesposiblehotelessevillaprimero\303\272ltimoeventosarchivoculturamujeresentra"
+  "daanuncioembargomercadograndesestudiomejoresfebrerodise\303\261oturismoc\303\263digoportadaespaciofamiliaantoniope"
+  "rmiteguardaralgunaspreciosalguiensentidovisitast\303\255tuloconocersegundoconsejofranciaminutossegundatenemosefect"
+  "osm\303\241lagasesi\303\263nrevistagranadacompraringresogarc\303\255aacci\303\263necuadorquienesinclusodeber\303"
+  "\241materiahombresmuestrapodr\303\255ama\303\261ana\303\272ltimaestamosoficialtambienning\303\272nsaludospodemosme"
+  "jorarpositionbusinesshomepagesecuritylanguagestandardcampaignfeaturescategoryexternalchildrenreservedresearchexcha"
+  "ngefavoritetemplatemilitaryindustryservicesmaterialproductsz-index:commentssoftwarecompletecalendarplatformarticle"
+  "srequiredmovementquestionbuildingpoliticspossiblereligionphysicalfeedbackregisterpicturesdisabledprotocolaudiences"
+  "ettingsactivityelementslearninganythingabstractprogressoverviewmagazineeconomictrainingpressurevarious <strong>pro"
+  "pertyshoppingtogetheradvancedbehaviordownloadfeaturedfootballselectedLanguagedistanceremembertrackingpasswordmodif"
+  "iedstudentsdirectlyfightingnortherndatabasefestivalbreakinglocationinternetdropdownpracticeevidencefunctionmarriag"
+  "eresponseproblemsnegativeprogramsanalysisreleasedbanner\">purchasepoliciesregionalcreativeargumentbookmarkreferrer"
+  "chemicaldivisioncallbackseparateprojectsconflicthardwareinterestdeliverymountainobtained= false;for(var acceptedca"
+  "pacitycomputeridentityaircraftemployedproposeddomesticincludesprovidedhospitalverticalcollapseapproachpartnerslogo"
+  "\"><adaughterauthor\" culturalfamilies/images/assemblypowerfulteachingfinisheddistrictcriticalcgi-bin/purposesrequ"
+  "ireselectionbecomingprovidesacademicexerciseactuallymedicineconstantaccidentMagazinedocumentstartingbottom\">obser"
+  "ved: &quot;extendedpreviousSoftwarecustomerdecisionstrengthdetailedslightlyplanningtextareacurrencyeveryonestraigh"
+  "ttransferpositiveproducedheritageshippingabsolutereceivedrelevantbutton\" violenceanywherebenefitslaunchedrecently"
+  "alliancefollowedmultiplebulletinincludedoccurredinternal$(this).republic><tr><tdcongressrecordedultimatesolution<u"
+  "l id=\"discoverHome</a>websitesnetworksalthoughentirelymemorialmessagescontinueactive\">somewhatvictoriaWestern  t"
+  "itle=\"LocationcontractvisitorsDownloadwithout right\">\012measureswidth = variableinvolvedvirginianormallyhappene"
+  "daccountsstandingnationalRegisterpreparedcontrolsaccuratebirthdaystrategyofficialgraphicscriminalpossiblyconsumerP"
+  "ersonalspeakingvalidateachieved.jpg\" />machines</h2>\012  keywordsfriendlybrotherscombinedoriginalcomposedexpecte"
+  "dadequatepakistanfollow\" valuable</label>relativebringingincreasegovernorplugins/List of Header\">\" name=\" (&qu"
+  "ot;graduate</head>\012commercemalaysiadirectormaintain;height:schedulechangingback to catholicpatternscolor: #grea"
+  "testsuppliesreliable</ul>\012\011\011<select citizensclothingwatching<li id=\"specificcarryingsentence<center>cont"
+  "rastthinkingcatch(e)southernMichael merchantcarouselpadding:interior.split(\"lizationOctober ){returnimproved--&gt"
+  ";\012\012coveragechairman.png\" />subjectsRichard whateverprobablyrecoverybaseballjudgmentconnect..css\" /> websit"
+  "ereporteddefault\"/></a>\015\012electricscotlandcreationquantity. ISBN 0did not instance-search-\" lang=\"speakers"
+  "ComputercontainsarchivesministerreactiondiscountItalianocriteriastrongly: 'http:'script'coveringofferingappearedBr"
+  "itish identifyFacebooknumerousvehiclesconcernsAmericanhandlingdiv id=\"William provider_contentaccuracysection and"
+  "ersonflexibleCategorylawrence<script>layout=\"approved maximumheader\"></table>Serviceshamiltoncurrent canadiancha"
+  "nnels/themes//articleoptionalportugalvalue=\"\"intervalwirelessentitledagenciesSearch\" measuredthousandspending&h"
+  "ellip;new Date\" size=\"pageNamemiddle\" \" /></a>hidden\">sequencepersonaloverflowopinionsillinoislinks\">\012"
+  "\011<title>versionssaturdayterminalitempropengineersectionsdesignerproposal=\"false\"Espa\303\261olreleasessubmit"
+  "\" er&quot;additionsymptomsorientedresourceright\"><pleasurestationshistory.leaving  border=contentscenter\">.\012"
+  "\012Some directedsuitablebulgaria.show();designedGeneral conceptsExampleswilliamsOriginal\"><span>search\">operato"
+  "rrequestsa &quot;allowingDocumentrevision. \012\012The yourselfContact michiganEnglish columbiapriorityprintingdri"
+  "nkingfacilityreturnedContent officersRussian generate-8859-1\"indicatefamiliar qualitymargin:0 contentviewportcont"
+  "acts-title\">portable.length eligibleinvolvesatlanticonload=\"default.suppliedpaymentsglossary\012\012After guidan"
+  "ce</td><tdencodingmiddle\">came to displaysscottishjonathanmajoritywidgets.clinicalthailandteachers<head>\012\011a"
+  "ffectedsupportspointer;toString</small>oklahomawill be investor0\" alt=\"holidaysResourcelicensed (which . After c"
+  "onsidervisitingexplorerprimary search\" android\"quickly meetingsestimate;return ;color:# height=approval, &quot; "
+  "checked.min.js\"magnetic></a></hforecast. While thursdaydvertise&eacute;hasClassevaluateorderingexistingpatients O"
+  "nline coloradoOptions\"campbell<!-- end</span><<br />\015\012_popups|sciences,&quot; quality Windows assignedheigh"
+  "t: <b classle&quot; value=\" Companyexamples<iframe believespresentsmarshallpart of properly).\012\012The taxonomy"
+  "much of </span>\012\" data-srtugu\303\252sscrollTo project<head>\015\012attorneyemphasissponsorsfancyboxworld's wi"
+  "ldlifechecked=sessionsprogrammpx;font- Projectjournalsbelievedvacationthompsonlightingand the special border=0chec"
+  "king</tbody><button Completeclearfix\012<head>\012article <sectionfindingsrole in popular  Octoberwebsite exposure"
+  "used to  changesoperatedclickingenteringcommandsinformed numbers  </div>creatingonSubmitmarylandcollegesanalyticli"
+  "stingscontact.loggedInadvisorysiblingscontent\"s&quot;)s. This packagescheckboxsuggestspregnanttomorrowspacing=ico"
+  "n.pngjapanesecodebasebutton\">gamblingsuch as , while </span> missourisportingtop:1px .</span>tensionswidth=\"2laz"
+  "yloadnovemberused in height=\"cript\">\012&nbsp;</<tr><td height:2/productcountry include footer\" &lt;!-- title\""
+  "></jquery.</form>\012(\347\256\200\344\275\223)(\347\271\201\351\253\224)hrvatskiitalianorom\303\242n\304\203t\303"
+  "\274rk\303\247e\330\247\330\261\330\257\331\210tambi\303\251nnoticiasmensajespersonasderechosnacionalservicioconta"
+  "ctousuariosprogramagobiernoempresasanunciosvalenciacolombiadespu\303\251sdeportesproyectoproductop\303\272bliconos"
+  "otroshistoriapresentemillonesmediantepreguntaanteriorrecursosproblemasantiagonuestrosopini\303\263nimprimirmientra"
+  "sam\303\251ricavendedorsociedadrespectorealizarregistropalabrasinter\303\251sentoncesespecialmiembrosrealidadc\303"
+  "\263rdobazaragozap\303\241ginassocialesbloqueargesti\303\263nalquilersistemascienciascompletoversi\303\263ncomplet"
+  "aestudiosp\303\272blicaobjetivoalicantebuscadorcantidadentradasaccionesarchivossuperiormayor\303\255aalemaniafunci"
+  "\303\263n\303\272ltimoshaciendoaquellosedici\303\263nfernandoambientefacebooknuestrasclientesprocesosbastanteprese"
+  "ntareportarcongresopublicarcomerciocontratoj\303\263venesdistritot\303\251cnicaconjuntoenerg\303\255atrabajarastur"
+  "iasrecienteutilizarbolet\303\255nsalvadorcorrectatrabajosprimerosnegocioslibertaddetallespantallapr\303\263ximoalm"
+  "er\303\255aanimalesqui\303\251nescoraz\303\263nsecci\303\263nbuscandoopcionesexteriorconceptotodav\303\255agaler"
+  "\303\255aescribirmedicinalicenciaconsultaaspectoscr\303\255ticad\303\263laresjusticiadeber\303\241nper\303\255odon"
+  "ecesitamantenerpeque\303\261orecibidatribunaltenerifecanci\303\263ncanariasdescargadiversosmallorcarequieret\303"
+  "\251cnicodeber\303\255aviviendafinanzasadelantefuncionaconsejosdif\303\255cilciudadesantiguasavanzadat\303\251rmin"
+  "ounidadess\303\241nchezcampa\303\261asoftonicrevistascontienesectoresmomentosfacultadcr\303\251ditodiversassupuest"
+  "ofactoressegundospeque\303\261a\320\263\320\276\320\264\320\260\320\265\321\201\320\273\320\270\320\265\321\201"
+  "\321\202\321\214\320\261\321\213\320\273\320\276\320\261\321\213\321\202\321\214\321\215\321\202\320\276\320\274"
+  "\320\225\321\201\320\273\320\270\321\202\320\276\320\263\320\276\320\274\320\265\320\275\321\217\320\262\321\201"
+  "\320\265\321\205\321\215\321\202\320\276\320\271\320\264\320\260\320\266\320\265\320\261\321\213\320\273\320\270"
+  "\320\263\320\276\320\264\321\203\320\264\320\265\320\275\321\214\321\215\321\202\320\276\321\202\320\261\321\213"
+  "\320\273\320\260\321\201\320\265\320\261\321\217\320\276\320\264\320\270\320\275\321\201\320\265\320\261\320\265"
+  "\320\275\320\260\320\264\320\276\321\201\320\260\320\271\321\202\321\204\320\276\321\202\320\276\320\275\320\265"
+  "\320\263\320\276\321\201\320\262\320\276\320\270\321\201\320\262\320\276\320\271\320\270\320\263\321\200\321\213"
+  "\321\202\320\276\320\266\320\265\320\262\321\201\320\265\320\274\321\201\320\262\320\276\321\216\320\273\320\270"
+  "\321\210\321\214\321\215\321\202\320\270\321\205\320\277\320\276\320\272\320\260\320\264\320\275\320\265\320\271"
+  "\320\264\320\276\320\274\320\260\320\274\320\270\321\200\320\260\320\273\320\270\320\261\320\276\321\202\320\265"
+  "\320\274\321\203\321\205\320\276\321\202\321\217\320\264\320\262\321\203\321\205\321\201\320\265\321\202\320\270"
+  "\320\273\321\216\320\264\320\270\320\264\320\265\320\273\320\276\320\274\320\270\321\200\320\265\321\202\320\265"
+  "\320\261\321\217\321\201\320\262\320\276\320\265\320\262\320\270\320\264\320\265\321\207\320\265\320\263\320\276"
+  "\321\215\321\202\320\270\320\274\321\201\321\207\320\265\321\202\321\202\320\265\320\274\321\213\321\206\320\265"
+  "\320\275\321\213\321\201\321\202\320\260\320\273\320\262\320\265\320\264\321\214\321\202\320\265\320\274\320\265"
+  "\320\262\320\276\320\264\321\213\321\202\320\265\320\261\320\265\320\262\321\213\321\210\320\265\320\275\320\260"
+  "\320\274\320\270\321\202\320\270\320\277\320\260\321\202\320\276\320\274\321\203\320\277\321\200\320\260\320\262"
+  "\320\273\320\270\321\206\320\260\320\276\320\264\320\275\320\260\320\263\320\276\320\264\321\213\320\267\320\275"
+  "\320\260\321\216\320\274\320\276\320\263\321\203\320\264\321\200\321\203\320\263\320\262\321\201\320\265\320\271"
+  "\320\270\320\264\320\265\321\202\320\272\320\270\320\275\320\276\320\276\320\264\320\275\320\276\320\264\320\265"
+  "\320\273\320\260\320\264\320\265\320\273\320\265\321\201\321\200\320\276\320\272\320\270\321\216\320\275\321\217"
+  "\320\262\320\265\321\201\321\214\320\225\321\201\321\202\321\214\321\200\320\260\320\267\320\260\320\275\320\260"
+  "\321\210\320\270\330\247\331\204\331\204\331\207\330\247\331\204\330\252\331\212\330\254\331\205\331\212\330\271"
+  "\330\256\330\247\330\265\330\251\330\247\331\204\330\260\331\212\330\271\331\204\331\212\331\207\330\254\330\257"
+  "\331\212\330\257\330\247\331\204\330\242\331\206\330\247\331\204\330\261\330\257\330\252\330\255\331\203\331\205"
+  "\330\265\331\201\330\255\330\251\331\203\330\247\331\206\330\252\330\247\331\204\331\204\331\212\331\212\331\203"
+  "\331\210\331\206\330\264\330\250\331\203\330\251\331\201\331\212\331\207\330\247\330\250\331\206\330\247\330\252"
+  "\330\255\331\210\330\247\330\241\330\243\331\203\330\253\330\261\330\256\331\204\330\247\331\204\330\247\331\204"
+  "\330\255\330\250\330\257\331\204\331\212\331\204\330\257\330\261\331\210\330\263\330\247\330\266\330\272\330\267"
+  "\330\252\331\203\331\210\331\206\331\207\331\206\330\247\331\203\330\263\330\247\330\255\330\251\331\206\330\247"
+  "\330\257\331\212\330\247\331\204\330\267\330\250\330\271\331\204\331\212\331\203\330\264\331\203\330\261\330\247"
+  "\331\212\331\205\331\203\331\206\331\205\331\206\331\207\330\247\330\264\330\261\331\203\330\251\330\261\330\246"
+  "\331\212\330\263\331\206\330\264\331\212\330\267\331\205\330\247\330\260\330\247\330\247\331\204\331\201\331\206"
+  "\330\264\330\250\330\247\330\250\330\252\330\271\330\250\330\261\330\261\330\255\331\205\330\251\331\203\330\247"
+  "\331\201\330\251\331\212\331\202\331\210\331\204\331\205\330\261\331\203\330\262\331\203\331\204\331\205\330\251"
+  "\330\243\330\255\331\205\330\257\331\202\331\204\330\250\331\212\331\212\330\271\331\206\331\212\330\265\331\210"
+  "\330\261\330\251\330\267\330\261\331\212\331\202\330\264\330\247\330\261\331\203\330\254\331\210\330\247\331\204"
+  "\330\243\330\256\330\261\331\211\331\205\330\271\331\206\330\247\330\247\330\250\330\255\330\253\330\271\330\261"
+  "\331\210\330\266\330\250\330\264\331\203\331\204\331\205\330\263\330\254\331\204\330\250\331\206\330\247\331\206"
+  "\330\256\330\247\331\204\330\257\331\203\330\252\330\247\330\250\331\203\331\204\331\212\330\251\330\250\330\257"
+  "\331\210\331\206\330\243\331\212\330\266\330\247\331\212\331\210\330\254\330\257\331\201\330\261\331\212\331\202"
+  "\331\203\330\252\330\250\330\252\330\243\331\201\330\266\331\204\331\205\330\267\330\250\330\256\330\247\331\203"
+  "\330\253\330\261\330\250\330\247\330\261\331\203\330\247\331\201\330\266\331\204\330\247\330\255\331\204\331\211"
+  "\331\206\331\201\330\263\331\207\330\243\331\212\330\247\331\205\330\261\330\257\331\210\330\257\330\243\331\206"
+  "\331\207\330\247\330\257\331\212\331\206\330\247\330\247\331\204\330\247\331\206\331\205\330\271\330\261\330\266"
+  "\330\252\330\271\331\204\331\205\330\257\330\247\330\256\331\204\331\205\331\205\331\203\331\206\000\000\000\000"
+  "\000\000\000\000\001\000\001\000\001\000\001\000\002\000\002\000\002\000\002\000\004\000\004\000\004\000\004\000"
+  "\000\001\002\003\004\005\006\007\007\006\005\004\003\002\001\000\010\011\012\013\014\015\016\017\017\016\015\014"
+  "\013\012\011\010\020\021\022\023\024\025\026\027\027\026\025\024\023\022\021\020\030\031\032\033\034\035\036\037"
+  "\037\036\035\034\033\032\031\030\377\377\377\377\000\000\000\000\000\000\000\000\377\377\377\377\001\000\000\000"
+  "\002\000\000\000\002\000\000\000\001\000\000\000\001\000\000\000\003\000\000\000\377\377\000\001\000\000\000\001"
+  "\000\000\377\377\000\001\000\000\000\010\000\010\000\010\000\010\000\000\000\001\000\002\000\003\000\004\000\005"
+  "\000\006\000\007resourcescountriesquestionsequipmentcommunityavailablehighlightDTD/xhtmlmarketingknowledgesomethin"
+  "gcontainerdirectionsubscribeadvertisecharacter\" value=\"</select>Australia\" class=\"situationauthorityfollowingp"
+  "rimarilyoperationchallengedevelopedanonymousfunction functionscompaniesstructureagreement\" title=\"potentialeduca"
+  "tionargumentssecondarycopyrightlanguagesexclusivecondition</form>\015\012statementattentionBiography} else {\012so"
+  "lutionswhen the Analyticstemplatesdangeroussatellitedocumentspublisherimportantprototypeinfluence&raquo;</effectiv"
+  "egenerallytransformbeautifultransportorganizedpublishedprominentuntil thethumbnailNational .focus();over the migra"
+  "tionannouncedfooter\">\012exceptionless thanexpensiveformationframeworkterritoryndicationcurrentlyclassNamecritici"
+  "smtraditionelsewhereAlexanderappointedmaterialsbroadcastmentionedaffiliate</option>treatmentdifferent/default.Pres"
+  "identonclick=\"biographyotherwisepermanentFran\303\247aisHollywoodexpansionstandards</style>\012reductionDecember "
+  "preferredCambridgeopponentsBusiness confusion>\012<title>presentedexplaineddoes not worldwideinterfacepositionsnew"
+  "spaper</table>\012mountainslike the essentialfinancialselectionaction=\"/abandonedEducationparseInt(stabilityunabl"
+  "e to</title>\012relationsNote thatefficientperformedtwo yearsSince thethereforewrapper\">alternateincreasedBattle "
+  "ofperceivedtrying tonecessaryportrayedelectionsElizabeth</iframe>discoveryinsurances.length;legendaryGeographycand"
+  "idatecorporatesometimesservices.inherited</strong>CommunityreligiouslocationsCommitteebuildingsthe worldno longerb"
+  "eginningreferencecannot befrequencytypicallyinto the relative;recordingpresidentinitiallytechniquethe otherit can "
+  "beexistenceunderlinethis timetelephoneitemscopepracticesadvantage);return For otherprovidingdemocracyboth the exte"
+  "nsivesufferingsupportedcomputers functionpracticalsaid thatit may beEnglish</from the scheduleddownloads</label>"
+  "\012suspectedmargin: 0spiritual</head>\012\012microsoftgraduallydiscussedhe becameexecutivejquery.jshouseholdconfi"
+  "rmedpurchasedliterallydestroyedup to thevariationremainingit is notcenturiesJapanese among thecompletedalgorithmin"
+  "terestsrebellionundefinedencourageresizableinvolvingsensitiveuniversalprovision(althoughfeaturingconducted), which"
+  " continued-header\">February numerous overflow:componentfragmentsexcellentcolspan=\"technicalnear the Advanced sou"
+  "rce ofexpressedHong Kong Facebookmultiple mechanismelevationoffensive</form>\012\011sponsoreddocument.or &quot;the"
+  "re arethose whomovementsprocessesdifficultsubmittedrecommendconvincedpromoting\" width=\".replace(classicalcoaliti"
+  "onhis firstdecisionsassistantindicatedevolution-wrapper\"enough toalong thedelivered-->\015\012<!--American protec"
+  "tedNovember </style><furnitureInternet  onblur=\"suspendedrecipientbased on Moreover,abolishedcollectedwere madeem"
+  "otionalemergencynarrativeadvocatespx;bordercommitteddir=\"ltr\"employeesresearch. selectedsuccessorcustomersdispla"
+  "yedSeptemberaddClass(Facebook suggestedand lateroperatingelaborateSometimesInstitutecertainlyinstalledfollowersJer"
+  "usalemthey havecomputinggeneratedprovincesguaranteearbitraryrecognizewanted topx;width:theory ofbehaviourWhile the"
+  "estimatedbegan to it becamemagnitudemust havemore thanDirectoryextensionsecretarynaturallyoccurringvariablesgiven "
+  "theplatform.</label><failed tocompoundskinds of societiesalongside --&gt;\012\012southwestthe rightradiationmay ha"
+  "ve unescape(spoken in\" href=\"/programmeonly the come fromdirectoryburied ina similarthey were</font></Norwegians"
+  "pecifiedproducingpassenger(new DatetemporaryfictionalAfter theequationsdownload.regularlydeveloperabove thelinked "
+  "tophenomenaperiod oftooltip\">substanceautomaticaspect ofAmong theconnectedestimatesAir Forcesystem ofobjectiveimm"
+  "ediatemaking itpaintingsconqueredare stillproceduregrowth ofheaded byEuropean divisionsmoleculesfranchiseintention"
+  "attractedchildhoodalso useddedicatedsingaporedegree offather ofconflicts</a></p>\012came fromwere usednote thatrec"
+  "eivingExecutiveeven moreaccess tocommanderPoliticalmusiciansdeliciousprisonersadvent ofUTF-8\" /><![CDATA[\">Conta"
+  "ctSouthern bgcolor=\"series of. It was in Europepermittedvalidate.appearingofficialsseriously-languageinitiatedext"
+  "endinglong-terminflationsuch thatgetCookiemarked by</button>implementbut it isincreasesdown the requiringdependent"
+  "-->\012<!-- interviewWith the copies ofconsensuswas builtVenezuela(formerlythe statepersonnelstrategicfavour ofinv"
+  "entionWikipediacontinentvirtuallywhich wasprincipleComplete identicalshow thatprimitiveaway frommolecularprecisely"
+  "dissolvedUnder theversion=\">&nbsp;</It is the This is will haveorganismssome timeFriedrichwas firstthe only fact "
+  "thatform id=\"precedingTechnicalphysicistoccurs innavigatorsection\">span id=\"sought tobelow thesurviving}</style"
+  ">his deathas in thecaused bypartiallyexisting using thewas givena list oflevels ofnotion ofOfficial dismissedscien"
+  "tistresemblesduplicateexplosiverecoveredall othergalleries{padding:people ofregion ofaddressesassociateimg alt=\"i"
+  "n modernshould bemethod ofreportingtimestampneeded tothe Greatregardingseemed toviewed asimpact onidea thatthe Wor"
+  "ldheight ofexpandingThese arecurrent\">carefullymaintainscharge ofClassicaladdressedpredictedownership<div id=\"ri"
+  "ght\">\015\012residenceleave thecontent\">are often  })();\015\012probably Professor-button\" respondedsays thatha"
+  "d to beplaced inHungarianstatus ofserves asUniversalexecutionaggregatefor whichinfectionagreed tohowever, popular"
+  "\">placed onconstructelectoralsymbol ofincludingreturn toarchitectChristianprevious living ineasier toprofessor"
+  "\012&lt;!-- effect ofanalyticswas takenwhere thetook overbelief inAfrikaansas far aspreventedwork witha special<fi"
+  "eldsetChristmasRetrieved\012\012In the back intonortheastmagazines><strong>committeegoverninggroups ofstored inest"
+  "ablisha generalits firsttheir ownpopulatedan objectCaribbeanallow thedistrictswisconsinlocation.; width: inhabited"
+  "SocialistJanuary 1</footer>similarlychoice ofthe same specific business The first.length; desire todeal withsince "
+  "theuserAgentconceivedindex.phpas &quot;engage inrecently,few yearswere also\012<head>\012<edited byare knowncities"
+  " inaccesskeycondemnedalso haveservices,family ofSchool ofconvertednature of languageministers</object>there is a p"
+  "opularsequencesadvocatedThey wereany otherlocation=enter themuch morereflectedwas namedoriginal a typicalwhen they"
+  "engineerscould notresidentswednesdaythe third productsJanuary 2what theya certainreactionsprocessorafter histhe la"
+  "st contained\"></div>\012</a></td>depend onsearch\">\012pieces ofcompetingReferencetennesseewhich has version=</sp"
+  "an> <</header>gives thehistorianvalue=\"\">padding:0view thattogether,the most was foundsubset ofattack onchildren"
+  ",points ofpersonal position:allegedlyClevelandwas laterand afterare givenwas stillscrollingdesign ofmakes themuch "
+  "lessAmericans.\012\012After , but theMuseum oflouisiana(from theminnesotaparticlesa processDominicanvolume ofretur"
+  "ningdefensive00px|righmade frommouseover\" style=\"states of(which iscontinuesFranciscobuilding without awith some"
+  "who woulda form ofa part ofbefore itknown as  Serviceslocation and oftenmeasuringand it ispaperbackvalues of\015"
+  "\012<title>= window.determineer&quot; played byand early</center>from thisthe threepower andof &quot;innerHTML<a h"
+  "ref=\"y:inline;Church ofthe eventvery highofficial -height: content=\"/cgi-bin/to createafrikaansesperantofran\303"
+  "\247aislatvie\305\241ulietuvi\305\263\304\214e\305\241tina\304\215e\305\241tina\340\271\204\340\270\227\340\270"
+  "\242\346\227\245\346\234\254\350\252\236\347\256\200\344\275\223\345\255\227\347\271\201\351\253\224\345\255\227"
+  "\355\225\234\352\265\255\354\226\264\344\270\272\344\273\200\344\271\210\350\256\241\347\256\227\346\234\272\347"
+  "\254\224\350\256\260\346\234\254\350\250\216\350\253\226\345\215\200\346\234\215\345\212\241\345\231\250\344\272"
+  "\222\350\201\224\347\275\221\346\210\277\345\234\260\344\272\247\344\277\261\344\271\220\351\203\250\345\207\272"
+  "\347\211\210\347\244\276\346\216\222\350\241\214\346\246\234\351\203\250\350\220\275\346\240\274\350\277\233\344"
+  "\270\200\346\255\245\346\224\257\344\273\230\345\256\235\351\252\214\350\257\201\347\240\201\345\247\224\345\221"
+  "\230\344\274\232\346\225\260\346\215\256\345\272\223\346\266\210\350\264\271\350\200\205\345\212\236\345\205\254"
+  "\345\256\244\350\256\250\350\256\272\345\214\272\346\267\261\345\234\263\345\270\202\346\222\255\346\224\276\345"
+  "\231\250\345\214\227\344\272\254\345\270\202\345\244\247\345\255\246\347\224\237\350\266\212\346\235\245\350\266"
+  "\212\347\256\241\347\220\206\345\221\230\344\277\241\346\201\257\347\275\221serviciosart\303\255culoargentinabarce"
+  "lonacualquierpublicadoproductospol\303\255ticarespuestawikipediasiguienteb\303\272squedacomunidadseguridadprincipa"
+  "lpreguntascontenidorespondervenezuelaproblemasdiciembrerelaci\303\263nnoviembresimilaresproyectosprogramasinstitut"
+  "oactividadencuentraeconom\303\255aim\303\241genescontactardescargarnecesarioatenci\303\263ntel\303\251fonocomisi"
+  "\303\263ncancionescapacidadencontraran\303\241lisisfavoritost\303\251rminosprovinciaetiquetaselementosfuncionesres"
+  "ultadocar\303\241cterpropiedadprincipionecesidadmunicipalcreaci\303\263ndescargaspresenciacomercialopinionesejerci"
+  "cioeditorialsalamancagonz\303\241lezdocumentopel\303\255cularecientesgeneralestarragonapr\303\241cticanovedadespro"
+  "puestapacientest\303\251cnicasobjetivoscontactos\340\244\256\340\245\207\340\244\202\340\244\262\340\244\277\340"
+  "\244\217\340\244\271\340\245\210\340\244\202\340\244\227\340\244\257\340\244\276\340\244\270\340\244\276\340\244"
+  "\245\340\244\217\340\244\265\340\244\202\340\244\260\340\244\271\340\245\207\340\244\225\340\245\213\340\244\210"
+  "\340\244\225\340\245\201\340\244\233\340\244\260\340\244\271\340\244\276\340\244\254\340\244\276\340\244\246\340"
+  "\244\225\340\244\271\340\244\276\340\244\270\340\244\255\340\245\200\340\244\271\340\245\201\340\244\217\340\244"
+  "\260\340\244\271\340\245\200\340\244\256\340\245\210\340\244\202\340\244\246\340\244\277\340\244\250\340\244\254"
+  "\340\244\276\340\244\244diplodocs\340\244\270\340\244\256\340\244\257\340\244\260\340\245\202\340\244\252\340\244"
+  "\250\340\244\276\340\244\256\340\244\252\340\244\244\340\244\276\340\244\253\340\244\277\340\244\260\340\244\224"
+  "\340\244\270\340\244\244\340\244\244\340\244\260\340\244\271\340\244\262\340\245\213\340\244\227\340\244\271\340"
+  "\245\201\340\244\206\340\244\254\340\244\276\340\244\260\340\244\246\340\245\207\340\244\266\340\244\271\340\245"
+  "\201\340\244\210\340\244\226\340\245\207\340\244\262\340\244\257\340\244\246\340\244\277\340\244\225\340\244\276"
+  "\340\244\256\340\244\265\340\245\207\340\244\254\340\244\244\340\245\200\340\244\250\340\244\254\340\245\200\340"
+  "\244\232\340\244\256\340\245\214\340\244\244\340\244\270\340\244\276\340\244\262\340\244\262\340\245\207\340\244"
+  "\226\340\244\234\340\245\211\340\244\254\340\244\256\340\244\246\340\244\246\340\244\244\340\244\245\340\244\276"
+  "\340\244\250\340\244\271\340\245\200\340\244\266\340\244\271\340\244\260\340\244\205\340\244\262\340\244\227\340"
+  "\244\225\340\244\255\340\245\200\340\244\250\340\244\227\340\244\260\340\244\252\340\244\276\340\244\270\340\244"
+  "\260\340\244\276\340\244\244\340\244\225\340\244\277\340\244\217\340\244\211\340\244\270\340\245\207\340\244\227"
+  "\340\244\257\340\245\200\340\244\271\340\245\202\340\244\201\340\244\206\340\244\227\340\245\207\340\244\237\340"
+  "\245\200\340\244\256\340\244\226\340\245\213\340\244\234\340\244\225\340\244\276\340\244\260\340\244\205\340\244"
+  "\255\340\245\200\340\244\227\340\244\257\340\245\207\340\244\244\340\245\201\340\244\256\340\244\265\340\245\213"
+  "\340\244\237\340\244\246\340\245\207\340\244\202\340\244\205\340\244\227\340\244\260\340\244\220\340\244\270\340"
+  "\245\207\340\244\256\340\245\207\340\244\262\340\244\262\340\244\227\340\244\276\340\244\271\340\244\276\340\244"
+  "\262\340\244\212\340\244\252\340\244\260\340\244\232\340\244\276\340\244\260\340\244\220\340\244\270\340\244\276"
+  "\340\244\246\340\245\207\340\244\260\340\244\234\340\244\277\340\244\270\340\244\246\340\244\277\340\244\262\340"
+  "\244\254\340\244\202\340\244\246\340\244\254\340\244\250\340\244\276\340\244\271\340\245\202\340\244\202\340\244"
+  "\262\340\244\276\340\244\226\340\244\234\340\245\200\340\244\244\340\244\254\340\244\237\340\244\250\340\244\256"
+  "\340\244\277\340\244\262\340\244\207\340\244\270\340\245\207\340\244\206\340\244\250\340\245\207\340\244\250\340"
+  "\244\257\340\244\276\340\244\225\340\245\201\340\244\262\340\244\262\340\245\211\340\244\227\340\244\255\340\244"
+  "\276\340\244\227\340\244\260\340\245\207\340\244\262\340\244\234\340\244\227\340\244\271\340\244\260\340\244\276"
+  "\340\244\256\340\244\262\340\244\227\340\245\207\340\244\252\340\245\207\340\244\234\340\244\271\340\244\276\340"
+  "\244\245\340\244\207\340\244\270\340\245\200\340\244\270\340\244\271\340\245\200\340\244\225\340\244\262\340\244"
+  "\276\340\244\240\340\245\200\340\244\225\340\244\271\340\244\276\340\244\201\340\244\246\340\245\202\340\244\260"
+  "\340\244\244\340\244\271\340\244\244\340\244\270\340\244\276\340\244\244\340\244\257\340\244\276\340\244\246\340"
+  "\244\206\340\244\257\340\244\276\340\244\252\340\244\276\340\244\225\340\244\225\340\245\214\340\244\250\340\244"
+  "\266\340\244\276\340\244\256\340\244\246\340\245\207\340\244\226\340\244\257\340\244\271\340\245\200\340\244\260"
+  "\340\244\276\340\244\257\340\244\226\340\245\201\340\244\246\340\244\262\340\244\227\340\245\200categoriesexperien"
+  "ce</title>\015\012Copyright javascriptconditionseverything<p class=\"technologybackground<a class=\"management&cop"
+  "y; 201javaScriptcharactersbreadcrumbthemselveshorizontalgovernmentCaliforniaactivitiesdiscoveredNavigationtransiti"
+  "onconnectionnavigationappearance</title><mcheckbox\" techniquesprotectionapparentlyas well asunt', 'UA-resolutiono"
+  "perationstelevisiontranslatedWashingtonnavigator. = window.impression&lt;br&gt;literaturepopulationbgcolor=\"#espe"
+  "cially content=\"productionnewsletterpropertiesdefinitionleadershipTechnologyParliamentcomparisonul class=\".index"
+  "Of(\"conclusiondiscussioncomponentsbiologicalRevolution_containerunderstoodnoscript><permissioneach otheratmospher"
+  "e onfocus=\"<form id=\"processingthis.valuegenerationConferencesubsequentwell-knownvariationsreputationphenomenond"
+  "isciplinelogo.png\" (document,boundariesexpressionsettlementBackgroundout of theenterprise(\"https:\" unescape(\"p"
+  "assword\" democratic<a href=\"/wrapper\">\012membershiplinguisticpx;paddingphilosophyassistanceuniversityfacilitie"
+  "srecognizedpreferenceif (typeofmaintainedvocabularyhypothesis.submit();&amp;nbsp;annotationbehind theFoundationpub"
+  "lisher\"assumptionintroducedcorruptionscientistsexplicitlyinstead ofdimensions onClick=\"considereddepartmentoccup"
+  "ationsoon afterinvestmentpronouncedidentifiedexperimentManagementgeographic\" height=\"link rel=\".replace(/depres"
+  "sionconferencepunishmenteliminatedresistanceadaptationoppositionwell knownsupplementdeterminedh1 class=\"0px;margi"
+  "nmechanicalstatisticscelebratedGovernment\012\012During tdevelopersartificialequivalentoriginatedCommissionattachm"
+  "ent<span id=\"there wereNederlandsbeyond theregisteredjournalistfrequentlyall of thelang=\"en\" </style>\015\012ab"
+  "solute; supportingextremely mainstream</strong> popularityemployment</table>\015\012 colspan=\"</form>\012  conver"
+  "sionabout the </p></div>integrated\" lang=\"enPortuguesesubstituteindividualimpossiblemultimediaalmost allpx solid"
+  " #apart fromsubject toin Englishcriticizedexcept forguidelinesoriginallyremarkablethe secondh2 class=\"<a title=\""
+  "(includingparametersprohibited= \"http://dictionaryperceptionrevolutionfoundationpx;height:successfulsupportersmil"
+  "lenniumhis fatherthe &quot;no-repeat;commercialindustrialencouragedamount of unofficialefficiencyReferencescoordin"
+  "atedisclaimerexpeditiondevelopingcalculatedsimplifiedlegitimatesubstring(0\" class=\"completelyillustratefive year"
+  "sinstrumentPublishing1\" class=\"psychologyconfidencenumber of absence offocused onjoined thestructurespreviously>"
+  "</iframe>once againbut ratherimmigrantsof course,a group ofLiteratureUnlike the</a>&nbsp;\012function it was theCo"
+  "nventionautomobileProtestantaggressiveafter the Similarly,\" /></div>collection\015\012functionvisibilitythe use o"
+  "fvolunteersattractionunder the threatened*<![CDATA[importancein generalthe latter</form>\012</.indexOf('i = 0; i <"
+  "differencedevoted totraditionssearch forultimatelytournamentattributesso-called }\012</style>evaluationemphasizeda"
+  "ccessible</section>successionalong withMeanwhile,industries</a><br />has becomeaspects ofTelevisionsufficientbaske"
+  "tballboth sidescontinuingan article<img alt=\"adventureshis mothermanchesterprinciplesparticularcommentaryeffects "
+  "ofdecided to\"><strong>publishersJournal ofdifficultyfacilitateacceptablestyle.css\"\011function innovation>Copyri"
+  "ghtsituationswould havebusinessesDictionarystatementsoften usedpersistentin Januarycomprising</title>\012\011diplo"
+  "maticcontainingperformingextensionsmay not beconcept of onclick=\"It is alsofinancial making theLuxembourgaddition"
+  "alare calledengaged in\"script\");but it waselectroniconsubmit=\"\012<!-- End electricalofficiallysuggestiontop of"
+  " theunlike theAustralianOriginallyreferences\012</head>\015\012recognisedinitializelimited toAlexandriaretirementA"
+  "dventuresfour years\012\012&lt;!-- increasingdecorationh3 class=\"origins ofobligationregulationclassified(functio"
+  "n(advantagesbeing the historians<base hrefrepeatedlywilling tocomparabledesignatednominationfunctionalinside there"
+  "velationend of thes for the authorizedrefused totake placeautonomouscompromisepolitical restauranttwo of theFebrua"
+  "ry 2quality ofswfobject.understandnearly allwritten byinterviews\" width=\"1withdrawalfloat:leftis usuallycandidat"
+  "esnewspapersmysteriousDepartmentbest knownparliamentsuppressedconvenientremembereddifferent systematichas led topr"
+  "opagandacontrolledinfluencesceremonialproclaimedProtectionli class=\"Scientificclass=\"no-trademarksmore than wide"
+  "spreadLiberationtook placeday of theas long asimprisonedAdditional\012<head>\012<mLaboratoryNovember 2exceptionsIn"
+  "dustrialvariety offloat: lefDuring theassessmenthave been deals withStatisticsoccurrence/ul></div>clearfix\">the p"
+  "ublicmany yearswhich wereover time,synonymouscontent\">\012presumablyhis familyuserAgent.unexpectedincluding chall"
+  "engeda minorityundefined\"belongs totaken fromin Octoberposition: said to bereligious Federation rowspan=\"only a "
+  "fewmeant thatled to the-->\015\012<div <fieldset>Archbishop class=\"nobeing usedapproachesprivilegesnoscript>\012r"
+  "esults inmay be theEaster eggmechanismsreasonablePopulationCollectionselected\">noscript>\015/index.phparrival of-"
+  "jssdk'));managed toincompletecasualtiescompletionChristiansSeptember arithmeticproceduresmight haveProductionit ap"
+  "pearsPhilosophyfriendshipleading togiving thetoward theguaranteeddocumentedcolor:#000video gamecommissionreflectin"
+  "gchange theassociatedsans-serifonkeypress; padding:He was theunderlyingtypically , and the srcElementsuccessivesin"
+  "ce the should be networkingaccountinguse of thelower thanshows that</span>\012\011\011complaintscontinuousquantiti"
+  "esastronomerhe did notdue to itsapplied toan averageefforts tothe futureattempt toTherefore,capabilityRepublicanwa"
+  "s formedElectronickilometerschallengespublishingthe formerindigenousdirectionssubsidiaryconspiracydetails ofand in"
+  " theaffordablesubstancesreason forconventionitemtype=\"absolutelysupposedlyremained aattractivetravellingseparatel"
+  "yfocuses onelementaryapplicablefound thatstylesheetmanuscriptstands for no-repeat(sometimesCommercialin Americaund"
+  "ertakenquarter ofan examplepersonallyindex.php\077</button>\012percentagebest-knowncreating a\" dir=\"ltrLieutenan"
+  "t\012<div id=\"they wouldability ofmade up ofnoted thatclear thatargue thatto anotherchildren'spurpose offormulate"
+  "dbased uponthe regionsubject ofpassengerspossession.\012\012In the Before theafterwardscurrently across thescienti"
+  "ficcommunity.capitalismin Germanyright-wingthe systemSociety ofpoliticiandirection:went on toremoval of New York a"
+  "partmentsindicationduring theunless thehistoricalhad been adefinitiveingredientattendanceCenter forprominenceready"
+  "Statestrategiesbut in theas part ofconstituteclaim thatlaboratorycompatiblefailure of, such as began withusing the"
+  " to providefeature offrom which/\" class=\"geologicalseveral ofdeliberateimportant holds thating&quot; valign=topt"
+  "he Germanoutside ofnegotiatedhis careerseparationid=\"searchwas calledthe fourthrecreationother thanpreventionwhil"
+  "e the education,connectingaccuratelywere builtwas killedagreementsmuch more Due to thewidth: 100some otherKingdom "
+  "ofthe entirefamous forto connectobjectivesthe Frenchpeople andfeatured\">is said tostructuralreferendummost oftena"
+  " separate->\012<div id Official worldwide.aria-labelthe planetand it wasd\" value=\"looking atbeneficialare in the"
+  "monitoringreportedlythe modernworking onallowed towhere the innovative</a></div>soundtracksearchFormtend to beinpu"
+  "t id=\"opening ofrestrictedadopted byaddressingtheologianmethods ofvariant ofChristian very largeautomotiveby far "
+  "therange frompursuit offollow thebrought toin Englandagree thataccused ofcomes frompreventingdiv style=his or hert"
+  "remendousfreedom ofconcerning0 1em 1em;Basketball/style.cssan earliereven after/\" title=\".com/indextaking thepit"
+  "tsburghcontent\">\015<script>(fturned outhaving the</span>\015\012 occasionalbecause itstarted tophysically></div>"
+  "\012  created byCurrently, bgcolor=\"tabindex=\"disastrousAnalytics also has a><div id=\"</style>\012<called forsi"
+  "nger and.src = \"//violationsthis pointconstantlyis locatedrecordingsd from thenederlandsportugu\303\252s\327\242"
+  "\327\221\327\250\327\231\327\252\331\201\330\247\330\261\330\263\333\214desarrollocomentarioeducaci\303\263nseptie"
+  "mbreregistradodirecci\303\263nubicaci\303\263npublicidadrespuestasresultadosimportantereservadosart\303\255culosdi"
+  "ferentessiguientesrep\303\272blicasituaci\303\263nministerioprivacidaddirectorioformaci\303\263npoblaci\303\263npr"
+  "esidentecontenidosaccesoriostechnoratipersonalescategor\303\255aespecialesdisponibleactualidadreferenciavalladolid"
+  "bibliotecarelacionescalendariopol\303\255ticasanterioresdocumentosnaturalezamaterialesdiferenciaecon\303\263micatr"
+  "ansporterodr\303\255guezparticiparencuentrandiscusi\303\263nestructurafundaci\303\263nfrecuentespermanentetotalmen"
+  "te\320\274\320\276\320\266\320\275\320\276\320\261\321\203\320\264\320\265\321\202\320\274\320\276\320\266\320\265"
+  "\321\202\320\262\321\200\320\265\320\274\321\217\321\202\320\260\320\272\320\266\320\265\321\207\321\202\320\276"
+  "\320\261\321\213\320\261\320\276\320\273\320\265\320\265\320\276\321\207\320\265\320\275\321\214\321\215\321\202"
+  "\320\276\320\263\320\276\320\272\320\276\320\263\320\264\320\260\320\277\320\276\321\201\320\273\320\265\320\262"
+  "\321\201\320\265\320\263\320\276\321\201\320\260\320\271\321\202\320\265\321\207\320\265\321\200\320\265\320\267"
+  "\320\274\320\276\320\263\321\203\321\202\321\201\320\260\320\271\321\202\320\260\320\266\320\270\320\267\320\275"
+  "\320\270\320\274\320\265\320\266\320\264\321\203\320\261\321\203\320\264\321\203\321\202\320\237\320\276\320\270"
+  "\321\201\320\272\320\267\320\264\320\265\321\201\321\214\320\262\320\270\320\264\320\265\320\276\321\201\320\262"
+  "\321\217\320\267\320\270\320\275\321\203\320\266\320\275\320\276\321\201\320\262\320\276\320\265\320\271\320\273"
+  "\321\216\320\264\320\265\320\271\320\277\320\276\321\200\320\275\320\276\320\274\320\275\320\276\320\263\320\276"
+  "\320\264\320\265\321\202\320\265\320\271\321\201\320\262\320\276\320\270\321\205\320\277\321\200\320\260\320\262"
+  "\320\260\321\202\320\260\320\272\320\276\320\271\320\274\320\265\321\201\321\202\320\276\320\270\320\274\320\265"
+  "\320\265\321\202\320\266\320\270\320\267\320\275\321\214\320\276\320\264\320\275\320\276\320\271\320\273\321\203"
+  "\321\207\321\210\320\265\320\277\320\265\321\200\320\265\320\264\321\207\320\260\321\201\321\202\320\270\321\207"
+  "\320\260\321\201\321\202\321\214\321\200\320\260\320\261\320\276\321\202\320\275\320\276\320\262\321\213\321\205"
+  "\320\277\321\200\320\260\320\262\320\276\321\201\320\276\320\261\320\276\320\271\320\277\320\276\321\202\320\276"
+  "\320\274\320\274\320\265\320\275\320\265\320\265\321\207\320\270\321\201\320\273\320\265\320\275\320\276\320\262"
+  "\321\213\320\265\321\203\321\201\320\273\321\203\320\263\320\276\320\272\320\276\320\273\320\276\320\275\320\260"
+  "\320\267\320\260\320\264\321\202\320\260\320\272\320\276\320\265\321\202\320\276\320\263\320\264\320\260\320\277"
+  "\320\276\321\207\321\202\320\270\320\237\320\276\321\201\320\273\320\265\321\202\320\260\320\272\320\270\320\265"
+  "\320\275\320\276\320\262\321\213\320\271\321\201\321\202\320\276\320\270\321\202\321\202\320\260\320\272\320\270"
+  "\321\205\321\201\321\200\320\260\320\267\321\203\320\241\320\260\320\275\320\272\321\202\321\204\320\276\321\200"
+  "\321\203\320\274\320\232\320\276\320\263\320\264\320\260\320\272\320\275\320\270\320\263\320\270\321\201\320\273"
+  "\320\276\320\262\320\260\320\275\320\260\321\210\320\265\320\271\320\275\320\260\320\271\321\202\320\270\321\201"
+  "\320\262\320\276\320\270\320\274\321\201\320\262\321\217\320\267\321\214\320\273\321\216\320\261\320\276\320\271"
+  "\321\207\320\260\321\201\321\202\320\276\321\201\321\200\320\265\320\264\320\270\320\232\321\200\320\276\320\274"
+  "\320\265\320\244\320\276\321\200\321\203\320\274\321\200\321\213\320\275\320\272\320\265\321\201\321\202\320\260"
+  "\320\273\320\270\320\277\320\276\320\270\321\201\320\272\321\202\321\213\321\201\321\217\321\207\320\274\320\265"
+  "\321\201\321\217\321\206\321\206\320\265\320\275\321\202\321\200\321\202\321\200\321\203\320\264\320\260\321\201"
+  "\320\260\320\274\321\213\321\205\321\200\321\213\320\275\320\272\320\260\320\235\320\276\320\262\321\213\320\271"
+  "\321\207\320\260\321\201\320\276\320\262\320\274\320\265\321\201\321\202\320\260\321\204\320\270\320\273\321\214"
+  "\320\274\320\274\320\260\321\200\321\202\320\260\321\201\321\202\321\200\320\260\320\275\320\274\320\265\321\201"
+  "\321\202\320\265\321\202\320\265\320\272\321\201\321\202\320\275\320\260\321\210\320\270\321\205\320\274\320\270"
+  "\320\275\321\203\321\202\320\270\320\274\320\265\320\275\320\270\320\270\320\274\320\265\321\216\321\202\320\275"
+  "\320\276\320\274\320\265\321\200\320\263\320\276\321\200\320\276\320\264\321\201\320\260\320\274\320\276\320\274"
+  "\321\215\321\202\320\276\320\274\321\203\320\272\320\276\320\275\321\206\320\265\321\201\320\262\320\276\320\265"
+  "\320\274\320\272\320\260\320\272\320\276\320\271\320\220\321\200\321\205\320\270\320\262\331\205\331\206\330\252"
+  "\330\257\331\211\330\245\330\261\330\263\330\247\331\204\330\261\330\263\330\247\331\204\330\251\330\247\331\204"
+  "\330\271\330\247\331\205\331\203\330\252\330\250\331\207\330\247\330\250\330\261\330\247\331\205\330\254\330\247"
+  "\331\204\331\212\331\210\331\205\330\247\331\204\330\265\331\210\330\261\330\254\330\257\331\212\330\257\330\251"
+  "\330\247\331\204\330\271\330\266\331\210\330\245\330\266\330\247\331\201\330\251\330\247\331\204\331\202\330\263"
+  "\331\205\330\247\331\204\330\271\330\247\330\250\330\252\330\255\331\205\331\212\331\204\331\205\331\204\331\201"
+  "\330\247\330\252\331\205\331\204\330\252\331\202\331\211\330\252\330\271\330\257\331\212\331\204\330\247\331\204"
+  "\330\264\330\271\330\261\330\243\330\256\330\250\330\247\330\261\330\252\330\267\331\210\331\212\330\261\330\271"
+  "\331\204\331\212\331\203\331\205\330\245\330\261\331\201\330\247\331\202\330\267\331\204\330\250\330\247\330\252"
+  "\330\247\331\204\331\204\330\272\330\251\330\252\330\261\330\252\331\212\330\250\330\247\331\204\331\206\330\247"
+  "\330\263\330\247\331\204\330\264\331\212\330\256\331\205\331\206\330\252\330\257\331\212\330\247\331\204\330\271"
+  "\330\261\330\250\330\247\331\204\331\202\330\265\330\265\330\247\331\201\331\204\330\247\331\205\330\271\331\204"
+  "\331\212\331\207\330\247\330\252\330\255\330\257\331\212\330\253\330\247\331\204\331\204\331\207\331\205\330\247"
+  "\331\204\330\271\331\205\331\204\331\205\331\203\330\252\330\250\330\251\331\212\331\205\331\203\331\206\331\203"
+  "\330\247\331\204\330\267\331\201\331\204\331\201\331\212\330\257\331\212\331\210\330\245\330\257\330\247\330\261"
+  "\330\251\330\252\330\247\330\261\331\212\330\256\330\247\331\204\330\265\330\255\330\251\330\252\330\263\330\254"
+  "\331\212\331\204\330\247\331\204\331\210\331\202\330\252\330\271\331\206\330\257\331\205\330\247\331\205\330\257"
+  "\331\212\331\206\330\251\330\252\330\265\331\205\331\212\331\205\330\243\330\261\330\264\331\212\331\201\330\247"
+  "\331\204\330\260\331\212\331\206\330\271\330\261\330\250\331\212\330\251\330\250\331\210\330\247\330\250\330\251"
+  "\330\243\331\204\330\271\330\247\330\250\330\247\331\204\330\263\331\201\330\261\331\205\330\264\330\247\331\203"
+  "\331\204\330\252\330\271\330\247\331\204\331\211\330\247\331\204\330\243\331\210\331\204\330\247\331\204\330\263"
+  "\331\206\330\251\330\254\330\247\331\205\330\271\330\251\330\247\331\204\330\265\330\255\331\201\330\247\331\204"
+  "\330\257\331\212\331\206\331\203\331\204\331\205\330\247\330\252\330\247\331\204\330\256\330\247\330\265\330\247"
+  "\331\204\331\205\331\204\331\201\330\243\330\271\330\266\330\247\330\241\331\203\330\252\330\247\330\250\330\251"
+  "\330\247\331\204\330\256\331\212\330\261\330\261\330\263\330\247\330\246\331\204\330\247\331\204\331\202\331\204"
+  "\330\250\330\247\331\204\330\243\330\257\330\250\331\205\331\202\330\247\330\267\330\271\331\205\330\261\330\247"
+  "\330\263\331\204\331\205\331\206\330\267\331\202\330\251\330\247\331\204\331\203\330\252\330\250\330\247\331\204"
+  "\330\261\330\254\331\204\330\247\330\264\330\252\330\261\331\203\330\247\331\204\331\202\330\257\331\205\331\212"
+  "\330\271\330\267\331\212\331\203sByTagName(.jpg\" alt=\"1px solid #.gif\" alt=\"transparentinformationapplication"
+  "\" onclick=\"establishedadvertising.png\" alt=\"environmentperformanceappropriate&amp;mdash;immediately</strong></"
+  "rather thantemperaturedevelopmentcompetitionplaceholdervisibility:copyright\">0\" height=\"even thoughreplacementd"
+  "estinationCorporation<ul class=\"AssociationindividualsperspectivesetTimeout(url(http://mathematicsmargin-top:even"
+  "tually description) no-repeatcollections.JPG|thumb|participate/head><bodyfloat:left;<li class=\"hundreds of\012"
+  "\012However, compositionclear:both;cooperationwithin the label for=\"border-top:New Zealandrecommendedphotographyi"
+  "nteresting&lt;sup&gt;controversyNetherlandsalternativemaxlength=\"switzerlandDevelopmentessentially\012\012Althoug"
+  "h </textarea>thunderbirdrepresented&amp;ndash;speculationcommunitieslegislationelectronics\012\011<div id=\"illust"
+  "ratedengineeringterritoriesauthoritiesdistributed6\" height=\"sans-serif;capable of disappearedinteractivelooking "
+  "forit would beAfghanistanwas createdMath.floor(surroundingcan also beobservationmaintenanceencountered<h2 class=\""
+  "more recentit has beeninvasion of).getTime()fundamentalDespite the\"><div id=\"inspirationexaminationpreparationex"
+  "planation<input id=\"</a></span>versions ofinstrumentsbefore the  = 'http://Descriptionrelatively .substring(each "
+  "of theexperimentsinfluentialintegrationmany peopledue to the combinationdo not haveMiddle East<noscript><copyright"
+  "\" perhaps theinstitutionin Decemberarrangementmost famouspersonalitycreation oflimitationsexclusivelysovereignty-"
+  "content\">\012<td class=\"undergroundparallel todoctrine ofoccupied byterminologyRenaissancea number ofsupport for"
+  "explorationrecognitionpredecessor<img src=\"/<h1 class=\"publicationmay also bespecialized</fieldset>progressivemi"
+  "llions ofstates thatenforcementaround the one another.parentNodeagricultureAlternativeresearcherstowards theMost o"
+  "f themany other (especially<td width=\";width:100%independent<h3 class=\" onchange=\").addClass(interactionOne of "
+  "the daughter ofaccessoriesbranches of\015\012<div id=\"the largestdeclarationregulationsInformationtranslationdocu"
+  "mentaryin order to\">\012<head>\012<\" height=\"1across the orientation);</script>implementedcan be seenthere was "
+  "ademonstratecontainer\">connectionsthe Britishwas written!important;px; margin-followed byability to complicateddu"
+  "ring the immigrationalso called<h4 class=\"distinctionreplaced bygovernmentslocation ofin Novemberwhether the</p>"
+  "\012</div>acquisitioncalled the persecutiondesignation{font-size:appeared ininvestigateexperiencedmost likelywidel"
+  "y useddiscussionspresence of (document.extensivelyIt has beenit does notcontrary toinhabitantsimprovementscholarsh"
+  "ipconsumptioninstructionfor exampleone or morepx; paddingthe currenta series ofare usuallyrole in thepreviously de"
+  "rivativesevidence ofexperiencescolorschemestated thatcertificate</a></div>\012 selected=\"high schoolresponse toco"
+  "mfortableadoption ofthree yearsthe countryin Februaryso that thepeople who provided by<param nameaffected byin ter"
+  "ms ofappointmentISO-8859-1\"was born inhistorical regarded asmeasurementis based on and other : function(significa"
+  "ntcelebrationtransmitted/js/jquery.is known astheoretical tabindex=\"it could be<noscript>\012having been\015\012<"
+  "head>\015\012< &quot;The compilationhe had beenproduced byphilosopherconstructedintended toamong othercompared tot"
+  "o say thatEngineeringa differentreferred todifferencesbelief thatphotographsidentifyingHistory of Republic ofneces"
+  "sarilyprobabilitytechnicallyleaving thespectacularfraction ofelectricityhead of therestaurantspartnershipemphasis "
+  "onmost recentshare with saying thatfilled withdesigned toit is often\"></iframe>as follows:merged withthrough thec"
+  "ommercial pointed outopportunityview of therequirementdivision ofprogramminghe receivedsetInterval\"></span></in N"
+  "ew Yorkadditional compression\012\012<div id=\"incorporate;</script><attachEventbecame the \" target=\"_carried ou"
+  "tSome of thescience andthe time ofContainer\">maintainingChristopherMuch of thewritings of\" height=\"2size of the"
+  "version of mixture of between theExamples ofeducationalcompetitive onsubmit=\"director ofdistinctive/DTD XHTML rel"
+  "ating totendency toprovince ofwhich woulddespite thescientific legislature.innerHTML allegationsAgriculturewas use"
+  "d inapproach tointelligentyears later,sans-serifdeterminingPerformanceappearances, which is foundationsabbreviated"
+  "higher thans from the individual composed ofsupposed toclaims thatattributionfont-size:1elements ofHistorical his "
+  "brotherat the timeanniversarygoverned byrelated to ultimately innovationsit is stillcan only bedefinitionstoGMTStr"
+  "ingA number ofimg class=\"Eventually,was changedoccurred inneighboringdistinguishwhen he wasintroducingterrestrial"
+  "Many of theargues thatan Americanconquest ofwidespread were killedscreen and In order toexpected todescendantsare "
+  "locatedlegislativegenerations backgroundmost peopleyears afterthere is nothe highestfrequently they do notargued t"
+  "hatshowed thatpredominanttheologicalby the timeconsideringshort-lived</span></a>can be usedvery littleone of the h"
+  "ad alreadyinterpretedcommunicatefeatures ofgovernment,</noscript>entered the\" height=\"3Independentpopulationslar"
+  "ge-scale. Although used in thedestructionpossibilitystarting intwo or moreexpressionssubordinatelarger thanhistory"
+  " and</option>\015\012Continentaleliminatingwill not bepractice ofin front ofsite of theensure thatto create amissi"
+  "ssippipotentiallyoutstandingbetter thanwhat is nowsituated inmeta name=\"TraditionalsuggestionsTranslationthe form"
+  " ofatmosphericideologicalenterprisescalculatingeast of theremnants ofpluginspage/index.php\077remained intransform"
+  "edHe was alsowas alreadystatisticalin favor ofMinistry ofmovement offormulationis required<link rel=\"This is the "
+  "<a href=\"/popularizedinvolved inare used toand severalmade by theseems to belikely thatPalestiniannamed afterit h"
+  "ad beenmost commonto refer tobut this isconsecutivetemporarilyIn general,conventionstakes placesubdivisionterritor"
+  "ialoperationalpermanentlywas largelyoutbreak ofin the pastfollowing a xmlns:og=\"><a class=\"class=\"textConversio"
+  "n may be usedmanufactureafter beingclearfix\">\012question ofwas electedto become abecause of some peopleinspired "
+  "bysuccessful a time whenmore commonamongst thean officialwidth:100%;technology,was adoptedto keep thesettlementsli"
+  "ve birthsindex.html\"Connecticutassigned to&amp;times;account foralign=rightthe companyalways beenreturned toinvol"
+  "vementBecause thethis period\" name=\"q\" confined toa result ofvalue=\"\" />is actuallyEnvironment\015\012</head>"
+  "\015\012Conversely,>\012<div id=\"0\" width=\"1is probablyhave becomecontrollingthe problemcitizens ofpoliticiansr"
+  "eached theas early as:none; over<table cellvalidity ofdirectly toonmousedownwhere it iswhen it wasmembers of relat"
+  "ion toaccommodatealong with In the latethe Englishdelicious\">this is notthe presentif they areand finallya matter"
+  " of\015\012\011</div>\015\012\015\012</script>faster thanmajority ofafter whichcomparativeto maintainimprove theaw"
+  "arded theer\" class=\"frameborderrestorationin the sameanalysis oftheir firstDuring the continentalsequence offunc"
+  "tion(){font-size: work on the</script>\012<begins withjavascript:constituentwas foundedequilibriumassume thatis gi"
+  "ven byneeds to becoordinatesthe variousare part ofonly in thesections ofis a commontheories ofdiscoveriesassociati"
+  "onedge of thestrength ofposition inpresent-dayuniversallyto form thebut insteadcorporationattached tois commonlyre"
+  "asons for &quot;the can be madewas able towhich meansbut did notonMouseOveras possibleoperated bycoming fromthe pr"
+  "imaryaddition offor severaltransferreda period ofare able tohowever, itshould havemuch larger\012\011</script>adop"
+  "ted theproperty ofdirected byeffectivelywas broughtchildren ofProgramminglonger thanmanuscriptswar againstby means"
+  " ofand most ofsimilar to proprietaryoriginatingprestigiousgrammaticalexperience.to make theIt was alsois found inc"
+  "ompetitorsin the U.S.replace thebrought thecalculationfall of thethe generalpracticallyin honor ofreleased inresid"
+  "entialand some ofking of thereaction to1st Earl ofculture andprincipally</title>\012  they can beback to thesome o"
+  "f hisexposure toare similarform of theaddFavoritecitizenshippart in thepeople within practiceto continue&amp;minus"
+  ";approved by the first allowed theand for thefunctioningplaying thesolution toheight=\"0\" in his bookmore than af"
+  "ollows thecreated thepresence in&nbsp;</td>nationalistthe idea ofa characterwere forced class=\"btndays of thefeat"
+  "ured inshowing theinterest inin place ofturn of thethe head ofLord of thepoliticallyhas its ownEducationalapproval"
+  " ofsome of theeach other,behavior ofand becauseand anotherappeared onrecorded inblack&quot;may includethe world'sc"
+  "an lead torefers to aborder=\"0\" government winning theresulted in while the Washington,the subjectcity in the></"
+  "div>\015\012\011\011reflect theto completebecame moreradioactiverejected bywithout anyhis father,which couldcopy o"
+  "f theto indicatea politicalaccounts ofconstitutesworked wither</a></li>of his lifeaccompaniedclientWidthprevent th"
+  "eLegislativedifferentlytogether inhas severalfor anothertext of thefounded thee with the is used forchanged theusu"
+  "ally theplace wherewhereas the> <a href=\"\"><a href=\"themselves,although hethat can betraditionalrole of theas a"
+  " resultremoveChilddesigned bywest of theSome peopleproduction,side of thenewslettersused by thedown to theaccepted"
+  " bylive in theattempts tooutside thefrequenciesHowever, inprogrammersat least inapproximatealthough itwas part ofa"
+  "nd variousGovernor ofthe articleturned into><a href=\"/the economyis the mostmost widelywould laterand perhapsrise"
+  " to theoccurs whenunder whichconditions.the westerntheory thatis producedthe city ofin which heseen in thethe cent"
+  "ralbuilding ofmany of hisarea of theis the onlymost of themany of thethe WesternThere is noextended toStatisticalc"
+  "olspan=2 |short storypossible totopologicalcritical ofreported toa Christiandecision tois equal toproblems ofThis "
+  "can bemerchandisefor most ofno evidenceeditions ofelements in&quot;. Thecom/images/which makesthe processremains t"
+  "heliterature,is a memberthe popularthe ancientproblems intime of thedefeated bybody of thea few yearsmuch of theth"
+  "e work ofCalifornia,served as agovernment.concepts ofmovement in\011\011<div id=\"it\" value=\"language ofas they "
+  "areproduced inis that theexplain thediv></div>\012However thelead to the\011<a href=\"/was grantedpeople haveconti"
+  "nuallywas seen asand relatedthe role ofproposed byof the besteach other.Constantinepeople fromdialects ofto revisi"
+  "onwas renameda source ofthe initiallaunched inprovide theto the westwhere thereand similarbetween twois also theEn"
+  "glish andconditions,that it wasentitled tothemselves.quantity ofransparencythe same asto join thecountry andthis i"
+  "s theThis led toa statementcontrast tolastIndexOfthrough hisis designedthe term isis providedprotect theng</a></li"
+  ">The currentthe site ofsubstantialexperience,in the Westthey shouldsloven\304\215inacomentariosuniversidadcondicio"
+  "nesactividadesexperienciatecnolog\303\255aproducci\303\263npuntuaci\303\263naplicaci\303\263ncontrase\303\261acate"
+  "gor\303\255asregistrarseprofesionaltratamientoreg\303\255stratesecretar\303\255aprincipalesprotecci\303\263nimport"
+  "antesimportanciaposibilidadinteresantecrecimientonecesidadessuscribirseasociaci\303\263ndisponiblesevaluaci\303"
+  "\263nestudiantesresponsableresoluci\303\263nguadalajararegistradosoportunidadcomercialesfotograf\303\255aautoridad"
+  "esingenier\303\255atelevisi\303\263ncompetenciaoperacionesestablecidosimplementeactualmentenavegaci\303\263nconfor"
+  "midadline-height:font-family:\" : \"http://applicationslink\" href=\"specifically//<![CDATA[\012Organizationdistri"
+  "bution0px; height:relationshipdevice-width<div class=\"<label for=\"registration</noscript>\012/index.html\"window"
+  ".open( !important;application/independence//www.googleorganizationautocompleterequirementsconservative<form name="
+  "\"intellectualmargin-left:18th centuryan importantinstitutionsabbreviation<img class=\"organisationcivilization19t"
+  "h centuryarchitectureincorporated20th century-container\">most notably/></a></div>notification'undefined')Furtherm"
+  "ore,believe thatinnerHTML = prior to thedramaticallyreferring tonegotiationsheadquartersSouth AfricaunsuccessfulPe"
+  "nnsylvaniaAs a result,<html lang=\"&lt;/sup&gt;dealing withphiladelphiahistorically);</script>\012padding-top:expe"
+  "rimentalgetAttributeinstructionstechnologiespart of the =function(){subscriptionl.dtd\">\015\012<htgeographicalCon"
+  "stitution', function(supported byagriculturalconstructionpublicationsfont-size: 1a variety of<div style=\"Encyclop"
+  "ediaiframe src=\"demonstratedaccomplisheduniversitiesDemographics);</script><dedicated toknowledge ofsatisfactionp"
+  "articularly</div></div>English (US)appendChild(transmissions. However, intelligence\" tabindex=\"float:right;Commo"
+  "nwealthranging fromin which theat least onereproductionencyclopedia;font-size:1jurisdictionat that time\"><a class"
+  "=\"In addition,description+conversationcontact withis generallyr\" content=\"representing&lt;math&gt;presentationo"
+  "ccasionally<img width=\"navigation\">compensationchampionshipmedia=\"all\" violation ofreference toreturn true;Str"
+  "ict//EN\" transactionsinterventionverificationInformation difficultiesChampionshipcapabilities<![endif]-->}\012</s"
+  "cript>\012Christianityfor example,Professionalrestrictionssuggest thatwas released(such as theremoveClass(unemploy"
+  "mentthe Americanstructure of/index.html published inspan class=\"\"><a href=\"/introductionbelonging toclaimed tha"
+  "tconsequences<meta name=\"Guide to theoverwhelmingagainst the concentrated,\012.nontouch observations</a>\012</div"
+  ">\012f (document.border: 1px {font-size:1treatment of0\" height=\"1modificationIndependencedivided intogreater tha"
+  "nachievementsestablishingJavaScript\" neverthelesssignificanceBroadcasting>&nbsp;</td>container\">\012such as the "
+  "influence ofa particularsrc='http://navigation\" half of the substantial &nbsp;</div>advantage ofdiscovery offunda"
+  "mental metropolitanthe opposite\" xml:lang=\"deliberatelyalign=centerevolution ofpreservationimprovementsbeginning"
+  " inJesus ChristPublicationsdisagreementtext-align:r, function()similaritiesbody></html>is currentlyalphabeticalis "
+  "sometimestype=\"image/many of the flow:hidden;available indescribe theexistence ofall over thethe Internet\011<ul "
+  "class=\"installationneighborhoodarmed forcesreducing thecontinues toNonetheless,temperatures\012\011\011<a href=\""
+  "close to theexamples of is about the(see below).\" id=\"searchprofessionalis availablethe official\011\011</script"
+  ">\012\012\011\011<div id=\"accelerationthrough the Hall of Famedescriptionstranslationsinterference type='text/rec"
+  "ent yearsin the worldvery popular{background:traditional some of the connected toexploitationemergence ofconstitut"
+  "ionA History ofsignificant manufacturedexpectations><noscript><can be foundbecause the has not beenneighbouringwit"
+  "hout the added to the\011<li class=\"instrumentalSoviet Unionacknowledgedwhich can bename for theattention toattem"
+  "pts to developmentsIn fact, the<li class=\"aimplicationssuitable formuch of the colonizationpresidentialcancelBubb"
+  "le Informationmost of the is describedrest of the more or lessin SeptemberIntelligencesrc=\"http://px; height: ava"
+  "ilable tomanufacturerhuman rightslink href=\"/availabilityproportionaloutside the astronomicalhuman beingsname of "
+  "the are found inare based onsmaller thana person whoexpansion ofarguing thatnow known asIn the earlyintermediatede"
+  "rived fromScandinavian</a></div>\015\012consider thean estimatedthe National<div id=\"pagresulting incommissioneda"
+  "nalogous toare required/ul>\012</div>\012was based onand became a&nbsp;&nbsp;t\" value=\"\" was capturedno more th"
+  "anrespectivelycontinue to >\015\012<head>\015\012<were createdmore generalinformation used for theindependent the "
+  "Imperialcomponent ofto the northinclude the Constructionside of the would not befor instanceinvention ofmore compl"
+  "excollectivelybackground: text-align: its originalinto accountthis processan extensivehowever, thethey are notreje"
+  "cted thecriticism ofduring whichprobably thethis article(function(){It should bean agreementaccidentallydiffers fr"
+  "omArchitecturebetter knownarrangementsinfluence onattended theidentical tosouth of thepass throughxml\" title=\"we"
+  "ight:bold;creating thedisplay:nonereplaced the<img src=\"/ihttps://www.World War IItestimonialsfound in therequire"
+  "d to and that thebetween the was designedconsists of considerablypublished bythe languageConservationconsisted ofr"
+  "efer to theback to the css\" media=\"People from available onproved to besuggestions\"was known asvarieties oflike"
+  "ly to becomprised ofsupport the hands of thecoupled withconnect and border:none;performancesbefore beinglater beca"
+  "mecalculationsoften calledresidents ofmeaning that><li class=\"evidence forexplanationsenvironments\"></a></div>wh"
+  "ich allowsIntroductiondeveloped bya wide rangeon behalf ofvalign=\"top\"principle ofat the time,</noscript>\015sai"
+  "d to havein the firstwhile othershypotheticalphilosopherspower of thecontained inperformed byinability towere writ"
+  "tenspan style=\"input name=\"the questionintended forrejection ofimplies thatinvented thethe standardwas probablyl"
+  "ink betweenprofessor ofinteractionschanging theIndian Ocean class=\"lastworking with'http://www.years beforeThis w"
+  "as therecreationalentering themeasurementsan extremelyvalue of thestart of the\012</script>\012\012an effort toinc"
+  "rease theto the southspacing=\"0\">sufficientlythe Europeanconverted toclearTimeoutdid not haveconsequentlyfor the"
+  " nextextension ofeconomic andalthough theare producedand with theinsufficientgiven by thestating thatexpenditures<"
+  "/span></a>\012thought thaton the basiscellpadding=image of thereturning toinformation,separated byassassinateds\" "
+  "content=\"authority ofnorthwestern</div>\012<div \"></div>\015\012  consultationcommunity ofthe nationalit should "
+  "beparticipants align=\"leftthe greatestselection ofsupernaturaldependent onis mentionedallowing thewas inventedacc"
+  "ompanyinghis personalavailable atstudy of theon the otherexecution ofHuman Rightsterms of theassociationsresearch "
+  "andsucceeded bydefeated theand from thebut they arecommander ofstate of theyears of agethe study of<ul class=\"spl"
+  "ace in thewhere he was<li class=\"fthere are nowhich becamehe publishedexpressed into which thecommissionerfont-we"
+  "ight:territory ofextensions\">Roman Empireequal to theIn contrast,however, andis typicallyand his wife(also called"
+  "><ul class=\"effectively evolved intoseem to havewhich is thethere was noan excellentall of thesedescribed byIn pr"
+  "actice,broadcastingcharged withreflected insubjected tomilitary andto the pointeconomicallysetTargetingare actuall"
+  "yvictory over();</script>continuouslyrequired forevolutionaryan effectivenorth of the, which was front of theor ot"
+  "herwisesome form ofhad not beengenerated byinformation.permitted toincludes thedevelopment,entered intothe previou"
+  "sconsistentlyare known asthe field ofthis type ofgiven to thethe title ofcontains theinstances ofin the northdue t"
+  "o theirare designedcorporationswas that theone of thesemore popularsucceeded insupport fromin differentdominated b"
+  "ydesigned forownership ofand possiblystandardizedresponseTextwas intendedreceived theassumed thatareas of theprima"
+  "rily inthe basis ofin the senseaccounts fordestroyed byat least twowas declaredcould not beSecretary ofappear to b"
+  "emargin-top:1/^\\s+|\\s+$/ge){throw e};the start oftwo separatelanguage andwho had beenoperation ofdeath of therea"
+  "l numbers\011<link rel=\"provided thethe story ofcompetitionsenglish (UK)english (US)\320\234\320\276\320\275\320"
+  "\263\320\276\320\273\320\241\321\200\320\277\321\201\320\272\320\270\321\201\321\200\320\277\321\201\320\272\320"
+  "\270\321\201\321\200\320\277\321\201\320\272\320\276\331\204\330\271\330\261\330\250\331\212\330\251\346\255\243"
+  "\351\253\224\344\270\255\346\226\207\347\256\200\344\275\223\344\270\255\346\226\207\347\271\201\344\275\223\344"
+  "\270\255\346\226\207\346\234\211\351\231\220\345\205\254\345\217\270\344\272\272\346\260\221\346\224\277\345\272"
+  "\234\351\230\277\351\207\214\345\267\264\345\267\264\347\244\276\344\274\232\344\270\273\344\271\211\346\223\215"
+  "\344\275\234\347\263\273\347\273\237\346\224\277\347\255\226\346\263\225\350\247\204informaci\303\263nherramientas"
+  "electr\303\263nicodescripci\303\263nclasificadosconocimientopublicaci\303\263nrelacionadasinform\303\241ticarelaci"
+  "onadosdepartamentotrabajadoresdirectamenteayuntamientomercadoLibrecont\303\241ctenoshabitacionescumplimientorestau"
+  "rantesdisposici\303\263nconsecuenciaelectr\303\263nicaaplicacionesdesconectadoinstalaci\303\263nrealizaci\303\263n"
+  "utilizaci\303\263nenciclopediaenfermedadesinstrumentosexperienciasinstituci\303\263nparticularessubcategoria\321"
+  "\202\320\276\320\273\321\214\320\272\320\276\320\240\320\276\321\201\321\201\320\270\320\270\321\200\320\260\320"
+  "\261\320\276\321\202\321\213\320\261\320\276\320\273\321\214\321\210\320\265\320\277\321\200\320\276\321\201\321"
+  "\202\320\276\320\274\320\276\320\266\320\265\321\202\320\265\320\264\321\200\321\203\320\263\320\270\321\205\321"
+  "\201\320\273\321\203\321\207\320\260\320\265\321\201\320\265\320\271\321\207\320\260\321\201\320\262\321\201\320"
+  "\265\320\263\320\264\320\260\320\240\320\276\321\201\321\201\320\270\321\217\320\234\320\276\321\201\320\272\320"
+  "\262\320\265\320\264\321\200\321\203\320\263\320\270\320\265\320\263\320\276\321\200\320\276\320\264\320\260\320"
+  "\262\320\276\320\277\321\200\320\276\321\201\320\264\320\260\320\275\320\275\321\213\321\205\320\264\320\276\320"
+  "\273\320\266\320\275\321\213\320\270\320\274\320\265\320\275\320\275\320\276\320\234\320\276\321\201\320\272\320"
+  "\262\321\213\321\200\321\203\320\261\320\273\320\265\320\271\320\234\320\276\321\201\320\272\320\262\320\260\321"
+  "\201\321\202\321\200\320\260\320\275\321\213\320\275\320\270\321\207\320\265\320\263\320\276\321\200\320\260\320"
+  "\261\320\276\321\202\320\265\320\264\320\276\320\273\320\266\320\265\320\275\321\203\321\201\320\273\321\203\320"
+  "\263\320\270\321\202\320\265\320\277\320\265\321\200\321\214\320\236\320\264\320\275\320\260\320\272\320\276\320"
+  "\277\320\276\321\202\320\276\320\274\321\203\321\200\320\260\320\261\320\276\321\202\321\203\320\260\320\277\321"
+  "\200\320\265\320\273\321\217\320\262\320\276\320\276\320\261\321\211\320\265\320\276\320\264\320\275\320\276\320"
+  "\263\320\276\321\201\320\262\320\276\320\265\320\263\320\276\321\201\321\202\320\260\321\202\321\214\320\270\320"
+  "\264\321\200\321\203\320\263\320\276\320\271\321\204\320\276\321\200\321\203\320\274\320\265\321\205\320\276\321"
+  "\200\320\276\321\210\320\276\320\277\321\200\320\276\321\202\320\270\320\262\321\201\321\201\321\213\320\273\320"
+  "\272\320\260\320\272\320\260\320\266\320\264\321\213\320\271\320\262\320\273\320\260\321\201\321\202\320\270\320"
+  "\263\321\200\321\203\320\277\320\277\321\213\320\262\320\274\320\265\321\201\321\202\320\265\321\200\320\260\320"
+  "\261\320\276\321\202\320\260\321\201\320\272\320\260\320\267\320\260\320\273\320\277\320\265\321\200\320\262\321"
+  "\213\320\271\320\264\320\265\320\273\320\260\321\202\321\214\320\264\320\265\320\275\321\214\320\263\320\270\320"
+  "\277\320\265\321\200\320\270\320\276\320\264\320\261\320\270\320\267\320\275\320\265\321\201\320\276\321\201\320"
+  "\275\320\276\320\262\320\265\320\274\320\276\320\274\320\265\320\275\321\202\320\272\321\203\320\277\320\270\321"
+  "\202\321\214\320\264\320\276\320\273\320\266\320\275\320\260\321\200\320\260\320\274\320\272\320\260\321\205\320"
+  "\275\320\260\321\207\320\260\320\273\320\276\320\240\320\260\320\261\320\276\321\202\320\260\320\242\320\276\320"
+  "\273\321\214\320\272\320\276\321\201\320\276\320\262\321\201\320\265\320\274\320\262\321\202\320\276\321\200\320"
+  "\276\320\271\320\275\320\260\321\207\320\260\320\273\320\260\321\201\320\277\320\270\321\201\320\276\320\272\321"
+  "\201\320\273\321\203\320\266\320\261\321\213\321\201\320\270\321\201\321\202\320\265\320\274\320\277\320\265\321"
+  "\207\320\260\321\202\320\270\320\275\320\276\320\262\320\276\320\263\320\276\320\277\320\276\320\274\320\276\321"
+  "\211\320\270\321\201\320\260\320\271\321\202\320\276\320\262\320\277\320\276\321\207\320\265\320\274\321\203\320"
+  "\277\320\276\320\274\320\276\321\211\321\214\320\264\320\276\320\273\320\266\320\275\320\276\321\201\321\201\321"
+  "\213\320\273\320\272\320\270\320\261\321\213\321\201\321\202\321\200\320\276\320\264\320\260\320\275\320\275\321"
+  "\213\320\265\320\274\320\275\320\276\320\263\320\270\320\265\320\277\321\200\320\276\320\265\320\272\321\202\320"
+  "\241\320\265\320\271\321\207\320\260\321\201\320\274\320\276\320\264\320\265\320\273\320\270\321\202\320\260\320"
+  "\272\320\276\320\263\320\276\320\276\320\275\320\273\320\260\320\271\320\275\320\263\320\276\321\200\320\276\320"
+  "\264\320\265\320\262\320\265\321\200\321\201\320\270\321\217\321\201\321\202\321\200\320\260\320\275\320\265\321"
+  "\204\320\270\320\273\321\214\320\274\321\213\321\203\321\200\320\276\320\262\320\275\321\217\321\200\320\260\320"
+  "\267\320\275\321\213\321\205\320\270\321\201\320\272\320\260\321\202\321\214\320\275\320\265\320\264\320\265\320"
+  "\273\321\216\321\217\320\275\320\262\320\260\321\200\321\217\320\274\320\265\320\275\321\214\321\210\320\265\320"
+  "\274\320\275\320\276\320\263\320\270\321\205\320\264\320\260\320\275\320\275\320\276\320\271\320\267\320\275\320"
+  "\260\321\207\320\270\321\202\320\275\320\265\320\273\321\214\320\267\321\217\321\204\320\276\321\200\321\203\320"
+  "\274\320\260\320\242\320\265\320\277\320\265\321\200\321\214\320\274\320\265\321\201\321\217\321\206\320\260\320"
+  "\267\320\260\321\211\320\270\321\202\321\213\320\233\321\203\321\207\321\210\320\270\320\265\340\244\250\340\244"
+  "\271\340\245\200\340\244\202\340\244\225\340\244\260\340\244\250\340\245\207\340\244\205\340\244\252\340\244\250"
+  "\340\245\207\340\244\225\340\244\277\340\244\257\340\244\276\340\244\225\340\244\260\340\245\207\340\244\202\340"
+  "\244\205\340\244\250\340\245\215\340\244\257\340\244\225\340\245\215\340\244\257\340\244\276\340\244\227\340\244"
+  "\276\340\244\207\340\244\241\340\244\254\340\244\276\340\244\260\340\245\207\340\244\225\340\244\277\340\244\270"
+  "\340\245\200\340\244\246\340\244\277\340\244\257\340\244\276\340\244\252\340\244\271\340\244\262\340\245\207\340"
+  "\244\270\340\244\277\340\244\202\340\244\271\340\244\255\340\244\276\340\244\260\340\244\244\340\244\205\340\244"
+  "\252\340\244\250\340\245\200\340\244\265\340\244\276\340\244\262\340\245\207\340\244\270\340\245\207\340\244\265"
+  "\340\244\276\340\244\225\340\244\260\340\244\244\340\245\207\340\244\256\340\245\207\340\244\260\340\245\207\340"
+  "\244\271\340\245\213\340\244\250\340\245\207\340\244\270\340\244\225\340\244\244\340\245\207\340\244\254\340\244"
+  "\271\340\245\201\340\244\244\340\244\270\340\244\276\340\244\207\340\244\237\340\244\271\340\245\213\340\244\227"
+  "\340\244\276\340\244\234\340\244\276\340\244\250\340\245\207\340\244\256\340\244\277\340\244\250\340\244\237\340"
+  "\244\225\340\244\260\340\244\244\340\244\276\340\244\225\340\244\260\340\244\250\340\244\276\340\244\211\340\244"
+  "\250\340\244\225\340\245\207\340\244\257\340\244\271\340\244\276\340\244\201\340\244\270\340\244\254\340\244\270"
+  "\340\245\207\340\244\255\340\244\276\340\244\267\340\244\276\340\244\206\340\244\252\340\244\225\340\245\207\340"
+  "\244\262\340\244\277\340\244\257\340\245\207\340\244\266\340\245\201\340\244\260\340\245\202\340\244\207\340\244"
+  "\270\340\244\225\340\245\207\340\244\230\340\244\202\340\244\237\340\245\207\340\244\256\340\245\207\340\244\260"
+  "\340\245\200\340\244\270\340\244\225\340\244\244\340\244\276\340\244\256\340\245\207\340\244\260\340\244\276\340"
+  "\244\262\340\245\207\340\244\225\340\244\260\340\244\205\340\244\247\340\244\277\340\244\225\340\244\205\340\244"
+  "\252\340\244\250\340\244\276\340\244\270\340\244\256\340\244\276\340\244\234\340\244\256\340\245\201\340\244\235"
+  "\340\245\207\340\244\225\340\244\276\340\244\260\340\244\243\340\244\271\340\245\213\340\244\244\340\244\276\340"
+  "\244\225\340\244\241\340\244\274\340\245\200\340\244\257\340\244\271\340\244\276\340\244\202\340\244\271\340\245"
+  "\213\340\244\237\340\244\262\340\244\266\340\244\254\340\245\215\340\244\246\340\244\262\340\244\277\340\244\257"
+  "\340\244\276\340\244\234\340\245\200\340\244\265\340\244\250\340\244\234\340\244\276\340\244\244\340\244\276\340"
+  "\244\225\340\245\210\340\244\270\340\245\207\340\244\206\340\244\252\340\244\225\340\244\276\340\244\265\340\244"
+  "\276\340\244\262\340\245\200\340\244\246\340\245\207\340\244\250\340\245\207\340\244\252\340\245\202\340\244\260"
+  "\340\245\200\340\244\252\340\244\276\340\244\250\340\245\200\340\244\211\340\244\270\340\244\225\340\245\207\340"
+  "\244\271\340\245\213\340\244\227\340\245\200\340\244\254\340\245\210\340\244\240\340\244\225\340\244\206\340\244"
+  "\252\340\244\225\340\245\200\340\244\265\340\244\260\340\245\215\340\244\267\340\244\227\340\244\276\340\244\202"
+  "\340\244\265\340\244\206\340\244\252\340\244\225\340\245\213\340\244\234\340\244\277\340\244\262\340\244\276\340"
+  "\244\234\340\244\276\340\244\250\340\244\276\340\244\270\340\244\271\340\244\256\340\244\244\340\244\271\340\244"
+  "\256\340\245\207\340\244\202\340\244\211\340\244\250\340\244\225\340\245\200\340\244\257\340\244\276\340\244\271"
+  "\340\245\202\340\244\246\340\244\260\340\245\215\340\244\234\340\244\270\340\245\202\340\244\232\340\245\200\340"
+  "\244\252\340\244\270\340\244\202\340\244\246\340\244\270\340\244\265\340\244\276\340\244\262\340\244\271\340\245"
+  "\213\340\244\250\340\244\276\340\244\271\340\245\213\340\244\244\340\245\200\340\244\234\340\245\210\340\244\270"
+  "\340\245\207\340\244\265\340\244\276\340\244\252\340\244\270\340\244\234\340\244\250\340\244\244\340\244\276\340"
+  "\244\250\340\245\207\340\244\244\340\244\276\340\244\234\340\244\276\340\244\260\340\245\200\340\244\230\340\244"
+  "\276\340\244\257\340\244\262\340\244\234\340\244\277\340\244\262\340\245\207\340\244\250\340\245\200\340\244\232"
+  "\340\245\207\340\244\234\340\244\276\340\244\202\340\244\232\340\244\252\340\244\244\340\245\215\340\244\260\340"
+  "\244\227\340\245\202\340\244\227\340\244\262\340\244\234\340\244\276\340\244\244\340\245\207\340\244\254\340\244"
+  "\276\340\244\271\340\244\260\340\244\206\340\244\252\340\244\250\340\245\207\340\244\265\340\244\276\340\244\271"
+  "\340\244\250\340\244\207\340\244\270\340\244\225\340\244\276\340\244\270\340\245\201\340\244\254\340\244\271\340"
+  "\244\260\340\244\271\340\244\250\340\245\207\340\244\207\340\244\270\340\244\270\340\245\207\340\244\270\340\244"
+  "\271\340\244\277\340\244\244\340\244\254\340\244\241\340\244\274\340\245\207\340\244\230\340\244\237\340\244\250"
+  "\340\244\276\340\244\244\340\244\262\340\244\276\340\244\266\340\244\252\340\244\276\340\244\202\340\244\232\340"
+  "\244\266\340\245\215\340\244\260\340\245\200\340\244\254\340\244\241\340\244\274\340\245\200\340\244\271\340\245"
+  "\213\340\244\244\340\245\207\340\244\270\340\244\276\340\244\210\340\244\237\340\244\266\340\244\276\340\244\257"
+  "\340\244\246\340\244\270\340\244\225\340\244\244\340\245\200\340\244\234\340\244\276\340\244\244\340\245\200\340"
+  "\244\265\340\244\276\340\244\262\340\244\276\340\244\271\340\244\234\340\244\276\340\244\260\340\244\252\340\244"
+  "\237\340\244\250\340\244\276\340\244\260\340\244\226\340\244\250\340\245\207\340\244\270\340\244\241\340\244\274"
+  "\340\244\225\340\244\256\340\244\277\340\244\262\340\244\276\340\244\211\340\244\270\340\244\225\340\245\200\340"
+  "\244\225\340\245\207\340\244\265\340\244\262\340\244\262\340\244\227\340\244\244\340\244\276\340\244\226\340\244"
+  "\276\340\244\250\340\244\276\340\244\205\340\244\260\340\245\215\340\244\245\340\244\234\340\244\271\340\244\276"
+  "\340\244\202\340\244\246\340\245\207\340\244\226\340\244\276\340\244\252\340\244\271\340\244\262\340\245\200\340"
+  "\244\250\340\244\277\340\244\257\340\244\256\340\244\254\340\244\277\340\244\250\340\244\276\340\244\254\340\245"
+  "\210\340\244\202\340\244\225\340\244\225\340\244\271\340\245\200\340\244\202\340\244\225\340\244\271\340\244\250"
+  "\340\244\276\340\244\246\340\245\207\340\244\244\340\244\276\340\244\271\340\244\256\340\244\262\340\245\207\340"
+  "\244\225\340\244\276\340\244\253\340\245\200\340\244\234\340\244\254\340\244\225\340\244\277\340\244\244\340\245"
+  "\201\340\244\260\340\244\244\340\244\256\340\244\276\340\244\202\340\244\227\340\244\265\340\244\271\340\245\200"
+  "\340\244\202\340\244\260\340\245\213\340\244\234\340\244\274\340\244\256\340\244\277\340\244\262\340\245\200\340"
+  "\244\206\340\244\260\340\245\213\340\244\252\340\244\270\340\245\207\340\244\250\340\244\276\340\244\257\340\244"
+  "\276\340\244\246\340\244\265\340\244\262\340\245\207\340\244\250\340\245\207\340\244\226\340\244\276\340\244\244"
+  "\340\244\276\340\244\225\340\244\260\340\245\200\340\244\254\340\244\211\340\244\250\340\244\225\340\244\276\340"
+  "\244\234\340\244\265\340\244\276\340\244\254\340\244\252\340\245\202\340\244\260\340\244\276\340\244\254\340\244"
+  "\241\340\244\274\340\244\276\340\244\270\340\245\214\340\244\246\340\244\276\340\244\266\340\245\207\340\244\257"
+  "\340\244\260\340\244\225\340\244\277\340\244\257\340\245\207\340\244\225\340\244\271\340\244\276\340\244\202\340"
+  "\244\205\340\244\225\340\244\270\340\244\260\340\244\254\340\244\250\340\244\276\340\244\217\340\244\265\340\244"
+  "\271\340\244\276\340\244\202\340\244\270\340\245\215\340\244\245\340\244\262\340\244\256\340\244\277\340\244\262"
+  "\340\245\207\340\244\262\340\245\207\340\244\226\340\244\225\340\244\265\340\244\277\340\244\267\340\244\257\340"
+  "\244\225\340\245\215\340\244\260\340\244\202\340\244\270\340\244\256\340\245\202\340\244\271\340\244\245\340\244"
+  "\276\340\244\250\340\244\276\330\252\330\263\330\252\330\267\331\212\330\271\331\205\330\264\330\247\330\261\331"
+  "\203\330\251\330\250\331\210\330\247\330\263\330\267\330\251\330\247\331\204\330\265\331\201\330\255\330\251\331"
+  "\205\331\210\330\247\330\266\331\212\330\271\330\247\331\204\330\256\330\247\330\265\330\251\330\247\331\204\331"
+  "\205\330\262\331\212\330\257\330\247\331\204\330\271\330\247\331\205\330\251\330\247\331\204\331\203\330\247\330"
+  "\252\330\250\330\247\331\204\330\261\330\257\331\210\330\257\330\250\330\261\331\206\330\247\331\205\330\254\330"
+  "\247\331\204\330\257\331\210\331\204\330\251\330\247\331\204\330\271\330\247\331\204\331\205\330\247\331\204\331"
+  "\205\331\210\331\202\330\271\330\247\331\204\330\271\330\261\330\250\331\212\330\247\331\204\330\263\330\261\331"
+  "\212\330\271\330\247\331\204\330\254\331\210\330\247\331\204\330\247\331\204\330\260\331\207\330\247\330\250\330"
+  "\247\331\204\330\255\331\212\330\247\330\251\330\247\331\204\330\255\331\202\331\210\331\202\330\247\331\204\331"
+  "\203\330\261\331\212\331\205\330\247\331\204\330\271\330\261\330\247\331\202\331\205\330\255\331\201\331\210\330"
+  "\270\330\251\330\247\331\204\330\253\330\247\331\206\331\212\331\205\330\264\330\247\331\207\330\257\330\251\330"
+  "\247\331\204\331\205\330\261\330\243\330\251\330\247\331\204\331\202\330\261\330\242\331\206\330\247\331\204\330"
+  "\264\330\250\330\247\330\250\330\247\331\204\330\255\331\210\330\247\330\261\330\247\331\204\330\254\330\257\331"
+  "\212\330\257\330\247\331\204\330\243\330\263\330\261\330\251\330\247\331\204\330\271\331\204\331\210\331\205\331"
+  "\205\330\254\331\205\331\210\330\271\330\251\330\247\331\204\330\261\330\255\331\205\331\206\330\247\331\204\331"
+  "\206\331\202\330\247\330\267\331\201\331\204\330\263\330\267\331\212\331\206\330\247\331\204\331\203\331\210\331"
+  "\212\330\252\330\247\331\204\330\257\331\206\331\212\330\247\330\250\330\261\331\203\330\247\330\252\331\207\330"
+  "\247\331\204\330\261\331\212\330\247\330\266\330\252\330\255\331\212\330\247\330\252\331\212\330\250\330\252\331"
+  "\210\331\202\331\212\330\252\330\247\331\204\330\243\331\210\331\204\331\211\330\247\331\204\330\250\330\261\331"
+  "\212\330\257\330\247\331\204\331\203\331\204\330\247\331\205\330\247\331\204\330\261\330\247\330\250\330\267\330"
+  "\247\331\204\330\264\330\256\330\265\331\212\330\263\331\212\330\247\330\261\330\247\330\252\330\247\331\204\330"
+  "\253\330\247\331\204\330\253\330\247\331\204\330\265\331\204\330\247\330\251\330\247\331\204\330\255\330\257\331"
+  "\212\330\253\330\247\331\204\330\262\331\210\330\247\330\261\330\247\331\204\330\256\331\204\331\212\330\254\330"
+  "\247\331\204\330\254\331\205\331\212\330\271\330\247\331\204\330\271\330\247\331\205\331\207\330\247\331\204\330"
+  "\254\331\205\330\247\331\204\330\247\331\204\330\263\330\247\330\271\330\251\331\205\330\264\330\247\331\207\330"
+  "\257\331\207\330\247\331\204\330\261\330\246\331\212\330\263\330\247\331\204\330\257\330\256\331\210\331\204\330"
+  "\247\331\204\331\201\331\206\331\212\330\251\330\247\331\204\331\203\330\252\330\247\330\250\330\247\331\204\330"
+  "\257\331\210\330\261\331\212\330\247\331\204\330\257\330\261\331\210\330\263\330\247\330\263\330\252\330\272\330"
+  "\261\331\202\330\252\330\265\330\247\331\205\331\212\331\205\330\247\331\204\330\250\331\206\330\247\330\252\330"
+  "\247\331\204\330\271\330\270\331\212\331\205entertainmentunderstanding = function().jpg\" width=\"configuration.pn"
+  "g\" width=\"<body class=\"Math.random()contemporary United Statescircumstances.appendChild(organizations<span clas"
+  "s=\"\"><img src=\"/distinguishedthousands of communicationclear\"></div>investigationfavicon.ico\" margin-right:ba"
+  "sed on the Massachusettstable border=internationalalso known aspronunciationbackground:#fpadding-left:For example,"
+  " miscellaneous&lt;/math&gt;psychologicalin particularearch\" type=\"form method=\"as opposed toSupreme Courtoccasi"
+  "onally Additionally,North Americapx;backgroundopportunitiesEntertainment.toLowerCase(manufacturingprofessional com"
+  "bined withFor instance,consisting of\" maxlength=\"return false;consciousnessMediterraneanextraordinaryassassinati"
+  "onsubsequently button type=\"the number ofthe original comprehensiverefers to the</ul>\012</div>\012philosophicall"
+  "ocation.hrefwas publishedSan Francisco(function(){\012<div id=\"mainsophisticatedmathematical /head>\015\012<bodys"
+  "uggests thatdocumentationconcentrationrelationshipsmay have been(for example,This article in some casesparts of th"
+  "e definition ofGreat Britain cellpadding=equivalent toplaceholder=\"; font-size: justificationbelieved thatsuffere"
+  "d fromattempted to leader of thecript\" src=\"/(function() {are available\012\011<link rel=\" src='http://interest"
+  "ed inconventional \" alt=\"\" /></are generallyhas also beenmost popular correspondingcredited withtyle=\"border:<"
+  "/a></span></.gif\" width=\"<iframe src=\"table class=\"inline-block;according to together withapproximatelyparliam"
+  "entarymore and moredisplay:none;traditionallypredominantly&nbsp;|&nbsp;&nbsp;</span> cellspacing=<input name=\"or"
+  "\" content=\"controversialproperty=\"og:/x-shockwave-demonstrationsurrounded byNevertheless,was the firstconsidera"
+  "ble Although the collaborationshould not beproportion of<span style=\"known as the shortly afterfor instance,descr"
+  "ibed as /head>\012<body starting withincreasingly the fact thatdiscussion ofmiddle of thean individualdifficult to"
+  " point of viewhomosexualityacceptance of</span></div>manufacturersorigin of thecommonly usedimportance ofdenominat"
+  "ionsbackground: #length of thedeterminationa significant\" border=\"0\">revolutionaryprinciples ofis consideredwas"
+  " developedIndo-Europeanvulnerable toproponents ofare sometimescloser to theNew York City name=\"searchattributed t"
+  "ocourse of themathematicianby the end ofat the end of\" border=\"0\" technological.removeClass(branch of theeviden"
+  "ce that![endif]-->\015\012Institute of into a singlerespectively.and thereforeproperties ofis located insome of wh"
+  "ichThere is alsocontinued to appearance of &amp;ndash; describes theconsiderationauthor of theindependentlyequippe"
+  "d withdoes not have</a><a href=\"confused with<link href=\"/at the age ofappear in theThese includeregardless ofco"
+  "uld be used style=&quot;several timesrepresent thebody>\012</html>thought to bepopulation ofpossibilitiespercentag"
+  "e ofaccess to thean attempt toproduction ofjquery/jquerytwo differentbelong to theestablishmentreplacing thedescri"
+  "ption\" determine theavailable forAccording to wide range of\011<div class=\"more commonlyorganisationsfunctionali"
+  "tywas completed &amp;mdash; participationthe characteran additionalappears to befact that thean example ofsignific"
+  "antlyonmouseover=\"because they async = true;problems withseems to havethe result of src=\"http://familiar withpos"
+  "session offunction () {took place inand sometimessubstantially<span></span>is often usedin an attemptgreat deal of"
+  "Environmentalsuccessfully virtually all20th century,professionalsnecessary to determined bycompatibilitybecause it"
+  " isDictionary ofmodificationsThe followingmay refer to:Consequently,Internationalalthough somethat would beworld's"
+  " firstclassified asbottom of the(particularlyalign=\"left\" most commonlybasis for thefoundation ofcontributionspo"
+  "pularity ofcenter of theto reduce thejurisdictionsapproximation onmouseout=\"New Testamentcollection of</span></a>"
+  "</in the Unitedfilm director-strict.dtd\">has been usedreturn to thealthough thischange in theseveral otherbut the"
+  "re areunprecedentedis similar toespecially inweight: bold;is called thecomputationalindicate thatrestricted to\011"
+  "<meta name=\"are typicallyconflict withHowever, the An example ofcompared withquantities ofrather than aconstellat"
+  "ionnecessary forreported thatspecificationpolitical and&nbsp;&nbsp;<references tothe same yearGovernment ofgenerat"
+  "ion ofhave not beenseveral yearscommitment to\011\011<ul class=\"visualization19th century,practitionersthat he wo"
+  "uldand continuedoccupation ofis defined ascentre of thethe amount of><div style=\"equivalent ofdifferentiatebrough"
+  "t aboutmargin-left: automaticallythought of asSome of these\012<div class=\"input class=\"replaced withis one of t"
+  "heeducation andinfluenced byreputation as\012<meta name=\"accommodation</div>\012</div>large part ofInstitute fort"
+  "he so-called against the In this case,was appointedclaimed to beHowever, thisDepartment ofthe remainingeffect on t"
+  "heparticularly deal with the\012<div style=\"almost alwaysare currentlyexpression ofphilosophy offor more thancivi"
+  "lizationson the islandselectedIndexcan result in\" value=\"\" />the structure /></a></div>Many of thesecaused by t"
+  "heof the Unitedspan class=\"mcan be tracedis related tobecame one ofis frequentlyliving in thetheoreticallyFollowi"
+  "ng theRevolutionarygovernment inis determinedthe politicalintroduced insufficient todescription\">short storiessep"
+  "aration ofas to whetherknown for itswas initiallydisplay:blockis an examplethe principalconsists of arecognized as"
+  "/body></html>a substantialreconstructedhead of stateresistance toundergraduateThere are twogravitationalare descri"
+  "bedintentionallyserved as theclass=\"headeropposition tofundamentallydominated theand the otheralliance withwas fo"
+  "rced torespectively,and politicalin support ofpeople in the20th century.and publishedloadChartbeatto understandmem"
+  "ber statesenvironmentalfirst half ofcountries andarchitecturalbe consideredcharacterizedclearIntervalauthoritative"
+  "Federation ofwas succeededand there area consequencethe Presidentalso includedfree softwaresuccession ofdeveloped "
+  "thewas destroyedaway from the;\012</script>\012<although theyfollowed by amore powerfulresulted in aUniversity ofH"
+  "owever, manythe presidentHowever, someis thought tountil the endwas announcedare importantalso includes><input typ"
+  "e=the center of DO NOT ALTERused to referthemes/\077sort=that had beenthe basis forhas developedin the summercompa"
+  "rativelydescribed thesuch as thosethe resultingis impossiblevarious otherSouth Africanhave the sameeffectivenessin"
+  " which case; text-align:structure and; background:regarding thesupported theis also knownstyle=\"marginincluding t"
+  "hebahasa Melayunorsk bokm\303\245lnorsk nynorsksloven\305\241\304\215inainternacionalcalificaci\303\263ncomunicaci"
+  "\303\263nconstrucci\303\263n\"><div class=\"disambiguationDomainName', 'administrationsimultaneouslytransportation"
+  "International margin-bottom:responsibility<![endif]-->\012</><meta name=\"implementationinfrastructurerepresentati"
+  "onborder-bottom:</head>\012<body>=http%3A%2F%2F<form method=\"method=\"post\" /favicon.ico\" });\012</script>\012."
+  "setAttribute(Administration= new Array();<![endif]-->\015\012display:block;Unfortunately,\">&nbsp;</div>/favicon.i"
+  "co\">='stylesheet' identification, for example,<li><a href=\"/an alternativeas a result ofpt\"></script>\012type="
+  "\"submit\" \012(function() {recommendationform action=\"/transformationreconstruction.style.display According to h"
+  "idden\" name=\"along with thedocument.body.approximately Communicationspost\" action=\"meaning &quot;--<![endif]--"
+  ">Prime Ministercharacteristic</a> <a class=the history of onmouseover=\"the governmenthref=\"https://was originall"
+  "ywas introducedclassificationrepresentativeare considered<![endif]-->\012\012depends on theUniversity of in contra"
+  "st to placeholder=\"in the case ofinternational constitutionalstyle=\"border-: function() {Because of the-strict.d"
+  "td\">\012<table class=\"accompanied byaccount of the<script src=\"/nature of the the people in in addition tos); j"
+  "s.id = id\" width=\"100%\"regarding the Roman Catholican independentfollowing the .gif\" width=\"1the following di"
+  "scriminationarchaeologicalprime minister.js\"></script>combination of marginwidth=\"createElement(w.attachEvent(</"
+  "a></td></tr>src=\"https://aIn particular, align=\"left\" Czech RepublicUnited Kingdomcorrespondenceconcluded that."
+  "html\" title=\"(function () {comes from theapplication of<span class=\"sbelieved to beement('script'</a>\012</li>"
+  "\012<livery different><span class=\"option value=\"(also known as\011<li><a href=\"><input name=\"separated fromre"
+  "ferred to as valign=\"top\">founder of theattempting to carbon dioxide\012\012<div class=\"class=\"search-/body>"
+  "\012</html>opportunity tocommunications</head>\015\012<body style=\"width:Ti\341\272\277ng Vi\341\273\207tchanges "
+  "in theborder-color:#0\" border=\"0\" </span></div><was discovered\" type=\"text\" );\012</script>\012\012Departmen"
+  "t of ecclesiasticalthere has beenresulting from</body></html>has never beenthe first timein response toautomatical"
+  "ly </div>\012\012<div iwas consideredpercent of the\" /></a></div>collection of descended fromsection of theaccept"
+  "-charsetto be confusedmember of the padding-right:translation ofinterpretation href='http://whether or notThere ar"
+  "e alsothere are manya small numberother parts ofimpossible to  class=\"buttonlocated in the. However, theand event"
+  "uallyAt the end of because of itsrepresents the<form action=\" method=\"post\"it is possiblemore likely toan incre"
+  "ase inhave also beencorresponds toannounced thatalign=\"right\">many countriesfor many yearsearliest knownbecause "
+  "it waspt\"></script>\015 valign=\"top\" inhabitants offollowing year\015\012<div class=\"million peoplecontroversi"
+  "al concerning theargue that thegovernment anda reference totransferred todescribing the style=\"color:although the"
+  "rebest known forsubmit\" name=\"multiplicationmore than one recognition ofCouncil of theedition of the  <meta name"
+  "=\"Entertainment away from the ;margin-right:at the time ofinvestigationsconnected withand many otheralthough it i"
+  "sbeginning with <span class=\"descendants of<span class=\"i align=\"right\"</head>\012<body aspects of thehas sinc"
+  "e beenEuropean Unionreminiscent ofmore difficultVice Presidentcomposition ofpassed throughmore importantfont-size:"
+  "11pxexplanation ofthe concept ofwritten in the\011<span class=\"is one of the resemblance toon the groundswhich co"
+  "ntainsincluding the defined by thepublication ofmeans that theoutside of thesupport of the<input class=\"<span cla"
+  "ss=\"t(Math.random()most prominentdescription ofConstantinoplewere published<div class=\"seappears in the1\" heigh"
+  "t=\"1\" most importantwhich includeswhich had beendestruction ofthe population\012\011<div class=\"possibility ofs"
+  "ometimes usedappear to havesuccess of theintended to bepresent in thestyle=\"clear:b\015\012</script>\015\012<was "
+  "founded ininterview with_id\" content=\"capital of the\015\012<link rel=\"srelease of thepoint out thatxMLHttpRequ"
+  "estand subsequentsecond largestvery importantspecificationssurface of theapplied to theforeign policy_setDomainNam"
+  "eestablished inis believed toIn addition tomeaning of theis named afterto protect theis representedDeclaration ofm"
+  "ore efficientClassificationother forms ofhe returned to<span class=\"cperformance of(function() {\015if and only i"
+  "fregions of theleading to therelations withUnited Nationsstyle=\"height:other than theype\" content=\"Association "
+  "of\012</head>\012<bodylocated on theis referred to(including theconcentrationsthe individualamong the mostthan any"
+  " other/>\012<link rel=\" return false;the purpose ofthe ability to;color:#fff}\012.\012<span class=\"the subject o"
+  "fdefinitions of>\015\012<link rel=\"claim that thehave developed<table width=\"celebration ofFollowing the to dist"
+  "inguish<span class=\"btakes place inunder the namenoted that the><![endif]-->\012style=\"margin-instead of theintr"
+  "oduced thethe process ofincreasing thedifferences inestimated thatespecially the/div><div id=\"was eventuallythrou"
+  "ghout histhe differencesomething thatspan></span></significantly ></script>\015\012\015\012environmental to preven"
+  "t thehave been usedespecially forunderstand theis essentiallywere the firstis the largesthave been made\" src=\"ht"
+  "tp://interpreted assecond half ofcrolling=\"no\" is composed ofII, Holy Romanis expected tohave their owndefined a"
+  "s thetraditionally have differentare often usedto ensure thatagreement withcontaining theare frequentlyinformation"
+  " onexample is theresulting in a</a></li></ul> class=\"footerand especiallytype=\"button\" </span></span>which incl"
+  "uded>\012<meta name=\"considered thecarried out byHowever, it isbecame part ofin relation topopular in thethe capi"
+  "tal ofwas officiallywhich has beenthe History ofalternative todifferent fromto support thesuggested thatin the pro"
+  "cess  <div class=\"the foundationbecause of hisconcerned withthe universityopposed to thethe context of<span class"
+  "=\"ptext\" name=\"q\"\011\011<div class=\"the scientificrepresented bymathematicianselected by thethat have been><"
+  "div class=\"cdiv id=\"headerin particular,converted into);\012</script>\012<philosophical srpskohrvatskiti\341\272"
+  "\277ng Vi\341\273\207t\320\240\321\203\321\201\321\201\320\272\320\270\320\271\321\200\321\203\321\201\321\201\320"
+  "\272\320\270\320\271investigaci\303\263nparticipaci\303\263n\320\272\320\276\321\202\320\276\321\200\321\213\320"
+  "\265\320\276\320\261\320\273\320\260\321\201\321\202\320\270\320\272\320\276\321\202\320\276\321\200\321\213\320"
+  "\271\321\207\320\265\320\273\320\276\320\262\320\265\320\272\321\201\320\270\321\201\321\202\320\265\320\274\321"
+  "\213\320\235\320\276\320\262\320\276\321\201\321\202\320\270\320\272\320\276\321\202\320\276\321\200\321\213\321"
+  "\205\320\276\320\261\320\273\320\260\321\201\321\202\321\214\320\262\321\200\320\265\320\274\320\265\320\275\320"
+  "\270\320\272\320\276\321\202\320\276\321\200\320\260\321\217\321\201\320\265\320\263\320\276\320\264\320\275\321"
+  "\217\321\201\320\272\320\260\321\207\320\260\321\202\321\214\320\275\320\276\320\262\320\276\321\201\321\202\320"
+  "\270\320\243\320\272\321\200\320\260\320\270\320\275\321\213\320\262\320\276\320\277\321\200\320\276\321\201\321"
+  "\213\320\272\320\276\321\202\320\276\321\200\320\276\320\271\321\201\320\264\320\265\320\273\320\260\321\202\321"
+  "\214\320\277\320\276\320\274\320\276\321\211\321\214\321\216\321\201\321\200\320\265\320\264\321\201\321\202\320"
+  "\262\320\276\320\261\321\200\320\260\320\267\320\276\320\274\321\201\321\202\320\276\321\200\320\276\320\275\321"
+  "\213\321\203\321\207\320\260\321\201\321\202\320\270\320\265\321\202\320\265\321\207\320\265\320\275\320\270\320"
+  "\265\320\223\320\273\320\260\320\262\320\275\320\260\321\217\320\270\321\201\321\202\320\276\321\200\320\270\320"
+  "\270\321\201\320\270\321\201\321\202\320\265\320\274\320\260\321\200\320\265\321\210\320\265\320\275\320\270\321"
+  "\217\320\241\320\272\320\260\321\207\320\260\321\202\321\214\320\277\320\276\321\215\321\202\320\276\320\274\321"
+  "\203\321\201\320\273\320\265\320\264\321\203\320\265\321\202\321\201\320\272\320\260\320\267\320\260\321\202\321"
+  "\214\321\202\320\276\320\262\320\260\321\200\320\276\320\262\320\272\320\276\320\275\320\265\321\207\320\275\320"
+  "\276\321\200\320\265\321\210\320\265\320\275\320\270\320\265\320\272\320\276\321\202\320\276\321\200\320\276\320"
+  "\265\320\276\321\200\320\263\320\260\320\275\320\276\320\262\320\272\320\276\321\202\320\276\321\200\320\276\320"
+  "\274\320\240\320\265\320\272\320\273\320\260\320\274\320\260\330\247\331\204\331\205\331\206\330\252\330\257\331"
+  "\211\331\205\331\206\330\252\330\257\331\212\330\247\330\252\330\247\331\204\331\205\331\210\330\266\331\210\330"
+  "\271\330\247\331\204\330\250\330\261\330\247\331\205\330\254\330\247\331\204\331\205\331\210\330\247\331\202\330"
+  "\271\330\247\331\204\330\261\330\263\330\247\330\246\331\204\331\205\330\264\330\247\330\261\331\203\330\247\330"
+  "\252\330\247\331\204\330\243\330\271\330\266\330\247\330\241\330\247\331\204\330\261\331\212\330\247\330\266\330"
+  "\251\330\247\331\204\330\252\330\265\331\205\331\212\331\205\330\247\331\204\330\247\330\271\330\266\330\247\330"
+  "\241\330\247\331\204\331\206\330\252\330\247\330\246\330\254\330\247\331\204\330\243\331\204\330\271\330\247\330"
+  "\250\330\247\331\204\330\252\330\263\330\254\331\212\331\204\330\247\331\204\330\243\331\202\330\263\330\247\331"
+  "\205\330\247\331\204\330\266\330\272\330\267\330\247\330\252\330\247\331\204\331\201\331\212\330\257\331\212\331"
+  "\210\330\247\331\204\330\252\330\261\330\255\331\212\330\250\330\247\331\204\330\254\330\257\331\212\330\257\330"
+  "\251\330\247\331\204\330\252\330\271\331\204\331\212\331\205\330\247\331\204\330\243\330\256\330\250\330\247\330"
+  "\261\330\247\331\204\330\247\331\201\331\204\330\247\331\205\330\247\331\204\330\243\331\201\331\204\330\247\331"
+  "\205\330\247\331\204\330\252\330\247\330\261\331\212\330\256\330\247\331\204\330\252\331\202\331\206\331\212\330"
+  "\251\330\247\331\204\330\247\331\204\330\271\330\247\330\250\330\247\331\204\330\256\331\210\330\247\330\267\330"
+  "\261\330\247\331\204\331\205\330\254\330\252\331\205\330\271\330\247\331\204\330\257\331\212\331\203\331\210\330"
+  "\261\330\247\331\204\330\263\331\212\330\247\330\255\330\251\330\271\330\250\330\257\330\247\331\204\331\204\331"
+  "\207\330\247\331\204\330\252\330\261\330\250\331\212\330\251\330\247\331\204\330\261\331\210\330\247\330\250\330"
+  "\267\330\247\331\204\330\243\330\257\330\250\331\212\330\251\330\247\331\204\330\247\330\256\330\250\330\247\330"
+  "\261\330\247\331\204\331\205\330\252\330\255\330\257\330\251\330\247\331\204\330\247\330\272\330\247\331\206\331"
+  "\212cursor:pointer;</title>\012<meta \" href=\"http://\"><span class=\"members of the window.locationvertical-alig"
+  "n:/a> | <a href=\"<!doctype html>media=\"screen\" <option value=\"favicon.ico\" />\012\011\011<div class=\"charact"
+  "eristics\" method=\"get\" /body>\012</html>\012shortcut icon\" document.write(padding-bottom:representativessubmit"
+  "\" value=\"align=\"center\" throughout the science fiction\012  <div class=\"submit\" class=\"one of the most vali"
+  "gn=\"top\"><was established);\015\012</script>\015\012return false;\">).style.displaybecause of the document.cooki"
+  "e<form action=\"/}body{margin:0;Encyclopedia ofversion of the .createElement(name\" content=\"</div>\012</div>\012"
+  "\012administrative </body>\012</html>history of the \"><input type=\"portion of the as part of the &nbsp;<a href="
+  "\"other countries\">\012<div class=\"</span></span><In other words,display: block;control of the introduction of/>"
+  "\012<meta name=\"as well as the in recent years\015\012\011<div class=\"</div>\012\011</div>\012inspired by thethe"
+  " end of the compatible withbecame known as style=\"margin:.js\"></script>< International there have beenGerman lan"
+  "guage style=\"color:#Communist Partyconsistent withborder=\"0\" cell marginheight=\"the majority of\" align=\"cent"
+  "errelated to the many different Orthodox Churchsimilar to the />\012<link rel=\"swas one of the until his death})("
+  ");\012</script>other languagescompared to theportions of thethe Netherlandsthe most commonbackground:url(argued th"
+  "at thescrolling=\"no\" included in theNorth American the name of theinterpretationsthe traditionaldevelopment of f"
+  "requently useda collection ofvery similar tosurrounding theexample of thisalign=\"center\">would have beenimage_ca"
+  "ption =attached to thesuggesting thatin the form of involved in theis derived fromnamed after theIntroduction tore"
+  "strictions on style=\"width: can be used to the creation ofmost important information andresulted in thecollapse o"
+  "f theThis means thatelements of thewas replaced byanalysis of theinspiration forregarded as themost successfulknow"
+  "n as &quot;a comprehensiveHistory of the were consideredreturned to theare referred toUnsourced image>\012\011<div"
+  " class=\"consists of thestopPropagationinterest in theavailability ofappears to haveelectromagneticenableServices("
+  "function of theIt is important</script></div>function(){var relative to theas a result of the position ofFor examp"
+  "le, in method=\"post\" was followed by&amp;mdash; thethe applicationjs\"></script>\015\012ul></div></div>after the"
+  " deathwith respect tostyle=\"padding:is particularlydisplay:inline; type=\"submit\" is divided into\344\270\255"
+  "\346\226\207 (\347\256\200\344\275\223)responsabilidadadministraci\303\263ninternacionalescorrespondiente\340\244"
+  "\211\340\244\252\340\244\257\340\245\213\340\244\227\340\244\252\340\245\202\340\244\260\340\245\215\340\244\265"
+  "\340\244\271\340\244\256\340\244\276\340\244\260\340\245\207\340\244\262\340\245\213\340\244\227\340\245\213\340"
+  "\244\202\340\244\232\340\245\201\340\244\250\340\244\276\340\244\265\340\244\262\340\245\207\340\244\225\340\244"
+  "\277\340\244\250\340\244\270\340\244\260\340\244\225\340\244\276\340\244\260\340\244\252\340\245\201\340\244\262"
+  "\340\244\277\340\244\270\340\244\226\340\245\213\340\244\234\340\245\207\340\244\202\340\244\232\340\244\276\340"
+  "\244\271\340\244\277\340\244\217\340\244\255\340\245\207\340\244\234\340\245\207\340\244\202\340\244\266\340\244"
+  "\276\340\244\256\340\244\277\340\244\262\340\244\271\340\244\256\340\244\276\340\244\260\340\245\200\340\244\234"
+  "\340\244\276\340\244\227\340\244\260\340\244\243\340\244\254\340\244\250\340\244\276\340\244\250\340\245\207\340"
+  "\244\225\340\245\201\340\244\256\340\244\276\340\244\260\340\244\254\340\245\215\340\244\262\340\245\211\340\244"
+  "\227\340\244\256\340\244\276\340\244\262\340\244\277\340\244\225\340\244\256\340\244\271\340\244\277\340\244\262"
+  "\340\244\276\340\244\252\340\245\203\340\244\267\340\245\215\340\244\240\340\244\254\340\244\242\340\244\274\340"
+  "\244\244\340\245\207\340\244\255\340\244\276\340\244\234\340\244\252\340\244\276\340\244\225\340\245\215\340\244"
+  "\262\340\244\277\340\244\225\340\244\237\340\245\215\340\244\260\340\245\207\340\244\250\340\244\226\340\244\277"
+  "\340\244\262\340\244\276\340\244\253\340\244\246\340\245\214\340\244\260\340\244\276\340\244\250\340\244\256\340"
+  "\244\276\340\244\256\340\244\262\340\245\207\340\244\256\340\244\244\340\244\246\340\244\276\340\244\250\340\244"
+  "\254\340\244\276\340\244\234\340\244\276\340\244\260\340\244\265\340\244\277\340\244\225\340\244\276\340\244\270"
+  "\340\244\225\340\245\215\340\244\257\340\245\213\340\244\202\340\244\232\340\244\276\340\244\271\340\244\244\340"
+  "\245\207\340\244\252\340\244\271\340\245\201\340\244\201\340\244\232\340\244\254\340\244\244\340\244\276\340\244"
+  "\257\340\244\276\340\244\270\340\244\202\340\244\265\340\244\276\340\244\246\340\244\246\340\245\207\340\244\226"
+  "\340\244\250\340\245\207\340\244\252\340\244\277\340\244\233\340\244\262\340\245\207\340\244\265\340\244\277\340"
+  "\244\266\340\245\207\340\244\267\340\244\260\340\244\276\340\244\234\340\245\215\340\244\257\340\244\211\340\244"
+  "\244\340\245\215\340\244\244\340\244\260\340\244\256\340\245\201\340\244\202\340\244\254\340\244\210\340\244\246"
+  "\340\245\213\340\244\250\340\245\213\340\244\202\340\244\211\340\244\252\340\244\225\340\244\260\340\244\243\340"
+  "\244\252\340\244\242\340\244\274\340\245\207\340\244\202\340\244\270\340\245\215\340\244\245\340\244\277\340\244"
+  "\244\340\244\253\340\244\277\340\244\262\340\245\215\340\244\256\340\244\256\340\245\201\340\244\226\340\245\215"
+  "\340\244\257\340\244\205\340\244\232\340\245\215\340\244\233\340\244\276\340\244\233\340\245\202\340\244\237\340"
+  "\244\244\340\245\200\340\244\270\340\244\202\340\244\227\340\245\200\340\244\244\340\244\234\340\244\276\340\244"
+  "\217\340\244\227\340\244\276\340\244\265\340\244\277\340\244\255\340\244\276\340\244\227\340\244\230\340\244\243"
+  "\340\245\215\340\244\237\340\245\207\340\244\246\340\245\202\340\244\270\340\244\260\340\245\207\340\244\246\340"
+  "\244\277\340\244\250\340\245\213\340\244\202\340\244\271\340\244\244\340\245\215\340\244\257\340\244\276\340\244"
+  "\270\340\245\207\340\244\225\340\245\215\340\244\270\340\244\227\340\244\276\340\244\202\340\244\247\340\245\200"
+  "\340\244\265\340\244\277\340\244\266\340\245\215\340\244\265\340\244\260\340\244\276\340\244\244\340\245\207\340"
+  "\244\202\340\244\246\340\245\210\340\244\237\340\245\215\340\244\270\340\244\250\340\244\225\340\245\215\340\244"
+  "\266\340\244\276\340\244\270\340\244\276\340\244\256\340\244\250\340\245\207\340\244\205\340\244\246\340\244\276"
+  "\340\244\262\340\244\244\340\244\254\340\244\277\340\244\234\340\244\262\340\245\200\340\244\252\340\245\201\340"
+  "\244\260\340\245\202\340\244\267\340\244\271\340\244\277\340\244\202\340\244\246\340\245\200\340\244\256\340\244"
+  "\277\340\244\244\340\245\215\340\244\260\340\244\225\340\244\265\340\244\277\340\244\244\340\244\276\340\244\260"
+  "\340\245\201\340\244\252\340\244\257\340\245\207\340\244\270\340\245\215\340\244\245\340\244\276\340\244\250\340"
+  "\244\225\340\244\260\340\245\213\340\244\241\340\244\274\340\244\256\340\245\201\340\244\225\340\245\215\340\244"
+  "\244\340\244\257\340\245\213\340\244\234\340\244\250\340\244\276\340\244\225\340\245\203\340\244\252\340\244\257"
+  "\340\244\276\340\244\252\340\245\213\340\244\270\340\245\215\340\244\237\340\244\230\340\244\260\340\245\207\340"
+  "\244\262\340\245\202\340\244\225\340\244\276\340\244\260\340\245\215\340\244\257\340\244\265\340\244\277\340\244"
+  "\232\340\244\276\340\244\260\340\244\270\340\245\202\340\244\232\340\244\250\340\244\276\340\244\256\340\245\202"
+  "\340\244\262\340\245\215\340\244\257\340\244\246\340\245\207\340\244\226\340\245\207\340\244\202\340\244\271\340"
+  "\244\256\340\245\207\340\244\266\340\244\276\340\244\270\340\245\215\340\244\225\340\245\202\340\244\262\340\244"
+  "\256\340\245\210\340\244\202\340\244\250\340\245\207\340\244\244\340\245\210\340\244\257\340\244\276\340\244\260"
+  "\340\244\234\340\244\277\340\244\270\340\244\225\340\245\207rss+xml\" title=\"-type\" content=\"title\" content=\""
+  "at the same time.js\"></script>\012<\" method=\"post\" </span></a></li>vertical-align:t/jquery.min.js\">.click(fun"
+  "ction( style=\"padding-})();\012</script>\012</span><a href=\"<a href=\"http://); return false;text-decoration: sc"
+  "rolling=\"no\" border-collapse:associated with Bahasa IndonesiaEnglish language<text xml:space=.gif\" border=\"0\""
+  "</body>\012</html>\012overflow:hidden;img src=\"http://addEventListenerresponsible for s.js\"></script>\012/favico"
+  "n.ico\" />operating system\" style=\"width:1target=\"_blank\">State Universitytext-align:left;\012document.write(,"
+  " including the around the world);\015\012</script>\015\012<\" style=\"height:;overflow:hiddenmore informationan in"
+  "ternationala member of the one of the firstcan be found in </div>\012\011\011</div>\012display: none;\">\" />\012<"
+  "link rel=\"\012  (function() {the 15th century.preventDefault(large number of Byzantine Empire.jpg|thumb|left|vast"
+  " majority ofmajority of the  align=\"center\">University Pressdominated by theSecond World Wardistribution of styl"
+  "e=\"position:the rest of the characterized by rel=\"nofollow\">derives from therather than the a combination ofsty"
+  "le=\"width:100English-speakingcomputer scienceborder=\"0\" alt=\"the existence ofDemocratic Party\" style=\"margin"
+  "-For this reason,.js\"></script>\012\011sByTagName(s)[0]js\"></script>\015\012<.js\"></script>\015\012link rel=\"i"
+  "con\" ' alt='' class='formation of theversions of the </a></div></div>/page>\012  <page>\012<div class=\"contbecam"
+  "e the firstbahasa Indonesiaenglish (simple)\316\225\316\273\316\273\316\267\316\275\316\271\316\272\316\254\321"
+  "\205\321\200\320\262\320\260\321\202\321\201\320\272\320\270\320\272\320\276\320\274\320\277\320\260\320\275\320"
+  "\270\320\270\321\217\320\262\320\273\321\217\320\265\321\202\321\201\321\217\320\224\320\276\320\261\320\260\320"
+  "\262\320\270\321\202\321\214\321\207\320\265\320\273\320\276\320\262\320\265\320\272\320\260\321\200\320\260\320"
+  "\267\320\262\320\270\321\202\320\270\321\217\320\230\320\275\321\202\320\265\321\200\320\275\320\265\321\202\320"
+  "\236\321\202\320\262\320\265\321\202\320\270\321\202\321\214\320\275\320\260\320\277\321\200\320\270\320\274\320"
+  "\265\321\200\320\270\320\275\321\202\320\265\321\200\320\275\320\265\321\202\320\272\320\276\321\202\320\276\321"
+  "\200\320\276\320\263\320\276\321\201\321\202\321\200\320\260\320\275\320\270\321\206\321\213\320\272\320\260\321"
+  "\207\320\265\321\201\321\202\320\262\320\265\321\203\321\201\320\273\320\276\320\262\320\270\321\217\321\205\320"
+  "\277\321\200\320\276\320\261\320\273\320\265\320\274\321\213\320\277\320\276\320\273\321\203\321\207\320\270\321"
+  "\202\321\214\321\217\320\262\320\273\321\217\321\216\321\202\321\201\321\217\320\275\320\260\320\270\320\261\320"
+  "\276\320\273\320\265\320\265\320\272\320\276\320\274\320\277\320\260\320\275\320\270\321\217\320\262\320\275\320"
+  "\270\320\274\320\260\320\275\320\270\320\265\321\201\321\200\320\265\320\264\321\201\321\202\320\262\320\260\330"
+  "\247\331\204\331\205\331\210\330\247\330\266\331\212\330\271\330\247\331\204\330\261\330\246\331\212\330\263\331"
+  "\212\330\251\330\247\331\204\330\247\331\206\330\252\331\202\330\247\331\204\331\205\330\264\330\247\330\261\331"
+  "\203\330\247\330\252\331\203\330\247\331\204\330\263\331\212\330\247\330\261\330\247\330\252\330\247\331\204\331"
+  "\205\331\203\330\252\331\210\330\250\330\251\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251\330"
+  "\247\330\255\330\265\330\247\330\246\331\212\330\247\330\252\330\247\331\204\330\271\330\247\331\204\331\205\331"
+  "\212\330\251\330\247\331\204\330\265\331\210\330\252\331\212\330\247\330\252\330\247\331\204\330\247\331\206\330"
+  "\252\330\261\331\206\330\252\330\247\331\204\330\252\330\265\330\247\331\205\331\212\331\205\330\247\331\204\330"
+  "\245\330\263\331\204\330\247\331\205\331\212\330\247\331\204\331\205\330\264\330\247\330\261\331\203\330\251\330"
+  "\247\331\204\331\205\330\261\330\246\331\212\330\247\330\252robots\" content=\"<div id=\"footer\">the United State"
+  "s<img src=\"http://.jpg|right|thumb|.js\"></script>\015\012<location.protocolframeborder=\"0\" s\" />\012<meta nam"
+  "e=\"</a></div></div><font-weight:bold;&quot; and &quot;depending on the margin:0;padding:\" rel=\"nofollow\" Presi"
+  "dent of the twentieth centuryevision>\012  </pageInternet Explorera.async = true;\015\012information about<div id="
+  "\"header\">\" action=\"http://<a href=\"https://<div id=\"content\"</div>\015\012</div>\015\012<derived from the <"
+  "img src='http://according to the \012</body>\012</html>\012style=\"font-size:script language=\"Arial, Helvetica,</"
+  "a><span class=\"</script><script political partiestd></tr></table><href=\"http://www.interpretation ofrel=\"styles"
+  "heet\" document.write('<charset=\"utf-8\">\012beginning of the revealed that thetelevision series\" rel=\"nofollow"
+  "\"> target=\"_blank\">claiming that thehttp%3A%2F%2Fwww.manifestations ofPrime Minister ofinfluenced by theclass="
+  "\"clearfix\">/div>\015\012</div>\015\012\015\012three-dimensionalChurch of Englandof North Carolinasquare kilometr"
+  "es.addEventListenerdistinct from thecommonly known asPhonetic Alphabetdeclared that thecontrolled by theBenjamin F"
+  "ranklinrole-playing gamethe University ofin Western Europepersonal computerProject Gutenbergregardless of thehas b"
+  "een proposedtogether with the></li><li class=\"in some countriesmin.js\"></script>of the populationofficial langua"
+  "ge<img src=\"images/identified by thenatural resourcesclassification ofcan be consideredquantum mechanicsNeverthel"
+  "ess, themillion years ago</body>\015\012</html>\015\316\225\316\273\316\273\316\267\316\275\316\271\316\272\316"
+  "\254\012take advantage ofand, according toattributed to theMicrosoft Windowsthe first centuryunder the controldiv "
+  "class=\"headershortly after thenotable exceptiontens of thousandsseveral differentaround the world.reaching milita"
+  "ryisolated from theopposition to thethe Old TestamentAfrican Americansinserted into theseparate from themetropolit"
+  "an areamakes it possibleacknowledged thatarguably the mosttype=\"text/css\">\012the InternationalAccording to the "
+  "pe=\"text/css\" />\012coincide with thetwo-thirds of theDuring this time,during the periodannounced that hethe int"
+  "ernationaland more recentlybelieved that theconsciousness andformerly known assurrounded by thefirst appeared inoc"
+  "casionally usedposition:absolute;\" target=\"_blank\" position:relative;text-align:center;jax/libs/jquery/1.backgr"
+  "ound-color:#type=\"application/anguage\" content=\"<meta http-equiv=\"Privacy Policy</a>e(\"%3Cscript src='\" targ"
+  "et=\"_blank\">On the other hand,.jpg|thumb|right|2</div><div class=\"<div style=\"float:nineteenth century</body>"
+  "\015\012</html>\015\012<img src=\"http://s;text-align:centerfont-weight: bold; According to the difference between"
+  "\" frameborder=\"0\" \" style=\"position:link href=\"http://html4/loose.dtd\">\012during this period</td></tr></ta"
+  "ble>closely related tofor the first time;font-weight:bold;input type=\"text\" <span style=\"font-onreadystatechang"
+  "e\011<div class=\"cleardocument.location. For example, the a wide variety of <!DOCTYPE html>\015\012<&nbsp;&nbsp;&"
+  "nbsp;\"><a href=\"http://style=\"float:left;concerned with the=http%3A%2F%2Fwww.in popular culturetype=\"text/css"
+  "\" />it is possible to Harvard Universitytylesheet\" href=\"/the main characterOxford University  name=\"keywords"
+  "\" cstyle=\"text-align:the United Kingdomfederal government<div style=\"margin depending on the description of the"
+  "<div class=\"header.min.js\"></script>destruction of theslightly differentin accordance withtelecommunicationsindi"
+  "cates that theshortly thereafterespecially in the European countriesHowever, there aresrc=\"http://staticsuggested"
+  " that the\" src=\"http://www.a large number of Telecommunications\" rel=\"nofollow\" tHoly Roman Emperoralmost exc"
+  "lusively\" border=\"0\" alt=\"Secretary of Stateculminating in theCIA World Factbookthe most importantanniversary "
+  "of thestyle=\"background-<li><em><a href=\"/the Atlantic Oceanstrictly speaking,shortly before thedifferent types "
+  "ofthe Ottoman Empire><img src=\"http://An Introduction toconsequence of thedeparture from theConfederate Statesind"
+  "igenous peoplesProceedings of theinformation on thetheories have beeninvolvement in thedivided into threeadjacent "
+  "countriesis responsible fordissolution of thecollaboration withwidely regarded ashis contemporariesfounding member"
+  " ofDominican Republicgenerally acceptedthe possibility ofare also availableunder constructionrestoration of thethe"
+  " general publicis almost entirelypasses through thehas been suggestedcomputer and videoGermanic languages accordin"
+  "g to the different from theshortly afterwardshref=\"https://www.recent developmentBoard of Directors<div class=\"s"
+  "earch| <a href=\"http://In particular, theMultiple footnotesor other substancethousands of yearstranslation of the"
+  "</div>\015\012</div>\015\012\015\012<a href=\"index.phpwas established inmin.js\"></script>\012participate in thea"
+  " strong influencestyle=\"margin-top:represented by thegraduated from theTraditionally, theElement(\"script\");Howe"
+  "ver, since the/div>\012</div>\012<div left; margin-left:protection against0; vertical-align:Unfortunately, thetype"
+  "=\"image/x-icon/div>\012<div class=\" class=\"clearfix\"><div class=\"footer\011\011</div>\012\011\011</div>\012th"
+  "e motion picture\320\221\321\212\320\273\320\263\320\260\321\200\321\201\320\272\320\270\320\261\321\212\320\273"
+  "\320\263\320\260\321\200\321\201\320\272\320\270\320\244\320\265\320\264\320\265\321\200\320\260\321\206\320\270"
+  "\320\270\320\275\320\265\321\201\320\272\320\276\320\273\321\214\320\272\320\276\321\201\320\276\320\276\320\261"
+  "\321\211\320\265\320\275\320\270\320\265\321\201\320\276\320\276\320\261\321\211\320\265\320\275\320\270\321\217"
+  "\320\277\321\200\320\276\320\263\321\200\320\260\320\274\320\274\321\213\320\236\321\202\320\277\321\200\320\260"
+  "\320\262\320\270\321\202\321\214\320\261\320\265\321\201\320\277\320\273\320\260\321\202\320\275\320\276\320\274"
+  "\320\260\321\202\320\265\321\200\320\270\320\260\320\273\321\213\320\277\320\276\320\267\320\262\320\276\320\273"
+  "\321\217\320\265\321\202\320\277\320\276\321\201\320\273\320\265\320\264\320\275\320\270\320\265\321\200\320\260"
+  "\320\267\320\273\320\270\321\207\320\275\321\213\321\205\320\277\321\200\320\276\320\264\321\203\320\272\321\206"
+  "\320\270\320\270\320\277\321\200\320\276\320\263\321\200\320\260\320\274\320\274\320\260\320\277\320\276\320\273"
+  "\320\275\320\276\321\201\321\202\321\214\321\216\320\275\320\260\321\205\320\276\320\264\320\270\321\202\321\201"
+  "\321\217\320\270\320\267\320\261\321\200\320\260\320\275\320\275\320\276\320\265\320\275\320\260\321\201\320\265"
+  "\320\273\320\265\320\275\320\270\321\217\320\270\320\267\320\274\320\265\320\275\320\265\320\275\320\270\321\217"
+  "\320\272\320\260\321\202\320\265\320\263\320\276\321\200\320\270\320\270\320\220\320\273\320\265\320\272\321\201"
+  "\320\260\320\275\320\264\321\200\340\244\246\340\245\215\340\244\265\340\244\276\340\244\260\340\244\276\340\244"
+  "\256\340\245\210\340\244\250\340\245\201\340\244\205\340\244\262\340\244\252\340\245\215\340\244\260\340\244\246"
+  "\340\244\276\340\244\250\340\244\255\340\244\276\340\244\260\340\244\244\340\245\200\340\244\257\340\244\205\340"
+  "\244\250\340\245\201\340\244\246\340\245\207\340\244\266\340\244\271\340\244\277\340\244\250\340\245\215\340\244"
+  "\246\340\245\200\340\244\207\340\244\202\340\244\241\340\244\277\340\244\257\340\244\276\340\244\246\340\244\277"
+  "\340\244\262\340\245\215\340\244\262\340\245\200\340\244\205\340\244\247\340\244\277\340\244\225\340\244\276\340"
+  "\244\260\340\244\265\340\245\200\340\244\241\340\244\277\340\244\257\340\245\213\340\244\232\340\244\277\340\244"
+  "\237\340\245\215\340\244\240\340\245\207\340\244\270\340\244\256\340\244\276\340\244\232\340\244\276\340\244\260"
+  "\340\244\234\340\244\202\340\244\225\340\245\215\340\244\266\340\244\250\340\244\246\340\245\201\340\244\250\340"
+  "\244\277\340\244\257\340\244\276\340\244\252\340\245\215\340\244\260\340\244\257\340\245\213\340\244\227\340\244"
+  "\205\340\244\250\340\245\201\340\244\270\340\244\276\340\244\260\340\244\221\340\244\250\340\244\262\340\244\276"
+  "\340\244\207\340\244\250\340\244\252\340\244\276\340\244\260\340\245\215\340\244\237\340\245\200\340\244\266\340"
+  "\244\260\340\245\215\340\244\244\340\245\213\340\244\202\340\244\262\340\245\213\340\244\225\340\244\270\340\244"
+  "\255\340\244\276\340\244\253\340\244\274\340\245\215\340\244\262\340\245\210\340\244\266\340\244\266\340\244\260"
+  "\340\245\215\340\244\244\340\245\207\340\244\202\340\244\252\340\245\215\340\244\260\340\244\246\340\245\207\340"
+  "\244\266\340\244\252\340\245\215\340\244\262\340\245\207\340\244\257\340\244\260\340\244\225\340\245\207\340\244"
+  "\202\340\244\246\340\245\215\340\244\260\340\244\270\340\245\215\340\244\245\340\244\277\340\244\244\340\244\277"
+  "\340\244\211\340\244\244\340\245\215\340\244\252\340\244\276\340\244\246\340\244\211\340\244\250\340\245\215\340"
+  "\244\271\340\245\207\340\244\202\340\244\232\340\244\277\340\244\237\340\245\215\340\244\240\340\244\276\340\244"
+  "\257\340\244\276\340\244\244\340\245\215\340\244\260\340\244\276\340\244\234\340\245\215\340\244\257\340\244\276"
+  "\340\244\246\340\244\276\340\244\252\340\245\201\340\244\260\340\244\276\340\244\250\340\245\207\340\244\234\340"
+  "\245\213\340\244\241\340\244\274\340\245\207\340\244\202\340\244\205\340\244\250\340\245\201\340\244\265\340\244"
+  "\276\340\244\246\340\244\266\340\245\215\340\244\260\340\245\207\340\244\243\340\245\200\340\244\266\340\244\277"
+  "\340\244\225\340\245\215\340\244\267\340\244\276\340\244\270\340\244\260\340\244\225\340\244\276\340\244\260\340"
+  "\245\200\340\244\270\340\244\202\340\244\227\340\245\215\340\244\260\340\244\271\340\244\252\340\244\260\340\244"
+  "\277\340\244\243\340\244\276\340\244\256\340\244\254\340\245\215\340\244\260\340\244\276\340\244\202\340\244\241"
+  "\340\244\254\340\244\232\340\245\215\340\244\232\340\245\213\340\244\202\340\244\211\340\244\252\340\244\262\340"
+  "\244\254\340\245\215\340\244\247\340\244\256\340\244\202\340\244\244\340\245\215\340\244\260\340\245\200\340\244"
+  "\270\340\244\202\340\244\252\340\244\260\340\245\215\340\244\225\340\244\211\340\244\256\340\245\215\340\244\256"
+  "\340\245\200\340\244\246\340\244\256\340\244\276\340\244\247\340\245\215\340\244\257\340\244\256\340\244\270\340"
+  "\244\271\340\244\276\340\244\257\340\244\244\340\244\276\340\244\266\340\244\254\340\245\215\340\244\246\340\245"
+  "\213\340\244\202\340\244\256\340\245\200\340\244\241\340\244\277\340\244\257\340\244\276\340\244\206\340\244\210"
+  "\340\244\252\340\245\200\340\244\217\340\244\262\340\244\256\340\245\213\340\244\254\340\244\276\340\244\207\340"
+  "\244\262\340\244\270\340\244\202\340\244\226\340\245\215\340\244\257\340\244\276\340\244\206\340\244\252\340\244"
+  "\260\340\245\207\340\244\266\340\244\250\340\244\205\340\244\250\340\245\201\340\244\254\340\244\202\340\244\247"
+  "\340\244\254\340\244\276\340\244\234\340\244\274\340\244\276\340\244\260\340\244\250\340\244\265\340\245\200\340"
+  "\244\250\340\244\244\340\244\256\340\244\252\340\245\215\340\244\260\340\244\256\340\245\201\340\244\226\340\244"
+  "\252\340\245\215\340\244\260\340\244\266\340\245\215\340\244\250\340\244\252\340\244\260\340\244\277\340\244\265"
+  "\340\244\276\340\244\260\340\244\250\340\245\201\340\244\225\340\244\270\340\244\276\340\244\250\340\244\270\340"
+  "\244\256\340\244\260\340\245\215\340\244\245\340\244\250\340\244\206\340\244\257\340\245\213\340\244\234\340\244"
+  "\277\340\244\244\340\244\270\340\245\213\340\244\256\340\244\265\340\244\276\340\244\260\330\247\331\204\331\205"
+  "\330\264\330\247\330\261\331\203\330\247\330\252\330\247\331\204\331\205\331\206\330\252\330\257\331\212\330\247"
+  "\330\252\330\247\331\204\331\203\331\205\330\250\331\212\331\210\330\252\330\261\330\247\331\204\331\205\330\264"
+  "\330\247\331\207\330\257\330\247\330\252\330\271\330\257\330\257\330\247\331\204\330\262\331\210\330\247\330\261"
+  "\330\271\330\257\330\257\330\247\331\204\330\261\330\257\331\210\330\257\330\247\331\204\330\245\330\263\331\204"
+  "\330\247\331\205\331\212\330\251\330\247\331\204\331\201\331\210\330\252\331\210\330\264\331\210\330\250\330\247"
+  "\331\204\331\205\330\263\330\247\330\250\331\202\330\247\330\252\330\247\331\204\331\205\330\271\331\204\331\210"
+  "\331\205\330\247\330\252\330\247\331\204\331\205\330\263\331\204\330\263\331\204\330\247\330\252\330\247\331\204"
+  "\330\254\330\261\330\247\331\201\331\212\331\203\330\263\330\247\331\204\330\247\330\263\331\204\330\247\331\205"
+  "\331\212\330\251\330\247\331\204\330\247\330\252\330\265\330\247\331\204\330\247\330\252keywords\" content=\"w3.or"
+  "g/1999/xhtml\"><a target=\"_blank\" text/html; charset=\" target=\"_blank\"><table cellpadding=\"autocomplete=\"of"
+  "f\" text-align: center;to last version by background-color: #\" href=\"http://www./div></div><div id=<a href=\"#\""
+  " class=\"\"><img src=\"http://cript\" src=\"http://\012<script language=\"//EN\" \"http://www.wencodeURIComponent("
+  "\" href=\"javascript:<div class=\"contentdocument.write('<scposition: absolute;script src=\"http:// style=\"margin"
+  "-top:.min.js\"></script>\012</div>\012<div class=\"w3.org/1999/xhtml\" \012\015\012</body>\015\012</html>distincti"
+  "on between/\" target=\"_blank\"><link href=\"http://encoding=\"utf-8\"\077>\012w.addEventListener\077action=\"http"
+  "://www.icon\" href=\"http:// style=\"background:type=\"text/css\" />\012meta property=\"og:t<input type=\"text\"  "
+  "style=\"text-align:the development of tylesheet\" type=\"tehtml; charset=utf-8is considered to betable width=\"100"
+  "%\" In addition to the contributed to the differences betweendevelopment of the It is important to </script>\012"
+  "\012<script  style=\"font-size:1></span><span id=gbLibrary of Congress<img src=\"http://imEnglish translationAcade"
+  "my of Sciencesdiv style=\"display:construction of the.getElementById(id)in conjunction withElement('script'); <met"
+  "a property=\"og:\320\221\321\212\320\273\320\263\320\260\321\200\321\201\320\272\320\270\012 type=\"text\" name=\""
+  ">Privacy Policy</a>administered by theenableSingleRequeststyle=&quot;margin:</div></div></div><><img src=\"http://"
+  "i style=&quot;float:referred to as the total population ofin Washington, D.C. style=\"background-among other thing"
+  "s,organization of theparticipated in thethe introduction ofidentified with thefictional character Oxford Universit"
+  "y misunderstanding ofThere are, however,stylesheet\" href=\"/Columbia Universityexpanded to includeusually referre"
+  "d toindicating that thehave suggested thataffiliated with thecorrelation betweennumber of different></td></tr></ta"
+  "ble>Republic of Ireland\012</script>\012<script under the influencecontribution to theOfficial website ofheadquart"
+  "ers of thecentered around theimplications of thehave been developedFederal Republic ofbecame increasinglycontinuat"
+  "ion of theNote, however, thatsimilar to that of capabilities of theaccordance with theparticipants in thefurther d"
+  "evelopmentunder the directionis often consideredhis younger brother</td></tr></table><a http-equiv=\"X-UA-physical"
+  " propertiesof British Columbiahas been criticized(with the exceptionquestions about thepassing through the0\" cell"
+  "padding=\"0\" thousands of peopleredirects here. Forhave children under%3E%3C/script%3E\"));<a href=\"http://www.<"
+  "li><a href=\"http://site_name\" content=\"text-decoration:nonestyle=\"display: none<meta http-equiv=\"X-new Date()"
+  ".getTime() type=\"image/x-icon\"</span><span class=\"language=\"javascriptwindow.location.href<a href=\"javascript"
+  ":-->\015\012<script type=\"t<a href='http://www.hortcut icon\" href=\"</div>\015\012<div class=\"<script src=\"htt"
+  "p://\" rel=\"stylesheet\" t</div>\012<script type=/a> <a href=\"http:// allowTransparency=\"X-UA-Compatible\" conr"
+  "elationship between\012</script>\015\012<script </a></li></ul></div>associated with the programming language</a><a"
+  " href=\"http://</a></li><li class=\"form action=\"http://<div style=\"display:type=\"text\" name=\"q\"<table width"
+  "=\"100%\" background-position:\" border=\"0\" width=\"rel=\"shortcut icon\" h6><ul><li><a href=\"  <meta http-equi"
+  "v=\"css\" media=\"screen\" responsible for the \" type=\"application/\" style=\"background-html; charset=utf-8\" a"
+  "llowtransparency=\"stylesheet\" type=\"te\015\012<meta http-equiv=\"></span><span class=\"0\" cellspacing=\"0\">;"
+  "\012</script>\012<script sometimes called thedoes not necessarilyFor more informationat the beginning of <!DOCTYPE"
+  " html><htmlparticularly in the type=\"hidden\" name=\"javascript:void(0);\"effectiveness of the autocomplete=\"off"
+  "\" generally considered><input type=\"text\" \"></script>\015\012<scriptthroughout the worldcommon misconceptionas"
+  "sociation with the</div>\012</div>\012<div cduring his lifetime,corresponding to thetype=\"image/x-icon\" an incre"
+  "asing numberdiplomatic relationsare often consideredmeta charset=\"utf-8\" <input type=\"text\" examples include t"
+  "he\"><img src=\"http://iparticipation in thethe establishment of\012</div>\012<div class=\"&amp;nbsp;&amp;nbsp;to "
+  "determine whetherquite different frommarked the beginningdistance between thecontributions to theconflict between "
+  "thewidely considered towas one of the firstwith varying degreeshave speculated that(document.getElementparticipati"
+  "ng in theoriginally developedeta charset=\"utf-8\"> type=\"text/css\" />\012interchangeably withmore closely relat"
+  "edsocial and politicalthat would otherwiseperpendicular to thestyle type=\"text/csstype=\"submit\" name=\"families"
+  " residing indeveloping countriescomputer programmingeconomic developmentdetermination of thefor more informationon"
+  " several occasionsportugu\303\252s (Europeu)\320\243\320\272\321\200\320\260\321\227\320\275\321\201\321\214\320"
+  "\272\320\260\321\203\320\272\321\200\320\260\321\227\320\275\321\201\321\214\320\272\320\260\320\240\320\276\321"
+  "\201\321\201\320\270\320\271\321\201\320\272\320\276\320\271\320\274\320\260\321\202\320\265\321\200\320\270\320"
+  "\260\320\273\320\276\320\262\320\270\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320\270\320\270\321"
+  "\203\320\277\321\200\320\260\320\262\320\273\320\265\320\275\320\270\321\217\320\275\320\265\320\276\320\261\321"
+  "\205\320\276\320\264\320\270\320\274\320\276\320\270\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320"
+  "\270\321\217\320\230\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320\270\321\217\320\240\320\265\321"
+  "\201\320\277\321\203\320\261\320\273\320\270\320\272\320\270\320\272\320\276\320\273\320\270\321\207\320\265\321"
+  "\201\321\202\320\262\320\276\320\270\320\275\321\204\320\276\321\200\320\274\320\260\321\206\320\270\321\216\321"
+  "\202\320\265\321\200\321\200\320\270\321\202\320\276\321\200\320\270\320\270\320\264\320\276\321\201\321\202\320"
+  "\260\321\202\320\276\321\207\320\275\320\276\330\247\331\204\331\205\330\252\331\210\330\247\330\254\330\257\331"
+  "\210\331\206\330\247\331\204\330\247\330\264\330\252\330\261\330\247\331\203\330\247\330\252\330\247\331\204\330"
+  "\247\331\202\330\252\330\261\330\247\330\255\330\247\330\252html; charset=UTF-8\" setTimeout(function()display:inl"
+  "ine-block;<input type=\"submit\" type = 'text/javascri<img src=\"http://www.\" \"http://www.w3.org/shortcut icon\""
+  " href=\"\" autocomplete=\"off\" </a></div><div class=</a></li>\012<li class=\"css\" type=\"text/css\" <form action"
+  "=\"http://xt/css\" href=\"http://link rel=\"alternate\" \015\012<script type=\"text/ onclick=\"javascript:(new Dat"
+  "e).getTime()}height=\"1\" width=\"1\" People's Republic of  <a href=\"http://www.text-decoration:underthe beginnin"
+  "g of the </div>\012</div>\012</div>\012establishment of the </div></div></div></d#viewport{min-height:\012<script "
+  "src=\"http://option><option value=often referred to as /option>\012<option valu<!DOCTYPE html>\012<!--[Internation"
+  "al Airport>\012<a href=\"http://www</a><a href=\"http://w\340\270\240\340\270\262\340\270\251\340\270\262\340\271"
+  "\204\340\270\227\340\270\242\341\203\245\341\203\220\341\203\240\341\203\227\341\203\243\341\203\232\341\203\230"
+  "\346\255\243\351\253\224\344\270\255\346\226\207 (\347\271\201\351\253\224)\340\244\250\340\244\277\340\244\260"
+  "\340\245\215\340\244\246\340\245\207\340\244\266\340\244\241\340\244\276\340\244\211\340\244\250\340\244\262\340"
+  "\245\213\340\244\241\340\244\225\340\245\215\340\244\267\340\245\207\340\244\244\340\245\215\340\244\260\340\244"
+  "\234\340\244\276\340\244\250\340\244\225\340\244\276\340\244\260\340\245\200\340\244\270\340\244\202\340\244\254"
+  "\340\244\202\340\244\247\340\244\277\340\244\244\340\244\270\340\245\215\340\244\245\340\244\276\340\244\252\340"
+  "\244\250\340\244\276\340\244\270\340\245\215\340\244\265\340\245\200\340\244\225\340\244\276\340\244\260\340\244"
+  "\270\340\244\202\340\244\270\340\245\215\340\244\225\340\244\260\340\244\243\340\244\270\340\244\276\340\244\256"
+  "\340\244\227\340\245\215\340\244\260\340\245\200\340\244\232\340\244\277\340\244\237\340\245\215\340\244\240\340"
+  "\245\213\340\244\202\340\244\265\340\244\277\340\244\234\340\245\215\340\244\236\340\244\276\340\244\250\340\244"
+  "\205\340\244\256\340\245\207\340\244\260\340\244\277\340\244\225\340\244\276\340\244\265\340\244\277\340\244\255"
+  "\340\244\277\340\244\250\340\245\215\340\244\250\340\244\227\340\244\276\340\244\241\340\244\277\340\244\257\340"
+  "\244\276\340\244\201\340\244\225\340\245\215\340\244\257\340\245\213\340\244\202\340\244\225\340\244\277\340\244"
+  "\270\340\245\201\340\244\260\340\244\225\340\245\215\340\244\267\340\244\276\340\244\252\340\244\271\340\245\201"
+  "\340\244\201\340\244\232\340\244\244\340\245\200\340\244\252\340\245\215\340\244\260\340\244\254\340\244\202\340"
+  "\244\247\340\244\250\340\244\237\340\244\277\340\244\252\340\245\215\340\244\252\340\244\243\340\245\200\340\244"
+  "\225\340\245\215\340\244\260\340\244\277\340\244\225\340\245\207\340\244\237\340\244\252\340\245\215\340\244\260"
+  "\340\244\276\340\244\260\340\244\202\340\244\255\340\244\252\340\245\215\340\244\260\340\244\276\340\244\252\340"
+  "\245\215\340\244\244\340\244\256\340\244\276\340\244\262\340\244\277\340\244\225\340\245\213\340\244\202\340\244"
+  "\260\340\244\253\340\244\274\340\245\215\340\244\244\340\244\276\340\244\260\340\244\250\340\244\277\340\244\260"
+  "\340\245\215\340\244\256\340\244\276\340\244\243\340\244\262\340\244\277\340\244\256\340\244\277\340\244\237\340"
+  "\245\207\340\244\241description\" content=\"document.location.prot.getElementsByTagName(<!DOCTYPE html>\012<html <"
+  "meta charset=\"utf-8\">:url\" content=\"http://.css\" rel=\"stylesheet\"style type=\"text/css\">type=\"text/css\" "
+  "href=\"w3.org/1999/xhtml\" xmltype=\"text/javascript\" method=\"get\" action=\"link rel=\"stylesheet\"  = document"
+  ".getElementtype=\"image/x-icon\" />cellpadding=\"0\" cellsp.css\" type=\"text/css\" </a></li><li><a href=\"\" widt"
+  "h=\"1\" height=\"1\"\"><a href=\"http://www.style=\"display:none;\">alternate\" type=\"appli-//W3C//DTD XHTML 1.0 "
+  "ellspacing=\"0\" cellpad type=\"hidden\" value=\"/a>&nbsp;<span role=\"s\012<input type=\"hidden\" language=\"Java"
+  "Script\"  document.getElementsBg=\"0\" cellspacing=\"0\" ype=\"text/css\" media=\"type='text/javascript'with the e"
+  "xception of ype=\"text/css\" rel=\"st height=\"1\" width=\"1\" ='+encodeURIComponent(<link rel=\"alternate\" \012b"
+  "ody, tr, input, textmeta name=\"robots\" conmethod=\"post\" action=\">\012<a href=\"http://www.css\" rel=\"stylesh"
+  "eet\" </div></div><div classlanguage=\"javascript\">aria-hidden=\"true\">\302\267<ript\" type=\"text/javasl=0;})()"
+  ";\012(function(){background-image: url(/a></li><li><a href=\"h\011\011<li><a href=\"http://ator\" aria-hidden=\"tr"
+  "u> <a href=\"http://www.language=\"javascript\" /option>\012<option value/div></div><div class=rator\" aria-hidden"
+  "=\"tre=(new Date).getTime()portugu\303\252s (do Brasil)\320\276\321\200\320\263\320\260\320\275\320\270\320\267"
+  "\320\260\321\206\320\270\320\270\320\262\320\276\320\267\320\274\320\276\320\266\320\275\320\276\321\201\321\202"
+  "\321\214\320\276\320\261\321\200\320\260\320\267\320\276\320\262\320\260\320\275\320\270\321\217\321\200\320\265"
+  "\320\263\320\270\321\201\321\202\321\200\320\260\321\206\320\270\320\270\320\262\320\276\320\267\320\274\320\276"
+  "\320\266\320\275\320\276\321\201\321\202\320\270\320\276\320\261\321\217\320\267\320\260\321\202\320\265\320\273"
+  "\321\214\320\275\320\260<!DOCTYPE html PUBLIC \"nt-Type\" content=\"text/<meta http-equiv=\"Conteransitional//EN\""
+  " \"http:<html xmlns=\"http://www-//W3C//DTD XHTML 1.0 TDTD/xhtml1-transitional//www.w3.org/TR/xhtml1/pe = 'text/ja"
+  "vascript';<meta name=\"descriptionparentNode.insertBefore<input type=\"hidden\" najs\" type=\"text/javascri(docume"
+  "nt).ready(functiscript type=\"text/javasimage\" content=\"http://UA-Compatible\" content=tml; charset=utf-8\" />"
+  "\012link rel=\"shortcut icon<link rel=\"stylesheet\" </script>\012<script type== document.createElemen<a target=\""
+  "_blank\" href= document.getElementsBinput type=\"text\" name=a.type = 'text/javascrinput type=\"hidden\" namehtml;"
+  " charset=utf-8\" />dtd\">\012<html xmlns=\"http-//W3C//DTD HTML 4.01 TentsByTagName('script')input type=\"hidden\""
+  " nam<script type=\"text/javas\" style=\"display:none;\">document.getElementById(=document.createElement(' type='te"
+  "xt/javascript'input type=\"text\" name=\"d.getElementsByTagName(snical\" href=\"http://www.C//DTD HTML 4.01 Transi"
+  "t<style type=\"text/css\">\012\012<style type=\"text/css\">ional.dtd\">\012<html xmlns=http-equiv=\"Content-Typedi"
+  "ng=\"0\" cellspacing=\"0\"html; charset=utf-8\" />\012 style=\"display:none;\"><<li><a href=\"http://www. type='te"
+  "xt/javascript'>\320\264\320\265\321\217\321\202\320\265\320\273\321\214\320\275\320\276\321\201\321\202\320\270"
+  "\321\201\320\276\320\276\321\202\320\262\320\265\321\202\321\201\321\202\320\262\320\270\320\270\320\277\321\200"
+  "\320\276\320\270\320\267\320\262\320\276\320\264\321\201\321\202\320\262\320\260\320\261\320\265\320\267\320\276"
+  "\320\277\320\260\321\201\320\275\320\276\321\201\321\202\320\270\340\244\252\340\245\201\340\244\270\340\245\215"
+  "\340\244\244\340\244\277\340\244\225\340\244\276\340\244\225\340\244\276\340\244\202\340\244\227\340\245\215\340"
+  "\244\260\340\245\207\340\244\270\340\244\211\340\244\250\340\245\215\340\244\271\340\245\213\340\244\202\340\244"
+  "\250\340\245\207\340\244\265\340\244\277\340\244\247\340\244\276\340\244\250\340\244\270\340\244\255\340\244\276"
+  "\340\244\253\340\244\277\340\244\225\340\245\215\340\244\270\340\244\277\340\244\202\340\244\227\340\244\270\340"
+  "\245\201\340\244\260\340\244\225\340\245\215\340\244\267\340\244\277\340\244\244\340\244\225\340\245\211\340\244"
+  "\252\340\245\200\340\244\260\340\244\276\340\244\207\340\244\237\340\244\265\340\244\277\340\244\234\340\245\215"
+  "\340\244\236\340\244\276\340\244\252\340\244\250\340\244\225\340\244\276\340\244\260\340\245\215\340\244\260\340"
+  "\244\265\340\244\276\340\244\210\340\244\270\340\244\225\340\245\215\340\244\260\340\244\277\340\244\257\340\244"
+  "\244\340\244\276";
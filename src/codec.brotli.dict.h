@@ -0,0 +1,16 @@
+#pragma once
+
+#include "typing.h"
+
+#define CODEC_BROTLI_WORD_MIN 4               // shortest word of the static dictionary
+#define CODEC_BROTLI_WORD_MAX 24              // longest word of the static dictionary
+#define CODEC_BROTLI_DICTIONARY_SIZE 122784   // bytes of all words of the static dictionary
+
+/// @brief Number of bits indexing the words of every length.
+extern const u8 CODEC_BROTLI_DICTIONARY_BITS[CODEC_BROTLI_WORD_MAX + 1];
+
+/// @brief Offset of the first word of every length within the static dictionary.
+extern const u32 CODEC_BROTLI_DICTIONARY_OFFSETS[CODEC_BROTLI_WORD_MAX + 1];
+
+/// @brief Words of the static dictionary, grouped by their lengths without any separators.
+extern const char CODEC_BROTLI_DICTIONARY[CODEC_BROTLI_DICTIONARY_SIZE];
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "malloc.h"
+#include "runner.h"
+#include "typing.h"
+
+/// @brief Decompresses a Brotli stream.
+/// @param source Pointer to the compressed stream.
+/// @param source_size Number of bytes in the compressed stream.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param target_size Number of bytes the output can hold, excluding the slack.
+/// @param pool Pointer to the malloc_pool structure providing the decoding tables.
+/// @return The number of decompressed bytes, or a negative error code on failure.
+extern i64 codec_brotli_decompress(
+  const char *source, u64 source_size, char *target, u64 target_size, struct malloc_pool *pool);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers brotli test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void codec_test_cases_brotli(struct runner_context *ctx);
+
+#endif
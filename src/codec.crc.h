@@ -0,0 +1,19 @@
+#pragma once
+
+#include "runner.h"
+#include "typing.h"
+
+/// @brief Extends a CRC-32 (ISO-HDLC, as used by gzip and parquet pages) with more bytes.
+/// @param crc The CRC-32 of the preceding bytes, zero for the first call.
+/// @param buffer Pointer to the bytes.
+/// @param size Number of bytes.
+/// @return The CRC-32 of the preceding bytes followed by the given ones.
+extern u32 codec_crc32(u32 crc, const char *buffer, u64 size);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers crc test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void codec_test_cases_crc(struct runner_context *ctx);
+
+#endif
@@ -0,0 +1,855 @@
+#include "codec.gzip.h"
+#include "codec.base.h"
+#include "codec.crc.h"
+#include "malloc.h"
+#include "runner.h"
+#include "typing.h"
+
+#define CODEC_GZIP_MAGIC 0x8b1f // first two bytes of a member
+#define CODEC_GZIP_DEFLATE 8    // the only compression method
+
+#define CODEC_GZIP_FLAG_HCRC 0x02     // the header ends with its own 16-bit crc
+#define CODEC_GZIP_FLAG_EXTRA 0x04    // the header carries an extra field
+#define CODEC_GZIP_FLAG_NAME 0x08     // the header carries a zero-terminated name
+#define CODEC_GZIP_FLAG_COMMENT 0x10  // the header carries a zero-terminated comment
+#define CODEC_GZIP_FLAG_RESERVED 0xe0 // flags which must be clear
+
+#define CODEC_GZIP_BLOCK_STORED 0  // block stored as is
+#define CODEC_GZIP_BLOCK_FIXED 1   // block using the fixed codes
+#define CODEC_GZIP_BLOCK_DYNAMIC 2 // block describing its own codes
+
+#define CODEC_GZIP_CODE_MAX 15         // longest code
+#define CODEC_GZIP_LITLEN_BITS 11      // bits indexing the literal/length table
+#define CODEC_GZIP_DISTANCE_BITS 8     // bits indexing the distance table
+#define CODEC_GZIP_LENGTHS_BITS 7      // bits indexing the code length table, enough for all its codes
+#define CODEC_GZIP_LITLEN_SYMBOLS 288  // literals, end of block and lengths, including two unused ones
+#define CODEC_GZIP_DISTANCE_SYMBOLS 32 // distances, including two unused ones
+#define CODEC_GZIP_LENGTHS_SYMBOLS 19  // code length symbols
+
+#define CODEC_GZIP_LITLEN_SIZE ((1 << CODEC_GZIP_LITLEN_BITS) + 1024)     // entries with room for subtables
+#define CODEC_GZIP_DISTANCE_SIZE ((1 << CODEC_GZIP_DISTANCE_BITS) + 1024) // entries with room for subtables
+
+#define CODEC_GZIP_LITERAL 0x00  // entry decoding a single literal
+#define CODEC_GZIP_LITERALS 0x01 // entry decoding two literals at once
+#define CODEC_GZIP_END 0x02      // entry ending the block
+#define CODEC_GZIP_SUBTABLE 0x03 // entry pointing to a subtable of longer codes
+#define CODEC_GZIP_INVALID 0x04  // entry without any code
+#define CODEC_GZIP_MATCH 0x10    // entry decoding a length or distance base, extra bits in the low nibble
+
+struct codec_gzip_entry {
+  u16 value; // literal(s), base, symbol or subtable offset
+  u8 bits;   // bits consumed by the code(s)
+  u8 tag;    // kind of the entry
+};
+
+struct codec_gzip_bits {
+  const char *ptr; // next byte to load
+  const char *end; // end of the input
+  u64 container;   // loaded bits, the next one lowest
+  u32 count;       // number of loaded bits
+  u32 overrun;     // zero bytes loaded past the end of the input
+};
+
+struct codec_gzip_state {
+  u32 fixed; // whether the tables hold the fixed codes
+
+  struct codec_gzip_entry litlen[CODEC_GZIP_LITLEN_SIZE];       // literal/length table and subtables
+  struct codec_gzip_entry distance[CODEC_GZIP_DISTANCE_SIZE];   // distance table and subtables
+  struct codec_gzip_entry lengths[1 << CODEC_GZIP_LENGTHS_BITS]; // code length table
+};
+
+// order in which the code length code lengths are stored
+static const u8 CODEC_GZIP_LENGTHS_ORDER[CODEC_GZIP_LENGTHS_SYMBOLS] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15,
+};
+
+static inline void codec_gzip_refill(struct codec_gzip_bits *bits) {
+  // far from the end, load 8 bytes and keep the whole ones, the rest is loaded again next time
+  if (bits->end - bits->ptr >= 8) {
+    bits->container |= *(const u64 *)bits->ptr << bits->count;
+    bits->ptr += (63 - bits->count) >> 3;
+    bits->count |= 56;
+    return;
+  }
+
+  // near the end byte by byte, zeros past the end are counted to detect truncation
+  while (bits->count <= 56) {
+    if (bits->ptr < bits->end) {
+      bits->container |= (u64)(u8)*bits->ptr++ << bits->count;
+    } else {
+      bits->overrun++;
+    }
+
+    bits->count += 8;
+  }
+}
+
+static inline void codec_gzip_consume(struct codec_gzip_bits *bits, u32 count) {
+  // drop the lowest bits
+  bits->container >>= count;
+  bits->count -= count;
+}
+
+static bool codec_gzip_truncated(const struct codec_gzip_bits *bits) {
+  // some of the zeros past the end were consumed
+  return bits->count < bits->overrun * 8;
+}
+
+static struct codec_gzip_entry codec_gzip_symbol(u32 kind, u32 symbol) {
+  struct codec_gzip_entry entry;
+  u32 extra;
+
+  // code length symbols and literals are plain values
+  entry.value = symbol;
+  entry.tag = CODEC_GZIP_LITERAL;
+
+  if (kind == CODEC_GZIP_LENGTHS_SYMBOLS) return entry;
+
+  if (kind == CODEC_GZIP_LITLEN_SYMBOLS) {
+    if (symbol < 256) return entry;
+    symbol -= 257;
+
+    // end of block, then lengths 3 to 10, then groups of 4 with one more extra bit each, then 258
+    if (symbol == (u32)-1) {
+      entry.tag = CODEC_GZIP_END;
+    } else if (symbol < 8) {
+      entry.value = symbol + 3;
+      entry.tag = CODEC_GZIP_MATCH;
+    } else if (symbol < 28) {
+      extra = (symbol >> 2) - 1;
+      entry.value = ((4 + (symbol & 0x03)) << extra) + 3;
+      entry.tag = CODEC_GZIP_MATCH | extra;
+    } else if (symbol == 28) {
+      entry.value = 258;
+      entry.tag = CODEC_GZIP_MATCH;
+    } else {
+      entry.tag = CODEC_GZIP_INVALID;
+    }
+
+    return entry;
+  }
+
+  // distances 1 to 4, then pairs with one more extra bit each
+  if (symbol < 4) {
+    entry.value = symbol + 1;
+    entry.tag = CODEC_GZIP_MATCH;
+  } else if (symbol < 30) {
+    extra = (symbol >> 1) - 1;
+    entry.value = ((2 + (symbol & 0x01)) << extra) + 1;
+    entry.tag = CODEC_GZIP_MATCH | extra;
+  } else {
+    entry.tag = CODEC_GZIP_INVALID;
+  }
+
+  return entry;
+}
+
+static u32 codec_gzip_reverse(u32 code, u32 length) {
+  u32 index, reversed;
+
+  // codes are stored starting with their highest bit
+  for (index = 0, reversed = 0; index < length; index++) {
+    reversed = (reversed << 1) | ((code >> index) & 0x01);
+  }
+
+  return reversed;
+}
+
+static i64 codec_gzip_build(
+  struct codec_gzip_entry *table, u32 capacity, u32 root, const u8 *lengths, u32 symbols, u32 kind) {
+  i32 left;
+  u32 index, length, longest, code, symbol, position, prefix, base, bits, used;
+  u16 counts[CODEC_GZIP_CODE_MAX + 1], offsets[CODEC_GZIP_CODE_MAX + 2], sorted[CODEC_GZIP_LITLEN_SYMBOLS];
+  struct codec_gzip_entry entry, invalid;
+
+  // count the codes of each length
+  for (length = 0; length <= CODEC_GZIP_CODE_MAX; length++) {
+    counts[length] = 0;
+  }
+
+  for (symbol = 0, longest = 0; symbol < symbols; symbol++) {
+    counts[lengths[symbol]]++;
+    longest = lengths[symbol] > longest ? lengths[symbol] : longest;
+  }
+
+  // the lengths must not describe more codes than exist, fewer are tolerated
+  for (length = 1, left = 1; length <= CODEC_GZIP_CODE_MAX; length++) {
+    left = (left << 1) - counts[length];
+    if (left < 0) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  // sort the symbols by their lengths, then by their values
+  for (length = 1, offsets[1] = 0; length <= CODEC_GZIP_CODE_MAX; length++) {
+    offsets[length + 1] = offsets[length] + counts[length];
+  }
+
+  for (symbol = 0; symbol < symbols; symbol++) {
+    if (lengths[symbol] > 0) sorted[offsets[lengths[symbol]]++] = symbol;
+  }
+
+  // entries without a code fail the decoding
+  invalid.value = 0;
+  invalid.bits = 1;
+  invalid.tag = CODEC_GZIP_INVALID;
+
+  for (index = 0; index < (1u << root); index++) {
+    table[index] = invalid;
+  }
+
+  // assign the canonical codes in order, longer codes go into subtables behind their first root bits
+  used = 1 << root;
+  prefix = (u32)-1;
+  base = 0;
+  bits = 0;
+  position = 0;
+
+  for (length = 1, code = 0; length <= CODEC_GZIP_CODE_MAX; length++, code <<= 1) {
+    while (counts[length] > 0) {
+      entry = codec_gzip_symbol(kind, sorted[position++]);
+
+      if (length <= root) {
+        entry.bits = length;
+
+        for (index = codec_gzip_reverse(code, length); index < (1u << root); index += 1 << length) {
+          table[index] = entry;
+        }
+      } else {
+        // a new prefix opens a subtable wide enough for all remaining codes sharing it
+        if ((index = codec_gzip_reverse(code >> (length - root), root)) != prefix) {
+          prefix = index;
+          bits = length - root;
+          left = 1 << bits;
+
+          while (bits + root < longest) {
+            left -= counts[bits + root];
+            if (left <= 0) break;
+
+            bits++;
+            left <<= 1;
+          }
+
+          if (used + (1 << bits) > capacity) return CODEC_ERROR_INVALID_INPUT;
+
+          table[prefix].value = used;
+          table[prefix].bits = bits;
+          table[prefix].tag = CODEC_GZIP_SUBTABLE;
+
+          for (index = 0; index < (1u << bits); index++) {
+            table[used + index] = invalid;
+          }
+
+          base = used;
+          used += 1 << bits;
+        }
+
+        // the remaining bits of the code index the subtable
+        entry.bits = length - root;
+        index = codec_gzip_reverse(code & ((1 << entry.bits) - 1), entry.bits);
+
+        for (; index < (1u << bits); index += 1 << entry.bits) {
+          table[base + index] = entry;
+        }
+      }
+
+      counts[length]--;
+      code++;
+    }
+  }
+
+  // success
+  return 0;
+}
+
+static void codec_gzip_pair(struct codec_gzip_entry *table) {
+  u32 index;
+  struct codec_gzip_entry first, second;
+
+  // a short literal code leaves bits which may already hold the next literal, backwards keeps those single
+  for (index = 1 << CODEC_GZIP_LITLEN_BITS; index-- > 0;) {
+    first = table[index];
+    if (first.tag != CODEC_GZIP_LITERAL || first.bits >= CODEC_GZIP_LITLEN_BITS) continue;
+
+    second = table[index >> first.bits];
+    if (second.tag != CODEC_GZIP_LITERAL || first.bits + second.bits > CODEC_GZIP_LITLEN_BITS) continue;
+
+    table[index].value = first.value | (second.value << 8);
+    table[index].bits = first.bits + second.bits;
+    table[index].tag = CODEC_GZIP_LITERALS;
+  }
+}
+
+static i64 codec_gzip_fixed(struct codec_gzip_state *state) {
+  i64 result;
+  u32 symbol;
+  u8 lengths[CODEC_GZIP_LITLEN_SYMBOLS];
+
+  // the fixed literal/length codes
+  for (symbol = 0; symbol < CODEC_GZIP_LITLEN_SYMBOLS; symbol++) {
+    lengths[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+  }
+
+  result = codec_gzip_build(state->litlen, CODEC_GZIP_LITLEN_SIZE, CODEC_GZIP_LITLEN_BITS, lengths,
+                            CODEC_GZIP_LITLEN_SYMBOLS, CODEC_GZIP_LITLEN_SYMBOLS);
+  if (result < 0) return result;
+
+  codec_gzip_pair(state->litlen);
+
+  // and the fixed distance codes
+  for (symbol = 0; symbol < CODEC_GZIP_DISTANCE_SYMBOLS; symbol++) {
+    lengths[symbol] = 5;
+  }
+
+  result = codec_gzip_build(state->distance, CODEC_GZIP_DISTANCE_SIZE, CODEC_GZIP_DISTANCE_BITS, lengths,
+                            CODEC_GZIP_DISTANCE_SYMBOLS, CODEC_GZIP_DISTANCE_SYMBOLS);
+  if (result < 0) return result;
+
+  // success
+  state->fixed = 1;
+  return 0;
+}
+
+static i64 codec_gzip_dynamic(struct codec_gzip_state *state, struct codec_gzip_bits *bits) {
+  i64 result;
+  u32 index, literals, distances, codes, repeat;
+  u8 value, lengths[CODEC_GZIP_LITLEN_SYMBOLS + CODEC_GZIP_DISTANCE_SYMBOLS];
+
+  struct codec_gzip_entry entry;
+
+  // the numbers of codes of each table
+  codec_gzip_refill(bits);
+
+  literals = (bits->container & 0x1f) + 257;
+  distances = ((bits->container >> 5) & 0x1f) + 1;
+  codes = ((bits->container >> 10) & 0x0f) + 4;
+  codec_gzip_consume(bits, 14);
+
+  if (literals > 286 || distances > 30) return CODEC_ERROR_INVALID_INPUT;
+
+  // the code length codes come in a fixed order, 3 bits each
+  for (index = 0; index < CODEC_GZIP_LENGTHS_SYMBOLS; index++) {
+    lengths[CODEC_GZIP_LENGTHS_ORDER[index]] = 0;
+  }
+
+  for (index = 0; index < codes; index++) {
+    codec_gzip_refill(bits);
+
+    lengths[CODEC_GZIP_LENGTHS_ORDER[index]] = bits->container & 0x07;
+    codec_gzip_consume(bits, 3);
+  }
+
+  result = codec_gzip_build(state->lengths, 1 << CODEC_GZIP_LENGTHS_BITS, CODEC_GZIP_LENGTHS_BITS, lengths,
+                            CODEC_GZIP_LENGTHS_SYMBOLS, CODEC_GZIP_LENGTHS_SYMBOLS);
+  if (result < 0) return result;
+
+  // the lengths of both tables form a single sequence with repeats
+  for (index = 0; index < literals + distances;) {
+    codec_gzip_refill(bits);
+
+    entry = state->lengths[bits->container & ((1 << CODEC_GZIP_LENGTHS_BITS) - 1)];
+    if (entry.tag == CODEC_GZIP_INVALID) return CODEC_ERROR_INVALID_INPUT;
+
+    codec_gzip_consume(bits, entry.bits);
+
+    // lengths themselves
+    if (entry.value < 16) {
+      lengths[index++] = entry.value;
+      continue;
+    }
+
+    // or repeats of the previous length or of zero
+    if (entry.value == 16) {
+      if (index == 0) return CODEC_ERROR_INVALID_INPUT;
+
+      value = lengths[index - 1];
+      repeat = 3 + (bits->container & 0x03);
+      codec_gzip_consume(bits, 2);
+    } else if (entry.value == 17) {
+      value = 0;
+      repeat = 3 + (bits->container & 0x07);
+      codec_gzip_consume(bits, 3);
+    } else {
+      value = 0;
+      repeat = 11 + (bits->container & 0x7f);
+      codec_gzip_consume(bits, 7);
+    }
+
+    if (repeat > literals + distances - index) return CODEC_ERROR_INVALID_INPUT;
+
+    while (repeat-- > 0) {
+      lengths[index++] = value;
+    }
+  }
+
+  // the end of block must have a code
+  if (lengths[256] == 0 || codec_gzip_truncated(bits)) return CODEC_ERROR_INVALID_INPUT;
+
+  // build both tables
+  result = codec_gzip_build(state->litlen, CODEC_GZIP_LITLEN_SIZE, CODEC_GZIP_LITLEN_BITS, lengths, literals,
+                            CODEC_GZIP_LITLEN_SYMBOLS);
+  if (result < 0) return result;
+
+  codec_gzip_pair(state->litlen);
+
+  result = codec_gzip_build(state->distance, CODEC_GZIP_DISTANCE_SIZE, CODEC_GZIP_DISTANCE_BITS, lengths + literals,
+                            distances, CODEC_GZIP_DISTANCE_SYMBOLS);
+  if (result < 0) return result;
+
+  // success
+  state->fixed = 0;
+  return 0;
+}
+
+static i64 codec_gzip_stored(struct codec_gzip_bits *bits, char *target, u64 *produced, u64 limit) {
+  u32 length;
+  u64 available;
+
+  // the length and its complement start at the next byte
+  codec_gzip_consume(bits, bits->count & 0x07);
+  codec_gzip_refill(bits);
+
+  length = bits->container & 0xffff;
+  if (((length ^ (bits->container >> 16)) & 0xffff) != 0xffff) return CODEC_ERROR_INVALID_INPUT;
+
+  codec_gzip_consume(bits, 32);
+  if (codec_gzip_truncated(bits)) return CODEC_ERROR_INVALID_INPUT;
+
+  // the bytes follow the loaded ones, which are given back
+  bits->ptr -= (bits->count >> 3) - bits->overrun;
+  bits->container = 0;
+  bits->count = 0;
+  bits->overrun = 0;
+
+  available = bits->end - bits->ptr;
+  if (length > available) return CODEC_ERROR_INVALID_INPUT;
+  if (length > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+  codec_copy_exact(target + *produced, bits->ptr, length);
+  bits->ptr += length;
+  *produced += length;
+
+  // success
+  return 0;
+}
+
+static i64 codec_gzip_block(struct codec_gzip_state *state,
+                            struct codec_gzip_bits *bits,
+                            char *target,
+                            u64 *produced,
+                            u64 limit,
+                            u64 start) {
+  u32 extra;
+  u64 length, distance;
+
+  struct codec_gzip_entry entry;
+
+  while (1) {
+    // one refill covers the longest length and distance codes with their extra bits
+    codec_gzip_refill(bits);
+    entry = state->litlen[bits->container & ((1 << CODEC_GZIP_LITLEN_BITS) - 1)];
+
+    // two literals at once
+    if (entry.tag == CODEC_GZIP_LITERALS) {
+      if (limit - *produced < 2) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+      *(u16 *)(target + *produced) = entry.value;
+      *produced += 2;
+
+      codec_gzip_consume(bits, entry.bits);
+      continue;
+    }
+
+    // longer codes continue in a subtable
+    if (entry.tag == CODEC_GZIP_SUBTABLE) {
+      codec_gzip_consume(bits, CODEC_GZIP_LITLEN_BITS);
+      entry = state->litlen[entry.value + (bits->container & ((1 << entry.bits) - 1))];
+    }
+
+    codec_gzip_consume(bits, entry.bits);
+
+    // a single literal
+    if (entry.tag == CODEC_GZIP_LITERAL) {
+      if (limit == *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+      target[(*produced)++] = entry.value;
+      continue;
+    }
+
+    // the end of the block
+    if (entry.tag == CODEC_GZIP_END) break;
+    if (entry.tag == CODEC_GZIP_INVALID) return CODEC_ERROR_INVALID_INPUT;
+
+    // otherwise a length with its extra bits
+    extra = entry.tag & 0x0f;
+    length = entry.value + (bits->container & ((1 << extra) - 1));
+    codec_gzip_consume(bits, extra);
+
+    // followed by a distance
+    entry = state->distance[bits->container & ((1 << CODEC_GZIP_DISTANCE_BITS) - 1)];
+
+    if (entry.tag == CODEC_GZIP_SUBTABLE) {
+      codec_gzip_consume(bits, CODEC_GZIP_DISTANCE_BITS);
+      entry = state->distance[entry.value + (bits->container & ((1 << entry.bits) - 1))];
+    }
+
+    codec_gzip_consume(bits, entry.bits);
+    if (entry.tag < CODEC_GZIP_MATCH) return CODEC_ERROR_INVALID_INPUT;
+
+    extra = entry.tag & 0x0f;
+    distance = entry.value + (bits->container & ((1 << extra) - 1));
+    codec_gzip_consume(bits, extra);
+
+    // the match must repeat output of the same member and fit
+    if (distance > *produced - start) return CODEC_ERROR_INVALID_INPUT;
+    if (length > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+    codec_copy_match(target + *produced, distance, length);
+    *produced += length;
+  }
+
+  // success
+  return 0;
+}
+
+static i64 codec_gzip_inflate(
+  struct codec_gzip_state *state, struct codec_gzip_bits *bits, char *target, u64 *produced, u64 limit) {
+  i64 result;
+  u32 type;
+  u64 start;
+  bool last;
+
+  // matches cannot reach before the member
+  start = *produced;
+
+  do {
+    // each block starts with 3 bits
+    codec_gzip_refill(bits);
+
+    last = bits->container & 0x01;
+    type = (bits->container >> 1) & 0x03;
+    codec_gzip_consume(bits, 3);
+
+    switch (type) {
+      case CODEC_GZIP_BLOCK_STORED:
+        result = codec_gzip_stored(bits, target, produced, limit);
+        break;
+
+      case CODEC_GZIP_BLOCK_FIXED:
+        result = state->fixed ? 0 : codec_gzip_fixed(state);
+        result = result < 0 ? result : codec_gzip_block(state, bits, target, produced, limit, start);
+        break;
+
+      case CODEC_GZIP_BLOCK_DYNAMIC:
+        result = codec_gzip_dynamic(state, bits);
+        result = result < 0 ? result : codec_gzip_block(state, bits, target, produced, limit, start);
+        break;
+
+      default:
+        return CODEC_ERROR_INVALID_INPUT;
+    }
+
+    // the block must be complete
+    if (result < 0) return result;
+    if (codec_gzip_truncated(bits)) return CODEC_ERROR_INVALID_INPUT;
+  } while (!last);
+
+  // success
+  return 0;
+}
+
+static i64 codec_gzip_header(const char *source, u64 size) {
+  u8 flags;
+  u64 offset;
+
+  // the fixed part identifies the member
+  if (size < 10) return CODEC_ERROR_INVALID_INPUT;
+  if ((u8)source[0] != (CODEC_GZIP_MAGIC & 0xff) || (u8)source[1] != (CODEC_GZIP_MAGIC >> 8)) {
+    return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  if (source[2] != CODEC_GZIP_DEFLATE) return CODEC_ERROR_UNSUPPORTED;
+
+  flags = source[3];
+  if (flags & CODEC_GZIP_FLAG_RESERVED) return CODEC_ERROR_INVALID_INPUT;
+
+  // the optional parts follow in a fixed order
+  offset = 10;
+
+  if (flags & CODEC_GZIP_FLAG_EXTRA) {
+    if (size - offset < 2) return CODEC_ERROR_INVALID_INPUT;
+    offset += 2 + ((u8)source[offset] | ((u64)(u8)source[offset + 1] << 8));
+    if (offset > size) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  if (flags & CODEC_GZIP_FLAG_NAME) {
+    while (offset < size && source[offset] != 0) offset++;
+    if (offset++ == size) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  if (flags & CODEC_GZIP_FLAG_COMMENT) {
+    while (offset < size && source[offset] != 0) offset++;
+    if (offset++ == size) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  if (flags & CODEC_GZIP_FLAG_HCRC) {
+    offset += 2;
+    if (offset > size) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  // success
+  return offset;
+}
+
+i64 codec_gzip_decompress(const char *source,
+                          u64 source_size,
+                          char *target,
+                          u64 target_size,
+                          struct malloc_pool *pool,
+                          bool verify) {
+  i64 result;
+  u32 crc, length;
+  u64 offset, produced, start;
+
+  struct malloc_lease lease;
+  struct codec_gzip_state *state;
+  struct codec_gzip_bits bits;
+
+  // the decoding tables
+  lease.size = malloc_fit(sizeof(struct codec_gzip_state));
+
+  result = malloc_acquire(pool, &lease);
+  if (result < 0) return result;
+
+  state = lease.ptr;
+  state->fixed = 0;
+
+  offset = 0;
+  produced = 0;
+
+  do {
+    // each member starts with a header
+    result = codec_gzip_header(source + offset, source_size - offset);
+    if (result < 0) goto cleanup;
+
+    offset += result;
+    start = produced;
+
+    // followed by the deflate stream
+    bits.ptr = source + offset;
+    bits.end = source + source_size;
+    bits.container = 0;
+    bits.count = 0;
+    bits.overrun = 0;
+
+    result = codec_gzip_inflate(state, &bits, target, &produced, target_size);
+    if (result < 0) goto cleanup;
+
+    // the stream ends at a byte boundary, the bytes loaded beyond it are given back
+    codec_gzip_consume(&bits, bits.count & 0x07);
+    offset = bits.ptr - source - ((bits.count >> 3) - bits.overrun);
+
+    // and the trailer holds the crc and the length of the member
+    result = CODEC_ERROR_INVALID_INPUT;
+    if (source_size - offset < 8) goto cleanup;
+
+    crc = (u8)source[offset] | (u32)(u8)source[offset + 1] << 8;
+    crc |= (u32)(u8)source[offset + 2] << 16 | (u32)(u8)source[offset + 3] << 24;
+
+    length = (u8)source[offset + 4] | (u32)(u8)source[offset + 5] << 8;
+    length |= (u32)(u8)source[offset + 6] << 16 | (u32)(u8)source[offset + 7] << 24;
+
+    if (length != (u32)(produced - start)) goto cleanup;
+    offset += 8;
+
+    // the crc is the expensive part, it may be skipped
+    result = CODEC_ERROR_CHECKSUM_MISMATCH;
+    if (verify && codec_crc32(0, target + start, produced - start) != crc) goto cleanup;
+  } while (offset < source_size);
+
+  // success
+  result = produced;
+
+cleanup:
+  malloc_release(pool, &lease);
+  return result;
+}
+
+#if defined(I13C_TESTS)
+
+static void can_decompress_gzip_fixed_block() {
+  i64 result;
+  u32 index;
+  char target[23 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // literals and a match with the fixed codes
+  const u8 source[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcb, 0x48, 0xcd, 0xc9,
+    0xc9, 0x57, 0xc8, 0x40, 0x27, 0x01, 0xe3, 0x51, 0x3d, 0x8d, 0x17, 0x00, 0x00, 0x00,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 23, &pool, 1);
+  assert(result == 23, "should decompress 23 bytes");
+
+  // assert the output
+  for (index = 0; index < 23; index++) {
+    assert(target[index] == "hello hello hello hello"[index], "byte should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_gzip_dynamic_block() {
+  i64 result;
+  u32 index, seed;
+  char target[100 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // 100 pseudo-random letters with their own codes
+  const u8 source[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x15, 0x8a, 0xc1, 0x09, 0x00, 0x41, 0x08, 0x03,
+    0x5b, 0x49, 0x6b, 0x3e, 0x06, 0xf4, 0xa3, 0xe0, 0xa6, 0x7f, 0xce, 0x7b, 0x24, 0x30, 0x99, 0xa4, 0x0c, 0x46,
+    0xb0, 0x57, 0x4b, 0x85, 0x9c, 0x44, 0x2f, 0x41, 0x87, 0x45, 0x9f, 0x9f, 0x71, 0x28, 0x57, 0x3a, 0x04, 0xed,
+    0xfb, 0xff, 0x8e, 0x95, 0xe7, 0xb7, 0x4d, 0x1a, 0x67, 0x35, 0x3e, 0x7c, 0x8f, 0xb9, 0xbd, 0x14, 0x55, 0xbe,
+    0x68, 0x3e, 0x27, 0xf9, 0xd6, 0xd9, 0x64, 0x00, 0x00, 0x00,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 100, &pool, 1);
+  assert(result == 100, "should decompress 100 bytes");
+
+  // assert the letters were drawn by the same generator
+  for (index = 0, seed = 7; index < 100; index++) {
+    seed = seed * 1103515245 + 12345;
+    assert(target[index] == "eeeettaaoinshr  "[(seed >> 16) & 0x0f], "letter should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_gzip_stored_members() {
+  i64 result;
+  u32 index;
+  char target[6 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // two members, each with a named header and a stored block of abc
+  const u8 source[] = {
+    0x1f, 0x8b, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 'x', 0x00,      // header with a name
+    0x01, 0x03, 0x00, 0xfc, 0xff, 'a', 'b', 'c',                               // final stored block
+    0xc2, 0x41, 0x24, 0x35, 0x03, 0x00, 0x00, 0x00,                            // crc and length
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,                // plain header
+    0x01, 0x03, 0x00, 0xfc, 0xff, 'a', 'b', 'c',                               // final stored block
+    0xc2, 0x41, 0x24, 0x35, 0x03, 0x00, 0x00, 0x00,                            // crc and length
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 6, &pool, 1);
+  assert(result == 6, "should decompress 6 bytes");
+
+  // assert both members
+  for (index = 0; index < 6; index++) {
+    assert(target[index] == "abcabc"[index], "byte should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_gzip_checksum_mismatch() {
+  i64 result;
+  char target[3 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // a stored block of abc with a wrong crc
+  const u8 source[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x03, 0x00, 0xfc,
+    0xff, 'a',  'b',  'c',  0xc3, 0x41, 0x24, 0x35, 0x03, 0x00, 0x00, 0x00,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it with verification
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 3, &pool, 1);
+  assert(result == CODEC_ERROR_CHECKSUM_MISMATCH, "should fail with CODEC_ERROR_CHECKSUM_MISMATCH");
+
+  // and without it
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 3, &pool, 0);
+  assert(result == 3, "should decompress 3 bytes");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_gzip_truncated_stream() {
+  i64 result;
+  char target[23 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // the fixed block without its trailer and last byte
+  const u8 source[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
+    0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57, 0xc8, 0x40, 0x27,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 23, &pool, 1);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_gzip_output_overflow() {
+  i64 result;
+  char target[10 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // the fixed block of 23 bytes
+  const u8 source[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcb, 0x48, 0xcd, 0xc9,
+    0xc9, 0x57, 0xc8, 0x40, 0x27, 0x01, 0xe3, 0x51, 0x3d, 0x8d, 0x17, 0x00, 0x00, 0x00,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it into a smaller output
+  result = codec_gzip_decompress((const char *)source, sizeof(source), target, 10, &pool, 1);
+  assert(result == CODEC_ERROR_OUTPUT_OVERFLOW, "should fail with CODEC_ERROR_OUTPUT_OVERFLOW");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+void codec_test_cases_gzip(struct runner_context *ctx) {
+  test_case(ctx, "can decompress gzip fixed block", can_decompress_gzip_fixed_block);
+  test_case(ctx, "can decompress gzip dynamic block", can_decompress_gzip_dynamic_block);
+  test_case(ctx, "can decompress gzip stored members", can_decompress_gzip_stored_members);
+  test_case(ctx, "can detect gzip checksum mismatch", can_detect_gzip_checksum_mismatch);
+  test_case(ctx, "can detect gzip truncated stream", can_detect_gzip_truncated_stream);
+  test_case(ctx, "can detect gzip output overflow", can_detect_gzip_output_overflow);
+}
+
+#endif
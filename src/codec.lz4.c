@@ -0,0 +1,306 @@
+#include "codec.lz4.h"
+#include "codec.base.h"
+#include "runner.h"
+#include "typing.h"
+
+#define CODEC_LZ4_RUN_MASK 0x0f  // length nibble announcing extension bytes
+#define CODEC_LZ4_MATCH_MIN 4    // shortest match, added to every match length
+#define CODEC_LZ4_HADOOP_SIZE 4  // bytes of every big-endian Hadoop length prefix
+
+// sixteen bytes, loaded and stored without any alignment requirement
+typedef u8 codec_lz4_bytes __attribute__((vector_size(16), aligned(1)));
+
+static inline i64 codec_lz4_length(const char *source, u64 source_size, u64 *offset, u64 *length) {
+  u8 byte;
+
+  // extension bytes are added while they are saturated
+  do {
+    if (*offset == source_size) return CODEC_ERROR_INVALID_INPUT;
+    byte = source[(*offset)++];
+    *length += byte;
+  } while (byte == 0xff);
+
+  // success
+  return 0;
+}
+
+i64 codec_lz4_decompress(const char *source, u64 source_size, char *target, u64 target_size) {
+  u8 token;
+  i64 result;
+  u64 offset, produced, size, distance;
+
+  // defaults
+  offset = 0;
+  produced = 0;
+
+  for (;;) {
+    // every sequence starts with a token, the block cannot end before the last literals
+    if (offset == source_size) return CODEC_ERROR_INVALID_INPUT;
+    token = source[offset++];
+
+    // the literal length is in the high nibble
+    size = token >> 4;
+
+    // short literals followed by a distance are copied as a single chunk while both buffers have room
+    if (size < CODEC_LZ4_RUN_MASK && source_size - offset >= sizeof(codec_lz4_bytes) + 2 &&
+        target_size - produced >= sizeof(codec_lz4_bytes)) {
+      *(codec_lz4_bytes *)(target + produced) = *(const codec_lz4_bytes *)(source + offset);
+    } else {
+      // possibly extended
+      if (size == CODEC_LZ4_RUN_MASK) {
+        result = codec_lz4_length(source, source_size, &offset, &size);
+        if (result < 0) return result;
+      }
+
+      // the literals must be available and fit
+      if (size > source_size - offset) return CODEC_ERROR_INVALID_INPUT;
+      if (size > target_size - produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+      // copy in whole chunks unless it would read past the block
+      if (source_size - offset - size >= CODEC_SLACK) {
+        codec_copy_wild(target + produced, source + offset, size);
+      } else {
+        codec_copy_exact(target + produced, source + offset, size);
+      }
+
+      // the last sequence has no match
+      if (offset + size == source_size) return produced + size;
+    }
+
+    offset += size;
+    produced += size;
+
+    // a little-endian distance of two bytes
+    if (source_size - offset < 2) return CODEC_ERROR_INVALID_INPUT;
+    distance = (u8)source[offset] | ((u64)(u8)source[offset + 1] << 8);
+    offset += 2;
+
+    // the match length is in the low nibble
+    size = token & CODEC_LZ4_RUN_MASK;
+
+    // short matches not overlapping a chunk are copied as two chunks while the output has room
+    if (size < CODEC_LZ4_RUN_MASK && distance >= sizeof(codec_lz4_bytes) && distance <= produced &&
+        target_size - produced >= 2 * sizeof(codec_lz4_bytes)) {
+      *(codec_lz4_bytes *)(target + produced) = *(const codec_lz4_bytes *)(target + produced - distance);
+      *(codec_lz4_bytes *)(target + produced + 16) = *(const codec_lz4_bytes *)(target + produced - distance + 16);
+
+      produced += size + CODEC_LZ4_MATCH_MIN;
+      continue;
+    }
+
+    // possibly extended
+    if (size == CODEC_LZ4_RUN_MASK) {
+      result = codec_lz4_length(source, source_size, &offset, &size);
+      if (result < 0) return result;
+    }
+
+    size += CODEC_LZ4_MATCH_MIN;
+
+    // the match must start within the output and fit
+    if (distance == 0 || distance > produced) return CODEC_ERROR_INVALID_INPUT;
+    if (size > target_size - produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+    codec_copy_match(target + produced, distance, size);
+    produced += size;
+  }
+}
+
+static u64 codec_lz4_read(const char *source) {
+  // big-endian 32-bit length
+  return ((u64)(u8)source[0] << 24) | ((u64)(u8)source[1] << 16) | ((u64)(u8)source[2] << 8) | (u8)source[3];
+}
+
+static i64 codec_lz4_hadoop(const char *source, u64 source_size, char *target, u64 target_size) {
+  i64 result;
+  u64 offset, produced, expected, done, size;
+
+  // defaults
+  offset = 0;
+  produced = 0;
+
+  while (offset < source_size) {
+    // every frame starts with its decompressed length
+    if (source_size - offset < CODEC_LZ4_HADOOP_SIZE) return CODEC_ERROR_INVALID_INPUT;
+    expected = codec_lz4_read(source + offset);
+    offset += CODEC_LZ4_HADOOP_SIZE;
+
+    // the frame must fit
+    if (expected > target_size - produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+    done = 0;
+
+    // followed by at least one block, more when the writer split its input
+    do {
+      if (source_size - offset < CODEC_LZ4_HADOOP_SIZE) return CODEC_ERROR_INVALID_INPUT;
+      size = codec_lz4_read(source + offset);
+      offset += CODEC_LZ4_HADOOP_SIZE;
+
+      // the block must be available
+      if (size > source_size - offset) return CODEC_ERROR_INVALID_INPUT;
+
+      result = codec_lz4_decompress(source + offset, size, target + produced + done, expected - done);
+      if (result < 0) return result;
+
+      offset += size;
+      done += result;
+    } while (done < expected);
+
+    produced += expected;
+  }
+
+  // success
+  return produced;
+}
+
+i64 codec_lz4_legacy_decompress(const char *source, u64 source_size, char *target, u64 target_size) {
+  i64 result;
+
+  // most writers frame the blocks like Hadoop does
+  result = codec_lz4_hadoop(source, source_size, target, target_size);
+  if (result >= 0) return result;
+
+  // older ones stored a single raw block
+  return codec_lz4_decompress(source, source_size, target, target_size);
+}
+
+#if defined(I13C_TESTS)
+
+static void can_decompress_lz4_literal() {
+  i64 result;
+  char target[11 + CODEC_SLACK];
+
+  // a single sequence with 11 literals and no match
+  const char source[] = {(char)0xb0, 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd'};
+
+  // decompress it
+  result = codec_lz4_decompress(source, sizeof(source), target, 11);
+  assert(result == 11, "should decompress 11 bytes");
+
+  // assert the output
+  assert(target[0] == 'h' && target[5] == ' ' && target[10] == 'd', "should decompress hello world");
+}
+
+static void can_decompress_lz4_matches() {
+  i64 result;
+  u32 index;
+  char target[77 + CODEC_SLACK];
+
+  // literal abcd with overlapping matches, the second one with an extended length
+  const char source[] = {
+    0x44, 'a', 'b', 'c', 'd', 0x04, 0x00, // literal abcd, match of 8 bytes at distance 4
+    0x0f, 0x0c, 0x00, 45,                 // match of 64 bytes at distance 12
+    0x10, 'd',                            // last literal d
+  };
+
+  // decompress it
+  result = codec_lz4_decompress(source, sizeof(source), target, 77);
+  assert(result == 77, "should decompress 77 bytes");
+
+  // assert the repeated pattern
+  for (index = 0; index < 76; index++) {
+    assert(target[index] == "abcd"[index % 4], "byte should repeat abcd");
+  }
+
+  assert(target[76] == 'd', "last byte should be the literal");
+}
+
+static void can_decompress_lz4_long_literal() {
+  i64 result;
+  u32 index;
+  char source[2 + 100], target[100 + CODEC_SLACK];
+
+  // a token with a saturated literal length and one extension byte
+  source[0] = (char)0xf0;
+  source[1] = 85;
+
+  for (index = 0; index < 100; index++) {
+    source[2 + index] = (char)(index * 3);
+  }
+
+  // decompress it
+  result = codec_lz4_decompress(source, 102, target, 100);
+  assert(result == 100, "should decompress 100 bytes");
+
+  // assert the output
+  for (index = 0; index < 100; index++) {
+    assert(target[index] == (char)(index * 3), "byte should match");
+  }
+}
+
+static void can_detect_lz4_invalid_distance() {
+  i64 result;
+  char target[16 + CODEC_SLACK];
+
+  // literal ab followed by a match reaching 3 bytes back
+  const char source[] = {0x21, 'a', 'b', 0x03, 0x00, 0x00};
+
+  // decompress it
+  result = codec_lz4_decompress(source, sizeof(source), target, 16);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+}
+
+static void can_detect_lz4_output_overflow() {
+  i64 result;
+  char target[4 + CODEC_SLACK];
+
+  // the literals exceed the output
+  const char source[] = {0x50, 'h', 'e', 'l', 'l', 'o'};
+
+  // decompress it
+  result = codec_lz4_decompress(source, sizeof(source), target, 4);
+  assert(result == CODEC_ERROR_OUTPUT_OVERFLOW, "should fail with CODEC_ERROR_OUTPUT_OVERFLOW");
+}
+
+static void can_detect_lz4_truncated_block() {
+  i64 result;
+  char target[16 + CODEC_SLACK];
+
+  // the literals are cut short
+  const char source[] = {0x50, 'h', 'e', 'l'};
+
+  // the block ends with a match instead of literals
+  const char partial[] = {0x10, 'a', 0x01, 0x00};
+
+  // decompress it
+  result = codec_lz4_decompress(source, sizeof(source), target, 16);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+
+  // decompress the other one
+  result = codec_lz4_decompress(partial, sizeof(partial), target, 16);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+}
+
+static void can_decompress_lz4_legacy_blocks() {
+  i64 result;
+  char target[16 + CODEC_SLACK];
+
+  // two Hadoop frames, each with its lengths and a single block
+  const char framed[] = {
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, (char)0xb0, 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd',
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x50,       '!', '!', '!', '!', '!',
+  };
+
+  // the same block without any framing
+  const char raw[] = {(char)0xb0, 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd'};
+
+  // decompress the frames
+  result = codec_lz4_legacy_decompress(framed, sizeof(framed), target, 16);
+  assert(result == 16, "should decompress 16 bytes");
+  assert(target[0] == 'h' && target[10] == 'd' && target[11] == '!' && target[15] == '!', "should concatenate frames");
+
+  // decompress the raw block
+  result = codec_lz4_legacy_decompress(raw, sizeof(raw), target, 16);
+  assert(result == 11, "should decompress 11 bytes");
+  assert(target[0] == 'h' && target[10] == 'd', "should fall back to the raw block");
+}
+
+void codec_test_cases_lz4(struct runner_context *ctx) {
+  test_case(ctx, "can decompress lz4 literal", can_decompress_lz4_literal);
+  test_case(ctx, "can decompress lz4 matches", can_decompress_lz4_matches);
+  test_case(ctx, "can decompress lz4 long literal", can_decompress_lz4_long_literal);
+  test_case(ctx, "can detect lz4 invalid distance", can_detect_lz4_invalid_distance);
+  test_case(ctx, "can detect lz4 output overflow", can_detect_lz4_output_overflow);
+  test_case(ctx, "can detect lz4 truncated block", can_detect_lz4_truncated_block);
+  test_case(ctx, "can decompress lz4 legacy blocks", can_decompress_lz4_legacy_blocks);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "runner.h"
+#include "typing.h"
+
+/// @brief Decompresses a raw LZ4 block.
+/// @param source Pointer to the compressed block.
+/// @param source_size Number of bytes in the compressed block.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param target_size Number of bytes the output can hold, excluding the slack.
+/// @return The number of decompressed bytes, or a negative error code on failure.
+extern i64 codec_lz4_decompress(const char *source, u64 source_size, char *target, u64 target_size);
+
+/// @brief Decompresses legacy LZ4 data, Hadoop-framed blocks or a raw block as written by older writers.
+/// @param source Pointer to the compressed data.
+/// @param source_size Number of bytes in the compressed data.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param target_size Number of bytes the output can hold, excluding the slack.
+/// @return The number of decompressed bytes, or a negative error code on failure.
+extern i64 codec_lz4_legacy_decompress(const char *source, u64 source_size, char *target, u64 target_size);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers lz4 test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void codec_test_cases_lz4(struct runner_context *ctx);
+
+#endif
@@ -0,0 +1,223 @@
+#include "codec.snappy.h"
+#include "codec.base.h"
+#include "runner.h"
+#include "typing.h"
+
+#define CODEC_SNAPPY_LITERAL 0x00 // tag of a literal
+#define CODEC_SNAPPY_COPY_1 0x01  // tag of a copy with an 11-bit distance
+#define CODEC_SNAPPY_COPY_2 0x02  // tag of a copy with a 16-bit distance
+#define CODEC_SNAPPY_COPY_4 0x03  // tag of a copy with a 32-bit distance
+
+#define CODEC_SNAPPY_LITERAL_SHORT 60 // longest literal with the length stored in its tag
+
+static u32 codec_snappy_read(const char *source, u32 bytes) {
+  u32 index, value;
+
+  // little-endian integer of 1 to 4 bytes
+  for (index = 0, value = 0; index < bytes; index++) {
+    value |= (u32)(u8)source[index] << (index * 8);
+  }
+
+  return value;
+}
+
+i64 codec_snappy_decompress(const char *source, u64 source_size, char *target, u64 target_size) {
+  u8 tag;
+  u32 bytes, shift;
+  u64 offset, length, produced, size, distance;
+
+  // the stream starts with the uncompressed length as a varint
+  offset = 0;
+  length = 0;
+  shift = 0;
+
+  do {
+    if (offset == source_size || shift > 28) return CODEC_ERROR_INVALID_INPUT;
+    tag = source[offset++];
+    length |= (u64)(tag & 0x7f) << shift;
+    shift += 7;
+  } while (tag & 0x80);
+
+  // the output must hold everything
+  if (length > target_size) return CODEC_ERROR_OUTPUT_OVERFLOW;
+  produced = 0;
+
+  while (offset < source_size) {
+    tag = source[offset++];
+
+    if ((tag & 0x03) == CODEC_SNAPPY_LITERAL) {
+      // short literals keep their length in the tag, longer ones in up to 4 following bytes
+      size = (tag >> 2) + 1;
+
+      if (size > CODEC_SNAPPY_LITERAL_SHORT) {
+        bytes = size - CODEC_SNAPPY_LITERAL_SHORT;
+        if (bytes > source_size - offset) return CODEC_ERROR_INVALID_INPUT;
+
+        size = (u64)codec_snappy_read(source + offset, bytes) + 1;
+        offset += bytes;
+      }
+
+      // the literal must be available and fit
+      if (size > source_size - offset) return CODEC_ERROR_INVALID_INPUT;
+      if (size > length - produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+      // copy in whole chunks unless it would read past the stream
+      if (source_size - offset - size >= CODEC_SLACK) {
+        codec_copy_wild(target + produced, source + offset, size);
+      } else {
+        codec_copy_exact(target + produced, source + offset, size);
+      }
+
+      offset += size;
+      produced += size;
+      continue;
+    }
+
+    if ((tag & 0x03) == CODEC_SNAPPY_COPY_1) {
+      // 3 bits of length and 11 bits of distance
+      if (offset == source_size) return CODEC_ERROR_INVALID_INPUT;
+
+      size = ((tag >> 2) & 0x07) + 4;
+      distance = ((u64)(tag & 0xe0) << 3) | (u8)source[offset++];
+    } else {
+      // 6 bits of length and 2 or 4 bytes of distance
+      bytes = (tag & 0x03) == CODEC_SNAPPY_COPY_2 ? 2 : 4;
+      if (bytes > source_size - offset) return CODEC_ERROR_INVALID_INPUT;
+
+      size = (tag >> 2) + 1;
+      distance = codec_snappy_read(source + offset, bytes);
+      offset += bytes;
+    }
+
+    // the copy must start within the output and fit
+    if (distance == 0 || distance > produced) return CODEC_ERROR_INVALID_INPUT;
+    if (size > length - produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+    codec_copy_match(target + produced, distance, size);
+    produced += size;
+  }
+
+  // the stream must produce exactly the announced length
+  if (produced != length) return CODEC_ERROR_OUTPUT_UNDERFLOW;
+
+  // success
+  return length;
+}
+
+#if defined(I13C_TESTS)
+
+static void can_decompress_snappy_literal() {
+  i64 result;
+  char target[11 + CODEC_SLACK];
+
+  // a single literal of 11 bytes
+  const char source[] = {0x0b, 0x28, 'h', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd'};
+
+  // decompress it
+  result = codec_snappy_decompress(source, sizeof(source), target, 11);
+  assert(result == 11, "should decompress 11 bytes");
+
+  // assert the output
+  assert(target[0] == 'h' && target[5] == ' ' && target[10] == 'd', "should decompress hello world");
+}
+
+static void can_decompress_snappy_copies() {
+  i64 result;
+  u32 index;
+  char target[77 + CODEC_SLACK];
+
+  // literal abcd, then copies with 1-byte, 2-byte and 4-byte distances
+  const char source[] = {
+    0x4d, 0x0c, 'a', 'b', 'c', 'd',     // 77 bytes, literal abcd
+    0x11, 0x04,                         // copy of 8 bytes at distance 4
+    (char)0xfe, 0x0c, 0x00,             // copy of 64 bytes at distance 12
+    0x03, 0x01, 0x00, 0x00, 0x00,       // copy of 1 byte at distance 1
+  };
+
+  // decompress it
+  result = codec_snappy_decompress(source, sizeof(source), target, 77);
+  assert(result == 77, "should decompress 77 bytes");
+
+  // assert the repeated pattern
+  for (index = 0; index < 76; index++) {
+    assert(target[index] == "abcd"[index % 4], "byte should repeat abcd");
+  }
+
+  assert(target[76] == 'd', "last byte should repeat the previous one");
+}
+
+static void can_decompress_snappy_long_literal() {
+  i64 result;
+  u32 index;
+  char source[2 + 2 + 100], target[100 + CODEC_SLACK];
+
+  // varint 100 and a literal with its length in the next byte
+  source[0] = 100;
+  source[1] = (char)(CODEC_SNAPPY_LITERAL_SHORT << 2);
+  source[2] = 99;
+
+  for (index = 0; index < 100; index++) {
+    source[3 + index] = (char)(index * 3);
+  }
+
+  // decompress it
+  result = codec_snappy_decompress(source, 103, target, 100);
+  assert(result == 100, "should decompress 100 bytes");
+
+  // assert the output
+  for (index = 0; index < 100; index++) {
+    assert(target[index] == (char)(index * 3), "byte should match");
+  }
+}
+
+static void can_detect_snappy_invalid_distance() {
+  i64 result;
+  char target[8 + CODEC_SLACK];
+
+  // literal ab followed by a copy reaching 3 bytes back
+  const char source[] = {0x08, 0x04, 'a', 'b', 0x09, 0x03};
+
+  // decompress it
+  result = codec_snappy_decompress(source, sizeof(source), target, 8);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+}
+
+static void can_detect_snappy_output_overflow() {
+  i64 result;
+  char target[4 + CODEC_SLACK];
+
+  // the announced length exceeds the output
+  const char source[] = {0x05, 0x10, 'h', 'e', 'l', 'l', 'o'};
+
+  // decompress it
+  result = codec_snappy_decompress(source, sizeof(source), target, 4);
+  assert(result == CODEC_ERROR_OUTPUT_OVERFLOW, "should fail with CODEC_ERROR_OUTPUT_OVERFLOW");
+}
+
+static void can_detect_snappy_truncated_stream() {
+  i64 result;
+  char target[8 + CODEC_SLACK];
+
+  // the literal is cut short
+  const char source[] = {0x05, 0x10, 'h', 'e', 'l'};
+  const char partial[] = {0x05, 0x00, 'h'};
+
+  // decompress it
+  result = codec_snappy_decompress(source, sizeof(source), target, 8);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+
+  // the stream ends before the announced length
+  result = codec_snappy_decompress(partial, sizeof(partial), target, 8);
+  assert(result == CODEC_ERROR_OUTPUT_UNDERFLOW, "should fail with CODEC_ERROR_OUTPUT_UNDERFLOW");
+}
+
+void codec_test_cases_snappy(struct runner_context *ctx) {
+  test_case(ctx, "can decompress snappy literal", can_decompress_snappy_literal);
+  test_case(ctx, "can decompress snappy copies", can_decompress_snappy_copies);
+  test_case(ctx, "can decompress snappy long literal", can_decompress_snappy_long_literal);
+  test_case(ctx, "can detect snappy invalid distance", can_detect_snappy_invalid_distance);
+  test_case(ctx, "can detect snappy output overflow", can_detect_snappy_output_overflow);
+  test_case(ctx, "can detect snappy truncated stream", can_detect_snappy_truncated_stream);
+}
+
+#endif
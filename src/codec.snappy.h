@@ -0,0 +1,20 @@
+#pragma once
+
+#include "runner.h"
+#include "typing.h"
+
+/// @brief Decompresses a raw Snappy stream.
+/// @param source Pointer to the compressed stream, starting with the uncompressed length.
+/// @param source_size Number of bytes in the compressed stream.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param target_size Number of bytes the output can hold, excluding the slack.
+/// @return The number of decompressed bytes, or a negative error code on failure.
+extern i64 codec_snappy_decompress(const char *source, u64 source_size, char *target, u64 target_size);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers snappy test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void codec_test_cases_snappy(struct runner_context *ctx);
+
+#endif
@@ -0,0 +1,1160 @@
+#include "codec.zstd.h"
+#include "codec.base.h"
+#include "malloc.h"
+#include "runner.h"
+#include "typing.h"
+
+#define CODEC_ZSTD_MAGIC 0xfd2fb528     // magic number of a frame
+#define CODEC_ZSTD_SKIPPABLE 0x184d2a50 // first of 16 magic numbers of skippable frames
+#define CODEC_ZSTD_BLOCK_MAX (1 << 17)  // largest decompressed block
+
+#define CODEC_ZSTD_BLOCK_RAW 0        // block stored as is
+#define CODEC_ZSTD_BLOCK_RLE 1        // block made of a single repeated byte
+#define CODEC_ZSTD_BLOCK_COMPRESSED 2 // block with literals and sequences
+
+#define CODEC_ZSTD_LITERALS_RAW 0        // literals stored as is
+#define CODEC_ZSTD_LITERALS_RLE 1        // literals made of a single repeated byte
+#define CODEC_ZSTD_LITERALS_COMPRESSED 2 // literals with their own huffman table
+#define CODEC_ZSTD_LITERALS_TREELESS 3   // literals reusing the previous huffman table
+
+#define CODEC_ZSTD_MODE_PREDEFINED 0 // sequence codes use the predefined distribution
+#define CODEC_ZSTD_MODE_RLE 1        // sequence codes are a single repeated symbol
+#define CODEC_ZSTD_MODE_COMPRESSED 2 // sequence codes use a described distribution
+#define CODEC_ZSTD_MODE_REPEAT 3     // sequence codes reuse the previous table
+
+#define CODEC_ZSTD_HUFFMAN_LOG 11 // longest huffman code
+#define CODEC_ZSTD_WEIGHTS_LOG 6  // accuracy of the distribution of huffman weights
+#define CODEC_ZSTD_WEIGHTS_MAX 15 // highest weight the distribution may describe
+#define CODEC_ZSTD_FSE_LOG 9      // highest accuracy of any sequence code distribution
+#define CODEC_ZSTD_FSE_SYMBOLS 64 // more than the highest sequence code
+
+#define CODEC_ZSTD_LL_LOG 9  // highest accuracy of the literals length distribution
+#define CODEC_ZSTD_ML_LOG 9  // highest accuracy of the match length distribution
+#define CODEC_ZSTD_OF_LOG 8  // highest accuracy of the offset distribution
+#define CODEC_ZSTD_LL_MAX 35 // highest literals length code
+#define CODEC_ZSTD_ML_MAX 52 // highest match length code
+#define CODEC_ZSTD_OF_MAX 31 // highest offset code
+
+struct codec_zstd_bits {
+  const char *start; // first byte of the backward stream
+  const char *ptr;   // position of the loaded container
+  u64 container;     // 8 bytes read from ptr
+  u32 consumed;      // bits consumed from the top of the container
+};
+
+struct codec_zstd_fse {
+  u16 base;  // base of the next state
+  u8 symbol; // decoded symbol
+  u8 bits;   // bits to read for the next state
+};
+
+struct codec_zstd_table {
+  u32 log;   // accuracy log, zero for RLE tables
+  u32 ready; // whether the table can be repeated
+
+  struct codec_zstd_fse entries[1 << CODEC_ZSTD_FSE_LOG];
+};
+
+struct codec_zstd_huffman {
+  u8 symbol; // decoded byte
+  u8 bits;   // length of its code
+};
+
+struct codec_zstd_state {
+  u32 huffman_log;                                              // longest code, zero without a table
+  struct codec_zstd_huffman huffman[1 << CODEC_ZSTD_HUFFMAN_LOG]; // table indexed by the next bits
+
+  struct codec_zstd_table literals_lengths; // table of literals length codes
+  struct codec_zstd_table offsets;          // table of offset codes
+  struct codec_zstd_table match_lengths;    // table of match length codes
+
+  u64 repeats[3]; // repeated offsets, most recent first
+
+  char *literals;    // decoded literals of the current block, followed by the slack
+  u64 literals_size; // number of decoded literals
+};
+
+static const u32 CODEC_ZSTD_LL_BASE[CODEC_ZSTD_LL_MAX + 1] = {
+  0,  1,  2,  3,  4,  5,  6,  7,  8,   9,   10,  11,   12,   13,   14,   15,    16,    18,
+  20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536,
+};
+
+static const u8 CODEC_ZSTD_LL_BITS[CODEC_ZSTD_LL_MAX + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,  0,  1,  1,
+  1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+};
+
+static const u32 CODEC_ZSTD_ML_BASE[CODEC_ZSTD_ML_MAX + 1] = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14,  15,  16,  17,   18,   19,   20,
+  21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,  33,  34,  35,   37,   39,   41,
+  43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539,
+};
+
+static const u8 CODEC_ZSTD_ML_BITS[CODEC_ZSTD_ML_MAX + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0,  0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,  1,  1,
+  2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+};
+
+static const i16 CODEC_ZSTD_LL_DEFAULT[CODEC_ZSTD_LL_MAX + 1] = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2,  2,
+  2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1,
+};
+
+static const i16 CODEC_ZSTD_ML_DEFAULT[CODEC_ZSTD_ML_MAX + 1] = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,  1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static const i16 CODEC_ZSTD_OF_DEFAULT[29] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1,
+};
+
+static u32 codec_zstd_highbit(u32 value) {
+  // position of the highest set bit, the value must not be zero
+  return 31 - __builtin_clz(value);
+}
+
+static u32 codec_zstd_read(const char *buffer, u32 bytes) {
+  u32 index, value;
+
+  // little-endian integer of 1 to 4 bytes
+  for (index = 0, value = 0; index < bytes; index++) {
+    value |= (u32)(u8)buffer[index] << (index * 8);
+  }
+
+  return value;
+}
+
+static u32 codec_zstd_peek(const char *buffer, u64 size, u64 offset) {
+  // up to 4 bytes from the offset, zeros past the end of the buffer
+  if (offset >= size) return 0;
+  return codec_zstd_read(buffer + offset, size - offset < 4 ? size - offset : 4);
+}
+
+static i64 codec_zstd_bits_init(struct codec_zstd_bits *bits, const char *buffer, u64 size) {
+  u8 last;
+
+  // the last byte holds a marker bit above the final bits
+  if (size == 0) return CODEC_ERROR_INVALID_INPUT;
+  if ((last = buffer[size - 1]) == 0) return CODEC_ERROR_INVALID_INPUT;
+
+  bits->start = buffer;
+  bits->consumed = 8 - codec_zstd_highbit(last);
+
+  // short streams leave the top of the container empty, as if already consumed
+  if (size < 8) {
+    bits->ptr = buffer;
+    bits->container = (u64)codec_zstd_read(buffer, size < 4 ? size : 4);
+    bits->container |= size > 4 ? (u64)codec_zstd_read(buffer + 4, size - 4) << 32 : 0;
+    bits->consumed += (8 - size) * 8;
+  } else {
+    bits->ptr = buffer + size - 8;
+    bits->container = *(const u64 *)bits->ptr;
+  }
+
+  // success
+  return 0;
+}
+
+static inline u64 codec_zstd_bits_read(struct codec_zstd_bits *bits, u32 count) {
+  u64 value;
+
+  // two shifts keep zero counts defined, bits past the start of the stream are garbage caught by the final check
+  value = (bits->container << (bits->consumed & 63)) >> 1 >> (63 - count);
+
+  bits->consumed += count;
+  return value;
+}
+
+static inline void codec_zstd_bits_reload(struct codec_zstd_bits *bits) {
+  u64 bytes;
+
+  // nothing is left before the container
+  if (bits->ptr == bits->start) return;
+
+  // move back by the consumed bytes, but not before the start
+  bytes = bits->consumed >> 3;
+  bytes = bytes < (u64)(bits->ptr - bits->start) ? bytes : (u64)(bits->ptr - bits->start);
+
+  bits->ptr -= bytes;
+  bits->consumed -= bytes * 8;
+  bits->container = *(const u64 *)bits->ptr;
+}
+
+static bool codec_zstd_bits_overflow(const struct codec_zstd_bits *bits) {
+  // more bits were read than the stream has
+  return bits->ptr == bits->start && bits->consumed > 64;
+}
+
+static bool codec_zstd_bits_finished(const struct codec_zstd_bits *bits) {
+  // exactly all bits were read
+  return bits->ptr == bits->start && bits->consumed == 64;
+}
+
+static i64 codec_zstd_fse_counts(
+  const char *buffer, u64 size, u32 max_symbol, u32 max_log, i16 *counts, u32 *symbols, u32 *log) {
+  i32 count, remaining, threshold, max;
+  u32 bits, symbol, repeat, consumed;
+  u64 offset, stream;
+  bool zero;
+
+  // the accuracy log comes first
+  if (size == 0) return CODEC_ERROR_INVALID_INPUT;
+
+  *log = ((u8)buffer[0] & 0x0f) + 5;
+  if (*log > max_log) return CODEC_ERROR_INVALID_INPUT;
+
+  // defaults
+  remaining = (1 << *log) + 1;
+  threshold = 1 << *log;
+  bits = *log + 1;
+  symbol = 0;
+  zero = 0;
+  offset = 0;
+  consumed = 4;
+  stream = codec_zstd_peek(buffer, size, 0) >> 4;
+
+  while (remaining > 1 && symbol <= max_symbol) {
+    // a zero probability is followed by 2-bit flags repeating it, where 3 announces another flag
+    if (zero) {
+      repeat = symbol;
+
+      while ((stream & 0x03) == 0x03) {
+        repeat += 3;
+        consumed += 2;
+
+        offset += consumed >> 3;
+        consumed &= 7;
+        stream = codec_zstd_peek(buffer, size, offset) >> consumed;
+      }
+
+      repeat += stream & 0x03;
+      consumed += 2;
+
+      // the repeated zeros cannot reach past the last symbol
+      if (repeat > max_symbol) return CODEC_ERROR_INVALID_INPUT;
+
+      while (symbol < repeat) {
+        counts[symbol++] = 0;
+      }
+
+      offset += consumed >> 3;
+      consumed &= 7;
+      stream = codec_zstd_peek(buffer, size, offset) >> consumed;
+    }
+
+    // each value takes bits or one bit less, depending on how many values are still possible
+    max = (2 * threshold - 1) - remaining;
+
+    if ((i32)(stream & (threshold - 1)) < max) {
+      count = stream & (threshold - 1);
+      consumed += bits - 1;
+    } else {
+      count = stream & (2 * threshold - 1);
+      count -= count >= threshold ? max : 0;
+      consumed += bits;
+    }
+
+    // the value is the probability plus one, where zero stands for less than one
+    count--;
+    remaining -= count < 0 ? -count : count;
+    counts[symbol++] = count;
+    zero = count == 0;
+
+    // fewer values remain possible
+    while (remaining < threshold) {
+      bits--;
+      threshold >>= 1;
+    }
+
+    offset += consumed >> 3;
+    consumed &= 7;
+    stream = codec_zstd_peek(buffer, size, offset) >> consumed;
+  }
+
+  // the probabilities must add up exactly
+  if (remaining != 1) return CODEC_ERROR_INVALID_INPUT;
+
+  // the description must fit in the buffer
+  offset += (consumed + 7) >> 3;
+  if (offset > size) return CODEC_ERROR_INVALID_INPUT;
+
+  // success
+  *symbols = symbol;
+  return offset;
+}
+
+static i64 codec_zstd_fse_build(struct codec_zstd_table *table, const i16 *counts, u32 symbols, u32 log) {
+  u32 index, symbol, size, high, position, step, state;
+  u16 next[CODEC_ZSTD_FSE_SYMBOLS];
+
+  // defaults
+  size = 1 << log;
+  high = size - 1;
+
+  // symbols with less than one probability take the highest states
+  for (symbol = 0; symbol < symbols; symbol++) {
+    if (counts[symbol] == -1) {
+      table->entries[high--].symbol = symbol;
+      next[symbol] = 1;
+    } else {
+      next[symbol] = counts[symbol];
+    }
+  }
+
+  // the others are spread over the remaining states
+  step = (size >> 1) + (size >> 3) + 3;
+  position = 0;
+
+  for (symbol = 0; symbol < symbols; symbol++) {
+    for (index = 0; counts[symbol] > 0 && index < (u32)counts[symbol]; index++) {
+      table->entries[position].symbol = symbol;
+
+      do {
+        position = (position + step) & (size - 1);
+      } while (position > high);
+    }
+  }
+
+  // the spread must visit every state exactly once
+  if (position != 0) return CODEC_ERROR_INVALID_INPUT;
+
+  // each state knows how to reach the next one
+  for (index = 0; index < size; index++) {
+    state = next[table->entries[index].symbol]++;
+
+    table->entries[index].bits = log - codec_zstd_highbit(state);
+    table->entries[index].base = (state << table->entries[index].bits) - size;
+  }
+
+  // success
+  table->log = log;
+  table->ready = 1;
+
+  return 0;
+}
+
+static void codec_zstd_fse_rle(struct codec_zstd_table *table, u8 symbol) {
+  // a single state always decoding the same symbol
+  table->entries[0].symbol = symbol;
+  table->entries[0].bits = 0;
+  table->entries[0].base = 0;
+
+  table->log = 0;
+  table->ready = 1;
+}
+
+static i64 codec_zstd_fse_read(
+  struct codec_zstd_table *table, const char *buffer, u64 size, u32 max_symbol, u32 max_log) {
+  i64 result;
+  u32 symbols, log;
+  i16 counts[CODEC_ZSTD_FSE_SYMBOLS];
+
+  // read the distribution
+  result = codec_zstd_fse_counts(buffer, size, max_symbol, max_log, counts, &symbols, &log);
+  if (result < 0) return result;
+
+  // and build the table from it
+  return codec_zstd_fse_build(table, counts, symbols, log) < 0 ? CODEC_ERROR_INVALID_INPUT : result;
+}
+
+static i64 codec_zstd_weights(const char *buffer, u64 size, u8 *weights, u32 *count) {
+  i64 result;
+  u8 header;
+  u32 index, state1, state2;
+
+  struct codec_zstd_bits bits;
+  struct codec_zstd_table table;
+
+  // the header tells how the weights are stored
+  if (size == 0) return CODEC_ERROR_INVALID_INPUT;
+  header = buffer[0];
+
+  // weights stored directly take 4 bits each
+  if (header >= 128) {
+    *count = header - 127;
+    if ((*count + 1) / 2 > size - 1) return CODEC_ERROR_INVALID_INPUT;
+
+    for (index = 0; index < *count; index++) {
+      weights[index] = index % 2 ? (u8)buffer[1 + index / 2] & 0x0f : (u8)buffer[1 + index / 2] >> 4;
+    }
+
+    return 1 + (*count + 1) / 2;
+  }
+
+  // otherwise they are compressed with their own distribution
+  if (header == 0 || header > size - 1) return CODEC_ERROR_INVALID_INPUT;
+
+  result = codec_zstd_fse_read(&table, buffer + 1, header, CODEC_ZSTD_WEIGHTS_MAX, CODEC_ZSTD_WEIGHTS_LOG);
+  if (result < 0) return result;
+
+  // followed by a backward stream of two interleaved states
+  result = codec_zstd_bits_init(&bits, buffer + 1 + result, header - result);
+  if (result < 0) return result;
+
+  state1 = codec_zstd_bits_read(&bits, table.log);
+  state2 = codec_zstd_bits_read(&bits, table.log);
+  *count = 0;
+
+  while (*count < 254) {
+    // the first state
+    weights[(*count)++] = table.entries[state1].symbol;
+    state1 = table.entries[state1].base + codec_zstd_bits_read(&bits, table.entries[state1].bits);
+    codec_zstd_bits_reload(&bits);
+
+    // the stream ends when a state would need bits beyond it, the other state still holds a weight
+    if (codec_zstd_bits_overflow(&bits)) {
+      weights[(*count)++] = table.entries[state2].symbol;
+      break;
+    }
+
+    // the second state
+    weights[(*count)++] = table.entries[state2].symbol;
+    state2 = table.entries[state2].base + codec_zstd_bits_read(&bits, table.entries[state2].bits);
+    codec_zstd_bits_reload(&bits);
+
+    if (codec_zstd_bits_overflow(&bits)) {
+      weights[(*count)++] = table.entries[state1].symbol;
+      break;
+    }
+  }
+
+  // the weights must end with the stream
+  if (!codec_zstd_bits_overflow(&bits)) return CODEC_ERROR_INVALID_INPUT;
+
+  // success
+  return 1 + header;
+}
+
+static i64 codec_zstd_huffman_read(struct codec_zstd_state *state, const char *buffer, u64 size) {
+  i64 result;
+  u32 index, count, total, log, rest, length, entry;
+  u32 ranks[CODEC_ZSTD_HUFFMAN_LOG + 2];
+  u8 weights[256];
+
+  // read the weights of all but the last symbol
+  result = codec_zstd_weights(buffer, size, weights, &count);
+  if (result < 0) return result;
+
+  // sum their shares of the table
+  for (index = 0, total = 0; index < count; index++) {
+    if (weights[index] > CODEC_ZSTD_HUFFMAN_LOG) return CODEC_ERROR_INVALID_INPUT;
+    total += (1 << weights[index]) >> 1;
+  }
+
+  // the last weight completes the sum to the next power of two
+  if (total == 0) return CODEC_ERROR_INVALID_INPUT;
+
+  log = codec_zstd_highbit(total) + 1;
+  rest = (1 << log) - total;
+
+  if (log > CODEC_ZSTD_HUFFMAN_LOG || (rest & (rest - 1)) != 0) return CODEC_ERROR_INVALID_INPUT;
+  weights[count++] = codec_zstd_highbit(rest) + 1;
+
+  // the first entry of each weight, lowest weights first
+  for (index = 0; index <= log; index++) {
+    ranks[index] = 0;
+  }
+
+  for (index = 0; index < count; index++) {
+    ranks[weights[index]]++;
+  }
+
+  for (index = 1, entry = 0; index <= log; index++) {
+    length = ranks[index] << (index - 1);
+    ranks[index] = entry;
+    entry += length;
+  }
+
+  // every symbol fills as many entries as its weight allows
+  for (index = 0; index < count; index++) {
+    if (weights[index] == 0) continue;
+
+    length = (1 << weights[index]) >> 1;
+    entry = ranks[weights[index]];
+    ranks[weights[index]] += length;
+
+    while (length-- > 0) {
+      state->huffman[entry].symbol = index;
+      state->huffman[entry].bits = log + 1 - weights[index];
+      entry++;
+    }
+  }
+
+  // success
+  state->huffman_log = log;
+  return result;
+}
+
+static inline u8 codec_zstd_huffman_next(const struct codec_zstd_state *state, struct codec_zstd_bits *bits) {
+  const struct codec_zstd_huffman *entry;
+
+  // the next bits index the table directly
+  entry = &state->huffman[(bits->container << (bits->consumed & 63)) >> (64 - state->huffman_log)];
+  bits->consumed += entry->bits;
+
+  return entry->symbol;
+}
+
+static i64
+codec_zstd_huffman_decode(struct codec_zstd_state *state, const char *buffer, u64 size, u64 count, bool single) {
+  i64 result;
+  u32 index;
+  u64 position, sizes[4], lengths[4], offsets[4];
+
+  struct codec_zstd_bits streams[4];
+
+  // a single stream decodes one symbol after another
+  if (single) {
+    result = codec_zstd_bits_init(&streams[0], buffer, size);
+    if (result < 0) return result;
+
+    for (position = 0; position < count; position++) {
+      state->literals[position] = codec_zstd_huffman_next(state, &streams[0]);
+      codec_zstd_bits_reload(&streams[0]);
+    }
+
+    return codec_zstd_bits_finished(&streams[0]) ? 0 : CODEC_ERROR_INVALID_INPUT;
+  }
+
+  // four streams are preceded by a jump table with the sizes of the first three
+  if (size < 6) return CODEC_ERROR_INVALID_INPUT;
+
+  sizes[0] = codec_zstd_read(buffer, 2);
+  sizes[1] = codec_zstd_read(buffer + 2, 2);
+  sizes[2] = codec_zstd_read(buffer + 4, 2);
+
+  if (sizes[0] + sizes[1] + sizes[2] > size - 6) return CODEC_ERROR_INVALID_INPUT;
+  sizes[3] = size - 6 - sizes[0] - sizes[1] - sizes[2];
+
+  // the last stream cannot be left with a negative share
+  if (3 * ((count + 3) / 4) > count) return CODEC_ERROR_INVALID_INPUT;
+
+  // each stream regenerates a quarter of the literals, the last one the remainder
+  for (index = 0, position = 6; index < 4; index++) {
+    lengths[index] = index < 3 ? (count + 3) / 4 : count - 3 * ((count + 3) / 4);
+    offsets[index] = index * ((count + 3) / 4);
+
+    result = codec_zstd_bits_init(&streams[index], buffer + position, sizes[index]);
+    if (result < 0) return result;
+
+    position += sizes[index];
+  }
+
+  // the streams are decoded side by side, each of them reloaded after four symbols
+  for (position = 0; position + 4 <= lengths[3]; position += 4) {
+    for (index = 0; index < 4; index++) {
+      state->literals[offsets[index] + position] = codec_zstd_huffman_next(state, &streams[index]);
+      state->literals[offsets[index] + position + 1] = codec_zstd_huffman_next(state, &streams[index]);
+      state->literals[offsets[index] + position + 2] = codec_zstd_huffman_next(state, &streams[index]);
+      state->literals[offsets[index] + position + 3] = codec_zstd_huffman_next(state, &streams[index]);
+      codec_zstd_bits_reload(&streams[index]);
+    }
+  }
+
+  // the rest of each stream one symbol at a time
+  for (index = 0; index < 4; index++) {
+    for (count = position; count < lengths[index]; count++) {
+      state->literals[offsets[index] + count] = codec_zstd_huffman_next(state, &streams[index]);
+      codec_zstd_bits_reload(&streams[index]);
+    }
+
+    if (!codec_zstd_bits_finished(&streams[index])) return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  // success
+  return 0;
+}
+
+static i64 codec_zstd_literals(struct codec_zstd_state *state, const char *buffer, u64 size) {
+  i64 result;
+  u8 type, format;
+  u32 bytes, bits, regenerated, compressed;
+  u64 header, offset;
+
+  // the header starts with the type and the size format
+  if (size == 0) return CODEC_ERROR_INVALID_INPUT;
+
+  type = buffer[0] & 0x03;
+  format = (buffer[0] >> 2) & 0x03;
+
+  if (type == CODEC_ZSTD_LITERALS_RAW || type == CODEC_ZSTD_LITERALS_RLE) {
+    // the regenerated size takes 5, 12 or 20 bits
+    bytes = format == 1 ? 2 : format == 3 ? 3 : 1;
+    if (bytes > size) return CODEC_ERROR_INVALID_INPUT;
+
+    regenerated = bytes == 1 ? (u8)buffer[0] >> 3 : codec_zstd_read(buffer, bytes) >> 4;
+    if (regenerated > CODEC_ZSTD_BLOCK_MAX) return CODEC_ERROR_INVALID_INPUT;
+
+    state->literals_size = regenerated;
+
+    // raw literals follow the header
+    if (type == CODEC_ZSTD_LITERALS_RAW) {
+      if (regenerated > size - bytes) return CODEC_ERROR_INVALID_INPUT;
+
+      codec_copy_exact(state->literals, buffer + bytes, regenerated);
+      return bytes + regenerated;
+    }
+
+    // a repeated literal is stored once
+    if (size - bytes < 1) return CODEC_ERROR_INVALID_INPUT;
+
+    for (offset = 0; offset < regenerated; offset++) {
+      state->literals[offset] = buffer[bytes];
+    }
+
+    return bytes + 1;
+  }
+
+  // huffman coded literals have both sizes in 10, 14 or 18 bits
+  bytes = format <= 1 ? 3 : format + 2;
+  bits = format <= 1 ? 10 : format == 2 ? 14 : 18;
+  if (bytes > size) return CODEC_ERROR_INVALID_INPUT;
+
+  header = codec_zstd_read(buffer, bytes < 4 ? bytes : 4);
+  header |= bytes == 5 ? (u64)(u8)buffer[4] << 32 : 0;
+
+  regenerated = (header >> 4) & ((1 << bits) - 1);
+  compressed = (header >> (4 + bits)) & ((1 << bits) - 1);
+
+  if (regenerated > CODEC_ZSTD_BLOCK_MAX) return CODEC_ERROR_INVALID_INPUT;
+  if (compressed > size - bytes) return CODEC_ERROR_INVALID_INPUT;
+
+  offset = bytes;
+
+  // either a new table precedes the streams or the previous one is reused
+  if (type == CODEC_ZSTD_LITERALS_COMPRESSED) {
+    result = codec_zstd_huffman_read(state, buffer + offset, compressed);
+    if (result < 0) return result;
+
+    offset += result;
+    compressed -= result;
+  } else if (state->huffman_log == 0) {
+    return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  // decode the streams, the first size format means a single one
+  result = codec_zstd_huffman_decode(state, buffer + offset, compressed, regenerated, format == 0);
+  if (result < 0) return result;
+
+  // success
+  state->literals_size = regenerated;
+  return offset + compressed;
+}
+
+static i64 codec_zstd_table(struct codec_zstd_table *table,
+                            u32 mode,
+                            const char *buffer,
+                            u64 size,
+                            const i16 *defaults,
+                            u32 symbols,
+                            u32 max_symbol,
+                            u32 max_log) {
+  switch (mode) {
+    case CODEC_ZSTD_MODE_PREDEFINED:
+      // the predefined distributions use 6 bits, the offsets 5 bits
+      return codec_zstd_fse_build(table, defaults, symbols, symbols > 32 ? 6 : 5);
+
+    case CODEC_ZSTD_MODE_RLE:
+      if (size == 0 || (u8)buffer[0] > max_symbol) return CODEC_ERROR_INVALID_INPUT;
+
+      codec_zstd_fse_rle(table, buffer[0]);
+      return 1;
+
+    case CODEC_ZSTD_MODE_COMPRESSED:
+      return codec_zstd_fse_read(table, buffer, size, max_symbol, max_log);
+
+    default:
+      return table->ready ? 0 : CODEC_ERROR_INVALID_INPUT;
+  }
+}
+
+static i64 codec_zstd_sequences(struct codec_zstd_state *state,
+                                const char *buffer,
+                                u64 size,
+                                char *target,
+                                u64 *produced,
+                                u64 limit,
+                                u64 start) {
+  i64 result;
+  u8 modes, code;
+  u32 count, index, state_ll, state_of, state_ml;
+  u64 offset, value, length, match, distance, literal;
+
+  struct codec_zstd_bits bits;
+
+  // the number of sequences takes 1 to 3 bytes
+  if (size == 0) return CODEC_ERROR_INVALID_INPUT;
+
+  count = (u8)buffer[0];
+  offset = 1;
+
+  if (count >= 128 && count < 255) {
+    if (size < 2) return CODEC_ERROR_INVALID_INPUT;
+    count = ((count - 128) << 8) + (u8)buffer[1];
+    offset = 2;
+  } else if (count == 255) {
+    if (size < 3) return CODEC_ERROR_INVALID_INPUT;
+    count = codec_zstd_read(buffer + 1, 2) + 0x7f00;
+    offset = 3;
+  }
+
+  literal = 0;
+
+  if (count > 0) {
+    // the modes of the three tables
+    if (offset == size) return CODEC_ERROR_INVALID_INPUT;
+
+    modes = buffer[offset++];
+    if (modes & 0x03) return CODEC_ERROR_INVALID_INPUT;
+
+    result = codec_zstd_table(&state->literals_lengths, modes >> 6, buffer + offset, size - offset,
+                              CODEC_ZSTD_LL_DEFAULT, CODEC_ZSTD_LL_MAX + 1, CODEC_ZSTD_LL_MAX, CODEC_ZSTD_LL_LOG);
+    if (result < 0) return result;
+    offset += result;
+
+    result = codec_zstd_table(&state->offsets, (modes >> 4) & 0x03, buffer + offset, size - offset,
+                              CODEC_ZSTD_OF_DEFAULT, 29, CODEC_ZSTD_OF_MAX, CODEC_ZSTD_OF_LOG);
+    if (result < 0) return result;
+    offset += result;
+
+    result = codec_zstd_table(&state->match_lengths, (modes >> 2) & 0x03, buffer + offset, size - offset,
+                              CODEC_ZSTD_ML_DEFAULT, CODEC_ZSTD_ML_MAX + 1, CODEC_ZSTD_ML_MAX, CODEC_ZSTD_ML_LOG);
+    if (result < 0) return result;
+    offset += result;
+
+    // the sequences fill the rest of the block as a backward stream
+    result = codec_zstd_bits_init(&bits, buffer + offset, size - offset);
+    if (result < 0) return result;
+
+    state_ll = codec_zstd_bits_read(&bits, state->literals_lengths.log);
+    state_of = codec_zstd_bits_read(&bits, state->offsets.log);
+    state_ml = codec_zstd_bits_read(&bits, state->match_lengths.log);
+    codec_zstd_bits_reload(&bits);
+
+    for (index = 0; index < count; index++) {
+      // the offset code tells the number of its extra bits
+      code = state->offsets.entries[state_of].symbol;
+      value = ((u64)1 << code) + codec_zstd_bits_read(&bits, code);
+      codec_zstd_bits_reload(&bits);
+
+      // followed by the extra bits of both lengths
+      code = state->match_lengths.entries[state_ml].symbol;
+      match = CODEC_ZSTD_ML_BASE[code] + codec_zstd_bits_read(&bits, CODEC_ZSTD_ML_BITS[code]);
+
+      code = state->literals_lengths.entries[state_ll].symbol;
+      length = CODEC_ZSTD_LL_BASE[code] + codec_zstd_bits_read(&bits, CODEC_ZSTD_LL_BITS[code]);
+      codec_zstd_bits_reload(&bits);
+
+      // small offset values select the repeated offsets, shifted by one without literals
+      if (value > 3) {
+        distance = value - 3;
+        state->repeats[2] = state->repeats[1];
+        state->repeats[1] = state->repeats[0];
+        state->repeats[0] = distance;
+      } else if ((value = value - 1 + (length == 0)) == 0) {
+        distance = state->repeats[0];
+      } else {
+        distance = value == 3 ? state->repeats[0] - 1 : state->repeats[value];
+        state->repeats[2] = value == 1 ? state->repeats[2] : state->repeats[1];
+        state->repeats[1] = state->repeats[0];
+        state->repeats[0] = distance;
+      }
+
+      // all but the last sequence move the states in the same order
+      if (index + 1 < count) {
+        state_ll = state->literals_lengths.entries[state_ll].base +
+                   codec_zstd_bits_read(&bits, state->literals_lengths.entries[state_ll].bits);
+        state_ml = state->match_lengths.entries[state_ml].base +
+                   codec_zstd_bits_read(&bits, state->match_lengths.entries[state_ml].bits);
+        state_of = state->offsets.entries[state_of].base +
+                   codec_zstd_bits_read(&bits, state->offsets.entries[state_of].bits);
+        codec_zstd_bits_reload(&bits);
+      }
+
+      // the sequence must stay within the literals and the output
+      if (length > state->literals_size - literal) return CODEC_ERROR_INVALID_INPUT;
+      if (length + match > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+      // copy the literals, the buffer has the slack for wild copies
+      codec_copy_wild(target + *produced, state->literals + literal, length);
+      literal += length;
+      *produced += length;
+
+      // and repeat the match from within the frame
+      if (distance == 0 || distance > *produced - start) return CODEC_ERROR_INVALID_INPUT;
+
+      codec_copy_match(target + *produced, distance, match);
+      *produced += match;
+    }
+
+    // the stream must be consumed exactly
+    if (!codec_zstd_bits_finished(&bits)) return CODEC_ERROR_INVALID_INPUT;
+  } else if (offset != size) {
+    return CODEC_ERROR_INVALID_INPUT;
+  }
+
+  // the remaining literals close the block
+  length = state->literals_size - literal;
+  if (length > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+  codec_copy_wild(target + *produced, state->literals + literal, length);
+  *produced += length;
+
+  // success
+  return 0;
+}
+
+static i64 codec_zstd_frame(
+  struct codec_zstd_state *state, const char *source, u64 size, char *target, u64 *produced, u64 limit) {
+  i64 result;
+  u8 descriptor, type;
+  u32 header, bytes;
+  u64 offset, content, start, block;
+  bool last;
+
+  // the frame header descriptor follows the magic number
+  if (size < 5) return CODEC_ERROR_INVALID_INPUT;
+
+  descriptor = source[4];
+  offset = 5;
+
+  // the reserved bit must be clear
+  if (descriptor & 0x08) return CODEC_ERROR_INVALID_INPUT;
+
+  // the window descriptor is not needed, the whole output stays addressable
+  offset += descriptor & 0x20 ? 0 : 1;
+
+  // dictionaries are not supported
+  bytes = (descriptor & 0x03) == 3 ? 4 : descriptor & 0x03;
+  if (offset + bytes > size) return CODEC_ERROR_INVALID_INPUT;
+
+  if (bytes > 0 && codec_zstd_read(source + offset, bytes) != 0) return CODEC_ERROR_UNSUPPORTED;
+  offset += bytes;
+
+  // the content size takes 0 to 8 bytes
+  bytes = descriptor >> 6 == 0 ? (descriptor & 0x20 ? 1 : 0) : 1 << (descriptor >> 6);
+  if (offset + bytes > size) return CODEC_ERROR_INVALID_INPUT;
+
+  content = bytes == 8 ? codec_zstd_read(source + offset, 4) | (u64)codec_zstd_read(source + offset + 4, 4) << 32
+                       : codec_zstd_read(source + offset, bytes) + (bytes == 2 ? 256 : 0);
+  offset += bytes;
+
+  // a known content size must fit
+  if (bytes > 0 && content > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+  // nothing is carried over from the previous frame
+  state->huffman_log = 0;
+  state->literals_lengths.ready = 0;
+  state->offsets.ready = 0;
+  state->match_lengths.ready = 0;
+
+  state->repeats[0] = 1;
+  state->repeats[1] = 4;
+  state->repeats[2] = 8;
+
+  start = *produced;
+
+  do {
+    // each block starts with a 3-byte header
+    if (size - offset < 3) return CODEC_ERROR_INVALID_INPUT;
+
+    header = codec_zstd_read(source + offset, 3);
+    offset += 3;
+
+    last = header & 0x01;
+    type = (header >> 1) & 0x03;
+    block = header >> 3;
+
+    if (block > CODEC_ZSTD_BLOCK_MAX) return CODEC_ERROR_INVALID_INPUT;
+
+    switch (type) {
+      case CODEC_ZSTD_BLOCK_RAW:
+        if (block > size - offset) return CODEC_ERROR_INVALID_INPUT;
+        if (block > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+        codec_copy_exact(target + *produced, source + offset, block);
+        *produced += block;
+        offset += block;
+        break;
+
+      case CODEC_ZSTD_BLOCK_RLE:
+        if (size - offset < 1) return CODEC_ERROR_INVALID_INPUT;
+        if (block > limit - *produced) return CODEC_ERROR_OUTPUT_OVERFLOW;
+
+        while (block-- > 0) {
+          target[(*produced)++] = source[offset];
+        }
+
+        offset += 1;
+        break;
+
+      case CODEC_ZSTD_BLOCK_COMPRESSED:
+        if (block > size - offset) return CODEC_ERROR_INVALID_INPUT;
+
+        result = codec_zstd_literals(state, source + offset, block);
+        if (result < 0) return result;
+
+        result = codec_zstd_sequences(state, source + offset + result, block - result, target, produced, limit, start);
+        if (result < 0) return result;
+
+        offset += block;
+        break;
+
+      default:
+        return CODEC_ERROR_INVALID_INPUT;
+    }
+  } while (!last);
+
+  // the optional checksum is skipped, not verified
+  if (descriptor & 0x04) {
+    if (size - offset < 4) return CODEC_ERROR_INVALID_INPUT;
+    offset += 4;
+  }
+
+  // a known content size must match
+  if (bytes > 0 && *produced - start != content) return CODEC_ERROR_INVALID_INPUT;
+
+  // success
+  return offset;
+}
+
+i64 codec_zstd_decompress(const char *source,
+                          u64 source_size,
+                          char *target,
+                          u64 target_size,
+                          struct malloc_pool *pool) {
+  i64 result;
+  u32 magic;
+  u64 offset, produced, skipped;
+
+  struct malloc_lease lease;
+  struct codec_zstd_state *state;
+
+  // at least one frame is expected
+  if (source_size == 0) return CODEC_ERROR_INVALID_INPUT;
+
+  // the tables and the literals of a single block, with the slack
+  lease.size = malloc_fit(sizeof(struct codec_zstd_state) + CODEC_ZSTD_BLOCK_MAX + CODEC_SLACK);
+
+  result = malloc_acquire(pool, &lease);
+  if (result < 0) return result;
+
+  state = lease.ptr;
+  state->literals = (char *)lease.ptr + sizeof(struct codec_zstd_state);
+
+  offset = 0;
+  produced = 0;
+
+  while (offset < source_size) {
+    // each frame starts with a magic number
+    result = CODEC_ERROR_INVALID_INPUT;
+    if (source_size - offset < 4) goto cleanup;
+
+    magic = codec_zstd_read(source + offset, 4);
+
+    // skippable frames announce their size
+    if ((magic & 0xfffffff0) == CODEC_ZSTD_SKIPPABLE) {
+      if (source_size - offset < 8) goto cleanup;
+
+      skipped = codec_zstd_read(source + offset + 4, 4);
+      if (skipped > source_size - offset - 8) goto cleanup;
+
+      offset += 8 + skipped;
+      continue;
+    }
+
+    if (magic != CODEC_ZSTD_MAGIC) goto cleanup;
+
+    // decompress the frame
+    result = codec_zstd_frame(state, source + offset, source_size - offset, target, &produced, target_size);
+    if (result < 0) goto cleanup;
+
+    offset += result;
+  }
+
+  // success
+  result = produced;
+
+cleanup:
+  malloc_release(pool, &lease);
+  return result;
+}
+
+#if defined(I13C_TESTS)
+
+static void can_decompress_zstd_sequences() {
+  i64 result;
+  char target[89 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // raw literals and predefined sequences, followed by a checksum
+  const u8 source[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x24, 0x59, 0xcd, 0x01, 0x00, 0x14, 0x03, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69,
+    0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73,
+    0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67,
+    0x2c, 0x20, 0x63, 0x61, 0x74, 0x2e, 0x01, 0x00, 0x0d, 0x4b, 0x55, 0x06, 0x6a, 0x15, 0xea, 0x14,
+  };
+
+  const char *expected = "the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat.";
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_zstd_decompress((const char *)source, sizeof(source), target, 89, &pool);
+  assert(result == 89, "should decompress 89 bytes");
+
+  // assert the output
+  for (result = 0; result < 89; result++) {
+    assert(target[result] == expected[result], "byte should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_zstd_huffman_literals() {
+  i64 result;
+  u32 index, seed;
+  char target[400 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // 400 pseudo-random letters as huffman literals in four streams with compressed weights
+  const u8 source[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x90, 0x00, 0xa5, 0x05, 0x00, 0x06, 0x19, 0x2c, 0x0a, 0xd0, 0xe7, 0xaa, 0x00,
+    0x87, 0x17, 0x00, 0x74, 0x50, 0x70, 0x27, 0x00, 0x29, 0x00, 0x29, 0x00, 0xb3, 0x08, 0x36, 0x82, 0x8b, 0x4e,
+    0xe7, 0xaa, 0x6f, 0x97, 0x80, 0x5e, 0x58, 0xe6, 0x3b, 0x1d, 0xb1, 0xbf, 0x8b, 0xf6, 0xf2, 0x36, 0x82, 0xb1,
+    0x33, 0x5f, 0x79, 0xa5, 0xcc, 0x49, 0x38, 0x74, 0x8c, 0xe9, 0x4d, 0xbf, 0xfb, 0x1d, 0x04, 0x93, 0x0a, 0xa0,
+    0xbd, 0x81, 0x49, 0xba, 0x8d, 0x24, 0xca, 0x0a, 0x1a, 0x78, 0xdb, 0x15, 0xa5, 0xdb, 0x9c, 0x7a, 0x7e, 0x78,
+    0x6b, 0x4b, 0x4a, 0x82, 0x23, 0xbb, 0x42, 0x4d, 0xd5, 0x5b, 0x07, 0x00, 0xd7, 0xa3, 0xae, 0xa0, 0xc3, 0x1a,
+    0x93, 0x1f, 0xa4, 0xa8, 0xe2, 0xc8, 0xe8, 0x0c, 0x82, 0x00, 0xbf, 0x0e, 0xde, 0x13, 0xf0, 0x2e, 0xf0, 0xf5,
+    0x7a, 0x0a, 0x77, 0x03, 0x95, 0x55, 0x7f, 0x23, 0x4a, 0x9b, 0x83, 0xa2, 0x12, 0x89, 0x75, 0xf1, 0x3a, 0xc5,
+    0x81, 0xe6, 0xda, 0x7f, 0xcd, 0xc8, 0x01, 0x9b, 0x4f, 0xcf, 0x7f, 0x39, 0x48, 0x62, 0xd8, 0x64, 0x7a, 0x9b,
+    0x53, 0x90, 0x16, 0x9d, 0xec, 0xe6, 0xb2, 0x6b, 0x29, 0xb4, 0xbd, 0x9e, 0xd0, 0x1d, 0xc7, 0x3d, 0x78, 0x2e,
+    0x08, 0x8b, 0xc1, 0x2d, 0x47, 0x47, 0x09, 0x65, 0x6d, 0x00,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_zstd_decompress((const char *)source, sizeof(source), target, 400, &pool);
+  assert(result == 400, "should decompress 400 bytes");
+
+  // assert the letters were drawn by the same generator
+  for (index = 0, seed = 7; index < 400; index++) {
+    seed = seed * 1103515245 + 12345;
+    assert(target[index] == "eeeettaaoinshr  "[(seed >> 16) & 0x0f], "letter should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_zstd_raw_and_rle_blocks() {
+  i64 result;
+  u32 index;
+  char target[2 * 103 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // a skippable frame, then twice a frame of 100 repeated bytes and 3 stored bytes
+  const u8 source[] = {
+    0x50, 0x2a, 0x4d, 0x18, 0x02, 0x00, 0x00, 0x00, 'z', 'z',                                   // skippable frame
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x67, 0x22, 0x03, 0x00, 'x', 0x19, 0x00, 0x00, 'a', 'b', 'c', // first frame
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x67, 0x22, 0x03, 0x00, 'x', 0x19, 0x00, 0x00, 'a', 'b', 'c', // second frame
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_zstd_decompress((const char *)source, sizeof(source), target, 2 * 103, &pool);
+  assert(result == 2 * 103, "should decompress 206 bytes");
+
+  // assert both frames
+  for (index = 0; index < 2 * 103; index++) {
+    assert(target[index] == (index % 103 < 100 ? 'x' : "abc"[index % 103 - 100]), "byte should match");
+  }
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_zstd_output_overflow() {
+  i64 result;
+  char target[50 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // a frame announcing 103 bytes
+  const u8 source[] = {0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x67, 0x22, 0x03, 0x00, 'x', 0x19, 0x00, 0x00, 'a', 'b', 'c'};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it into a smaller output
+  result = codec_zstd_decompress((const char *)source, sizeof(source), target, 50, &pool);
+  assert(result == CODEC_ERROR_OUTPUT_OVERFLOW, "should fail with CODEC_ERROR_OUTPUT_OVERFLOW");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_zstd_truncated_frame() {
+  i64 result;
+  char target[103 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // a frame missing its last stored byte
+  const u8 source[] = {0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x67, 0x22, 0x03, 0x00, 'x', 0x19, 0x00, 0x00, 'a', 'b'};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_zstd_decompress((const char *)source, sizeof(source), target, 103, &pool);
+  assert(result == CODEC_ERROR_INVALID_INPUT, "should fail with CODEC_ERROR_INVALID_INPUT");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+static void can_detect_zstd_dictionary() {
+  i64 result;
+  char target[103 + CODEC_SLACK];
+
+  struct malloc_pool pool;
+
+  // a frame referring to dictionary 7
+  const u8 source[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x21, 0x07, 0x67, 0x22, 0x03, 0x00, 'x', 0x19, 0x00, 0x00, 'a', 'b', 'c',
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // decompress it
+  result = codec_zstd_decompress((const char *)source, sizeof(source), target, 103, &pool);
+  assert(result == CODEC_ERROR_UNSUPPORTED, "should fail with CODEC_ERROR_UNSUPPORTED");
+
+  // release everything
+  malloc_destroy(&pool);
+}
+
+void codec_test_cases_zstd(struct runner_context *ctx) {
+  test_case(ctx, "can decompress zstd sequences", can_decompress_zstd_sequences);
+  test_case(ctx, "can decompress zstd huffman literals", can_decompress_zstd_huffman_literals);
+  test_case(ctx, "can decompress zstd raw and rle blocks", can_decompress_zstd_raw_and_rle_blocks);
+  test_case(ctx, "can detect zstd output overflow", can_detect_zstd_output_overflow);
+  test_case(ctx, "can detect zstd truncated frame", can_detect_zstd_truncated_frame);
+  test_case(ctx, "can detect zstd dictionary", can_detect_zstd_dictionary);
+}
+
+#endif
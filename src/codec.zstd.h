@@ -0,0 +1,26 @@
+#pragma once
+
+#include "malloc.h"
+#include "runner.h"
+#include "typing.h"
+
+/// @brief Decompresses one or more Zstandard frames.
+/// @param source Pointer to the compressed frames.
+/// @param source_size Number of bytes in the compressed frames.
+/// @param target Pointer to the output, followed by at least CODEC_SLACK writable bytes.
+/// @param target_size Number of bytes the output can hold, excluding the slack.
+/// @param pool Pointer to the malloc_pool structure providing the decoding tables and literals.
+/// @return The number of decompressed bytes, or a negative error code on failure.
+extern i64 codec_zstd_decompress(const char *source,
+                                 u64 source_size,
+                                 char *target,
+                                 u64 target_size,
+                                 struct malloc_pool *pool);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers zstd test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void codec_test_cases_zstd(struct runner_context *ctx);
+
+#endif
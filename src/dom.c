@@ -1,4 +1,5 @@
 #include "dom.h"
+#include "format.real.h"
 #include "stdout.h"
 #include "typing.h"
 
@@ -21,6 +22,9 @@ static i64 write_unsigned(struct dom_state *state, struct dom_token *token);
 static i64 write_signed(struct dom_state *state, struct dom_token *token);
 static i64 write_text(struct dom_state *state, struct dom_token *token);
 static i64 write_ascii(struct dom_state *state, struct dom_token *token);
+static i64 write_bool(struct dom_state *state, struct dom_token *token);
+static i64 write_binary(struct dom_state *state, struct dom_token *token);
+static i64 write_real(struct dom_state *state, struct dom_token *token);
 static i64 write_invalid(struct dom_state *state, struct dom_token *token);
 
 // forward declarations
@@ -36,13 +40,36 @@ static i64 write_key_end(struct dom_state *state, struct dom_token *token);
 static i64 write_value_start(struct dom_state *state, struct dom_token *token);
 static i64 write_value_end(struct dom_state *state, struct dom_token *token);
 
+// forward declarations
+static i64 write_json_null(struct dom_state *state, struct dom_token *token);
+static i64 write_json_number(struct dom_state *state, struct dom_token *token);
+static i64 write_json_text(struct dom_state *state, struct dom_token *token);
+static i64 write_json_ascii(struct dom_state *state, struct dom_token *token);
+static i64 write_json_bool(struct dom_state *state, struct dom_token *token);
+static i64 write_json_binary(struct dom_state *state, struct dom_token *token);
+static i64 write_json_real(struct dom_state *state, struct dom_token *token);
+
+// forward declarations
+static i64 write_json_value(struct dom_state *state, struct dom_token *token);
+static i64 write_json_array_start(struct dom_state *state, struct dom_token *token);
+static i64 write_json_array_end(struct dom_state *state, struct dom_token *token);
+static i64 write_json_index_start(struct dom_state *state, struct dom_token *token);
+static i64 write_json_index_end(struct dom_state *state, struct dom_token *token);
+static i64 write_json_struct_start(struct dom_state *state, struct dom_token *token);
+static i64 write_json_struct_end(struct dom_state *state, struct dom_token *token);
+static i64 write_json_key_start(struct dom_state *state, struct dom_token *token);
+static i64 write_json_key_end(struct dom_state *state, struct dom_token *token);
+static i64 write_json_value_start(struct dom_state *state, struct dom_token *token);
+static i64 write_json_value_end(struct dom_state *state, struct dom_token *token);
+
 // type to function mappings
 static const dom_write_fn DOM_WRITE_VALUE_FN[DOM_TYPE_SIZE] = {
-  [DOM_TYPE_NULL] = write_null,      [DOM_TYPE_I8] = write_signed,    [DOM_TYPE_I16] = write_signed,
-  [DOM_TYPE_I32] = write_signed,     [DOM_TYPE_I64] = write_signed,   [DOM_TYPE_U8] = write_unsigned,
-  [DOM_TYPE_U16] = write_unsigned,   [DOM_TYPE_U32] = write_unsigned, [DOM_TYPE_U64] = write_unsigned,
-  [DOM_TYPE_TEXT] = write_text,      [DOM_TYPE_ASCII] = write_ascii,  [DOM_TYPE_ARRAY] = write_invalid,
-  [DOM_TYPE_STRUCT] = write_invalid,
+  [DOM_TYPE_NULL] = write_null,     [DOM_TYPE_I8] = write_signed,     [DOM_TYPE_I16] = write_signed,
+  [DOM_TYPE_I32] = write_signed,    [DOM_TYPE_I64] = write_signed,    [DOM_TYPE_U8] = write_unsigned,
+  [DOM_TYPE_U16] = write_unsigned,  [DOM_TYPE_U32] = write_unsigned,  [DOM_TYPE_U64] = write_unsigned,
+  [DOM_TYPE_TEXT] = write_text,     [DOM_TYPE_ASCII] = write_ascii,   [DOM_TYPE_BOOL] = write_bool,
+  [DOM_TYPE_BINARY] = write_binary, [DOM_TYPE_F32] = write_real,      [DOM_TYPE_F64] = write_real,
+  [DOM_TYPE_ARRAY] = write_invalid, [DOM_TYPE_STRUCT] = write_invalid,
 };
 
 // op to function mappings
@@ -55,11 +82,39 @@ static const dom_write_fn DOM_WRITE_OP_FN[DOM_OP_SIZE] = {
   [DOM_OP_VALUE_END] = write_value_end,
 };
 
+// type to function mappings for json
+static const dom_write_fn DOM_WRITE_JSON_VALUE_FN[DOM_TYPE_SIZE] = {
+  [DOM_TYPE_NULL] = write_json_null,     [DOM_TYPE_I8] = write_json_number,   [DOM_TYPE_I16] = write_json_number,
+  [DOM_TYPE_I32] = write_json_number,    [DOM_TYPE_I64] = write_json_number,  [DOM_TYPE_U8] = write_json_number,
+  [DOM_TYPE_U16] = write_json_number,    [DOM_TYPE_U32] = write_json_number,  [DOM_TYPE_U64] = write_json_number,
+  [DOM_TYPE_TEXT] = write_json_text,     [DOM_TYPE_ASCII] = write_json_ascii, [DOM_TYPE_BOOL] = write_json_bool,
+  [DOM_TYPE_BINARY] = write_json_binary, [DOM_TYPE_F32] = write_json_real,    [DOM_TYPE_F64] = write_json_real,
+  [DOM_TYPE_ARRAY] = write_invalid,      [DOM_TYPE_STRUCT] = write_invalid,
+};
+
+// op to function mappings for json
+static const dom_write_fn DOM_WRITE_JSON_OP_FN[DOM_OP_SIZE] = {
+  [DOM_OP_LITERAL] = write_json_value,         [DOM_OP_ARRAY_START] = write_json_array_start,
+  [DOM_OP_ARRAY_END] = write_json_array_end,   [DOM_OP_INDEX_START] = write_json_index_start,
+  [DOM_OP_INDEX_END] = write_json_index_end,   [DOM_OP_STRUCT_START] = write_json_struct_start,
+  [DOM_OP_STRUCT_END] = write_json_struct_end, [DOM_OP_KEY_START] = write_json_key_start,
+  [DOM_OP_KEY_END] = write_json_key_end,       [DOM_OP_VALUE_START] = write_json_value_start,
+  [DOM_OP_VALUE_END] = write_json_value_end,
+};
+
+// style to op mappings
+static const dom_write_fn *const DOM_WRITE_STYLE_FN[DOM_STYLE_SIZE] = {
+  [DOM_STYLE_TEXT] = DOM_WRITE_OP_FN,
+  [DOM_STYLE_JSON] = DOM_WRITE_JSON_OP_FN,
+  [DOM_STYLE_NDJSON] = DOM_WRITE_JSON_OP_FN,
+};
+
 // type to string mappings
 static const char *const DOM_TYPE_NAMES[DOM_TYPE_SIZE] = {
-  [DOM_TYPE_NULL] = "null", [DOM_TYPE_I8] = "i8",     [DOM_TYPE_I16] = "i16",     [DOM_TYPE_I32] = "i32",
-  [DOM_TYPE_I64] = "i64",   [DOM_TYPE_U8] = "u8",     [DOM_TYPE_U16] = "u16",     [DOM_TYPE_U32] = "u32",
-  [DOM_TYPE_U64] = "u64",   [DOM_TYPE_TEXT] = "text", [DOM_TYPE_ARRAY] = "array", [DOM_TYPE_STRUCT] = "struct",
+  [DOM_TYPE_NULL] = "null",   [DOM_TYPE_I8] = "i8",         [DOM_TYPE_I16] = "i16",   [DOM_TYPE_I32] = "i32",
+  [DOM_TYPE_I64] = "i64",     [DOM_TYPE_U8] = "u8",         [DOM_TYPE_U16] = "u16",   [DOM_TYPE_U32] = "u32",
+  [DOM_TYPE_U64] = "u64",     [DOM_TYPE_TEXT] = "text",     [DOM_TYPE_BOOL] = "bool", [DOM_TYPE_BINARY] = "binary",
+  [DOM_TYPE_F32] = "f32",     [DOM_TYPE_F64] = "f64",       [DOM_TYPE_ARRAY] = "array", [DOM_TYPE_STRUCT] = "struct",
 };
 
 static i64 write_null(struct dom_state *state, struct dom_token *) {
@@ -113,7 +168,7 @@ static i64 write_text(struct dom_state *state, struct dom_token *token) {
   return format(&state->format);
 }
 
-static i64 write_ascii(struct dom_state *state, struct dom_token *token) {
+static i64 write_piece(struct dom_state *state, struct dom_token *token, const char *fmt) {
   u64 indent;
   const char *newline;
 
@@ -132,7 +187,7 @@ static i64 write_ascii(struct dom_state *state, struct dom_token *token) {
     newline = "";
   }
 
-  state->format.fmt = "%i%a%s";
+  state->format.fmt = fmt;
   state->format.vargs[0] = (void *)indent;
   state->format.vargs[1] = (void *)UNPACK(token->data);
   state->format.vargs[2] = (void *)(u64)COUNT(token->data);
@@ -145,6 +200,65 @@ static i64 write_ascii(struct dom_state *state, struct dom_token *token) {
   return format(&state->format);
 }
 
+static i64 write_ascii(struct dom_state *state, struct dom_token *token) {
+  // printable characters as they are, the rest as dots
+  return write_piece(state, token, "%i%a%s");
+}
+
+static i64 write_binary(struct dom_state *state, struct dom_token *token) {
+  // every byte as two hex digits
+  return write_piece(state, token, "%i%b%s");
+}
+
+static i64 write_bool(struct dom_state *state, struct dom_token *token) {
+  struct dom_token text;
+
+  // booleans are written as words
+  text.op = token->op;
+  text.type = DOM_TYPE_TEXT;
+  text.data = token->data ? (u64) "true" : (u64) "false";
+
+  return write_text(state, &text);
+}
+
+const char *dom_real(const struct dom_token *token, char *buffer) {
+  u32 count;
+
+  union {
+    u64 bits;
+    f64 value;
+  } wide;
+
+  union {
+    u32 bits;
+    f32 value;
+  } narrow;
+
+  // the token keeps the bits of the value in its own width
+  if (token->type == DOM_TYPE_F32) {
+    narrow.bits = (u32)token->data;
+    count = format_real(buffer, narrow.value, TRUE);
+  } else {
+    wide.bits = token->data;
+    count = format_real(buffer, wide.value, FALSE);
+  }
+
+  buffer[count] = EOS;
+  return buffer;
+}
+
+static i64 write_real(struct dom_state *state, struct dom_token *token) {
+  char buffer[DOM_REAL_SIZE];
+
+  // the fewest digits reading back as the same value
+  state->format.fmt = "%i%s\n";
+  state->format.vargs[0] = (void *)(u64)(state->entries_indent + 1);
+  state->format.vargs[1] = (void *)dom_real(token, buffer);
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
 static i64 write_invalid(struct dom_state *, struct dom_token *) {
   // writting is not expected
   return DOM_ERROR_INVALID_TYPE;
@@ -346,6 +460,7 @@ static i64 write_value_start(struct dom_state *state, struct dom_token *token) {
 
   // fix up the next entry
   state->entries[state->entries_indent].op = DOM_OP_VALUE_START;
+  state->entries[state->entries_indent].index = 0;
 
   // prepare the format string
   state->format.fmt = ", type=%s\n";
@@ -367,14 +482,466 @@ static i64 write_value_end(struct dom_state *state, struct dom_token *) {
     return DOM_ERROR_INVALID_HIERARCHY;
   }
 
+  // prepare the format string
+  state->format.fmt = "%s";
+  state->format.vargs[0] = (void *)"";
+  state->format.vargs_offset = 0;
+
+  // if the newline was not added before, add it now
+  if (state->entries[state->entries_indent].index > 0) {
+    state->format.vargs[0] = (void *)"\n";
+  }
+
   // decrease the indent
   state->entries_indent--;
 
-  // succeed
+  // format the value end
+  return format(&state->format);
+}
+
+static const char *json_open(struct dom_state *state) {
+  // nested values just mark their slot as filled
+  if (state->entries_indent >= 0) {
+    state->entries[state->entries_indent].index++;
+    return "";
+  }
+
+  // top-level items of a single JSON document are separated by commas
+  state->items++;
+  return state->style == DOM_STYLE_JSON && state->items > 1 ? "," : "";
+}
+
+static const char *json_close(struct dom_state *state) {
+  // only top-level items of NDJSON are terminated
+  return state->style == DOM_STYLE_NDJSON && state->entries_indent < 0 ? "\n" : "";
+}
+
+static bool json_in_key(struct dom_state *state) {
+  return state->entries_indent >= 0 && state->entries[state->entries_indent].op == DOM_OP_KEY_START;
+}
+
+static i64 write_json_null(struct dom_state *state, struct dom_token *) {
+  // prepare the format string
+  state->format.fmt = "%snull%s";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs[1] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  // format the null value
+  return format(&state->format);
+}
+
+static i64 write_json_number(struct dom_state *state, struct dom_token *token) {
+  state->format.fmt = "%s%d%s";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs[1] = (void *)token->data;
+  state->format.vargs[2] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
+static i64 write_json_real(struct dom_state *state, struct dom_token *token) {
+  const char *digits;
+  char buffer[DOM_REAL_SIZE];
+
+  // nan and inf are no JSON numbers, so they are written as strings
+  digits = dom_real(token, buffer);
+  state->format.fmt = buffer[0] == 'n' || buffer[0] == 'i' || buffer[1] == 'i' ? "%s\"%s\"%s" : "%s%s%s";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs[1] = (void *)digits;
+  state->format.vargs[2] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
+static i64 write_json_text(struct dom_state *state, struct dom_token *token) {
+  u64 size;
+  const char *text;
+
+  // find the length of the text
+  size = 0;
+  text = (const char *)token->data;
+
+  while (text[size] != EOS) {
+    size++;
+  }
+
+  // keys are already quoted by their start and end
+  if (json_in_key(state)) {
+    state->format.fmt = "%j";
+    state->format.vargs[0] = (void *)text;
+    state->format.vargs[1] = (void *)size;
+    state->format.vargs_offset = 0;
+
+    return format(&state->format);
+  }
+
+  state->format.fmt = "%s\"%j\"%s";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs[1] = (void *)text;
+  state->format.vargs[2] = (void *)size;
+  state->format.vargs[3] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
+static i64 write_json_ascii(struct dom_state *state, struct dom_token *token) {
+  i64 length;
+  u64 size, taken, joined, index;
+  const char *data;
+  struct dom_state_entry *entry;
+
+  // default
+  data = (const char *)UNPACK(token->data);
+  size = COUNT(token->data);
+
+  // top-level ascii cannot be continued, so it is quoted at once
+  if (state->entries_indent < 0) {
+    state->format.fmt = "%s\"%j\"%s";
+    state->format.vargs[0] = (void *)json_open(state);
+    state->format.vargs[1] = (void *)data;
+    state->format.vargs[2] = (void *)size;
+    state->format.vargs[3] = (void *)json_close(state);
+    state->format.vargs_offset = 0;
+
+    return format(&state->format);
+  }
+
+  // the first piece of a value opens the string, the slot end closes it
+  entry = &state->entries[state->entries_indent];
+  state->format.fmt = "%j%j";
+
+  if (entry->op != DOM_OP_KEY_START && entry->type != DOM_TYPE_ASCII) {
+    json_open(state);
+    entry->type = DOM_TYPE_ASCII;
+    state->format.fmt = "\"%j%j";
+  }
+
+  // a sequence split by the previous piece is completed from this one
+  joined = state->pending_size;
+  taken = 0;
+
+  for (index = 0; index < joined; index++) {
+    state->joined[index] = state->pending[index];
+  }
+
+  length = joined > 0 ? format_utf8(state->joined, joined) : 1;
+  while (length < 0 && taken < size) {
+    state->joined[joined++] = data[taken++];
+    length = format_utf8(state->joined, joined);
+  }
+
+  // a piece too short to complete it just extends it
+  if (length < 0) {
+    for (index = 0; index < joined; index++) {
+      state->pending[index] = state->joined[index];
+    }
+
+    state->pending_size = (u8)joined;
+    joined = 0;
+  } else {
+    // an invalid sequence leaves its bytes to be escaped and the piece intact
+    if (length == 0) {
+      joined = state->pending_size;
+      taken = 0;
+    }
+
+    state->pending_size = 0;
+  }
+
+  data += taken;
+  size -= taken;
+
+  // a sequence cut by the end of the piece waits for the next one
+  for (index = 1; index <= 3 && index <= size; index++) {
+    if (((u8)data[size - index] & 0xc0) != 0x80) break;
+  }
+
+  if (index <= 3 && index <= size && format_utf8(data + size - index, index) < 0) {
+    for (taken = 0; taken < index; taken++) {
+      state->pending[taken] = data[size - index + taken];
+    }
+
+    state->pending_size = (u8)index;
+    size -= index;
+  }
+
+  state->format.vargs[0] = (void *)state->joined;
+  state->format.vargs[1] = (void *)joined;
+  state->format.vargs[2] = (void *)data;
+  state->format.vargs[3] = (void *)size;
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
+static i64 write_json_bool(struct dom_state *state, struct dom_token *token) {
+  state->format.fmt = "%s%s%s";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs[1] = (void *)(token->data ? "true" : "false");
+  state->format.vargs[2] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
+static i64 write_json_binary(struct dom_state *state, struct dom_token *token) {
+  // bytes are written as a string of hex digits
+  state->format.fmt = "%s\"%b\"%s";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs[1] = (void *)UNPACK(token->data);
+  state->format.vargs[2] = (void *)(u64)COUNT(token->data);
+  state->format.vargs[3] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  return format(&state->format);
+}
+
+static i64 write_json_value(struct dom_state *state, struct dom_token *token) {
+  // check if the token type is valid
+  if (token->type >= DOM_TYPE_ARRAY) {
+    return DOM_ERROR_INVALID_TYPE;
+  }
+
+  // format the value
+  return DOM_WRITE_JSON_VALUE_FN[token->type](state, token);
+}
+
+static i64 write_json_array_start(struct dom_state *state, struct dom_token *) {
+  // the array fills the slot of its parent
+  state->format.fmt = "%s[";
+  state->format.vargs[0] = (void *)json_open(state);
+  state->format.vargs_offset = 0;
+
+  // increase the indent
+  state->entries_indent++;
+
+  // fix up the next entry
+  state->entries[state->entries_indent].op = DOM_OP_ARRAY_START;
+  state->entries[state->entries_indent].index = 0;
+
+  // format the array start
+  return format(&state->format);
+}
+
+static i64 write_json_array_end(struct dom_state *state, struct dom_token *) {
+  // check for hierarchy depth
+  if (state->entries_indent < 0) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // check for hierarchy match
+  if (state->entries[state->entries_indent].op != DOM_OP_ARRAY_START) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // decrease the indent
+  state->entries_indent--;
+
+  // prepare the format string
+  state->format.fmt = "]%s";
+  state->format.vargs[0] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  // format the array end
+  return format(&state->format);
+}
+
+static i64 write_json_index_start(struct dom_state *state, struct dom_token *) {
+  // check for hierarchy match
+  if (state->entries_indent < 0 || state->entries[state->entries_indent].op != DOM_OP_ARRAY_START) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // all items except the first one are preceded by a comma
+  state->format.fmt = state->entries[state->entries_indent].index++ > 0 ? "," : "";
+  state->format.vargs_offset = 0;
+
+  // increase the indent
+  state->entries_indent++;
+
+  // fix up the next entry
+  state->entries[state->entries_indent].op = DOM_OP_INDEX_START;
+  state->entries[state->entries_indent].type = DOM_TYPE_NULL;
+  state->entries[state->entries_indent].index = 0;
+
+  // format the separator
+  return format(&state->format);
+}
+
+static i64 write_json_slot_end(struct dom_state *state, u8 op) {
+  struct dom_state_entry *entry;
+
+  // check for hierarchy depth
+  if (state->entries_indent < 0) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // check for hierarchy match
+  entry = &state->entries[state->entries_indent];
+  if (entry->op != op) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // close the pending string or fill the empty slot
+  state->format.fmt = "%s";
+  state->format.vargs_offset = 0;
+
+  if (entry->type == DOM_TYPE_ASCII) {
+    // a sequence never completed is escaped byte by byte
+    state->format.fmt = "%j\"";
+    state->format.vargs[0] = (void *)state->pending;
+    state->format.vargs[1] = (void *)(u64)state->pending_size;
+    state->pending_size = 0;
+  } else if (entry->index == 0) {
+    state->format.vargs[0] = (void *)"null";
+  } else {
+    state->format.vargs[0] = (void *)"";
+  }
+
+  // decrease the indent
+  state->entries_indent--;
+
+  // format the slot end
+  return format(&state->format);
+}
+
+static i64 write_json_index_end(struct dom_state *state, struct dom_token *) {
+  return write_json_slot_end(state, DOM_OP_INDEX_START);
+}
+
+static i64 write_json_struct_start(struct dom_state *state, struct dom_token *token) {
+  struct dom_state_entry *entry;
+
+  // a struct nested directly in a struct has no key, so its type name becomes the key
+  if (state->entries_indent >= 0 && state->entries[state->entries_indent].op == DOM_OP_STRUCT_START) {
+    entry = &state->entries[state->entries_indent];
+
+    state->format.fmt = "%s\"%s\":{";
+    state->format.vargs[0] = (void *)(entry->index++ > 0 ? "," : "");
+    state->format.vargs[1] = (void *)(token->data ? token->data : (u64) "struct");
+  } else {
+    // otherwise the struct fills the slot of its parent
+    state->format.fmt = "%s{";
+    state->format.vargs[0] = (void *)json_open(state);
+  }
+
+  // all arguments are set
+  state->format.vargs_offset = 0;
+
+  // increase the indent
+  state->entries_indent++;
+
+  // fix up the next entry
+  state->entries[state->entries_indent].op = DOM_OP_STRUCT_START;
+  state->entries[state->entries_indent].index = 0;
+
+  // format the struct start
+  return format(&state->format);
+}
+
+static i64 write_json_struct_end(struct dom_state *state, struct dom_token *) {
+  // check for hierarchy depth
+  if (state->entries_indent < 0) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // check for hierarchy match
+  if (state->entries[state->entries_indent].op != DOM_OP_STRUCT_START) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // decrease the indent
+  state->entries_indent--;
+
+  // prepare the format string
+  state->format.fmt = "}%s";
+  state->format.vargs[0] = (void *)json_close(state);
+  state->format.vargs_offset = 0;
+
+  // format the struct end
+  return format(&state->format);
+}
+
+static i64 write_json_key_start(struct dom_state *state, struct dom_token *) {
+  // check for hierarchy match
+  if (state->entries_indent < 0 || state->entries[state->entries_indent].op != DOM_OP_STRUCT_START) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // all keys except the first one are preceded by a comma
+  state->format.fmt = state->entries[state->entries_indent].index++ > 0 ? ",\"" : "\"";
+  state->format.vargs_offset = 0;
+
+  // increase the indent
+  state->entries_indent++;
+
+  // fix up the next entry
+  state->entries[state->entries_indent].op = DOM_OP_KEY_START;
+  state->entries[state->entries_indent].index = 0;
+
+  // format the opening quote
+  return format(&state->format);
+}
+
+static i64 write_json_key_end(struct dom_state *state, struct dom_token *) {
+  // check for hierarchy depth
+  if (state->entries_indent < 0) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // check for hierarchy match
+  if (state->entries[state->entries_indent].op != DOM_OP_KEY_START) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // decrease the indent
+  state->entries_indent--;
+
+  // prepare the format string, a sequence never completed is escaped byte by byte
+  state->format.fmt = "%j\":";
+  state->format.vargs[0] = (void *)state->pending;
+  state->format.vargs[1] = (void *)(u64)state->pending_size;
+  state->format.vargs_offset = 0;
+  state->pending_size = 0;
+
+  // format the closing quote
+  return format(&state->format);
+}
+
+static i64 write_json_value_start(struct dom_state *state, struct dom_token *) {
+  // check for hierarchy match
+  if (state->entries_indent < 0 || state->entries[state->entries_indent].op != DOM_OP_STRUCT_START) {
+    return DOM_ERROR_INVALID_HIERARCHY;
+  }
+
+  // increase the indent
+  state->entries_indent++;
+
+  // fix up the next entry
+  state->entries[state->entries_indent].op = DOM_OP_VALUE_START;
+  state->entries[state->entries_indent].type = DOM_TYPE_NULL;
+  state->entries[state->entries_indent].index = 0;
+
+  // the type is not part of the output
   return 0;
 }
 
+static i64 write_json_value_end(struct dom_state *state, struct dom_token *) {
+  return write_json_slot_end(state, DOM_OP_VALUE_START);
+}
+
 void dom_init(struct dom_state *state, struct malloc_lease *buffer) {
+  dom_init_style(state, buffer, DOM_STYLE_TEXT);
+}
+
+void dom_init_style(struct dom_state *state, struct malloc_lease *buffer, enum dom_style style) {
+  state->style = style;
+  state->items = 0;
+  state->pending_size = 0;
   state->entries_indent = -1;
   state->buffer = buffer;
   state->format.fmt = NULL;
@@ -407,7 +974,7 @@ i64 dom_write(struct dom_state *state, struct dom_token *tokens, u32 count) {
     }
 
     // delegate the call
-    result = DOM_WRITE_OP_FN[tokens->op](state, tokens);
+    result = DOM_WRITE_STYLE_FN[state->style][tokens->op](state, tokens);
 
     // we treat is as written, because it will be resumed
     if (result == FORMAT_ERROR_BUFFER_TOO_SMALL) {
@@ -1086,6 +1653,309 @@ static void can_resume_write_on_ascii_multipart() {
   assert_eq_str(buffer, expected, "should write exact text");
 }
 
+static void can_write_json_struct_with_nested_values() {
+  u32 size;
+  i64 result;
+  char buffer[256];
+
+  struct dom_state state;
+  struct malloc_lease lease;
+  struct dom_token tokens[25];
+
+  // initialize the state
+  lease.ptr = buffer;
+  lease.size = sizeof(buffer);
+
+  size = 25;
+  dom_init_style(&state, &lease, DOM_STYLE_JSON);
+
+  // set up the tokens
+  tokens[0].op = DOM_OP_STRUCT_START;
+  tokens[0].data = (u64) "abc";
+
+  tokens[1].op = DOM_OP_KEY_START;
+  tokens[2].op = DOM_OP_LITERAL;
+  tokens[2].type = DOM_TYPE_TEXT;
+  tokens[2].data = (u64) "a";
+  tokens[3].op = DOM_OP_KEY_END;
+
+  tokens[4].op = DOM_OP_VALUE_START;
+  tokens[5].op = DOM_OP_ARRAY_START;
+  tokens[6].op = DOM_OP_INDEX_START;
+  tokens[7].op = DOM_OP_LITERAL;
+  tokens[7].type = DOM_TYPE_I32;
+  tokens[7].data = (u64)(i64)-1;
+  tokens[8].op = DOM_OP_INDEX_END;
+  tokens[9].op = DOM_OP_INDEX_START;
+  tokens[10].op = DOM_OP_LITERAL;
+  tokens[10].type = DOM_TYPE_TEXT;
+  tokens[10].data = (u64) "x\"y";
+  tokens[11].op = DOM_OP_INDEX_END;
+  tokens[12].op = DOM_OP_ARRAY_END;
+  tokens[13].op = DOM_OP_VALUE_END;
+
+  tokens[14].op = DOM_OP_KEY_START;
+  tokens[15].op = DOM_OP_LITERAL;
+  tokens[15].type = DOM_TYPE_I32;
+  tokens[15].data = (u64)7;
+  tokens[16].op = DOM_OP_KEY_END;
+
+  tokens[17].op = DOM_OP_VALUE_START;
+  tokens[18].op = DOM_OP_LITERAL;
+  tokens[18].type = DOM_TYPE_ASCII;
+  tokens[18].data = PACK(2, "hello");
+  tokens[19].op = DOM_OP_LITERAL;
+  tokens[19].type = DOM_TYPE_ASCII;
+  tokens[19].data = PACK(3, "llo");
+  tokens[20].op = DOM_OP_VALUE_END;
+
+  tokens[21].op = DOM_OP_KEY_START;
+  tokens[22].op = DOM_OP_LITERAL;
+  tokens[22].type = DOM_TYPE_TEXT;
+  tokens[22].data = (u64) "n";
+  tokens[23].op = DOM_OP_KEY_END;
+
+  tokens[24].op = DOM_OP_VALUE_START;
+
+  // write the tokens
+  result = dom_write(&state, tokens, size);
+  assert(CONSUMED(result) == size, "should consume all tokens");
+
+  // close the empty value and the struct
+  tokens[0].op = DOM_OP_VALUE_END;
+  tokens[1].op = DOM_OP_STRUCT_END;
+
+  result = dom_write(&state, tokens, 2);
+  assert(CONSUMED(result) == 2, "should consume remaining tokens");
+
+  const char *expected = "{\"a\":[-1,\"x\\\"y\"],\"7\":\"hello\",\"n\":null}";
+
+  assert(state.format.buffer_offset == 38, "should write 38 bytes to the buffer");
+  assert_eq_str(buffer, expected, "should write exact json");
+}
+
+static void can_write_json_top_level_items() {
+  i64 result;
+  char buffer[256];
+
+  struct dom_state state;
+  struct malloc_lease lease;
+  struct dom_token tokens[4];
+
+  // initialize the state
+  lease.ptr = buffer;
+  lease.size = sizeof(buffer);
+
+  dom_init_style(&state, &lease, DOM_STYLE_JSON);
+
+  // set up two empty top-level items
+  tokens[0].op = DOM_OP_STRUCT_START;
+  tokens[1].op = DOM_OP_STRUCT_END;
+  tokens[2].op = DOM_OP_ARRAY_START;
+  tokens[3].op = DOM_OP_ARRAY_END;
+
+  // write the tokens
+  result = dom_write(&state, tokens, 4);
+
+  // assert the result
+  assert(CONSUMED(result) == 4, "should consume all tokens");
+  assert(state.items == 2, "should count two top-level items");
+  assert_eq_str(buffer, "{},[]", "should separate items with commas");
+}
+
+static void can_write_ndjson_top_level_items() {
+  i64 result;
+  char buffer[256];
+
+  struct dom_state state;
+  struct malloc_lease lease;
+  struct dom_token tokens[4];
+
+  // initialize the state
+  lease.ptr = buffer;
+  lease.size = sizeof(buffer);
+
+  dom_init_style(&state, &lease, DOM_STYLE_NDJSON);
+
+  // set up two empty top-level items
+  tokens[0].op = DOM_OP_STRUCT_START;
+  tokens[1].op = DOM_OP_STRUCT_END;
+  tokens[2].op = DOM_OP_ARRAY_START;
+  tokens[3].op = DOM_OP_ARRAY_END;
+
+  // write the tokens
+  result = dom_write(&state, tokens, 4);
+
+  // assert the result
+  assert(CONSUMED(result) == 4, "should consume all tokens");
+  assert_eq_str(buffer, "{}\n[]\n", "should terminate each item with a newline");
+}
+
+static void can_resume_json_write_on_ascii() {
+  i64 result;
+  char buffer[80];
+
+  struct dom_state state;
+  struct malloc_lease lease;
+  struct dom_token tokens[5];
+
+  // initialize the state, leaving 16 bytes for the output
+  lease.ptr = buffer;
+  lease.size = sizeof(buffer);
+
+  dom_init_style(&state, &lease, DOM_STYLE_JSON);
+
+  // set up the tokens
+  tokens[0].op = DOM_OP_ARRAY_START;
+  tokens[1].op = DOM_OP_INDEX_START;
+
+  tokens[2].op = DOM_OP_LITERAL;
+  tokens[2].type = DOM_TYPE_ASCII;
+  tokens[2].data = PACK(19, "0123456789\"abcdefgh");
+
+  tokens[3].op = DOM_OP_INDEX_END;
+  tokens[4].op = DOM_OP_ARRAY_END;
+
+  // write the tokens
+  result = dom_write(&state, tokens, 5);
+
+  // assert the result
+  assert(CONSUMED(result) == 3, "should consume only three tokens");
+  assert(PRODUCED(result) == 16, "should write 16 bytes to the buffer");
+  assert_eq_str(buffer, "[\"0123456789\\\"ab", "should keep the escape sequence whole");
+
+  // reset the state
+  state.format.buffer_offset = 0;
+
+  // flush the buffer
+  result = dom_flush(&state);
+
+  // assert the result
+  assert(result == 0, "should succeed");
+  assert(state.format.buffer_offset == 6, "should write 6 bytes to the buffer");
+
+  // write the tokens
+  result = dom_write(&state, tokens + 3, 2);
+
+  // assert the result
+  assert(CONSUMED(result) == 2, "should consume remaining two tokens");
+  assert_eq_str(buffer, "cdefgh\"]", "should close the string and the array");
+}
+
+static void can_write_json_typed_values() {
+  i64 result;
+  char buffer[256];
+
+  struct dom_state state;
+  struct malloc_lease lease;
+  struct dom_token tokens[18];
+
+  // initialize the state
+  lease.ptr = buffer;
+  lease.size = sizeof(buffer);
+
+  dom_init_style(&state, &lease, DOM_STYLE_JSON);
+
+  // booleans and binaries fill their slots at once
+  tokens[0].op = DOM_OP_ARRAY_START;
+  tokens[1].op = DOM_OP_INDEX_START;
+  tokens[2].op = DOM_OP_LITERAL;
+  tokens[2].type = DOM_TYPE_BOOL;
+  tokens[2].data = 1;
+  tokens[3].op = DOM_OP_INDEX_END;
+  tokens[4].op = DOM_OP_INDEX_START;
+  tokens[5].op = DOM_OP_LITERAL;
+  tokens[5].type = DOM_TYPE_BINARY;
+  tokens[5].data = PACK(2, "\x00\xff");
+  tokens[6].op = DOM_OP_INDEX_END;
+
+  // a sequence split between two pieces stays whole
+  tokens[7].op = DOM_OP_INDEX_START;
+  tokens[8].op = DOM_OP_LITERAL;
+  tokens[8].type = DOM_TYPE_ASCII;
+  tokens[8].data = PACK(2, "a\xc5");
+  tokens[9].op = DOM_OP_LITERAL;
+  tokens[9].type = DOM_TYPE_ASCII;
+  tokens[9].data = PACK(2, "\x9a\n");
+  tokens[10].op = DOM_OP_INDEX_END;
+
+  // a sequence never completed is escaped
+  tokens[11].op = DOM_OP_INDEX_START;
+  tokens[12].op = DOM_OP_LITERAL;
+  tokens[12].type = DOM_TYPE_ASCII;
+  tokens[12].data = PACK(2, "b\xe2");
+  tokens[13].op = DOM_OP_LITERAL;
+  tokens[13].type = DOM_TYPE_ASCII;
+  tokens[13].data = PACK(1, "\x82");
+  tokens[14].op = DOM_OP_INDEX_END;
+  tokens[15].op = DOM_OP_INDEX_START;
+  tokens[16].op = DOM_OP_INDEX_END;
+  tokens[17].op = DOM_OP_ARRAY_END;
+
+  // write the tokens
+  result = dom_write(&state, tokens, 18);
+
+  // assert the result
+  assert(CONSUMED(result) == 18, "should consume all tokens");
+  assert_eq_str(buffer, "[true,\"00ff\",\"a\xc5\x9a\\n\",\"b\\u00e2\\u0082\",null]", "should write typed json values");
+}
+
+static void can_write_json_real_values() {
+  i64 result;
+  char buffer[256];
+
+  struct dom_state state;
+  struct malloc_lease lease;
+  struct dom_token tokens[11];
+
+  union {
+    f64 value;
+    u64 bits;
+  } wide;
+
+  union {
+    f32 value;
+    u32 bits;
+  } narrow;
+
+  // initialize the state
+  lease.ptr = buffer;
+  lease.size = sizeof(buffer);
+
+  dom_init_style(&state, &lease, DOM_STYLE_JSON);
+
+  // both widths keep their own shortest digits
+  tokens[0].op = DOM_OP_ARRAY_START;
+  tokens[1].op = DOM_OP_INDEX_START;
+  wide.value = 0.1;
+  tokens[2].op = DOM_OP_LITERAL;
+  tokens[2].type = DOM_TYPE_F64;
+  tokens[2].data = wide.bits;
+  tokens[3].op = DOM_OP_INDEX_END;
+  tokens[4].op = DOM_OP_INDEX_START;
+  narrow.value = 0.1f;
+  tokens[5].op = DOM_OP_LITERAL;
+  tokens[5].type = DOM_TYPE_F32;
+  tokens[5].data = narrow.bits;
+  tokens[6].op = DOM_OP_INDEX_END;
+
+  // values without a JSON number become strings
+  tokens[7].op = DOM_OP_INDEX_START;
+  wide.value = -1.0 / 0.0;
+  tokens[8].op = DOM_OP_LITERAL;
+  tokens[8].type = DOM_TYPE_F64;
+  tokens[8].data = wide.bits;
+  tokens[9].op = DOM_OP_INDEX_END;
+  tokens[10].op = DOM_OP_ARRAY_END;
+
+  // write the tokens
+  result = dom_write(&state, tokens, 11);
+
+  // assert the result
+  assert(CONSUMED(result) == 11, "should consume all tokens");
+  assert_eq_str(buffer, "[0.1,0.1,\"-inf\"]", "should write json reals");
+}
+
 void dom_test_cases(struct runner_context *ctx) {
   test_case(ctx, "can write array with no items", can_write_array_with_no_items);
   test_case(ctx, "can write array with one item", can_write_array_with_one_item);
@@ -1100,6 +1970,13 @@ void dom_test_cases(struct runner_context *ctx) {
   test_case(ctx, "can resume write on text", can_resume_write_on_text);
   test_case(ctx, "can resume write on ascii", can_resume_write_on_ascii);
   test_case(ctx, "can resume write on ascii multipart", can_resume_write_on_ascii_multipart);
+
+  test_case(ctx, "can write json struct with nested values", can_write_json_struct_with_nested_values);
+  test_case(ctx, "can write json top-level items", can_write_json_top_level_items);
+  test_case(ctx, "can write ndjson top-level items", can_write_ndjson_top_level_items);
+  test_case(ctx, "can resume json write on ascii", can_resume_json_write_on_ascii);
+  test_case(ctx, "can write json typed values", can_write_json_typed_values);
+  test_case(ctx, "can write json real values", can_write_json_real_values);
 }
 
 #endif
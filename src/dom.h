@@ -2,12 +2,14 @@
 
 #include "error.h"
 #include "format.base.h"
+#include "format.real.h"
 #include "malloc.h"
 #include "typing.h"
 #include "vargs.h"
 
 #define DOM_TOKENS_MAX 32
 #define DOM_ENTRIES_MAX 16
+#define DOM_REAL_SIZE (FORMAT_REAL_SIZE + 1)
 
 enum dom_error {
   // indicates that the token type is invalid
@@ -32,9 +34,13 @@ enum dom_type {
   DOM_TYPE_U64 = 0x08,
   DOM_TYPE_TEXT = 0x09,
   DOM_TYPE_ASCII = 0x0a,
-  DOM_TYPE_ARRAY = 0x0b,
-  DOM_TYPE_STRUCT = 0x0c,
-  DOM_TYPE_SIZE = 0x0d,
+  DOM_TYPE_BOOL = 0x0b,
+  DOM_TYPE_BINARY = 0x0c,
+  DOM_TYPE_F32 = 0x0d,
+  DOM_TYPE_F64 = 0x0e,
+  DOM_TYPE_ARRAY = 0x0f,
+  DOM_TYPE_STRUCT = 0x10,
+  DOM_TYPE_SIZE = 0x11,
 };
 
 enum dom_op {
@@ -52,6 +58,13 @@ enum dom_op {
   DOM_OP_SIZE
 };
 
+enum dom_style {
+  DOM_STYLE_TEXT = 0x00,   // indented human readable text
+  DOM_STYLE_JSON = 0x01,   // compact JSON, top-level items separated by commas
+  DOM_STYLE_NDJSON = 0x02, // compact JSON, each top-level item on its own line
+  DOM_STYLE_SIZE
+};
+
 struct dom_token {
   u8 op;    // required op
   u8 type;  // required type
@@ -65,9 +78,15 @@ struct dom_state_entry {
 };
 
 struct dom_state {
+  u8 style;               // selected renderer
   i8 entries_indent;      // entries depth level
+  u32 items;              // number of started top-level items
   void *vargs[VARGS_MAX]; // variable arguments
 
+  u8 pending_size; // bytes of a UTF-8 sequence split between two ascii pieces
+  char pending[4]; // the leading bytes of the split sequence
+  char joined[4];  // the split sequence once completed by the next piece
+
   struct malloc_lease *buffer;                     // allocated output
   struct format_context format;                    // format context
   struct dom_state_entry entries[DOM_ENTRIES_MAX]; // stack of entries
@@ -78,6 +97,12 @@ struct dom_state {
 /// @param buffer Pointer to the buffer to use for writing.
 extern void dom_init(struct dom_state *state, struct malloc_lease *buffer);
 
+/// @brief Initializes the DOM state with the selected renderer.
+/// @param state Pointer to the DOM state to initialize.
+/// @param buffer Pointer to the buffer to use for writing.
+/// @param style Renderer used by all subsequent writes.
+extern void dom_init_style(struct dom_state *state, struct malloc_lease *buffer, enum dom_style style);
+
 /// @brief Write a DOM token stream to the stdout.
 /// @param state Pointer to the DOM state passed between calls.
 /// @param tokens Pointer to the array of DOM tokens to write.
@@ -90,6 +115,12 @@ extern i64 dom_write(struct dom_state *state, struct dom_token *tokens, u32 coun
 /// @return Zero on success, or a negative error code.
 extern i64 dom_flush(struct dom_state *state);
 
+/// @brief Formats the value of a real literal with the fewest digits reading back as the same value.
+/// @param token Pointer to the DOM_TYPE_F32 or DOM_TYPE_F64 literal.
+/// @param buffer Pointer to at least DOM_REAL_SIZE bytes receiving the null-terminated digits.
+/// @return The buffer with the digits.
+extern const char *dom_real(const struct dom_token *token, char *buffer);
+
 #if defined(I13C_TESTS)
 
 /// @brief Registers dom test cases.
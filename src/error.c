@@ -10,7 +10,7 @@ static const char *const ERROR_MAP[] = {
   [ERROR_INDEX(THRIFT_ERROR_BASE)] = THRIFT_ERROR_NAME,   [ERROR_INDEX(MALLOC_ERROR_BASE)] = MALLOC_ERROR_NAME,
   [ERROR_INDEX(PARQUET_ERROR_BASE)] = PARQUET_ERROR_NAME, [ERROR_INDEX(DOM_ERROR_BASE)] = DOM_ERROR_NAME,
   [ERROR_INDEX(FORMAT_ERROR_BASE)] = FORMAT_ERROR_NAME,   [ERROR_INDEX(ARENA_ERROR_BASE)] = ARENA_ERROR_NAME,
-  [ERROR_INDEX(ARGV_ERROR_BASE)] = ARGV_ERROR_NAME,
+  [ERROR_INDEX(ARGV_ERROR_BASE)] = ARGV_ERROR_NAME,       [ERROR_INDEX(CODEC_ERROR_BASE)] = CODEC_ERROR_NAME,
 };
 
 const char *res2str(i64 result) {
@@ -28,7 +28,10 @@
 #define ARGV_ERROR_BASE (ERROR_BASE - 6 * ERROR_BLOCK_SIZE)
 #define ARGV_ERROR_NAME "argv"
 
-#define ERROR_BASE_MAX ARGV_ERROR_BASE
+#define CODEC_ERROR_BASE (ERROR_BASE - 7 * ERROR_BLOCK_SIZE)
+#define CODEC_ERROR_NAME "codec"
+
+#define ERROR_BASE_MAX CODEC_ERROR_BASE
 
 /// @brief Converts a result to a string representation.
 /// @param result Result value to convert.
@@ -18,6 +18,12 @@
 #define SUBSTITUTION_ASCII_MAX 0x7e
 #define SUBSTITUTION_ASCII_FALLBACK 0x2e
 
+#define SUBSTITUTION_JSON 'j'
+#define SUBSTITUTION_JSON_ESCAPE '\\'
+#define SUBSTITUTION_JSON_UNICODE_LEN 6
+
+#define SUBSTITUTION_BINARY 'b'
+
 #define SUBSTITUTION_DECIMAL 'd'
 #define SUBSTITUTION_DECIMAL_LEN 21
 #define SUBSTITUTION_DECIMAL_ALPHABET "0123456789"
@@ -212,6 +218,157 @@ static i64 substitute_ascii(struct format_context *ctx, const char **src, u64 *s
   return 0;
 }
 
+i64 format_utf8(const char *src, u64 size) {
+  u8 lead, low, high;
+  u64 length, index;
+
+  // the lead byte tells the length and narrows the second byte against overlongs and surrogates
+  lead = (u8)src[0];
+  low = 0x80;
+  high = 0xbf;
+
+  if (lead < 0x80) return 1;
+  if (lead < 0xc2 || lead > 0xf4) return 0;
+
+  if (lead < 0xe0) {
+    length = 2;
+  } else if (lead < 0xf0) {
+    length = 3;
+    low = lead == 0xe0 ? 0xa0 : 0x80;
+    high = lead == 0xed ? 0x9f : 0xbf;
+  } else {
+    length = 4;
+    low = lead == 0xf0 ? 0x90 : 0x80;
+    high = lead == 0xf4 ? 0x8f : 0xbf;
+  }
+
+  // all continuation bytes present have to be in range
+  for (index = 1; index < length && index < size; index++) {
+    if ((u8)src[index] < low || (u8)src[index] > high) return 0;
+
+    low = 0x80;
+    high = 0xbf;
+  }
+
+  // a valid prefix cut short reports the missing bytes
+  return index < length ? -(i64)(length - index) : (i64)length;
+}
+
+static i64 substitute_json(struct format_context *ctx, const char **src, u64 *size) {
+  u8 ch;
+  i64 length;
+  u64 available, needed, index;
+  const char *escape;
+  const char *chars = SUBSTITUTION_HEX_ALPHABET;
+
+  // calculate available space in the buffer
+  available = ctx->buffer_size - ctx->buffer_offset;
+
+  // copy the string until EOS or until the next character does not fit
+  while (*size > 0) {
+    ch = (u8)**src;
+    length = 1;
+    escape = NULL;
+
+    // short escapes for quotes, backslashes and common control characters
+    switch (ch) {
+      case '"':
+        escape = "\\\"";
+        break;
+      case '\\':
+        escape = "\\\\";
+        break;
+      case '\n':
+        escape = "\\n";
+        break;
+      case '\r':
+        escape = "\\r";
+        break;
+      case '\t':
+        escape = "\\t";
+        break;
+      case '\b':
+        escape = "\\b";
+        break;
+      case '\f':
+        escape = "\\f";
+        break;
+    }
+
+    // valid UTF-8 passes as it is, other control characters and stray bytes become code points; a stray byte
+    // reads back as the U+0080..U+00FF character it names, so bytes which are not UTF-8 are not kept exactly
+    if (escape != NULL) {
+      needed = 2;
+    } else if (ch >= SUBSTITUTION_ASCII_MIN && ch <= SUBSTITUTION_ASCII_MAX) {
+      needed = 1;
+    } else if (ch > SUBSTITUTION_ASCII_MAX && (length = format_utf8(*src, *size)) > 1) {
+      needed = (u64)length;
+    } else {
+      length = 1;
+      needed = SUBSTITUTION_JSON_UNICODE_LEN;
+    }
+
+    // never split an escape or a multibyte sequence
+    if (available < needed) break;
+
+    if (escape != NULL) {
+      ctx->buffer[ctx->buffer_offset++] = escape[0];
+      ctx->buffer[ctx->buffer_offset++] = escape[1];
+    } else if (needed == SUBSTITUTION_JSON_UNICODE_LEN) {
+      ctx->buffer[ctx->buffer_offset++] = SUBSTITUTION_JSON_ESCAPE;
+      ctx->buffer[ctx->buffer_offset++] = 'u';
+      ctx->buffer[ctx->buffer_offset++] = '0';
+      ctx->buffer[ctx->buffer_offset++] = '0';
+      ctx->buffer[ctx->buffer_offset++] = chars[ch >> 4];
+      ctx->buffer[ctx->buffer_offset++] = chars[ch & 0x0f];
+    } else {
+      for (index = 0; index < needed; index++) {
+        ctx->buffer[ctx->buffer_offset++] = (*src)[index];
+      }
+    }
+
+    available -= needed;
+    *src += length;
+    *size -= (u64)length;
+  }
+
+  // report an error if the string was not fully copied
+  if (*size > 0) {
+    return FORMAT_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  // success
+  return 0;
+}
+
+static i64 substitute_binary(struct format_context *ctx, const char **src, u64 *size) {
+  u8 ch;
+  u64 available;
+  const char *chars = SUBSTITUTION_HEX_ALPHABET;
+
+  // calculate available space in the buffer
+  available = ctx->buffer_size - ctx->buffer_offset;
+
+  // each byte takes two lowercase hex digits
+  while (*size > 0 && available >= 2) {
+    ch = (u8)**src;
+    (*src)++;
+    (*size)--;
+
+    ctx->buffer[ctx->buffer_offset++] = chars[ch >> 4];
+    ctx->buffer[ctx->buffer_offset++] = chars[ch & 0x0f];
+    available -= 2;
+  }
+
+  // report an error if the bytes were not fully copied
+  if (*size > 0) {
+    return FORMAT_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  // success
+  return 0;
+}
+
 static i64 substitute_endless(struct format_context *ctx, const char *src, i64 *count) {
   char ch;
   u64 available;
@@ -265,6 +422,24 @@ i64 format(struct format_context *ctx) {
           ctx->fmt += 2;
           continue;
 
+        case SUBSTITUTION_JSON:
+          result = substitute_json(ctx, (const char **)ctx->vargs + ctx->vargs_offset,
+                                   (u64 *)ctx->vargs + ctx->vargs_offset + 1);
+          if (result == FORMAT_ERROR_BUFFER_TOO_SMALL) continue;
+
+          ctx->vargs_offset += 2;
+          ctx->fmt += 2;
+          continue;
+
+        case SUBSTITUTION_BINARY:
+          result = substitute_binary(ctx, (const char **)ctx->vargs + ctx->vargs_offset,
+                                     (u64 *)ctx->vargs + ctx->vargs_offset + 1);
+          if (result == FORMAT_ERROR_BUFFER_TOO_SMALL) continue;
+
+          ctx->vargs_offset += 2;
+          ctx->fmt += 2;
+          continue;
+
         case SUBSTITUTION_ENDLESS:
           result = substitute_endless(ctx, (const char *)ctx->vargs[ctx->vargs_offset],
                                       (i64 *)ctx->vargs + ctx->vargs_offset + 1);
@@ -553,6 +728,122 @@ static void can_format_with_ascii_substitution() {
   assert_eq_str(buffer, "ASCII: Hello, ..limak!", "should format 'ASCII: Hello, ..limak!'");
 }
 
+static void can_format_with_json_substitution() {
+  char buffer[32];
+  struct format_context ctx;
+  void *vargs[VARGS_MAX];
+  i64 offset = 0;
+
+  // initialize the context
+  ctx.fmt = "JSON: %j";
+  ctx.vargs = vargs;
+  ctx.vargs_offset = 0;
+  ctx.vargs_max = VARGS_MAX;
+  ctx.buffer = buffer;
+  ctx.buffer_offset = 0;
+  ctx.buffer_size = sizeof(buffer) - 2;
+
+  // not initialize all vargs
+  vargs[0] = "a\"b\\c\n";
+  vargs[1] = (void *)(u64)6;
+
+  // format a string with json substitution
+  offset = format(&ctx);
+
+  // assert the result
+  assert(offset == 15, "should write 15 bytes");
+  assert_eq_str(buffer, "JSON: a\\\"b\\\\c\\n", "should format 'JSON: a\\\"b\\\\c\\n'");
+}
+
+static void can_format_with_json_substitution_of_utf8() {
+  char buffer[64];
+  struct format_context ctx;
+  void *vargs[VARGS_MAX];
+  i64 offset = 0;
+
+  // initialize the context
+  ctx.fmt = "%j";
+  ctx.vargs = vargs;
+  ctx.vargs_offset = 0;
+  ctx.vargs_max = VARGS_MAX;
+  ctx.buffer = buffer;
+  ctx.buffer_offset = 0;
+  ctx.buffer_size = sizeof(buffer) - 2;
+
+  // valid sequences, a control character, a stray continuation, an overlong and a cut sequence
+  vargs[0] = "\xc5\x9alimak\x01\x80\xc0\xaf\xe2\x82";
+  vargs[1] = (void *)(u64)13;
+
+  // format a string with json substitution
+  offset = format(&ctx);
+
+  // assert the result
+  assert(offset == 43, "should write 43 bytes");
+  assert_eq_str(buffer, "\xc5\x9alimak\\u0001\\u0080\\u00c0\\u00af\\u00e2\\u0082", "should escape only invalid bytes");
+}
+
+static void can_format_with_binary_substitution() {
+  char buffer[32];
+  struct format_context ctx;
+  void *vargs[VARGS_MAX];
+  i64 offset = 0;
+
+  // initialize the context
+  ctx.fmt = "HEX: %b";
+  ctx.vargs = vargs;
+  ctx.vargs_offset = 0;
+  ctx.vargs_max = VARGS_MAX;
+  ctx.buffer = buffer;
+  ctx.buffer_offset = 0;
+  ctx.buffer_size = sizeof(buffer) - 2;
+
+  // not initialize all vargs
+  vargs[0] = "\x00\x7f\xab\xff";
+  vargs[1] = (void *)(u64)4;
+
+  // format bytes with binary substitution
+  offset = format(&ctx);
+
+  // assert the result
+  assert(offset == 13, "should write 13 bytes");
+  assert_eq_str(buffer, "HEX: 007fabff", "should format 'HEX: 007fabff'");
+}
+
+static void can_detect_overflow_in_json_substitution() {
+  char buffer[16];
+  struct format_context ctx;
+  void *vargs[VARGS_MAX];
+  i64 result;
+
+  // initialize the context
+  ctx.fmt = "%j";
+  ctx.vargs = vargs;
+  ctx.vargs_offset = 0;
+  ctx.vargs_max = VARGS_MAX;
+  ctx.buffer = buffer;
+  ctx.buffer_offset = 0;
+  ctx.buffer_size = 4;
+
+  // escaped quote does not fit the last byte
+  vargs[0] = "abc\"d";
+  vargs[1] = (void *)(u64)5;
+
+  // format a string with json substitution
+  result = format(&ctx);
+
+  // assert the result
+  assert(result == FORMAT_ERROR_BUFFER_TOO_SMALL, "should detect buffer too small");
+  assert(ctx.buffer_offset == 3, "should not split the escape sequence");
+
+  // resume in the emptied buffer
+  ctx.buffer_offset = 0;
+  result = format(&ctx);
+
+  // assert the result
+  assert(result == 3, "should write 3 bytes");
+  assert_eq_str(buffer, "\\\"d", "should resume with the escape sequence");
+}
+
 static void can_format_with_endless_substitution() {
   char buffer[512];
   struct format_context ctx;
@@ -909,6 +1200,9 @@ void format_test_cases_base(struct runner_context *ctx) {
   test_case(ctx, "can format with decimal int64 min", can_format_with_decimal_int64_min);
   test_case(ctx, "can format with indent substitution", can_format_with_indent_substitution);
   test_case(ctx, "can format with ascii substitution", can_format_with_ascii_substitution);
+  test_case(ctx, "can format with json substitution", can_format_with_json_substitution);
+  test_case(ctx, "can format with json substitution of utf8", can_format_with_json_substitution_of_utf8);
+  test_case(ctx, "can format with binary substitution", can_format_with_binary_substitution);
   test_case(ctx, "can format with endless substitution", can_format_with_endless_substitution);
   test_case(ctx, "can format with result substitution", can_format_with_result_substitution);
   test_case(ctx, "can format with unknown substitution", can_format_with_unknown_substitution);
@@ -921,6 +1215,7 @@ void format_test_cases_base(struct runner_context *ctx) {
   test_case(ctx, "can detect overflow with two vargs", can_detect_overflow_with_two_vargs);
   test_case(ctx, "can detect overflow in long substitution 1", can_detect_overflow_in_long_substitution_1);
   test_case(ctx, "can detect overflow in long substitution 2", can_detect_overflow_in_long_substitution_2);
+  test_case(ctx, "can detect overflow in json substitution", can_detect_overflow_in_json_substitution);
 }
 
 #endif
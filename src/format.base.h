@@ -23,6 +23,13 @@ struct format_context {
 /// @return The number of bytes written to the buffer, or a negative error code.
 extern i64 format(struct format_context *ctx);
 
+/// @brief Measures the UTF-8 sequence starting at the given bytes.
+/// @param src Pointer to the bytes, at least one.
+/// @param size Number of available bytes.
+/// @return The length of the valid sequence, 0 if the bytes cannot form one, or the negated number of bytes missing
+/// from a valid sequence cut short.
+extern i64 format_utf8(const char *src, u64 size);
+
 #if defined(I13C_TESTS)
 
 /// @brief Registers format test cases.
@@ -0,0 +1,468 @@
+#include "format.real.h"
+#include "runner.h"
+#include "typing.h"
+
+#define FORMAT_REAL_BIG_LIMBS 40 // limbs holding any DOUBLE scaled by the powers of ten it needs, about 1130 bits
+
+// an unsigned integer wide enough to compare a value with its neighbours exactly
+struct format_real_big {
+  u32 size;                         // number of limbs in use, the highest one is never zero
+  u32 limbs[FORMAT_REAL_BIG_LIMBS]; // limbs, the lowest first
+};
+
+// pairs of decimal digits, so digits are extracted two at a time
+static const char FORMAT_REAL_DIGITS[201] = "0001020304050607080910111213141516171819"
+                                            "2021222324252627282930313233343536373839"
+                                            "4041424344454647484950515253545556575859"
+                                            "6061626364656667686970717273747576777879"
+                                            "8081828384858687888990919293949596979899";
+
+// powers of ten exactly representable as doubles, and up to 1e10 as floats
+static const f64 FORMAT_REAL_POWERS[23] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// powers of ten telling the number of digits of an integer
+static const u64 FORMAT_REAL_SCALES[20] = {
+  1ull,
+  10ull,
+  100ull,
+  1000ull,
+  10000ull,
+  100000ull,
+  1000000ull,
+  10000000ull,
+  100000000ull,
+  1000000000ull,
+  10000000000ull,
+  100000000000ull,
+  1000000000000ull,
+  10000000000000ull,
+  100000000000000ull,
+  1000000000000000ull,
+  10000000000000000ull,
+  100000000000000000ull,
+  1000000000000000000ull,
+  10000000000000000000ull,
+};
+
+static f64 format_real_scale(f64 value, i32 shift) {
+  // far shifts go through the largest exact power
+  while (shift > 22) {
+    value *= 1e22;
+    shift -= 22;
+  }
+
+  while (shift < -22) {
+    value /= 1e22;
+    shift += 22;
+  }
+
+  return shift >= 0 ? value * FORMAT_REAL_POWERS[shift] : value / FORMAT_REAL_POWERS[-shift];
+}
+
+static void format_real_big_set(struct format_real_big *big, u64 value) {
+  big->limbs[0] = (u32)value;
+  big->limbs[1] = (u32)(value >> 32);
+  big->size = (value >> 32) > 0 ? 2 : value > 0;
+}
+
+static void format_real_big_multiply(struct format_real_big *big, u32 factor) {
+  u32 index;
+  u64 carry;
+
+  for (index = 0, carry = 0; index < big->size; index++) {
+    carry += (u64)big->limbs[index] * factor;
+    big->limbs[index] = (u32)carry;
+    carry >>= 32;
+  }
+
+  // the carry opens a new limb
+  if (carry > 0) big->limbs[big->size++] = (u32)carry;
+}
+
+static void format_real_big_shift(struct format_real_big *big, u32 bits) {
+  i32 index;
+  u32 limbs;
+
+  // whole limbs move up, zeros fill the bottom
+  limbs = bits / 32;
+
+  if (big->size > 0 && limbs > 0) {
+    for (index = big->size - 1; index >= 0; index--) big->limbs[index + limbs] = big->limbs[index];
+    for (index = 0; index < (i32)limbs; index++) big->limbs[index] = 0;
+
+    big->size += limbs;
+  }
+
+  // the remaining bits are a multiplication
+  format_real_big_multiply(big, 1u << (bits % 32));
+}
+
+static void format_real_big_power(struct format_real_big *big, u32 power) {
+  // nine digits at a time fit a limb
+  for (; power >= 9; power -= 9) format_real_big_multiply(big, 1000000000);
+  format_real_big_multiply(big, (u32)FORMAT_REAL_SCALES[power]);
+}
+
+static void format_real_big_add(struct format_real_big *target,
+                                const struct format_real_big *left,
+                                const struct format_real_big *right) {
+  u32 index;
+  u64 carry;
+
+  target->size = left->size > right->size ? left->size : right->size;
+
+  for (index = 0, carry = 0; index < target->size; index++) {
+    carry += index < left->size ? left->limbs[index] : 0;
+    carry += index < right->size ? right->limbs[index] : 0;
+    target->limbs[index] = (u32)carry;
+    carry >>= 32;
+  }
+
+  // the carry opens a new limb
+  if (carry > 0) target->limbs[target->size++] = (u32)carry;
+}
+
+static void format_real_big_subtract(struct format_real_big *big, const struct format_real_big *other) {
+  u32 index;
+  i64 borrow;
+
+  // the other one is never larger
+  for (index = 0, borrow = 0; index < big->size; index++) {
+    borrow = (i64)big->limbs[index] - (index < other->size ? other->limbs[index] : 0) - borrow;
+    big->limbs[index] = (u32)borrow;
+    borrow = borrow < 0;
+  }
+
+  // drop the emptied highest limbs
+  while (big->size > 0 && big->limbs[big->size - 1] == 0) big->size--;
+}
+
+static i32 format_real_big_compare(const struct format_real_big *left, const struct format_real_big *right) {
+  i32 index;
+
+  // more limbs mean a larger value
+  if (left->size != right->size) return left->size < right->size ? -1 : 1;
+
+  for (index = left->size - 1; index >= 0; index--) {
+    if (left->limbs[index] != right->limbs[index]) return left->limbs[index] < right->limbs[index] ? -1 : 1;
+  }
+
+  return 0;
+}
+
+static u32 format_real_shortest(u64 mantissa, i32 exponent, bool boundary, char *digits, i32 *decimal) {
+  i32 order, compared;
+  u32 count, digit;
+  bool even, below, above;
+  struct format_real_big value, scale, high, low, sum;
+
+  // the value is value / scale, the neighbours lie half-way at (value +- high or low) / scale, all doubled
+  format_real_big_set(&value, mantissa);
+  format_real_big_set(&scale, 1);
+  format_real_big_set(&high, 1);
+  format_real_big_set(&low, 1);
+
+  if (exponent >= 0) {
+    format_real_big_shift(&value, exponent);
+    format_real_big_shift(&high, exponent);
+    format_real_big_shift(&low, exponent);
+  } else {
+    format_real_big_shift(&scale, -exponent);
+  }
+
+  // the lower neighbour of a power of two is twice as close
+  format_real_big_shift(&value, boundary ? 2 : 1);
+  format_real_big_shift(&scale, boundary ? 2 : 1);
+  if (boundary) format_real_big_shift(&high, 1);
+
+  // an even mantissa owns the half-way points, as reading rounds ties to even
+  even = (mantissa & 1) == 0;
+
+  // the binary exponent tells the decimal one, up to one
+  order = ((63 - __builtin_clzll(mantissa) + exponent) * 78913) >> 18;
+
+  if (order >= 0) {
+    format_real_big_power(&scale, order);
+  } else {
+    format_real_big_power(&value, -order);
+    format_real_big_power(&high, -order);
+    format_real_big_power(&low, -order);
+  }
+
+  // the upper neighbour must stay below the next power of ten
+  for (;;) {
+    format_real_big_add(&sum, &value, &high);
+    compared = format_real_big_compare(&sum, &scale);
+    if (compared < 0 || (compared == 0 && !even)) break;
+
+    format_real_big_multiply(&scale, 10);
+    order++;
+  }
+
+  // generate the digits until the rest is closer than a neighbour
+  for (count = 0, below = above = FALSE; !below && !above && count < FORMAT_REAL_DOUBLE_DIGITS; count++) {
+    format_real_big_multiply(&value, 10);
+    format_real_big_multiply(&high, 10);
+    format_real_big_multiply(&low, 10);
+
+    // the quotient is a single digit
+    for (digit = 0; format_real_big_compare(&value, &scale) >= 0; digit++) {
+      format_real_big_subtract(&value, &scale);
+    }
+
+    compared = format_real_big_compare(&value, &low);
+    below = compared < 0 || (compared == 0 && even);
+
+    format_real_big_add(&sum, &value, &high);
+    compared = format_real_big_compare(&sum, &scale);
+    above = compared > 0 || (compared == 0 && even);
+
+    // both digits read back, the closer one wins
+    if (below && above) {
+      format_real_big_shift(&value, 1);
+      compared = format_real_big_compare(&value, &scale);
+      digit += compared > 0 || (compared == 0 && (digit & 1));
+    } else if (above) {
+      digit++;
+    }
+
+    digits[count] = '0' + digit;
+  }
+
+  // the digits are 0.d1d2... times 10^order
+  *decimal = order - 1;
+  return count;
+}
+
+static u32 format_real_guess(f64 value, bool single, char *digits, i32 *decimal) {
+  i32 exponent, shift, index, count;
+  u64 mantissa, limit;
+  f32 narrow;
+  f64 wide;
+
+  union {
+    f64 value;
+    u64 bits;
+  } binary;
+
+  // a grid of 15 digits, or 6 for FLOAT, is coarser than the gaps between neighbours
+  count = single ? 6 : 15;
+
+  // the binary exponent tells the decimal one, up to one
+  binary.value = value;
+  exponent = (((i32)((binary.bits >> 52) & 0x7ff) - 1023) * 78913) >> 18;
+
+  // scale the value to exactly that many integer digits
+  value = format_real_scale(value, count - 1 - exponent);
+  limit = FORMAT_REAL_SCALES[count];
+
+  for (; value >= limit; exponent++) value /= 10;
+  for (; value < limit / 10; exponent--) value *= 10;
+
+  // rounding may carry into one more digit
+  mantissa = (u64)(value + 0.5);
+  if (mantissa >= limit) {
+    mantissa /= 10;
+    exponent++;
+  }
+
+  // the digits read back exactly only when the power of ten is exact, then at most one of them does
+  shift = exponent - (count - 1);
+  if (shift < -(single ? 10 : 22) || shift > (single ? 10 : 22)) return 0;
+
+  if (single) {
+    narrow = shift >= 0 ? (f32)mantissa * (f32)FORMAT_REAL_POWERS[shift]
+                        : (f32)mantissa / (f32)FORMAT_REAL_POWERS[-shift];
+    if (narrow != (f32)binary.value) return 0;
+  } else {
+    wide = shift >= 0 ? (f64)mantissa * FORMAT_REAL_POWERS[shift] : (f64)mantissa / FORMAT_REAL_POWERS[-shift];
+    if (wide != binary.value) return 0;
+  }
+
+  // extract the digits two at a time
+  for (index = count; index > 1; index -= 2, mantissa /= 100) {
+    digits[index - 1] = FORMAT_REAL_DIGITS[mantissa % 100 * 2 + 1];
+    digits[index - 2] = FORMAT_REAL_DIGITS[mantissa % 100 * 2];
+  }
+
+  if (index == 1) digits[0] = '0' + mantissa;
+
+  *decimal = exponent;
+  return count;
+}
+
+u32 format_real(char *target, f64 value, bool single) {
+  i32 exponent, index, count, precision;
+  u64 mantissa, hidden, biased;
+  char *origin;
+  char buffer[FORMAT_REAL_DOUBLE_DIGITS];
+
+  union {
+    f64 value;
+    u64 bits;
+  } binary;
+
+  union {
+    f32 value;
+    u32 bits;
+  } narrow;
+
+  origin = target;
+  precision = single ? FORMAT_REAL_FLOAT_DIGITS : FORMAT_REAL_DOUBLE_DIGITS;
+
+  // special values first
+  if (value != value) {
+    *target++ = 'n';
+    *target++ = 'a';
+    *target++ = 'n';
+    return target - origin;
+  }
+
+  if (value < 0) {
+    *target++ = '-';
+    value = -value;
+  }
+
+  if (value == 0) {
+    *target++ = '0';
+    return target - origin;
+  }
+
+  if (value > 1.7976931348623157e308) {
+    *target++ = 'i';
+    *target++ = 'n';
+    *target++ = 'f';
+    return target - origin;
+  }
+
+  if (value < (single ? 16777216.0 : 9007199254740992.0) && value == (f64)(u64)value) {
+    // integers with every digit significant are their own shortest form
+    mantissa = (u64)value;
+    count = 1;
+    while (mantissa >= FORMAT_REAL_SCALES[count]) count++;
+
+    for (index = count, exponent = count - 1; index > 0; index--, mantissa /= 10) {
+      buffer[index - 1] = '0' + mantissa % 10;
+    }
+  } else if ((count = format_real_guess(value, single, buffer, &exponent)) == 0) {
+    // split the value of its own width into the mantissa and the binary exponent
+    if (single) {
+      narrow.value = (f32)value;
+      biased = (narrow.bits >> 23) & 0xff;
+      hidden = 1ull << 23;
+      mantissa = narrow.bits & (hidden - 1);
+      exponent = biased > 0 ? (i32)biased - 150 : -149;
+    } else {
+      binary.value = value;
+      biased = (binary.bits >> 52) & 0x7ff;
+      hidden = 1ull << 52;
+      mantissa = binary.bits & (hidden - 1);
+      exponent = biased > 0 ? (i32)biased - 1075 : -1074;
+    }
+
+    // subnormal values have no hidden bit
+    if (biased > 0) mantissa |= hidden;
+
+    // the fewest digits reading back as the same value, found exactly
+    count = format_real_shortest(mantissa, exponent, mantissa == hidden && biased > 1, buffer, &exponent);
+  }
+
+  while (count > 1 && buffer[count - 1] == '0') count--;
+
+  if (exponent < -5 || exponent >= precision) {
+    // scientific notation for very small or very large values
+    *target++ = buffer[0];
+    if (count > 1) *target++ = '.';
+
+    for (index = 1; index < count; index++) {
+      *target++ = buffer[index];
+    }
+
+    *target++ = 'e';
+    *target++ = exponent < 0 ? '-' : '+';
+    exponent = exponent < 0 ? -exponent : exponent;
+
+    if (exponent >= 100) *target++ = '0' + exponent / 100;
+    *target++ = FORMAT_REAL_DIGITS[exponent % 100 * 2];
+    *target++ = FORMAT_REAL_DIGITS[exponent % 100 * 2 + 1];
+  } else if (exponent >= 0) {
+    // integer digits, padded with zeros
+    for (index = 0; index <= exponent; index++) {
+      *target++ = index < count ? buffer[index] : '0';
+    }
+
+    if (count > exponent + 1) *target++ = '.';
+
+    for (; index < count; index++) {
+      *target++ = buffer[index];
+    }
+  } else {
+    // fractions below one
+    *target++ = '0';
+    *target++ = '.';
+
+    for (index = exponent + 1; index < 0; index++) {
+      *target++ = '0';
+    }
+
+    for (index = 0; index < count; index++) {
+      *target++ = buffer[index];
+    }
+  }
+
+  return target - origin;
+}
+
+
+#if defined(I13C_TESTS)
+
+static bool format_real_equals(f64 value, bool single, const char *expected) {
+  u32 index, count;
+  char buffer[FORMAT_REAL_SIZE];
+
+  // compare each character and the length
+  count = format_real(buffer, value, single);
+  for (index = 0; index < count; index++) {
+    if (expected[index] == EOS || expected[index] != buffer[index]) return FALSE;
+  }
+
+  return expected[index] == EOS;
+}
+
+static void can_format_shortest_reals() {
+  // doubles need as many digits as their neighbours require
+  assert(format_real_equals(0.1, FALSE, "0.1"), "should format 0.1");
+  assert(format_real_equals(71.2833, FALSE, "71.2833"), "should format 71.2833");
+  assert(format_real_equals(-2.5, FALSE, "-2.5"), "should format -2.5");
+  assert(format_real_equals(1e20, FALSE, "1e+20"), "should format 1e+20");
+  assert(format_real_equals(0.1 + 0.2, FALSE, "0.30000000000000004"), "should format 0.1 + 0.2");
+  assert(format_real_equals(5e-324, FALSE, "5e-324"), "should format the smallest subnormal");
+
+  // floats only need to read back as floats
+  assert(format_real_equals(0.1f, TRUE, "0.1"), "should format 0.1f");
+  assert(format_real_equals(1.0f / 3, TRUE, "0.33333334"), "should format 1/3f");
+}
+
+static void can_format_special_reals() {
+  // values without digits
+  assert(format_real_equals(0.0, FALSE, "0"), "should format zero");
+  assert(format_real_equals(0.0 / 0.0, FALSE, "nan"), "should format nan");
+  assert(format_real_equals(1.0 / 0.0, FALSE, "inf"), "should format inf");
+  assert(format_real_equals(-1.0 / 0.0, FALSE, "-inf"), "should format -inf");
+
+  // the longest forms still fit the buffer
+  assert(format_real_equals(-2.2250738585072014e-308, FALSE, "-2.2250738585072014e-308"),
+         "should format the smallest normal");
+  assert(format_real_equals(-1.7976931348623157e308, FALSE, "-1.7976931348623157e+308"),
+         "should format the largest double");
+}
+
+void format_test_cases_real(struct runner_context *ctx) {
+  test_case(ctx, "can format shortest reals", can_format_shortest_reals);
+  test_case(ctx, "can format special reals", can_format_special_reals);
+}
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "runner.h"
+#include "typing.h"
+
+#define FORMAT_REAL_SIZE 32          // room taken by any formatted real
+#define FORMAT_REAL_DOUBLE_DIGITS 17 // most significant digits a DOUBLE needs to read back
+#define FORMAT_REAL_FLOAT_DIGITS 9   // most significant digits a FLOAT needs to read back
+
+/// @brief Formats a floating point value with the fewest digits reading back as the same value, in %g notation.
+/// @param target Pointer to at least FORMAT_REAL_SIZE bytes receiving the digits, not terminated.
+/// @param value Value to format.
+/// @param single Whether the value is a widened FLOAT, so it only needs to read back as the same FLOAT.
+/// @return The number of bytes written.
+extern u32 format_real(char *target, f64 value, bool single);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers format real test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void format_test_cases_real(struct runner_context *ctx);
+
+#endif
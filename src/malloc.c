@@ -71,6 +71,18 @@ success:
   return 0;
 }
 
+u64 malloc_fit(u64 size) {
+  u64 fitted;
+
+  // the lease is a power of two, at least one page
+  fitted = 4096;
+  while (fitted < size) {
+    fitted <<= 1;
+  }
+
+  return fitted;
+}
+
 void malloc_release(struct malloc_pool *pool, struct malloc_lease *lease) {
   u32 index;
   struct malloc_slot *slot;
@@ -258,6 +270,16 @@ static void cannot_allocate_not_power_of_two() {
   malloc_destroy(&pool);
 }
 
+static void can_fit_lease_size() {
+  // small sizes take a single page
+  assert(malloc_fit(0) == 4096, "should fit nothing in a page");
+  assert(malloc_fit(4096) == 4096, "should fit a page in a page");
+
+  // larger sizes take the next power of two
+  assert(malloc_fit(4097) == 8192, "should fit a page and a byte in two pages");
+  assert(malloc_fit(200000) == 262144, "should fit in the next power of two");
+}
+
 void malloc_test_cases(struct runner_context *ctx) {
   // positive cases
   test_case(ctx, "can init and destroy pool", can_init_and_destroy_pool);
@@ -268,6 +290,7 @@ void malloc_test_cases(struct runner_context *ctx) {
   test_case(ctx, "cannot allocate too small lease", cannot_allocate_too_small_lease);
   test_case(ctx, "cannot allocate too large lease", cannot_allocate_too_large_lease);
   test_case(ctx, "cannot allocate not power of two", cannot_allocate_not_power_of_two);
+  test_case(ctx, "can fit lease size", can_fit_lease_size);
 }
 
 #endif
@@ -42,6 +42,11 @@ extern void malloc_destroy(struct malloc_pool *pool);
 /// @return NULL on success, or a negative error code on failure.
 extern i64 malloc_acquire(struct malloc_pool *pool, struct malloc_lease *lease);
 
+/// @brief Rounds a size up to an acceptable lease size, a power of two of at least one page.
+/// @param size Minimum number of bytes the lease must hold.
+/// @return The smallest acceptable lease size holding the given number of bytes.
+extern u64 malloc_fit(u64 size);
+
 /// @brief Releases a previously allocated memory block.
 /// @param pool Pointer to the malloc_pool structure.
 /// @param lease Pointer to the malloc_lease structure to release.
@@ -6,6 +6,7 @@
 
 void parquet_init(struct parquet_file *file, struct malloc_pool *pool) {
   file->fd = 0;
+  file->size = 0;
   file->pool = pool;
 
   file->footer.lease.ptr = NULL;
@@ -39,6 +40,9 @@ i64 parquet_open(struct parquet_file *file, const char *path) {
     goto cleanup_file;
   }
 
+  // remember the size to validate page offsets
+  file->size = stat.st_size;
+
   // set default parameters
   file->footer.lease.size = DEFAULT_BUFFER_SIZE;
 
@@ -100,9 +104,9 @@ alloc:
     goto alloc;
   }
 
-  // success
+  // success, the file descriptor stays open for reading pages
   result = 0;
-  goto cleanup_file;
+  goto cleanup;
 
 cleanup_buffer:
   // release the buffer and clear the pointers
@@ -32,6 +32,9 @@ enum parquet_error {
 
   // indicates that some hard limits have been reached
   PARQUET_ERROR_LIMITS_REACHED = PARQUET_ERROR_BASE - 0x08,
+
+  // indicates that the stored data does not match its checksum
+  PARQUET_ERROR_CHECKSUM_MISMATCH = PARQUET_ERROR_BASE - 0x09,
 };
 
 struct parquet_footer {
@@ -44,7 +47,8 @@ struct parquet_footer {
 };
 
 struct parquet_file {
-  u32 fd;                   // file descriptor for the parquet file
+  u32 fd;                   // file descriptor for the parquet file, kept open for reading pages
+  u64 size;                 // size of the parquet file in bytes
   struct malloc_pool *pool; // memory pool for buffer allocation
 
   struct arena_allocator arena; // parse/schema allocator
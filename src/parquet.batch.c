@@ -0,0 +1,1054 @@
+#include "parquet.batch.h"
+#include "arena.h"
+#include "codec.base.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.delta.h"
+#include "parquet.dictionary.h"
+#include "parquet.page.h"
+#include "parquet.parse.h"
+#include "parquet.plain.h"
+#include "parquet.rle.h"
+#include "parquet.split.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_BATCH_HEAP_SIZE 262144 // largest block of values reconstructed from a single page
+
+static i64 parquet_batch_acquire(struct malloc_pool *pool, struct malloc_lease *lease, u64 size) {
+  lease->size = malloc_fit(size);
+  return malloc_acquire(pool, lease);
+}
+
+static i64 parquet_batch_reserve(struct malloc_pool *pool,
+                                 struct parquet_vector *vector,
+                                 i32 data_type,
+                                 i32 type_length,
+                                 u32 capacity) {
+  // reuse the vector when it is large enough
+  if (vector->values != NULL && vector->capacity >= capacity) {
+    parquet_vector_reset(vector);
+    return 0;
+  }
+
+  // otherwise replace it with a larger one
+  parquet_vector_release(vector, pool);
+  return parquet_vector_init(vector, pool, data_type, type_length, capacity);
+}
+
+static void parquet_batch_prepare(struct parquet_batch_column *column, struct parquet_file *file) {
+  // nothing is allocated yet, so the release is always safe
+  column->nulls = 0;
+  column->open = FALSE;
+  column->has_dictionary = FALSE;
+
+  column->values.values = NULL;
+  column->values.lease.ptr = NULL;
+  column->validity = NULL;
+  column->offsets = NULL;
+  column->data = NULL;
+  column->bitmap.ptr = NULL;
+  column->bytes.ptr = NULL;
+
+  column->pages.file = file;
+  column->pages.chunk.ptr = NULL;
+  column->pages.buffer.ptr = NULL;
+  column->dictionary.values.values = NULL;
+  column->dictionary.values.lease.ptr = NULL;
+  column->entries.ptr = NULL;
+  column->staged.values = NULL;
+  column->staged.lease.ptr = NULL;
+  column->scratch.values = NULL;
+  column->scratch.lease.ptr = NULL;
+  column->levels.ptr = NULL;
+  column->level = 0;
+  column->count = 0;
+  column->value = 0;
+
+  arena_init(&column->heap, file->pool, PARQUET_BATCH_HEAP_SIZE, PARQUET_BATCH_HEAP_SIZE);
+}
+
+static i64 parquet_batch_resolve(struct parquet_batch_column *column,
+                                 struct parquet_schema_element **schemas,
+                                 u32 index) {
+  u32 top, leaf, definition, repetition;
+  const struct parquet_schema_element *element;
+
+  u32 remaining[PARQUET_BATCH_MAX_DEPTH];   // children of each open group not visited yet
+  u32 definitions[PARQUET_BATCH_MAX_DEPTH]; // definition level of each open group
+  u32 repetitions[PARQUET_BATCH_MAX_DEPTH]; // repetition level of each open group
+
+  // the root opens the first group
+  if (schemas == NULL || *schemas == NULL) return PARQUET_ERROR_INVALID_SCHEMA;
+  if ((*schemas)->num_children < 0) return PARQUET_ERROR_INVALID_SCHEMA;
+
+  top = 0;
+  leaf = 0;
+  remaining[0] = (*schemas)->num_children;
+  definitions[0] = 0;
+  repetitions[0] = 0;
+
+  // visit the elements depth-first, as they are stored
+  for (schemas++; *schemas != NULL; schemas++) {
+    element = *schemas;
+
+    // climb out of the groups having all children visited
+    while (top > 0 && remaining[top] == 0) top--;
+    if (remaining[top] == 0) return PARQUET_ERROR_INVALID_SCHEMA;
+
+    remaining[top]--;
+    definition = definitions[top] + (element->repetition_type != PARQUET_REPETITION_TYPE_REQUIRED);
+    repetition = repetitions[top] + (element->repetition_type == PARQUET_REPETITION_TYPE_REPEATED);
+
+    // a group opens the level of its children
+    if (element->num_children > 0) {
+      if (++top >= PARQUET_BATCH_MAX_DEPTH) return PARQUET_ERROR_LIMITS_REACHED;
+
+      remaining[top] = element->num_children;
+      definitions[top] = definition;
+      repetitions[top] = repetition;
+      continue;
+    }
+
+    // leaves are numbered like the column chunks
+    if (leaf++ != index) continue;
+
+    // repeated columns do not have a single value per row
+    if (repetition > 0) return PARQUET_ERROR_INVALID_TYPE;
+
+    column->name = element->name;
+    column->index = index;
+    column->data_type = element->data_type;
+    column->type_length = element->type_length;
+    column->converted_type = element->converted_type;
+    column->max_definition = definition;
+
+    return 0;
+  }
+
+  // the index is beyond the last leaf
+  return PARQUET_INVALID_ARGUMENTS;
+}
+
+static i64 parquet_batch_allocate(struct parquet_batch_column *column, struct malloc_pool *pool, u32 capacity) {
+  i64 result;
+  u64 offsets, validity;
+
+  // one slot per row
+  result = parquet_vector_init(&column->values, pool, column->data_type, column->type_length, capacity);
+  if (result < 0) return result;
+
+  // capacity + 1 offsets, padded to keep the validity in whole words
+  offsets = (((u64)capacity + 1) * sizeof(u32) + 7) & ~7ull;
+  validity = ((u64)capacity + 63) / 64 * 8;
+
+  result = parquet_batch_acquire(pool, &column->bitmap, offsets + validity);
+  if (result < 0) return result;
+
+  column->offsets = column->bitmap.ptr;
+  column->validity = (u8 *)column->bitmap.ptr + offsets;
+
+  // only variable length values need their own bytes
+  if (column->data_type != PARQUET_DATA_TYPE_BYTE_ARRAY) return 0;
+
+  result = parquet_batch_acquire(pool, &column->bytes, 4096);
+  if (result < 0) return result;
+
+  // success
+  column->data = column->bytes.ptr;
+  return 0;
+}
+
+static void parquet_batch_close(struct parquet_batch_column *column, struct malloc_pool *pool) {
+  // the column chunk of the drained row group
+  if (column->open) {
+    parquet_pages_release(&column->pages);
+    column->open = FALSE;
+  }
+
+  // and its dictionary with the page it references
+  if (column->has_dictionary) {
+    parquet_dictionary_release(&column->dictionary, pool);
+    column->has_dictionary = FALSE;
+  }
+
+  if (column->entries.ptr != NULL) {
+    malloc_release(pool, &column->entries);
+  }
+
+  // no page is loaded anymore
+  column->level = 0;
+  column->count = 0;
+  column->value = 0;
+}
+
+static i64 parquet_batch_open(struct parquet_batch *batch, u32 row_group) {
+  i64 result;
+  u32 index, position;
+  struct parquet_column_chunk **chunks;
+  struct parquet_batch_column *column;
+
+  // a row group without columns is malformed
+  chunks = batch->metadata->row_groups[row_group]->columns;
+  if (chunks == PARQUET_NULL_VALUE) return PARQUET_ERROR_INVALID_FILE;
+
+  for (index = 0; index < batch->count; index++) {
+    column = &batch->columns[index];
+
+    // every row group must hold the resolved column
+    for (position = 0; position < column->index; position++) {
+      if (chunks[position] == NULL) return PARQUET_ERROR_INVALID_FILE;
+    }
+
+    if (chunks[position] == NULL || chunks[position]->meta == NULL) return PARQUET_ERROR_INVALID_FILE;
+
+    result = parquet_pages_init(&column->pages, batch->file, chunks[position]->meta, batch->verify);
+    if (result < 0) return result;
+
+    column->open = TRUE;
+  }
+
+  // success
+  batch->row_group = row_group;
+  batch->opened = row_group + 1;
+  batch->remaining = batch->metadata->row_groups[row_group]->num_rows > 0
+                       ? (u64)batch->metadata->row_groups[row_group]->num_rows
+                       : 0;
+
+  return 0;
+}
+
+static i64 parquet_batch_dictionary(struct parquet_batch_column *column,
+                                    struct malloc_pool *pool,
+                                    const struct parquet_page *page) {
+  i64 result;
+  u64 size;
+  const char *data;
+
+  // a chunk has at most one dictionary
+  if (column->has_dictionary) return PARQUET_ERROR_INVALID_FILE;
+
+  result = parquet_pages_decompress(&column->pages, page, &data);
+  if (result < 0) return result;
+
+  // the entries outlive the decompression buffer, so they reference a copy
+  size = result;
+  result = parquet_batch_acquire(pool, &column->entries, size);
+  if (result < 0) return result;
+
+  codec_copy_exact(column->entries.ptr, data, size);
+
+  result = parquet_dictionary_init(&column->dictionary,
+                                   pool,
+                                   column->data_type,
+                                   column->type_length,
+                                   column->entries.ptr,
+                                   size,
+                                   page->header.dictionary.num_values);
+  if (result < 0) return result;
+
+  // success
+  column->has_dictionary = TRUE;
+  return 0;
+}
+
+static i64 parquet_batch_decode(struct parquet_batch_column *column,
+                                struct malloc_pool *pool,
+                                i32 encoding,
+                                const char *data,
+                                u64 size,
+                                u32 present) {
+  i64 result;
+  u32 index;
+  struct parquet_rle rle;
+
+  // one spare slot lets the scatter read ahead without any branch
+  result = parquet_batch_reserve(pool, &column->staged, column->data_type, column->type_length, present + 1);
+  if (result < 0) return result;
+
+  // a page of nulls has no values at all
+  if (present == 0) return 0;
+
+  switch (encoding) {
+    case PARQUET_ENCODING_PLAIN:
+      result = parquet_plain_decode(&column->staged, data, size, present);
+      break;
+
+    case PARQUET_ENCODING_PLAIN_DICTIONARY:
+    case PARQUET_ENCODING_RLE_DICTIONARY:
+      if (!column->has_dictionary) return PARQUET_ERROR_INVALID_FILE;
+
+      result = parquet_batch_reserve(pool, &column->scratch, PARQUET_DATA_TYPE_INT32, 0, present);
+      if (result < 0) return result;
+
+      result = parquet_rle_init_indices(&rle, data, size);
+      if (result < 0) return result;
+
+      result = parquet_dictionary_indices(&column->dictionary, &rle, &column->scratch, present);
+      if (result < 0) return result;
+
+      result = parquet_dictionary_gather(&column->dictionary, (u32 *)column->scratch.values, present, &column->staged);
+      break;
+
+    case PARQUET_ENCODING_RLE:
+      if (column->data_type != PARQUET_DATA_TYPE_BOOLEAN) return PARQUET_ERROR_INVALID_TYPE;
+
+      result = parquet_batch_reserve(pool, &column->scratch, PARQUET_DATA_TYPE_INT32, 0, present);
+      if (result < 0) return result;
+
+      // booleans are runs of single bits, prefixed by their length
+      result = parquet_rle_init_levels(&rle, data, size, 1);
+      if (result < 0) return result;
+
+      result = parquet_rle_decode(&rle, (u32 *)column->scratch.values, present);
+      if (result < 0) return result;
+
+      for (index = 0; index < present; index++) {
+        column->staged.values[index] = ((u32 *)column->scratch.values)[index] != 0;
+      }
+
+      column->staged.count = present;
+      break;
+
+    case PARQUET_ENCODING_DELTA_BINARY_PACKED:
+      result = parquet_delta_decode(&column->staged, data, size, present);
+      break;
+
+    case PARQUET_ENCODING_DELTA_LENGTH_BYTE_ARRAY:
+      result = parquet_batch_reserve(pool, &column->scratch, PARQUET_DATA_TYPE_INT32, 0, present);
+      if (result < 0) return result;
+
+      result = parquet_delta_length_decode(&column->staged, &column->scratch, data, size, present);
+      break;
+
+    case PARQUET_ENCODING_DELTA_BYTE_ARRAY:
+      result = parquet_batch_reserve(pool, &column->scratch, PARQUET_DATA_TYPE_INT32, 0, 2 * present);
+      if (result < 0) return result;
+
+      // the values of the previous page were already copied out
+      result = arena_revert(&column->heap, 0);
+      if (result < 0) return result;
+
+      result = parquet_delta_bytes_decode(&column->staged, &column->scratch, &column->heap, data, size, present);
+      break;
+
+    case PARQUET_ENCODING_BYTE_STREAM_SPLIT:
+      result = parquet_split_decode(&column->staged, data, size, present);
+      break;
+
+    default:
+      return PARQUET_ERROR_INVALID_TYPE;
+  }
+
+  if (result < 0) return result;
+
+  // every present value must be decoded
+  return column->staged.count == present ? 0 : PARQUET_ERROR_INVALID_FILE;
+}
+
+static i64 parquet_batch_load(struct parquet_batch_column *column, struct malloc_pool *pool) {
+  i64 result;
+  i32 encoding;
+  u32 index, count, present, width;
+  u64 size;
+  const char *data;
+  const u32 *levels;
+
+  struct parquet_rle rle;
+  struct parquet_page *page;
+  struct parquet_page_levels sections;
+
+  // definition levels take as many bits as the deepest of them
+  width = column->max_definition > 0 ? 32 - __builtin_clz(column->max_definition) : 0;
+  page = &column->page;
+
+  while (TRUE) {
+    result = parquet_pages_next(&column->pages, page);
+    if (result < 0) return result;
+
+    // the chunk ended before the rows of the row group
+    if (result == 0) return PARQUET_ERROR_INVALID_FILE;
+
+    // the stored bytes are checked before anything is decompressed
+    if (column->pages.verify) {
+      result = parquet_pages_verify(page);
+      if (result < 0) return result;
+    }
+
+    switch (page->header.type) {
+      case PARQUET_PAGE_TYPE_DICTIONARY_PAGE:
+        result = parquet_batch_dictionary(column, pool, page);
+        if (result < 0) return result;
+        continue;
+
+      case PARQUET_PAGE_TYPE_DATA_PAGE:
+      case PARQUET_PAGE_TYPE_DATA_PAGE_V2:
+        break;
+
+      default:
+        continue;
+    }
+
+    if (page->header.type == PARQUET_PAGE_TYPE_DATA_PAGE) {
+      count = page->header.data.num_values;
+      encoding = page->header.data.encoding;
+      if (page->header.data.num_values < 0) return PARQUET_ERROR_INVALID_FILE;
+    } else {
+      count = page->header.data_v2.num_values;
+      encoding = page->header.data_v2.encoding;
+      if (page->header.data_v2.num_values < 0) return PARQUET_ERROR_INVALID_FILE;
+    }
+
+    // room for the definition levels of the page
+    if (column->levels.ptr == NULL || column->levels.size < (u64)count * sizeof(u32)) {
+      if (column->levels.ptr != NULL) malloc_release(pool, &column->levels);
+
+      result = parquet_batch_acquire(pool, &column->levels, (u64)count * sizeof(u32));
+      if (result < 0) return result;
+    }
+
+    if (page->header.type == PARQUET_PAGE_TYPE_DATA_PAGE) {
+      // levels are stored in front of the values, all compressed together
+      result = parquet_pages_decompress(&column->pages, page, &data);
+      if (result < 0) return result;
+
+      size = result;
+      if (width > 0) {
+        result = parquet_rle_init_levels(&rle, data, size, width);
+        if (result < 0) return result;
+
+        data += result;
+        size -= result;
+      }
+    } else {
+      // levels are stored uncompressed ahead of the values
+      result = parquet_pages_levels(page, &sections);
+      if (result < 0) return result;
+
+      if (width > 0) {
+        result = parquet_rle_init(&rle, sections.definition, sections.definition_size, width);
+        if (result < 0) return result;
+      }
+
+      result = parquet_pages_values(&column->pages, page, &data);
+      if (result < 0) return result;
+
+      size = result;
+    }
+
+    // count the present values, required columns have all of them
+    present = count;
+    levels = column->levels.ptr;
+
+    if (width > 0) {
+      result = parquet_rle_decode(&rle, column->levels.ptr, count);
+      if (result < 0) return result;
+
+      for (index = 0, present = 0; index < count; index++) {
+        present += levels[index] == column->max_definition;
+      }
+    }
+
+    result = parquet_batch_decode(column, pool, encoding, data, size, present);
+    if (result < 0) return result;
+
+    // success
+    column->level = 0;
+    column->count = count;
+    column->value = 0;
+
+    return 0;
+  }
+}
+
+static inline __attribute__((always_inline)) u32 parquet_batch_scatter(char *target,
+                                                                       const char *source,
+                                                                       const u32 *definition,
+                                                                       u8 *validity,
+                                                                       u32 row,
+                                                                       u32 count,
+                                                                       u32 max_definition,
+                                                                       u32 width) {
+  u32 index, offset, present, consumed;
+
+  consumed = 0;
+
+  // every slot is written, missing values are masked out and do not advance the source
+  for (index = 0; index < count; index++, row++, target += width) {
+    present = definition[index] == max_definition;
+
+    switch (width) {
+      case 4:
+        *(u32 *)target = *(const u32 *)source & -present;
+        break;
+      case 8:
+        *(u64 *)target = *(const u64 *)source & -(u64)present;
+        break;
+      default:
+        for (offset = 0; offset < width; offset++) {
+          target[offset] = source[offset] & -(char)present;
+        }
+    }
+
+    validity[row >> 3] |= present << (row & 7);
+    source += present * width;
+    consumed += present;
+  }
+
+  return consumed;
+}
+
+static void parquet_batch_fixed(struct parquet_batch_column *column, u32 row, u32 count) {
+  u32 index, width, max, consumed;
+  u8 *validity;
+  char *target;
+  const char *source;
+  const u32 *definition;
+
+  width = column->values.width;
+  target = column->values.values + (u64)row * width;
+  source = column->staged.values + (u64)column->value * width;
+
+  // required values are copied in bulk
+  if (column->max_definition == 0) {
+    codec_copy_exact(target, source, (u64)count * width);
+
+    for (index = row; index < row + count; index++) {
+      column->validity[index >> 3] |= 1 << (index & 7);
+    }
+
+    column->value += count;
+    column->level += count;
+    return;
+  }
+
+  definition = (const u32 *)column->levels.ptr + column->level;
+  validity = column->validity;
+  max = column->max_definition;
+
+  // common widths get their own loops
+  switch (width) {
+    case 4:
+      consumed = parquet_batch_scatter(target, source, definition, validity, row, count, max, 4);
+      break;
+    case 8:
+      consumed = parquet_batch_scatter(target, source, definition, validity, row, count, max, 8);
+      break;
+    default:
+      consumed = parquet_batch_scatter(target, source, definition, validity, row, count, max, width);
+  }
+
+  column->nulls += count - consumed;
+  column->value += consumed;
+  column->level += count;
+}
+
+static i64 parquet_batch_bytes(struct parquet_batch_column *column, struct malloc_pool *pool, u32 row, u32 count) {
+  i64 result;
+  u32 index, present, offset;
+  u64 size;
+  const u32 *definition;
+  const struct parquet_binary *binary;
+  struct malloc_lease lease;
+
+  definition = column->max_definition > 0 ? (const u32 *)column->levels.ptr + column->level : NULL;
+  binary = (const struct parquet_binary *)column->staged.values + column->value;
+
+  // sum the bytes of the present values first, so the data grows at most once
+  size = column->offsets[row];
+  for (index = 0, present = 0; index < count; index++) {
+    if (definition != NULL && definition[index] != column->max_definition) continue;
+    size += binary[present++].size;
+  }
+
+  if (size > column->bytes.size) {
+    // the data must fit in the largest lease
+    if (size > 4096ull << (MALLOC_SLOTS - 1)) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+    result = parquet_batch_acquire(pool, &lease, size);
+    if (result < 0) return result;
+
+    // keep the bytes of the previous rows
+    codec_copy_exact(lease.ptr, column->data, column->offsets[row]);
+    malloc_release(pool, &column->bytes);
+
+    column->bytes = lease;
+    column->data = lease.ptr;
+  }
+
+  offset = column->offsets[row];
+
+  // append the present values, missing ones take no bytes
+  for (index = 0; index < count; index++, row++) {
+    if (definition == NULL || definition[index] == column->max_definition) {
+      codec_copy_exact(column->data + offset, binary->ptr, binary->size);
+      column->validity[row >> 3] |= 1 << (row & 7);
+
+      offset += binary->size;
+      binary++;
+    }
+
+    column->offsets[row + 1] = offset;
+  }
+
+  column->nulls += count - present;
+  column->value += present;
+  column->level += count;
+
+  return 0;
+}
+
+static i64 parquet_batch_fill(struct parquet_batch_column *column, struct malloc_pool *pool, u32 rows) {
+  i64 result;
+  u32 index, row, take;
+  struct parquet_binary *binary;
+
+  // the validity is or-ed in, so it starts cleared
+  for (index = 0; index < (rows + 63) / 64; index++) {
+    ((u64 *)column->validity)[index] = 0;
+  }
+
+  column->nulls = 0;
+  column->offsets[0] = 0;
+
+  // take the levels of as many pages as needed
+  for (row = 0; row < rows; row += take) {
+    if (column->level == column->count) {
+      result = parquet_batch_load(column, pool);
+      if (result < 0) return result;
+    }
+
+    take = column->count - column->level;
+    if (take > rows - row) take = rows - row;
+
+    if (column->data_type == PARQUET_DATA_TYPE_BYTE_ARRAY) {
+      result = parquet_batch_bytes(column, pool, row, take);
+      if (result < 0) return result;
+    } else {
+      parquet_batch_fixed(column, row, take);
+    }
+  }
+
+  column->values.count = rows;
+  if (column->data_type != PARQUET_DATA_TYPE_BYTE_ARRAY) return 0;
+
+  // variable length slots reference the copied bytes
+  binary = (struct parquet_binary *)column->values.values;
+  for (index = 0; index < rows; index++) {
+    binary[index].ptr = column->data + column->offsets[index];
+    binary[index].size = column->offsets[index + 1] - column->offsets[index];
+  }
+
+  return 0;
+}
+
+i64 parquet_batch_init(struct parquet_batch *batch,
+                       struct parquet_file *file,
+                       const struct parquet_metadata *metadata,
+                       const u32 *columns,
+                       u32 count,
+                       u32 capacity,
+                       bool verify) {
+  i64 result;
+  u32 index;
+  struct parquet_batch_column *column;
+
+  // defaults
+  batch->file = file;
+  batch->metadata = metadata;
+  batch->lease.ptr = NULL;
+  batch->row_group = 0;
+  batch->opened = 0;
+  batch->remaining = 0;
+  batch->rows = 0;
+  batch->capacity = capacity;
+  batch->verify = verify;
+  batch->selected = 0;
+  batch->selection = NULL;
+  batch->count = 0;
+  batch->failed = 0;
+  batch->columns = NULL;
+
+  // at least one column and one row
+  if (count == 0 || capacity == 0) return PARQUET_INVALID_ARGUMENTS;
+
+  // the columns followed by the selection
+  result = parquet_batch_acquire(
+    file->pool, &batch->lease, (u64)count * sizeof(struct parquet_batch_column) + (u64)capacity * sizeof(u32));
+  if (result < 0) return result;
+
+  batch->columns = batch->lease.ptr;
+  batch->selection = (u32 *)(batch->columns + count);
+
+  for (index = 0; index < count; index++) {
+    column = &batch->columns[index];
+
+    // each prepared column is released on failure
+    parquet_batch_prepare(column, file);
+    batch->count++;
+
+    result = parquet_batch_resolve(column, metadata->schemas, columns[index]);
+    if (result < 0) goto cleanup;
+
+    result = parquet_batch_allocate(column, file->pool, capacity);
+    if (result < 0) goto cleanup;
+  }
+
+  // success
+  return 0;
+
+cleanup:
+  parquet_batch_release(batch);
+  return result;
+}
+
+i64 parquet_batch_next(struct parquet_batch *batch) {
+  i64 result;
+  u32 index, rows;
+
+  // open the next row group once the current one is drained, skipping the empty ones
+  while (batch->remaining == 0) {
+    for (index = 0; index < batch->count; index++) {
+      parquet_batch_close(&batch->columns[index], batch->file->pool);
+    }
+
+    batch->rows = 0;
+    batch->selected = 0;
+
+    if (batch->metadata->row_groups == NULL) return 0;
+    if (batch->metadata->row_groups[batch->opened] == NULL) return 0;
+
+    result = parquet_batch_open(batch, batch->opened);
+    if (result < 0) return result;
+  }
+
+  // as many rows as fit, without crossing into the next row group
+  rows = batch->remaining < batch->capacity ? batch->remaining : batch->capacity;
+
+  for (index = 0; index < batch->count; index++) {
+    batch->failed = index;
+
+    result = parquet_batch_fill(&batch->columns[index], batch->file->pool, rows);
+    if (result < 0) return result;
+  }
+
+  // a fresh batch selects all its rows
+  for (index = 0; index < rows; index++) {
+    batch->selection[index] = index;
+  }
+
+  batch->rows = rows;
+  batch->selected = rows;
+  batch->remaining -= rows;
+
+  return rows;
+}
+
+void parquet_batch_release(struct parquet_batch *batch) {
+  u32 index;
+  struct malloc_pool *pool;
+  struct parquet_batch_column *column;
+
+  pool = batch->file->pool;
+
+  for (index = 0; index < batch->count; index++) {
+    column = &batch->columns[index];
+    parquet_batch_close(column, pool);
+
+    // the page state
+    parquet_vector_release(&column->staged, pool);
+    parquet_vector_release(&column->scratch, pool);
+    arena_destroy(&column->heap);
+
+    if (column->levels.ptr != NULL) {
+      malloc_release(pool, &column->levels);
+    }
+
+    // and the batch state
+    parquet_vector_release(&column->values, pool);
+
+    if (column->bitmap.ptr != NULL) {
+      malloc_release(pool, &column->bitmap);
+    }
+
+    if (column->bytes.ptr != NULL) {
+      malloc_release(pool, &column->bytes);
+    }
+  }
+
+  // the columns and the selection
+  if (batch->lease.ptr != NULL) {
+    malloc_release(pool, &batch->lease);
+  }
+
+  batch->count = 0;
+  batch->columns = NULL;
+  batch->selection = NULL;
+}
+
+#if defined(I13C_TESTS)
+
+static bool parquet_batch_equals(const struct parquet_binary *binary, const char *expected) {
+  u32 index;
+
+  // compare each character and the length
+  for (index = 0; index < binary->size; index++) {
+    if (expected[index] == '\0' || expected[index] != binary->ptr[index]) return FALSE;
+  }
+
+  return expected[index] == '\0';
+}
+
+static bool parquet_batch_valid(const struct parquet_batch_column *column, u32 row) {
+  return (column->validity[row >> 3] >> (row & 7)) & 1;
+}
+
+static void can_iterate_batches_of_flat_columns() {
+  i64 result;
+  u32 index, batches, rows, nulls, males, survived;
+  u64 identifiers;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_batch batch;
+  struct parquet_batch_column *column;
+  const struct parquet_binary *names;
+
+  // passenger id, survived, name, sex and age
+  const u32 columns[] = {0, 1, 3, 4, 5};
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file
+  result = parquet_open(&file, "data/test04.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  // small batches force several of them
+  result = parquet_batch_init(&batch, &file, &metadata, columns, 5, 256, TRUE);
+  assert(result == 0, "should initialize batch");
+  assert(batch.columns[4].data_type == PARQUET_DATA_TYPE_DOUBLE, "should resolve age as double");
+  assert(batch.columns[4].max_definition == 1, "should resolve age as optional");
+
+  batches = 0;
+  rows = 0;
+  nulls = 0;
+  males = 0;
+  survived = 0;
+  identifiers = 0;
+
+  while ((result = parquet_batch_next(&batch)) > 0) {
+    assert(result <= 256, "should respect the capacity");
+    assert(batch.selected == batch.rows, "should select all rows");
+    assert(batch.selection[batch.rows - 1] == batch.rows - 1, "should select rows in order");
+
+    // the first row of the file
+    if (batches++ == 0) {
+      names = (const struct parquet_binary *)batch.columns[2].values.values;
+      assert(((i64 *)batch.columns[0].values.values)[0] == 1, "should start with the first passenger");
+      assert(parquet_batch_equals(&names[0], "Braund, Mr. Owen Harris"), "should copy the first name");
+    }
+
+    for (index = 0; index < batch.rows; index++) {
+      identifiers += ((i64 *)batch.columns[0].values.values)[index];
+      survived += ((i64 *)batch.columns[1].values.values)[index];
+      males += parquet_batch_equals((const struct parquet_binary *)batch.columns[3].values.values + index, "male");
+    }
+
+    // missing ages are zeroed and counted
+    column = &batch.columns[4];
+    for (index = 0; index < batch.rows; index++) {
+      if (parquet_batch_valid(column, index)) continue;
+      assert(((f64 *)column->values.values)[index] == 0, "should zero a missing age");
+    }
+
+    // offsets delimit the copied names
+    column = &batch.columns[2];
+    assert(column->offsets[0] == 0, "should start at the first byte");
+    assert(column->offsets[batch.rows] <= column->bytes.size, "should fit the names");
+
+    nulls += batch.columns[4].nulls;
+    rows += batch.rows;
+  }
+
+  assert(result == 0, "should reach the end of the file");
+  assert(batches == 4, "should return four batches");
+  assert(rows == 891, "should return every row");
+  assert(identifiers == 891 * 892 / 2, "should sum every passenger id");
+  assert(survived == 342, "should count survivors");
+  assert(males == 577, "should count males");
+  assert(nulls == 177, "should count missing ages");
+
+  // release everything
+  parquet_batch_release(&batch);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_iterate_batches_of_dictionary_columns() {
+  i64 result;
+  u32 index, batches, rows, hours;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_batch batch;
+
+  // date, hour and country code, all dictionary-encoded
+  const u32 columns[] = {0, 1, 2};
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file
+  result = parquet_open(&file, "data/test01.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  result = parquet_batch_init(&batch, &file, &metadata, columns, 3, PARQUET_BATCH_ROWS, TRUE);
+  assert(result == 0, "should initialize batch");
+
+  batches = 0;
+  rows = 0;
+  hours = 0;
+
+  // a single page of each column spans both batches
+  while ((result = parquet_batch_next(&batch)) > 0) {
+    assert(result == (batches++ == 0 ? PARQUET_BATCH_ROWS : 5815 - PARQUET_BATCH_ROWS), "should fill the batches");
+
+    for (index = 0; index < batch.rows; index++) {
+      assert(((i32 *)batch.columns[0].values.values)[index] == 20174, "should decode the single date");
+      hours += ((i32 *)batch.columns[1].values.values)[index] < 24;
+    }
+
+    rows += batch.rows;
+  }
+
+  assert(result == 0, "should reach the end of the file");
+  assert(batches == 2, "should return two batches");
+  assert(rows == 5815, "should return every row");
+  assert(hours == 5815, "should decode hours of the day");
+
+  // release everything
+  parquet_batch_release(&batch);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_batch_invalid_columns() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_batch batch;
+
+  const u32 missing[] = {0, 5};
+  const u32 repeated[] = {10};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // a column beyond the last leaf
+  parquet_init(&file, &pool);
+
+  result = parquet_open(&file, "data/test01.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  result = parquet_batch_init(&batch, &file, &metadata, missing, 2, PARQUET_BATCH_ROWS, TRUE);
+  assert(result == PARQUET_INVALID_ARGUMENTS, "should fail with PARQUET_INVALID_ARGUMENTS");
+
+  parquet_close(&file);
+
+  // a column nested in lists
+  parquet_init(&file, &pool);
+
+  result = parquet_open(&file, "data/test03.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  result = parquet_batch_init(&batch, &file, &metadata, repeated, 1, PARQUET_BATCH_ROWS, TRUE);
+  assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
+
+  // release everything
+  parquet_close(&file);
+  malloc_destroy(&pool);
+
+  // nothing should leak
+  assert(pool.acquired == pool.released, "should release every lease");
+}
+
+static void can_verify_batch_page_checksums() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_batch batch;
+
+  const u32 columns[] = {0, 1};
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  result = parquet_open(&file, "data/test05.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  // every page carries a matching checksum
+  result = parquet_batch_init(&batch, &file, &metadata, columns, 2, PARQUET_BATCH_ROWS, TRUE);
+  assert(result == 0, "should initialize batch");
+
+  result = parquet_batch_next(&batch);
+  assert(result == 2, "should decode two rows");
+
+  parquet_batch_release(&batch);
+
+  // the same columns once the dictionary page of the second one, behind its 19-byte header, is altered
+  result = parquet_batch_init(&batch, &file, &metadata, columns, 2, PARQUET_BATCH_ROWS, TRUE);
+  assert(result == 0, "should initialize batch");
+
+  result = parquet_batch_open(&batch, 0);
+  assert(result == 0, "should open the row group");
+
+  ((char *)batch.columns[1].pages.chunk.ptr)[19] ^= 0x01;
+
+  result = parquet_batch_next(&batch);
+  assert(result == PARQUET_ERROR_CHECKSUM_MISMATCH, "should fail with PARQUET_ERROR_CHECKSUM_MISMATCH");
+  assert(batch.failed == 1, "should name the second column");
+  assert(batch.columns[1].page.index == 0, "should name the dictionary page");
+
+  // release everything
+  parquet_batch_release(&batch);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+
+  // nothing should leak
+  assert(pool.acquired == pool.released, "should release every lease");
+}
+
+void parquet_test_cases_batch(struct runner_context *ctx) {
+  test_case(ctx, "can iterate batches of flat columns", can_iterate_batches_of_flat_columns);
+  test_case(ctx, "can iterate batches of dictionary columns", can_iterate_batches_of_dictionary_columns);
+  test_case(ctx, "can detect batch invalid columns", can_detect_batch_invalid_columns);
+  test_case(ctx, "can verify batch page checksums", can_verify_batch_page_checksums);
+}
+
+#endif
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "arena.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.dictionary.h"
+#include "parquet.page.h"
+#include "parquet.parse.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_BATCH_ROWS 4096   // default rows of a batch, a few columns of wide values stay within L2
+#define PARQUET_BATCH_MAX_DEPTH 10 // deepest supported path below the root, as deep as the schema
+
+struct parquet_batch_column {
+  const char *name;    // name of the leaf in the schema
+  u32 index;           // position of the column chunk in every row group
+  i32 data_type;       // physical type of the values
+  i32 type_length;     // length of FIXED_LEN_BYTE_ARRAY values
+  i32 converted_type;  // logical type of the values
+  u32 max_definition;  // definition level of a present value, 0 for required columns
+  u32 nulls;           // number of missing values in the batch
+  bool open;           // whether the column chunk of the current row group is open
+  bool has_dictionary; // whether the dictionary of the current column chunk was decoded
+
+  struct parquet_vector values; // one slot per row, missing values are zeroed or empty
+  u8 *validity;                 // one bit per row, set when the value is present
+  u32 *offsets;                 // BYTE_ARRAY only, rows + 1 offsets into the data
+  char *data;                   // BYTE_ARRAY only, copied bytes of the present values
+  struct malloc_lease bitmap;   // lease backing the offsets and the validity
+  struct malloc_lease bytes;    // lease backing the data, grown on demand
+
+  struct parquet_pages pages;           // pages of the column chunk of the current row group
+  struct parquet_page page;             // last page read from the chunk, the corrupted one after a failure
+  struct parquet_dictionary dictionary; // entries of the current column chunk, if dictionary-encoded
+  struct malloc_lease entries;          // copy of the dictionary page referenced by the entries
+  struct parquet_vector staged;         // present values of the current page, decoded at once
+  struct parquet_vector scratch;        // dictionary indices, delta lengths or boolean runs of the current page
+  struct arena_allocator heap;          // values reconstructed by DELTA_BYTE_ARRAY
+  struct malloc_lease levels;           // definition levels of the current page
+  u32 level;                            // next definition level of the current page
+  u32 count;                            // number of definition levels in the current page
+  u32 value;                            // next staged value of the current page
+};
+
+struct parquet_batch {
+  struct parquet_file *file;               // file owning the column chunks
+  const struct parquet_metadata *metadata; // parsed metadata of the file
+  struct malloc_lease lease;               // lease backing the columns and the selection
+
+  u32 row_group; // index of the row group the batch comes from
+  u32 opened;    // number of row groups opened so far
+  u64 remaining; // rows of the current row group not yet returned
+
+  u32 rows;       // number of rows in the batch
+  u32 capacity;   // maximum number of rows in a batch
+  bool verify;    // whether pages and gzip members are checked against their CRC-32
+  u32 selected;   // number of row indices in the selection
+  u32 *selection; // indices of the selected rows, all rows of a fresh batch
+
+  u32 count;                            // number of columns
+  u32 failed;                           // column being decoded when the last batch failed
+  struct parquet_batch_column *columns; // columns in the requested order
+};
+
+/// @brief Resolves the requested flat columns in the schema and allocates their vectors.
+/// @param batch Pointer to the parquet_batch structure to initialize.
+/// @param file Pointer to the opened parquet_file structure.
+/// @param metadata Pointer to the parsed metadata of the file, it must outlive the batch.
+/// @param columns Pointer to the leaf column indices, in the order of the batch columns.
+/// @param count Number of column indices.
+/// @param capacity Maximum number of rows in a batch, PARQUET_BATCH_ROWS unless values are very wide.
+/// @param verify Whether pages are compared with their optional CRC-32 before decompression, and gzip members after.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_batch_init(struct parquet_batch *batch,
+                              struct parquet_file *file,
+                              const struct parquet_metadata *metadata,
+                              const u32 *columns,
+                              u32 count,
+                              u32 capacity,
+                              bool verify);
+
+/// @brief Decodes the next batch of rows, moving over the row groups, a batch never spans two of them.
+/// @param batch Pointer to the initialized parquet_batch structure.
+/// @return The number of rows in the batch, 0 after the last row group, or a negative error code on failure.
+extern i64 parquet_batch_next(struct parquet_batch *batch);
+
+/// @brief Releases the column chunks and the memory held by every column.
+/// @param batch Pointer to the initialized parquet_batch structure.
+extern void parquet_batch_release(struct parquet_batch *batch);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet batch test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_batch(struct runner_context *ctx);
+
+#endif
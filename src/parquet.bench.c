@@ -0,0 +1,543 @@
+#include "parquet.bench.h"
+#include "codec.base.h"
+#include "codec.crc.h"
+#include "codec.gzip.h"
+#include "codec.snappy.h"
+#include "malloc.h"
+#include "parquet.parse.h"
+#include "parquet.rle.h"
+#include "parquet.split.h"
+#include "parquet.vector.h"
+#include "stdout.h"
+#include "sys.h"
+#include "typing.h"
+
+#if defined(I13C_PARQUET)
+
+#define PARQUET_BENCH_VALUES (1 << 16) // values decoded in a single round
+#define PARQUET_BENCH_ROUNDS 256       // rounds measured for each bit width
+#define PARQUET_BENCH_RUN 128          // values in a single RLE run
+#define PARQUET_BENCH_PAGE (1 << 18)   // bytes in a synthetic decompressed page
+
+static u64 parquet_bench_varint(char *buffer, u32 value) {
+  u64 size;
+
+  // emit 7 bits at a time, LSB first
+  for (size = 0; value >= 0x80; value >>= 7) {
+    buffer[size++] = (char)(value | 0x80);
+  }
+
+  buffer[size++] = (char)value;
+  return size;
+}
+
+static u64 parquet_bench_pack(char *buffer, u32 width) {
+  u32 index, seed;
+  u64 size, window, bits;
+
+  // a single bit-packed run covering all values
+  size = parquet_bench_varint(buffer, ((PARQUET_BENCH_VALUES / PARQUET_RLE_GROUP_SIZE) << 1) | 1);
+
+  // defaults
+  seed = 0x13c13c13;
+  window = 0;
+  bits = 0;
+
+  for (index = 0; index < PARQUET_BENCH_VALUES; index++) {
+    // pseudo-random value
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    // append its lowest bits to the window
+    window |= (u64)(width == 32 ? seed : seed & ((1u << width) - 1)) << bits;
+    bits += width;
+
+    // flush complete bytes
+    while (bits >= 8) {
+      buffer[size++] = (char)window;
+      window >>= 8;
+      bits -= 8;
+    }
+  }
+
+  // success
+  return size;
+}
+
+static u64 parquet_bench_repeat(char *buffer, u32 width) {
+  u32 run, index;
+  u64 size;
+
+  // consecutive RLE runs covering all values
+  for (run = 0, size = 0; run < PARQUET_BENCH_VALUES / PARQUET_BENCH_RUN; run++) {
+    size += parquet_bench_varint(buffer + size, PARQUET_BENCH_RUN << 1);
+
+    // the repeated value occupies whole bytes
+    for (index = 0; index < (width + 7) / 8; index++) {
+      buffer[size++] = (char)(run >> (index * 8));
+    }
+  }
+
+  // success
+  return size;
+}
+
+static void parquet_bench_report(const char *label, u64 count, u64 elapsed) {
+  // avoid division by zero on very fast rounds
+  elapsed = elapsed > 0 ? elapsed : 1;
+
+  // the caller already described the kernel on this line
+  writef("%s=%d, elapsed=%dus, %s/s=%d\n", label, count, elapsed, label, count * 1000000 / elapsed);
+}
+
+static i64 parquet_bench_measure(const char *kind, const char *buffer, u64 size, u32 width, u32 *values) {
+  i64 result;
+  u32 round;
+  u64 started, elapsed;
+
+  struct parquet_rle rle;
+
+  // start the clock
+  started = sys_clock_micros();
+
+  for (round = 0; round < PARQUET_BENCH_ROUNDS; round++) {
+    result = parquet_rle_init(&rle, buffer, size, width);
+    if (result < 0) return result;
+
+    result = parquet_rle_decode(&rle, values, PARQUET_BENCH_VALUES);
+    if (result < 0) return result;
+  }
+
+  // stop the clock and print the throughput
+  elapsed = sys_clock_micros() - started;
+  writef("kernel=%s, width=%d, ", kind, (u64)width);
+  parquet_bench_report("values", (u64)PARQUET_BENCH_VALUES * PARQUET_BENCH_ROUNDS, elapsed);
+
+  // success
+  return 0;
+}
+
+i32 parquet_bench_rle(u32 argc, const char **argv) {
+  i64 result;
+  u32 width;
+  u64 size;
+
+  struct malloc_pool pool;
+  struct malloc_lease buffer;
+  struct malloc_lease values;
+
+  // no arguments are expected
+  (void)argc;
+  (void)argv;
+
+  // initialize memory
+  malloc_init(&pool);
+
+  // the encoded values never exceed 32 bits each, plus the run headers
+  buffer.size = (u64)PARQUET_BENCH_VALUES * sizeof(u32) * 2;
+  result = malloc_acquire(&pool, &buffer);
+  if (result < 0) goto cleanup_memory;
+
+  // the decoded values
+  values.size = (u64)PARQUET_BENCH_VALUES * sizeof(u32);
+  result = malloc_acquire(&pool, &values);
+  if (result < 0) goto cleanup_buffer;
+
+  for (width = 1; width <= PARQUET_RLE_MAX_WIDTH; width++) {
+    // measure unpacking
+    size = parquet_bench_pack(buffer.ptr, width);
+    result = parquet_bench_measure("bit-packed", buffer.ptr, size, width, values.ptr);
+    if (result < 0) goto cleanup_values;
+
+    // measure broadcasting
+    size = parquet_bench_repeat(buffer.ptr, width);
+    result = parquet_bench_measure("rle", buffer.ptr, size, width, values.ptr);
+    if (result < 0) goto cleanup_values;
+  }
+
+  // success
+  result = 0;
+
+cleanup_values:
+  malloc_release(&pool, &values);
+
+cleanup_buffer:
+  malloc_release(&pool, &buffer);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+  return result;
+}
+
+static void parquet_bench_split_scalar(struct parquet_vector *vector, const char *buffer, u32 count) {
+  u32 index, offset;
+
+  // the reference loop gathers one byte of one value at a time
+  for (index = 0; index < count; index++) {
+    for (offset = 0; offset < vector->width; offset++) {
+      vector->values[(u64)index * vector->width + offset] = buffer[(u64)offset * count + index];
+    }
+  }
+
+  vector->count = count;
+}
+
+static i64 parquet_bench_split_measure(const char *kind, struct parquet_vector *vector, const char *buffer) {
+  i64 result;
+  u32 round;
+  u64 started, elapsed;
+
+  // start the clock
+  started = sys_clock_micros();
+
+  for (round = 0; round < PARQUET_BENCH_ROUNDS; round++) {
+    parquet_vector_reset(vector);
+
+    if (kind[0] == 's') {
+      parquet_bench_split_scalar(vector, buffer, PARQUET_BENCH_VALUES);
+    } else {
+      result = parquet_split_decode(vector, buffer, (u64)PARQUET_BENCH_VALUES * vector->width, PARQUET_BENCH_VALUES);
+      if (result < 0) return result;
+    }
+  }
+
+  // stop the clock and print the throughput
+  elapsed = sys_clock_micros() - started;
+  writef("kernel=%s, width=%d, ", kind, (u64)vector->width);
+  parquet_bench_report("values", (u64)PARQUET_BENCH_VALUES * PARQUET_BENCH_ROUNDS, elapsed);
+
+  // success
+  return 0;
+}
+
+i32 parquet_bench_split(u32 argc, const char **argv) {
+  i64 result;
+  u32 index, kind;
+  u64 size;
+
+  struct malloc_pool pool;
+  struct malloc_lease buffer;
+  struct parquet_vector vector;
+
+  const i32 types[] = {PARQUET_DATA_TYPE_FLOAT, PARQUET_DATA_TYPE_DOUBLE};
+  const char *kinds[] = {"scalar", "vector"};
+
+  // no arguments are expected
+  (void)argc;
+  (void)argv;
+
+  // initialize memory
+  malloc_init(&pool);
+
+  // the byte streams of the widest type
+  buffer.size = (u64)PARQUET_BENCH_VALUES * sizeof(f64);
+  result = malloc_acquire(&pool, &buffer);
+  if (result < 0) goto cleanup_memory;
+
+  // any bytes will do, the transposition does not depend on them
+  for (size = 0; size < buffer.size; size++) {
+    ((char *)buffer.ptr)[size] = (char)(size * 31 + (size >> 9));
+  }
+
+  for (index = 0; index < sizeof(types) / sizeof(types[0]); index++) {
+    result = parquet_vector_init(&vector, &pool, types[index], 0, PARQUET_BENCH_VALUES);
+    if (result < 0) goto cleanup_buffer;
+
+    // measure both kernels over the same streams
+    for (kind = 0; kind < sizeof(kinds) / sizeof(kinds[0]); kind++) {
+      result = parquet_bench_split_measure(kinds[kind], &vector, buffer.ptr);
+      if (result < 0) break;
+    }
+
+    parquet_vector_release(&vector, &pool);
+    if (result < 0) goto cleanup_buffer;
+  }
+
+  // success
+  result = 0;
+
+cleanup_buffer:
+  malloc_release(&pool, &buffer);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+  return result;
+}
+
+static u64 parquet_bench_snappy_page(char *buffer, u64 *start, u64 *length) {
+  u32 seed, size, distance;
+  u64 offset, produced, index, header;
+
+  // the body starts after room for the longest varint
+  offset = 5;
+  produced = 0;
+  seed = 0x13c13c13;
+
+  while (produced + 128 < PARQUET_BENCH_PAGE) {
+    // pseudo-random choices
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    // a literal of 1 to 32 bytes
+    size = (seed & 0x1f) + 1;
+    buffer[offset++] = (char)((size - 1) << 2);
+
+    for (index = 0; index < size; index++) {
+      buffer[offset++] = (char)(seed >> (index % 24));
+    }
+
+    produced += size;
+
+    // a copy of 4 to 64 bytes, mixing short overlapping and long distances
+    size = ((seed >> 5) & 0x3f) + 1;
+    size = size < 4 ? 4 : size;
+    distance = (seed >> 11) & 0x01 ? ((seed >> 12) & 0x0f) + 1 : ((seed >> 12) & 0xfff) + 1;
+    distance = distance > produced ? produced : distance;
+
+    buffer[offset++] = (char)(((size - 1) << 2) | 0x02);
+    buffer[offset++] = (char)distance;
+    buffer[offset++] = (char)(distance >> 8);
+
+    produced += size;
+  }
+
+  // the uncompressed length directly precedes the body
+  for (index = produced, header = 0; index >= 0x80; index >>= 7) header++;
+  for (index = 0; index <= header; index++) {
+    buffer[5 - header - 1 + index] = (char)(((produced >> (index * 7)) & 0x7f) | (index < header ? 0x80 : 0));
+  }
+
+  // success
+  *start = 5 - header - 1;
+  *length = produced;
+
+  return offset - *start;
+}
+
+i32 parquet_bench_snappy(u32 argc, const char **argv) {
+  i64 result;
+  u32 round;
+  u64 start, size, length, started, elapsed;
+
+  struct malloc_pool pool;
+  struct malloc_lease buffer;
+  struct malloc_lease output;
+
+  // no arguments are expected
+  (void)argc;
+  (void)argv;
+
+  // initialize memory
+  malloc_init(&pool);
+
+  // the compressed page never exceeds twice the decompressed one
+  buffer.size = PARQUET_BENCH_PAGE * 2;
+  result = malloc_acquire(&pool, &buffer);
+  if (result < 0) goto cleanup_memory;
+
+  // the decompressed page with the slack
+  output.size = PARQUET_BENCH_PAGE * 2;
+  result = malloc_acquire(&pool, &output);
+  if (result < 0) goto cleanup_buffer;
+
+  // generate the page
+  size = parquet_bench_snappy_page(buffer.ptr, &start, &length);
+
+  // start the clock
+  started = sys_clock_micros();
+
+  for (round = 0; round < PARQUET_BENCH_ROUNDS; round++) {
+    result = codec_snappy_decompress((const char *)buffer.ptr + start, size, output.ptr, length);
+    if (result < 0) goto cleanup_output;
+  }
+
+  // stop the clock and print the throughput
+  elapsed = sys_clock_micros() - started;
+  writef("codec=snappy, compressed=%d, ", size);
+  parquet_bench_report("bytes", (u64)length * PARQUET_BENCH_ROUNDS, elapsed);
+
+  // success
+  result = 0;
+
+cleanup_output:
+  malloc_release(&pool, &output);
+
+cleanup_buffer:
+  malloc_release(&pool, &buffer);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+  return result;
+}
+
+static void parquet_bench_gzip_emit(char *buffer, u64 *offset, u64 *container, u32 *count, u32 value, u32 bits) {
+  // bits are appended above the pending ones and flushed a byte at a time
+  *container |= (u64)value << *count;
+  *count += bits;
+
+  while (*count >= 8) {
+    buffer[(*offset)++] = (char)*container;
+    *container >>= 8;
+    *count -= 8;
+  }
+}
+
+static void parquet_bench_gzip_code(char *buffer, u64 *offset, u64 *container, u32 *count, u32 code, u32 bits) {
+  u32 index, reversed;
+
+  // huffman codes are written starting with their highest bit
+  for (index = 0, reversed = 0; index < bits; index++) {
+    reversed = (reversed << 1) | ((code >> index) & 0x01);
+  }
+
+  parquet_bench_gzip_emit(buffer, offset, container, count, reversed, bits);
+}
+
+static void parquet_bench_gzip_symbol(char *buffer, u64 *offset, u64 *container, u32 *count, u32 symbol) {
+  // the fixed literal/length codes
+  if (symbol < 144) {
+    parquet_bench_gzip_code(buffer, offset, container, count, 0x30 + symbol, 8);
+  } else if (symbol < 256) {
+    parquet_bench_gzip_code(buffer, offset, container, count, 0x190 + symbol - 144, 9);
+  } else if (symbol < 280) {
+    parquet_bench_gzip_code(buffer, offset, container, count, symbol - 256, 7);
+  } else {
+    parquet_bench_gzip_code(buffer, offset, container, count, 0xc0 + symbol - 280, 8);
+  }
+}
+
+static u64 parquet_bench_gzip_page(char *buffer, char *output, u64 *length) {
+  u32 seed, size, distance, code, extra, base, count;
+  u64 offset, produced, index, container;
+
+  // a member header without a name, followed by a single fixed block
+  for (offset = 0; offset < 10; offset++) {
+    buffer[offset] = "\x1f\x8b\x08\x00\x00\x00\x00\x00\x00\x03"[offset];
+  }
+
+  container = 0;
+  count = 0;
+  produced = 0;
+  seed = 0x13c13c13;
+
+  parquet_bench_gzip_emit(buffer, &offset, &container, &count, 0x03, 3);
+
+  while (produced + 128 < PARQUET_BENCH_PAGE) {
+    // pseudo-random choices
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    // a literal of 1 to 32 bytes, also written to the output to compute the trailer
+    size = (seed & 0x1f) + 1;
+
+    for (index = 0; index < size; index++) {
+      output[produced++] = (char)(seed >> (index % 24));
+      parquet_bench_gzip_symbol(buffer, &offset, &container, &count, (u8)(seed >> (index % 24)));
+    }
+
+    // a match of 3 to 66 bytes, mixing short overlapping and long distances
+    size = ((seed >> 5) & 0x3f) + 3;
+    distance = (seed >> 11) & 0x01 ? ((seed >> 12) & 0x0f) + 1 : ((seed >> 12) & 0xfff) + 1;
+    distance = distance > produced ? produced : distance;
+
+    // the length code with the highest base not above the length
+    for (code = 27;; code--) {
+      extra = code < 8 ? 0 : (code >> 2) - 1;
+      base = code < 8 ? code + 3 : ((4 + (code & 0x03)) << extra) + 3;
+      if (base <= size) break;
+    }
+
+    parquet_bench_gzip_symbol(buffer, &offset, &container, &count, 257 + code);
+    parquet_bench_gzip_emit(buffer, &offset, &container, &count, size - base, extra);
+
+    // and the distance code the same way
+    for (code = 29;; code--) {
+      extra = code < 4 ? 0 : (code >> 1) - 1;
+      base = code < 4 ? code + 1 : ((2 + (code & 0x01)) << extra) + 1;
+      if (base <= distance) break;
+    }
+
+    parquet_bench_gzip_code(buffer, &offset, &container, &count, code, 5);
+    parquet_bench_gzip_emit(buffer, &offset, &container, &count, distance - base, extra);
+
+    // the match is repeated in the output as well
+    for (index = 0; index < size; index++, produced++) {
+      output[produced] = output[produced - distance];
+    }
+  }
+
+  // the end of block, padded to a byte
+  parquet_bench_gzip_symbol(buffer, &offset, &container, &count, 256);
+  parquet_bench_gzip_emit(buffer, &offset, &container, &count, 0, (8 - count) & 0x07);
+
+  // the trailer holds the crc and the length
+  parquet_bench_gzip_emit(buffer, &offset, &container, &count, codec_crc32(0, output, produced), 32);
+  parquet_bench_gzip_emit(buffer, &offset, &container, &count, produced, 32);
+
+  // success
+  *length = produced;
+  return offset;
+}
+
+i32 parquet_bench_gzip(u32 argc, const char **argv) {
+  i64 result;
+  u32 round, verify;
+  u64 size, length, started, elapsed;
+
+  struct malloc_pool pool;
+  struct malloc_lease buffer;
+  struct malloc_lease output;
+
+  // no arguments are expected
+  (void)argc;
+  (void)argv;
+
+  // initialize memory
+  malloc_init(&pool);
+
+  // the compressed page never exceeds twice the decompressed one
+  buffer.size = PARQUET_BENCH_PAGE * 2;
+  result = malloc_acquire(&pool, &buffer);
+  if (result < 0) goto cleanup_memory;
+
+  // the decompressed page with the slack
+  output.size = PARQUET_BENCH_PAGE * 2;
+  result = malloc_acquire(&pool, &output);
+  if (result < 0) goto cleanup_buffer;
+
+  // generate the page
+  size = parquet_bench_gzip_page(buffer.ptr, output.ptr, &length);
+
+  // measure with and without the crc
+  for (verify = 0; verify <= 1; verify++) {
+    started = sys_clock_micros();
+
+    for (round = 0; round < PARQUET_BENCH_ROUNDS; round++) {
+      result = codec_gzip_decompress(buffer.ptr, size, output.ptr, length, &pool, verify);
+      if (result < 0) goto cleanup_output;
+    }
+
+    // stop the clock and print the throughput
+    elapsed = sys_clock_micros() - started;
+    writef("codec=gzip, verify=%d, compressed=%d, ", verify, size);
+    parquet_bench_report("bytes", (u64)length * PARQUET_BENCH_ROUNDS, elapsed);
+  }
+
+  // success
+  result = 0;
+
+cleanup_output:
+  malloc_release(&pool, &output);
+
+cleanup_buffer:
+  malloc_release(&pool, &buffer);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+  return result;
+}
+
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "typing.h"
+
+/// @brief Measures the RLE/bit-packing hybrid decoder for every bit width.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_bench_rle(u32 argc, const char **argv);
+
+/// @brief Measures the BYTE_STREAM_SPLIT decoder against a scalar loop.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_bench_split(u32 argc, const char **argv);
+
+/// @brief Measures the Snappy decompressor over a synthetic page.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_bench_snappy(u32 argc, const char **argv);
+
+/// @brief Measures the gzip decompressor over a synthetic page, with and without the CRC-32.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_bench_gzip(u32 argc, const char **argv);
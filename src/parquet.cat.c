@@ -0,0 +1,365 @@
+#include "parquet.cat.h"
+#include "argv.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.batch.h"
+#include "parquet.convert.h"
+#include "parquet.csv.h"
+#include "parquet.parse.h"
+#include "parquet.schema.open.h"
+#include "parquet.show.h"
+#include "typing.h"
+
+#if defined(I13C_PARQUET)
+
+static const char *parquet_cat_prefix(const char *name, const char *path, const char *end) {
+  // compare each character of the name
+  while (*name != '\0' && path < end && *name == *path) {
+    name++;
+    path++;
+  }
+
+  // the whole name must be followed by a separator or the end of the path
+  if (*name != '\0') return NULL;
+  if (path < end && *path != '.') return NULL;
+
+  return path;
+}
+
+static bool parquet_cat_lookup(const struct parquet_schema *node, const char *path, const char *end, u32 *leaf) {
+  u64 index;
+  const char *rest;
+  const struct parquet_schema *child;
+
+  for (index = 0; index < node->children.count; index++) {
+    child = node->children.elements[index];
+    rest = path != NULL ? parquet_cat_prefix(child->name, path, end) : NULL;
+
+    // leaves are numbered in the schema order, like the column chunks
+    if (child->children.count == 0) {
+      if (rest != NULL && rest == end) return TRUE;
+
+      *leaf += 1;
+      continue;
+    }
+
+    // groups keep matching below the separator, or just count their leaves
+    if (parquet_cat_lookup(child, rest != NULL && rest < end ? rest + 1 : NULL, end, leaf)) return TRUE;
+  }
+
+  return FALSE;
+}
+
+static void parquet_cat_flat(const struct parquet_schema *node, bool repeated, u32 *leaf, u32 *columns, u32 *count) {
+  u64 index;
+  bool nested;
+  const struct parquet_schema *child;
+
+  for (index = 0; index < node->children.count; index++) {
+    child = node->children.elements[index];
+    nested = repeated || child->repeated_type == PARQUET_REPETITION_TYPE_REPEATED;
+
+    // groups visit their leaves, numbered in the schema order
+    if (child->children.count > 0) {
+      parquet_cat_flat(child, nested, leaf, columns, count);
+      continue;
+    }
+
+    // columns nested in repeated groups have no single value per row
+    if (!nested) {
+      if (columns != NULL) columns[*count] = *leaf;
+      *count += 1;
+    }
+
+    *leaf += 1;
+  }
+}
+
+static i64 parquet_cat_header(struct parquet_csv *csv, const struct parquet_batch *batch) {
+  i64 result;
+  u32 index, size;
+  const char *name;
+
+  for (index = 0; index < batch->count; index++) {
+    if (index > 0) {
+      result = parquet_csv_raw(csv, ",", 1);
+      if (result < 0) return result;
+    }
+
+    // names are null-terminated
+    name = batch->columns[index].name;
+    size = 0;
+
+    while (name[size] != '\0') size++;
+
+    result = parquet_csv_text(csv, name, size);
+    if (result < 0) return result;
+  }
+
+  return parquet_csv_raw(csv, "\n", 1);
+}
+
+static i64 parquet_cat_convert(const struct parquet_batch *batch, struct malloc_lease *converted) {
+  i64 result;
+  u32 index;
+  const struct parquet_batch_column *column;
+
+  for (index = 0; index < batch->count; index++) {
+    column = &batch->columns[index];
+
+    // dates are formatted once per batch, missing ones hold the epoch
+    if (column->data_type == PARQUET_DATA_TYPE_INT32 && column->converted_type == PARQUET_CONVERTED_TYPE_DATE) {
+      result = parquet_convert_date((const i32 *)column->values.values, batch->rows, converted[index].ptr);
+      if (result < 0) return result;
+    }
+
+    // legacy timestamps become nanoseconds since the epoch
+    if (column->data_type == PARQUET_DATA_TYPE_INT96) {
+      parquet_convert_int96(column->values.values, batch->rows, converted[index].ptr);
+    }
+  }
+
+  // success
+  return 0;
+}
+
+static i64 parquet_cat_value(struct parquet_csv *csv,
+                             const struct parquet_batch_column *column,
+                             const struct malloc_lease *converted,
+                             u32 row) {
+  const char *date;
+  const struct parquet_binary *binary;
+
+  switch (column->data_type) {
+    case PARQUET_DATA_TYPE_BOOLEAN:
+      if (column->values.values[row]) return parquet_csv_raw(csv, "true", 4);
+      return parquet_csv_raw(csv, "false", 5);
+
+    case PARQUET_DATA_TYPE_INT32:
+      if (converted->ptr != NULL) {
+        date = (const char *)converted->ptr + (u64)row * PARQUET_CONVERT_DATE_SIZE;
+        return parquet_csv_raw(csv, date, PARQUET_CONVERT_DATE_SIZE);
+      }
+
+      return parquet_csv_integer(csv, ((const i32 *)column->values.values)[row]);
+
+    case PARQUET_DATA_TYPE_INT64:
+      return parquet_csv_integer(csv, ((const i64 *)column->values.values)[row]);
+
+    case PARQUET_DATA_TYPE_INT96:
+      return parquet_csv_integer(csv, ((const i64 *)converted->ptr)[row]);
+
+    case PARQUET_DATA_TYPE_FLOAT:
+      return parquet_csv_real(csv, ((const f32 *)column->values.values)[row], TRUE);
+
+    case PARQUET_DATA_TYPE_DOUBLE:
+      return parquet_csv_real(csv, ((const f64 *)column->values.values)[row], FALSE);
+
+    case PARQUET_DATA_TYPE_BYTE_ARRAY:
+      binary = (const struct parquet_binary *)column->values.values + row;
+      return parquet_csv_text(csv, binary->ptr, binary->size);
+
+    case PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED:
+      return parquet_csv_hex(csv, column->values.values + (u64)row * column->values.width, column->values.width);
+
+    default:
+      return PARQUET_ERROR_INVALID_TYPE;
+  }
+}
+
+static i64
+parquet_cat_rows(struct parquet_csv *csv, const struct parquet_batch *batch, const struct malloc_lease *converted) {
+  i64 result;
+  u32 index, row, column;
+
+  // only the selected rows, missing values leave their fields empty while empty texts are quoted
+  for (index = 0; index < batch->selected; index++) {
+    row = batch->selection[index];
+
+    for (column = 0; column < batch->count; column++) {
+      if (column > 0) {
+        result = parquet_csv_raw(csv, ",", 1);
+        if (result < 0) return result;
+      }
+
+      if (((batch->columns[column].validity[row >> 3] >> (row & 7)) & 1) == 0) continue;
+
+      result = parquet_cat_value(csv, &batch->columns[column], &converted[column], row);
+      if (result < 0) return result;
+    }
+
+    result = parquet_csv_raw(csv, "\n", 1);
+    if (result < 0) return result;
+  }
+
+  // success
+  return 0;
+}
+
+i32 parquet_cat(u32 argc, const char **argv) {
+  i64 result;
+  u32 index, count, leaf;
+  u64 size;
+  const char *names, *start, *end;
+  bool verify;
+
+  u32 *columns;
+  struct malloc_lease *converted;
+  struct parquet_batch_column *column;
+  struct parquet_column_meta *meta;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_schema schema;
+  struct parquet_batch batch;
+  struct parquet_csv csv;
+
+  // check for required arguments
+  result = PARQUET_INVALID_ARGUMENTS;
+  if (argc < 1) goto cleanup;
+
+  // all columns unless projected
+  names = argv_value(argc - 1, argv + 1, "--columns");
+
+  // page checksums, and gzip members once decompressed, are only verified on request
+  verify = argv_flag(argc - 1, argv + 1, "--verify-crc");
+
+  // initialize memory and parquet file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // try to open parquet file
+  result = parquet_open(&file, argv[0]);
+  if (result < 0) goto cleanup_memory;
+
+  // try to parse metadata
+  result = parquet_parse(&file, &metadata);
+  if (result < 0) goto cleanup_file;
+
+  // try to open schema
+  result = parquet_open_schema(&file.arena, metadata.schemas, &schema);
+  if (result < 0) goto cleanup_file;
+
+  // count the projected names or all leaves outside repeated groups
+  count = 0;
+  if (names != NULL) {
+    for (count = 1, end = names; *end != '\0'; end++) {
+      count += *end == ',';
+    }
+  } else {
+    leaf = 0;
+    parquet_cat_flat(&schema, FALSE, &leaf, NULL, &count);
+  }
+
+  result = PARQUET_INVALID_ARGUMENTS;
+  if (count == 0) goto cleanup_file;
+
+  // the conversion buffers followed by the column indices
+  size = (u64)count * (sizeof(struct malloc_lease) + sizeof(u32));
+
+  lease.size = malloc_fit(size);
+  result = malloc_acquire(&pool, &lease);
+  if (result < 0) goto cleanup_file;
+
+  converted = lease.ptr;
+  columns = (u32 *)(converted + count);
+
+  // without a projection the unsupported columns are skipped
+  if (names == NULL) {
+    leaf = 0;
+    count = 0;
+    parquet_cat_flat(&schema, FALSE, &leaf, columns, &count);
+  }
+
+  // resolve each name to the index of its leaf
+  for (index = 0, start = names; index < count; index++) {
+    converted[index].ptr = NULL;
+    if (names == NULL) continue;
+
+    end = start;
+    while (*end != '\0' && *end != ',') end++;
+
+    leaf = 0;
+    result = PARQUET_ERROR_INVALID_SCHEMA;
+    if (!parquet_cat_lookup(&schema, start, end, &leaf)) goto cleanup_lease;
+
+    columns[index] = leaf;
+    start = end + 1;
+  }
+
+  // decode only the projected column chunks
+  result = parquet_batch_init(&batch, &file, &metadata, columns, count, PARQUET_BATCH_ROWS, verify);
+  if (result < 0) goto cleanup_lease;
+
+  // some types are converted a whole batch at a time
+  for (index = 0; index < count; index++) {
+    if (batch.columns[index].data_type == PARQUET_DATA_TYPE_INT96) {
+      size = (u64)PARQUET_BATCH_ROWS * sizeof(i64);
+    } else if (batch.columns[index].converted_type == PARQUET_CONVERTED_TYPE_DATE) {
+      size = (u64)PARQUET_BATCH_ROWS * PARQUET_CONVERT_DATE_SIZE;
+    } else {
+      continue;
+    }
+
+    converted[index].size = malloc_fit(size);
+    result = malloc_acquire(&pool, &converted[index]);
+    if (result < 0) goto cleanup_converted;
+  }
+
+  // the output is collected and written in large blocks
+  result = parquet_csv_init(&csv, &pool, 1);
+  if (result < 0) goto cleanup_converted;
+
+  result = parquet_cat_header(&csv, &batch);
+  if (result < 0) goto cleanup_csv;
+
+  while ((result = parquet_batch_next(&batch)) > 0) {
+    result = parquet_cat_convert(&batch, converted);
+    if (result < 0) goto cleanup_csv;
+
+    result = parquet_cat_rows(&csv, &batch, converted);
+    if (result < 0) goto cleanup_csv;
+  }
+
+  // tell which page failed its checksum
+  if (result == PARQUET_ERROR_CHECKSUM_MISMATCH) {
+    column = &batch.columns[batch.failed];
+    meta = metadata.row_groups[batch.row_group]->columns[column->index]->meta;
+    parquet_show_mismatch(argv[0], batch.row_group, column->index, meta, &column->page);
+  }
+
+  if (result < 0) goto cleanup_csv;
+
+  // write what remains
+  result = parquet_csv_flush(&csv);
+  if (result < 0) goto cleanup_csv;
+
+  // success
+  result = 0;
+
+cleanup_csv:
+  parquet_csv_release(&csv, &pool);
+
+cleanup_converted:
+  for (index = 0; index < count; index++) {
+    if (converted[index].ptr != NULL) malloc_release(&pool, &converted[index]);
+  }
+
+  parquet_batch_release(&batch);
+
+cleanup_lease:
+  malloc_release(&pool, &lease);
+
+cleanup_file:
+  parquet_close(&file);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+
+cleanup:
+  return result;
+}
+
+#endif
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "typing.h"
+
+/// @brief Streams the rows of a Parquet file as CSV, optionally projected to a list of columns.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_cat(u32 argc, const char **argv);
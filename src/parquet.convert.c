@@ -0,0 +1,259 @@
+#include "parquet.convert.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_CONVERT_NANOS_PER_DAY 86400000000000ll // nanoseconds in a day, leap seconds aside
+
+// lanes of the 32-bit and 64-bit conversions, loaded and stored without any alignment requirement
+typedef i32 parquet_convert_v8si __attribute__((vector_size(32)));
+typedef i32 parquet_convert_u8si __attribute__((vector_size(32), aligned(4)));
+typedef i32 parquet_convert_v4si __attribute__((vector_size(16)));
+typedef i64 parquet_convert_v4di __attribute__((vector_size(32)));
+typedef i64 parquet_convert_u4di __attribute__((vector_size(32), aligned(8)));
+
+void parquet_convert_int96(const char *values, u32 count, i64 *output) {
+  u32 index;
+  parquet_convert_v4si days;
+  parquet_convert_v4di nanos;
+
+  // four values at a time, splitting the nanoseconds of the day from the julian day
+  for (index = 0; index + 4 <= count; index += 4, values += 4 * PARQUET_CONVERT_INT96_SIZE) {
+    nanos = (parquet_convert_v4di){
+      *(const i64 *)(values + 0 * PARQUET_CONVERT_INT96_SIZE),
+      *(const i64 *)(values + 1 * PARQUET_CONVERT_INT96_SIZE),
+      *(const i64 *)(values + 2 * PARQUET_CONVERT_INT96_SIZE),
+      *(const i64 *)(values + 3 * PARQUET_CONVERT_INT96_SIZE),
+    };
+
+    days = (parquet_convert_v4si){
+      *(const i32 *)(values + 0 * PARQUET_CONVERT_INT96_SIZE + 8),
+      *(const i32 *)(values + 1 * PARQUET_CONVERT_INT96_SIZE + 8),
+      *(const i32 *)(values + 2 * PARQUET_CONVERT_INT96_SIZE + 8),
+      *(const i32 *)(values + 3 * PARQUET_CONVERT_INT96_SIZE + 8),
+    };
+
+    // days since the epoch scaled to nanoseconds, plus the time of the day
+    *(parquet_convert_u4di *)(output + index) =
+      (__builtin_convertvector(days, parquet_convert_v4di) - PARQUET_CONVERT_UNIX_DAY) * PARQUET_CONVERT_NANOS_PER_DAY +
+      nanos;
+  }
+
+  // the remaining values one by one
+  for (; index < count; index++, values += PARQUET_CONVERT_INT96_SIZE) {
+    output[index] = (*(const i32 *)(values + 8) - (i64)PARQUET_CONVERT_UNIX_DAY) * PARQUET_CONVERT_NANOS_PER_DAY;
+    output[index] += *(const i64 *)values;
+  }
+}
+
+i64 parquet_convert_timestamp(const i64 *values, u32 count, i32 converted_type, i64 *output) {
+  u32 index;
+  i64 scale;
+
+  // the unit tells the scale
+  switch (converted_type) {
+    case PARQUET_CONVERTED_TYPE_TIMESTAMP_MILLIS:
+      scale = 1000000;
+      break;
+    case PARQUET_CONVERTED_TYPE_TIMESTAMP_MICROS:
+      scale = 1000;
+      break;
+    default:
+      return PARQUET_ERROR_INVALID_TYPE;
+  }
+
+  // four values at a time
+  for (index = 0; index + 4 <= count; index += 4) {
+    *(parquet_convert_u4di *)(output + index) = *(const parquet_convert_u4di *)(values + index) * scale;
+  }
+
+  // the remaining values one by one
+  for (; index < count; index++) {
+    output[index] = values[index] * scale;
+  }
+
+  // success
+  return 0;
+}
+
+static inline __attribute__((always_inline)) void
+parquet_convert_date_block(const parquet_convert_v8si *days, char *output, u32 count) {
+  u32 index;
+  parquet_convert_v8si z, era, doe, yoe, doy, mp, year, month, day, head, middle, tail;
+
+  // shifted by one 400 years era to keep every value positive, see civil_from_days by Howard Hinnant
+  z = *days + 719468 + 146097;
+  era = z / 146097;
+  doe = z - era * 146097;
+  yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  mp = (5 * doy + 2) / 153;
+
+  // the year starts in march, so january and february belong to the next one, comparisons yield -1 lanes
+  day = doy - (153 * mp + 2) / 5 + 1;
+  month = mp + 3 + ((mp >= 10) & -12);
+  year = yoe + era * 400 - 400 - (month <= 2);
+
+  // assemble the digits of all lanes, little-endian within each word
+  head = (year / 1000) | (year / 100 % 10) << 8 | (year / 10 % 10) << 16 | (year % 10) << 24;
+  middle = '-' | (month / 10) << 8 | (month % 10) << 16 | '-' << 24;
+  tail = (day / 10) | (day % 10) << 8;
+
+  head += 0x30303030;
+  middle += 0x00303000;
+  tail += 0x3030;
+
+  // and store them
+  for (index = 0; index < count; index++, output += PARQUET_CONVERT_DATE_SIZE) {
+    *(u32 *)(output + 0) = head[index];
+    *(u32 *)(output + 4) = middle[index];
+    *(u16 *)(output + 8) = tail[index];
+  }
+}
+
+i64 parquet_convert_date(const i32 *days, u32 count, char *output) {
+  u32 index, offset;
+  parquet_convert_v8si lanes, invalid;
+
+  // eight values at a time
+  for (index = 0; index + PARQUET_CONVERT_LANES <= count; index += PARQUET_CONVERT_LANES) {
+    lanes = *(const parquet_convert_u8si *)(days + index);
+
+    // only four digit years are formatted
+    invalid = (lanes < PARQUET_CONVERT_DATE_MIN) | (lanes > PARQUET_CONVERT_DATE_MAX);
+    if (invalid[0] | invalid[1] | invalid[2] | invalid[3] | invalid[4] | invalid[5] | invalid[6] | invalid[7]) {
+      return PARQUET_ERROR_INVALID_VALUE;
+    }
+
+    parquet_convert_date_block(&lanes, output + (u64)index * PARQUET_CONVERT_DATE_SIZE, PARQUET_CONVERT_LANES);
+  }
+
+  // the remaining values go through a padded block
+  if (index < count) {
+    lanes = (parquet_convert_v8si){0};
+
+    for (offset = 0; index + offset < count; offset++) {
+      if (days[index + offset] < PARQUET_CONVERT_DATE_MIN) return PARQUET_ERROR_INVALID_VALUE;
+      if (days[index + offset] > PARQUET_CONVERT_DATE_MAX) return PARQUET_ERROR_INVALID_VALUE;
+
+      lanes[offset] = days[index + offset];
+    }
+
+    parquet_convert_date_block(&lanes, output + (u64)index * PARQUET_CONVERT_DATE_SIZE, offset);
+  }
+
+  // success
+  return 0;
+}
+
+#if defined(I13C_TESTS)
+
+static void can_convert_int96_timestamps() {
+  u32 index;
+  i64 output[6];
+  char values[6 * PARQUET_CONVERT_INT96_SIZE];
+
+  // julian days around the epoch with growing times of the day
+  const i32 days[] = {2440588, 2440589, 2440587, 2451545, 2440588, 2459581};
+  const i64 nanos[] = {0, 1, 86399999999999, 43200000000000, 1500000000, 3600000000000};
+
+  // the expected nanoseconds since the epoch
+  const i64 expected[] = {
+    0, 86400000000001, -1, 946728000000000000, 1500000000, 1640998800000000000,
+  };
+
+  // lay the values out as stored
+  for (index = 0; index < 6; index++) {
+    *(i64 *)(values + index * PARQUET_CONVERT_INT96_SIZE) = nanos[index];
+    *(i32 *)(values + index * PARQUET_CONVERT_INT96_SIZE + 8) = days[index];
+  }
+
+  // convert a block and a tail
+  parquet_convert_int96(values, 6, output);
+
+  for (index = 0; index < 6; index++) {
+    assert(output[index] == expected[index], "nanoseconds should match");
+  }
+}
+
+static void can_convert_timestamps_to_nanos() {
+  i64 result;
+  u32 index;
+  i64 output[5];
+
+  const i64 millis[] = {0, 1, -1, 1641085200000, 86400000};
+  const i64 micros[] = {0, 1, -1, 1641085200000000, 86400000000};
+
+  // both units end up in nanoseconds
+  result = parquet_convert_timestamp(millis, 5, PARQUET_CONVERTED_TYPE_TIMESTAMP_MILLIS, output);
+  assert(result == 0, "should convert millis");
+
+  for (index = 0; index < 5; index++) {
+    assert(output[index] == millis[index] * 1000000, "millis should be scaled");
+  }
+
+  result = parquet_convert_timestamp(micros, 5, PARQUET_CONVERTED_TYPE_TIMESTAMP_MICROS, output);
+  assert(result == 0, "should convert micros");
+
+  for (index = 0; index < 5; index++) {
+    assert(output[index] == micros[index] * 1000, "micros should be scaled");
+  }
+
+  // other types are rejected
+  result = parquet_convert_timestamp(micros, 5, PARQUET_CONVERTED_TYPE_DATE, output);
+  assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
+}
+
+static void can_format_dates() {
+  i64 result;
+  u32 index;
+  char output[11 * PARQUET_CONVERT_DATE_SIZE];
+
+  // epoch, leap days, century boundaries and both ends of the range
+  const i32 days[] = {0, -1, 59, 11016, 10956, 19358, -141427, 2932896, -719528, 951, -25508};
+
+  const char *expected = "1970-01-01"
+                         "1969-12-31"
+                         "1970-03-01"
+                         "2000-02-29"
+                         "1999-12-31"
+                         "2023-01-01"
+                         "1582-10-15"
+                         "9999-12-31"
+                         "0000-01-01"
+                         "1972-08-09"
+                         "1900-03-01";
+
+  // convert a block and a tail
+  result = parquet_convert_date(days, 11, output);
+  assert(result == 0, "should format dates");
+
+  for (index = 0; index < 11 * PARQUET_CONVERT_DATE_SIZE; index++) {
+    assert(output[index] == expected[index], "character should match");
+  }
+}
+
+static void can_detect_dates_out_of_range() {
+  i64 result;
+  char output[9 * PARQUET_CONVERT_DATE_SIZE];
+
+  // a five digit year in a block, a negative one in a tail
+  const i32 block[] = {0, 0, 0, 2932897, 0, 0, 0, 0};
+  const i32 tail[] = {0, 0, 0, 0, 0, 0, 0, 0, -719529};
+
+  result = parquet_convert_date(block, 8, output);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+
+  result = parquet_convert_date(tail, 9, output);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+}
+
+void parquet_test_cases_convert(struct runner_context *ctx) {
+  test_case(ctx, "can convert int96 timestamps", can_convert_int96_timestamps);
+  test_case(ctx, "can convert timestamps to nanos", can_convert_timestamps_to_nanos);
+  test_case(ctx, "can format dates", can_format_dates);
+  test_case(ctx, "can detect dates out of range", can_detect_dates_out_of_range);
+}
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_CONVERT_LANES 8          // 32-bit values converted at once, half of it for 64-bit values
+#define PARQUET_CONVERT_INT96_SIZE 12    // bytes of an INT96 value, nanoseconds of the day and the julian day
+#define PARQUET_CONVERT_DATE_SIZE 10     // bytes of a date formatted as YYYY-MM-DD
+#define PARQUET_CONVERT_UNIX_DAY 2440588 // julian day of 1970-01-01
+
+#define PARQUET_CONVERT_DATE_MIN -719528 // days from 1970-01-01 back to 0000-01-01
+#define PARQUET_CONVERT_DATE_MAX 2932896 // days from 1970-01-01 up to 9999-12-31
+
+/// @brief Converts legacy INT96 timestamps into nanoseconds since the unix epoch, four values at a time.
+/// @param values Pointer to the INT96 values, 12 bytes each.
+/// @param count Number of values.
+/// @param output Pointer to the output nanoseconds.
+extern void parquet_convert_int96(const char *values, u32 count, i64 *output);
+
+/// @brief Converts TIMESTAMP_MILLIS or TIMESTAMP_MICROS values into nanoseconds since the unix epoch.
+/// @param values Pointer to the timestamps.
+/// @param count Number of values.
+/// @param converted_type Converted type of the column, telling the unit of the values.
+/// @param output Pointer to the output nanoseconds, may be the same as the values.
+/// @return 0 on success, or a negative error code if the converted type is not a timestamp.
+extern i64 parquet_convert_timestamp(const i64 *values, u32 count, i32 converted_type, i64 *output);
+
+/// @brief Formats DATE values, days since the unix epoch, as YYYY-MM-DD, eight values at a time.
+/// @param days Pointer to the days since the unix epoch.
+/// @param count Number of values.
+/// @param output Pointer to the output, PARQUET_CONVERT_DATE_SIZE bytes for each value without any separator.
+/// @return 0 on success, or a negative error code if a date falls outside of years 0 to 9999.
+extern i64 parquet_convert_date(const i32 *days, u32 count, char *output);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet convert test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_convert(struct runner_context *ctx);
+
+#endif
@@ -0,0 +1,88 @@
+#include "parquet.count.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "stderr.h"
+#include "stdout.h"
+#include "typing.h"
+
+#if defined(I13C_PARQUET)
+
+static i64 parquet_count_file(struct malloc_pool *pool, const char *path, struct parquet_row_counts *counts) {
+  i64 result;
+  struct parquet_file file;
+
+  // the pool is shared, so its slots are reused by every file
+  parquet_init(&file, pool);
+
+  // try to open parquet file, only its footer is read
+  result = parquet_open(&file, path);
+  if (result < 0) goto cleanup;
+
+  // try to parse the row counts, the rest is skipped
+  result = parquet_parse_counts(&file, counts);
+  if (result < 0) goto cleanup_file;
+
+  // the row groups must add up to the declared rows
+  result = PARQUET_ERROR_INVALID_FILE;
+  if (counts->num_rows != counts->row_groups.num_rows) goto cleanup_file;
+
+  // success
+  result = 0;
+
+cleanup_file:
+  parquet_close(&file);
+
+cleanup:
+  return result;
+}
+
+i32 parquet_count(u32 argc, const char **argv) {
+  i64 result, failure, rows;
+  u32 index, files;
+  u64 groups;
+
+  struct malloc_pool pool;
+  struct parquet_row_counts counts;
+
+  // check for required arguments
+  result = PARQUET_INVALID_ARGUMENTS;
+  if (argc < 1) goto cleanup;
+
+  // initialize memory
+  malloc_init(&pool);
+
+  failure = 0;
+  files = 0;
+  groups = 0;
+  rows = 0;
+
+  for (index = 0; index < argc; index++) {
+    // a broken file is reported and the scan goes on
+    result = parquet_count_file(&pool, argv[index], &counts);
+    if (result < 0) {
+      errorf("Cannot count rows; file=%s, error=%r\n", argv[index], result);
+      failure = result;
+      continue;
+    }
+
+    // describe the file by its path
+    writef("file=%s, row-groups=%d, rows=%d\n", argv[index], (i64)counts.row_groups.count, counts.num_rows);
+
+    files += 1;
+    groups += counts.row_groups.count;
+    rows += counts.num_rows;
+  }
+
+  // summarize all counted files
+  writef("files=%d, row-groups=%d, rows=%d\n", (i64)files, (i64)groups, rows);
+
+  // the last failure is the result
+  result = failure;
+  malloc_destroy(&pool);
+
+cleanup:
+  return result;
+}
+
+#endif
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "typing.h"
+
+/// @brief Counts the rows of many Parquet files, reading only the row counts of their footers.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_count(u32 argc, const char **argv);
@@ -0,0 +1,385 @@
+#include "parquet.csv.h"
+#include "codec.base.h"
+#include "format.real.h"
+#include "malloc.h"
+#include "runner.h"
+#include "sys.h"
+#include "typing.h"
+
+// pairs of decimal digits, so integers are formatted two digits at a time
+static const char PARQUET_CSV_DIGITS[201] = "0001020304050607080910111213141516171819"
+                                            "2021222324252627282930313233343536373839"
+                                            "4041424344454647484950515253545556575859"
+                                            "6061626364656667686970717273747576777879"
+                                            "8081828384858687888990919293949596979899";
+
+// powers of ten telling the number of digits of an integer
+static const u64 PARQUET_CSV_SCALES[20] = {
+  1ull,
+  10ull,
+  100ull,
+  1000ull,
+  10000ull,
+  100000ull,
+  1000000ull,
+  10000000ull,
+  100000000ull,
+  1000000000ull,
+  10000000000ull,
+  100000000000ull,
+  1000000000000ull,
+  10000000000000ull,
+  100000000000000ull,
+  1000000000000000ull,
+  10000000000000000ull,
+  100000000000000000ull,
+  1000000000000000000ull,
+  10000000000000000000ull,
+};
+
+static const char PARQUET_CSV_HEX[17] = "0123456789abcdef";
+
+static i64 parquet_csv_reserve(struct parquet_csv *csv, u64 size) {
+  // flush only when the bytes would not fit
+  if (csv->lease.size - csv->offset >= size) return 0;
+  return parquet_csv_flush(csv);
+}
+
+i64 parquet_csv_init(struct parquet_csv *csv, struct malloc_pool *pool, i32 fd) {
+  i64 result;
+
+  // defaults
+  csv->fd = fd;
+  csv->offset = 0;
+  csv->buffer = NULL;
+
+  // allocate the buffer
+  csv->lease.size = PARQUET_CSV_BUFFER_SIZE;
+  result = malloc_acquire(pool, &csv->lease);
+  if (result < 0) return result;
+
+  // success
+  csv->buffer = csv->lease.ptr;
+  return 0;
+}
+
+i64 parquet_csv_flush(struct parquet_csv *csv) {
+  i64 result;
+  u64 written;
+
+  // a single write usually takes everything
+  for (written = 0; written < csv->offset; written += result) {
+    result = sys_write(csv->fd, csv->buffer + written, csv->offset - written);
+    if (result < 0) return result;
+  }
+
+  // success
+  csv->offset = 0;
+  return 0;
+}
+
+i64 parquet_csv_raw(struct parquet_csv *csv, const char *data, u64 size) {
+  i64 result;
+  u64 available;
+
+  // separators and short values fit without any flush
+  if (csv->lease.size - csv->offset >= size) {
+    codec_copy_exact(csv->buffer + csv->offset, data, size);
+    csv->offset += size;
+    return 0;
+  }
+
+  while (size > 0) {
+    // make some room when the buffer is full
+    if (csv->offset == csv->lease.size) {
+      result = parquet_csv_flush(csv);
+      if (result < 0) return result;
+    }
+
+    // copy as much as fits
+    available = csv->lease.size - csv->offset;
+    if (available > size) available = size;
+
+    codec_copy_exact(csv->buffer + csv->offset, data, available);
+
+    csv->offset += available;
+    data += available;
+    size -= available;
+  }
+
+  // success
+  return 0;
+}
+
+i64 parquet_csv_text(struct parquet_csv *csv, const char *data, u64 size) {
+  i64 result;
+  u64 index;
+  bool quoted;
+
+  // most texts need no quotes at all, an empty one is quoted to differ from a missing value
+  for (index = 0, quoted = size == 0; index < size; index++) {
+    quoted |= (data[index] == ',') | (data[index] == '"') | (data[index] == '\n') | (data[index] == '\r');
+  }
+
+  if (!quoted) return parquet_csv_raw(csv, data, size);
+
+  // doubled quotes take at most twice the size, usually known to fit at once
+  result = parquet_csv_reserve(csv, 2 * size + 2);
+  if (result < 0) return result;
+
+  csv->buffer[csv->offset++] = '"';
+
+  for (index = 0; index < size; index++) {
+    if (csv->lease.size - csv->offset < 2) {
+      result = parquet_csv_flush(csv);
+      if (result < 0) return result;
+    }
+
+    // quotes inside are doubled
+    if (data[index] == '"') csv->buffer[csv->offset++] = '"';
+    csv->buffer[csv->offset++] = data[index];
+  }
+
+  result = parquet_csv_reserve(csv, 1);
+  if (result < 0) return result;
+
+  // success
+  csv->buffer[csv->offset++] = '"';
+  return 0;
+}
+
+i64 parquet_csv_hex(struct parquet_csv *csv, const char *data, u64 size) {
+  i64 result;
+  u64 index;
+
+  for (index = 0; index < size; index++) {
+    result = parquet_csv_reserve(csv, 2);
+    if (result < 0) return result;
+
+    // high nibble first
+    csv->buffer[csv->offset++] = PARQUET_CSV_HEX[(u8)data[index] >> 4];
+    csv->buffer[csv->offset++] = PARQUET_CSV_HEX[(u8)data[index] & 0x0f];
+  }
+
+  // success
+  return 0;
+}
+
+i64 parquet_csv_integer(struct parquet_csv *csv, i64 value) {
+  i64 result;
+  u32 count, pair;
+  u64 absolute;
+  char *target;
+
+  result = parquet_csv_reserve(csv, PARQUET_CSV_FIELD_SIZE);
+  if (result < 0) return result;
+
+  // the sign goes directly to the output
+  if (value < 0) csv->buffer[csv->offset++] = '-';
+  absolute = value < 0 ? -(u64)value : (u64)value;
+
+  // count the digits, so they are written in place from the lowest ones
+  count = 1;
+  while (count < 20 && absolute >= PARQUET_CSV_SCALES[count]) count++;
+
+  csv->offset += count;
+  target = csv->buffer + csv->offset;
+
+  // two digits at a time
+  while (absolute >= 100) {
+    pair = (absolute % 100) * 2;
+    absolute /= 100;
+
+    *--target = PARQUET_CSV_DIGITS[pair + 1];
+    *--target = PARQUET_CSV_DIGITS[pair];
+  }
+
+  // the highest one or two digits
+  if (absolute >= 10) {
+    *--target = PARQUET_CSV_DIGITS[absolute * 2 + 1];
+    *--target = PARQUET_CSV_DIGITS[absolute * 2];
+  } else {
+    *--target = '0' + absolute;
+  }
+
+  // success
+  return 0;
+}
+
+i64 parquet_csv_real(struct parquet_csv *csv, f64 value, bool single) {
+  i64 result;
+
+  result = parquet_csv_reserve(csv, PARQUET_CSV_FIELD_SIZE);
+  if (result < 0) return result;
+
+  // success
+  csv->offset += format_real(csv->buffer + csv->offset, value, single);
+  return 0;
+}
+
+void parquet_csv_release(struct parquet_csv *csv, struct malloc_pool *pool) {
+  // release the buffer if any
+  if (csv->lease.ptr != NULL) {
+    malloc_release(pool, &csv->lease);
+  }
+
+  csv->buffer = NULL;
+  csv->offset = 0;
+}
+
+#if defined(I13C_TESTS)
+
+static bool parquet_csv_equals(const struct parquet_csv *csv, const char *expected) {
+  u64 index;
+
+  // compare each character and the length
+  for (index = 0; index < csv->offset; index++) {
+    if (expected[index] == '\0' || expected[index] != csv->buffer[index]) return FALSE;
+  }
+
+  return expected[index] == '\0';
+}
+
+static void can_format_csv_integers() {
+  i64 result;
+  u32 index;
+
+  struct malloc_pool pool;
+  struct parquet_csv csv;
+
+  const i64 values[] = {0, 7, -1, 42, 100, -12345, 9223372036854775807ll, -9223372036854775807ll - 1};
+
+  // initialize the pool and the output
+  malloc_init(&pool);
+
+  result = parquet_csv_init(&csv, &pool, 1);
+  assert(result == 0, "should initialize output");
+
+  for (index = 0; index < 8; index++) {
+    if (index > 0) parquet_csv_raw(&csv, ",", 1);
+
+    result = parquet_csv_integer(&csv, values[index]);
+    assert(result == 0, "should format integer");
+  }
+
+  assert(parquet_csv_equals(&csv, "0,7,-1,42,100,-12345,9223372036854775807,-9223372036854775808"),
+         "should format every integer");
+
+  // release everything
+  parquet_csv_release(&csv, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_format_csv_reals() {
+  i64 result;
+  u32 index;
+
+  struct malloc_pool pool;
+  struct parquet_csv csv;
+
+  const f64 values[] = {0, 0.1, 71.2833, -2.5, 22, 1e20, 1.5e-7, 123456789012345678.0, 0.000125, 1.0 / 3, 5e-324};
+  const f32 floats[] = {0.1f, 1.0f / 3, 16777216.0f, 3.4028235e38f};
+
+  // initialize the pool and the output
+  malloc_init(&pool);
+
+  result = parquet_csv_init(&csv, &pool, 1);
+  assert(result == 0, "should initialize output");
+
+  for (index = 0; index < 11; index++) {
+    if (index > 0) parquet_csv_raw(&csv, ",", 1);
+
+    result = parquet_csv_real(&csv, values[index], FALSE);
+    assert(result == 0, "should format double");
+  }
+
+  // sums of decimals may need all 17 digits
+  parquet_csv_raw(&csv, ",", 1);
+  result = parquet_csv_real(&csv, 0.1 + 0.2, FALSE);
+  assert(result == 0, "should format double");
+
+  // floats only need to read back as floats
+  for (index = 0; index < 4; index++) {
+    parquet_csv_raw(&csv, ",", 1);
+
+    result = parquet_csv_real(&csv, floats[index], TRUE);
+    assert(result == 0, "should format float");
+  }
+
+  assert(parquet_csv_equals(&csv,
+                            "0,0.1,71.2833,-2.5,22,1e+20,1.5e-07,1.2345678901234568e+17,0.000125,0.3333333333333333,"
+                            "5e-324,0.30000000000000004,0.1,0.33333334,16777216,3.4028235e+38"),
+         "should format every real with the fewest digits reading back");
+
+  // release everything
+  parquet_csv_release(&csv, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_format_csv_texts() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_csv csv;
+
+  // initialize the pool and the output
+  malloc_init(&pool);
+
+  result = parquet_csv_init(&csv, &pool, 1);
+  assert(result == 0, "should initialize output");
+
+  // plain, separated, quoted and binary fields
+  result = parquet_csv_text(&csv, "male", 4);
+  assert(result == 0, "should append plain text");
+
+  parquet_csv_raw(&csv, ",", 1);
+  result = parquet_csv_text(&csv, "Braund, Mr. Owen", 16);
+  assert(result == 0, "should append separated text");
+
+  parquet_csv_raw(&csv, ",", 1);
+  result = parquet_csv_text(&csv, "say \"hi\"", 8);
+  assert(result == 0, "should append quoted text");
+
+  parquet_csv_raw(&csv, ",", 1);
+  result = parquet_csv_hex(&csv, "\x00\x7f\xab", 3);
+  assert(result == 0, "should append binary");
+
+  assert(parquet_csv_equals(&csv, "male,\"Braund, Mr. Owen\",\"say \"\"hi\"\"\",007fab"), "should format every field");
+
+  // release everything
+  parquet_csv_release(&csv, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_format_csv_empty_texts() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_csv csv;
+
+  // initialize the pool and the output
+  malloc_init(&pool);
+
+  result = parquet_csv_init(&csv, &pool, 1);
+  assert(result == 0, "should initialize output");
+
+  // an empty text, then a missing value leaving its field empty
+  result = parquet_csv_text(&csv, "", 0);
+  assert(result == 0, "should append empty text");
+
+  parquet_csv_raw(&csv, ",", 1);
+  assert(parquet_csv_equals(&csv, "\"\","), "should tell an empty text from a missing value");
+
+  // release everything
+  parquet_csv_release(&csv, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_csv(struct runner_context *ctx) {
+  test_case(ctx, "can format csv integers", can_format_csv_integers);
+  test_case(ctx, "can format csv reals", can_format_csv_reals);
+  test_case(ctx, "can format csv texts", can_format_csv_texts);
+  test_case(ctx, "can format csv empty texts", can_format_csv_empty_texts);
+}
+
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "malloc.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_CSV_BUFFER_SIZE 262144 // bytes collected before a single write
+#define PARQUET_CSV_FIELD_SIZE 32      // room taken by any formatted number
+
+struct parquet_csv {
+  i32 fd;                    // file descriptor receiving the output
+  u64 offset;                // number of bytes waiting in the buffer
+  char *buffer;              // bytes waiting for the next write
+  struct malloc_lease lease; // lease backing the buffer
+};
+
+/// @brief Allocates the buffer collecting the output.
+/// @param csv Pointer to the parquet_csv structure to initialize.
+/// @param pool Pointer to the malloc_pool structure to allocate from.
+/// @param fd File descriptor receiving the output.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_init(struct parquet_csv *csv, struct malloc_pool *pool, i32 fd);
+
+/// @brief Writes all collected bytes.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_flush(struct parquet_csv *csv);
+
+/// @brief Appends bytes as they are, such as separators or already formatted values.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @param data Pointer to the bytes.
+/// @param size Number of bytes.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_raw(struct parquet_csv *csv, const char *data, u64 size);
+
+/// @brief Appends a text field, quoted only when it contains separators, quotes or line breaks.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @param data Pointer to the text.
+/// @param size Number of bytes of the text.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_text(struct parquet_csv *csv, const char *data, u64 size);
+
+/// @brief Appends binary data as lowercase hexadecimal digits.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @param data Pointer to the bytes.
+/// @param size Number of bytes.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_hex(struct parquet_csv *csv, const char *data, u64 size);
+
+/// @brief Appends a signed integer in decimal notation.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @param value Value to format.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_integer(struct parquet_csv *csv, i64 value);
+
+/// @brief Appends a floating point value with the fewest digits reading back as the same value, in %g notation.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @param value Value to format.
+/// @param single Whether the value is a widened FLOAT, so it only needs to read back as the same FLOAT.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_csv_real(struct parquet_csv *csv, f64 value, bool single);
+
+/// @brief Releases the buffer without writing the collected bytes.
+/// @param csv Pointer to the initialized parquet_csv structure.
+/// @param pool Pointer to the malloc_pool structure the buffer was allocated from.
+extern void parquet_csv_release(struct parquet_csv *csv, struct malloc_pool *pool);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet csv test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_csv(struct runner_context *ctx);
+
+#endif
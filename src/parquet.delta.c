@@ -0,0 +1,943 @@
+#include "parquet.delta.h"
+#include "arena.h"
+#include "codec.base.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "parquet.rle.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_DELTA_MAX_WIDTH 64 // widest bit width of INT64 deltas
+
+// eight 32-bit lanes and four 64-bit lanes, each lowered to a single AVX2 register when available
+typedef u32 parquet_delta_lanes __attribute__((vector_size(32), aligned(4)));
+typedef u64 parquet_delta_wide __attribute__((vector_size(32), aligned(4)));
+
+struct parquet_delta_stream {
+  const char *buffer; // encoded stream
+  u64 size;           // number of bytes in the buffer
+  u64 offset;         // position of the next unread byte
+
+  u32 block_size; // number of values in a block
+  u32 miniblocks; // number of miniblocks in a block
+  u32 total;      // number of values announced by the header
+
+  u64 min_delta; // minimum delta of the current block
+  u64 last;      // last reconstructed value
+};
+
+static i64 parquet_delta_varint(struct parquet_delta_stream *stream, u64 *value) {
+  u8 byte;
+  u32 shift;
+
+  // defaults
+  *value = 0;
+  shift = 0;
+
+  do {
+    // the value is a ULEB128 varint
+    if (stream->offset == stream->size) return PARQUET_ERROR_INVALID_FILE;
+    if (shift > 63) return PARQUET_ERROR_INVALID_VALUE;
+
+    byte = stream->buffer[stream->offset++];
+    *value |= (u64)(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+
+  // success
+  return 0;
+}
+
+static i64 parquet_delta_zigzag(struct parquet_delta_stream *stream, u64 *value) {
+  i64 result;
+
+  // read the raw varint
+  result = parquet_delta_varint(stream, value);
+  if (result < 0) return result;
+
+  // and map it back to a signed value
+  *value = (*value >> 1) ^ -(*value & 0x01);
+  return 0;
+}
+
+static i64 parquet_delta_header(struct parquet_delta_stream *stream) {
+  i64 result;
+  u64 block_size, miniblocks, total;
+
+  // the header consists of three varints
+  result = parquet_delta_varint(stream, &block_size);
+  if (result < 0) return result;
+
+  result = parquet_delta_varint(stream, &miniblocks);
+  if (result < 0) return result;
+
+  result = parquet_delta_varint(stream, &total);
+  if (result < 0) return result;
+
+  // followed by the first value
+  result = parquet_delta_zigzag(stream, &stream->last);
+  if (result < 0) return result;
+
+  // blocks must split into whole groups of miniblocks
+  if (block_size == 0 || block_size > 0xffffffff || block_size % PARQUET_DELTA_BLOCK_MULTIPLE) {
+    return PARQUET_ERROR_INVALID_VALUE;
+  }
+
+  if (miniblocks == 0 || block_size % miniblocks || (block_size / miniblocks) % PARQUET_DELTA_MINIBLOCK_MULTIPLE) {
+    return PARQUET_ERROR_INVALID_VALUE;
+  }
+
+  if (total > 0xffffffff) return PARQUET_ERROR_INVALID_VALUE;
+
+  // success
+  stream->block_size = block_size;
+  stream->miniblocks = miniblocks;
+  stream->total = total;
+
+  return 0;
+}
+
+static const char *parquet_delta_group(struct parquet_delta_stream *stream, u64 offset, u32 width, char *padded) {
+  u32 index;
+
+  // the kernels may read a few bytes past the group
+  if (stream->size - offset - width >= PARQUET_RLE_PADDING) {
+    return stream->buffer + offset;
+  }
+
+  // otherwise the group is copied into a zero-padded buffer
+  for (index = 0; index < PARQUET_DELTA_MAX_WIDTH + PARQUET_RLE_PADDING; index++) {
+    padded[index] = index < width ? stream->buffer[offset + index] : 0;
+  }
+
+  return padded;
+}
+
+static void parquet_delta_unpack_wide(const char *buffer, u64 *values, u32 width) {
+  u32 index, bit;
+  u64 low, high;
+
+  for (index = 0; index < PARQUET_RLE_GROUP_SIZE; index++) {
+    // a value may span 9 bytes
+    bit = index * width;
+    low = *(const u64 *)(buffer + bit / 8);
+    high = (u8)buffer[bit / 8 + 8];
+
+    // merge both parts and drop the bits of the next value
+    values[index] = bit % 8 ? (low >> (bit % 8)) | (high << (64 - bit % 8)) : low;
+    values[index] &= width == 64 ? 0xffffffffffffffffull : (1ull << width) - 1;
+  }
+}
+
+static void parquet_delta_scan(parquet_delta_lanes *lanes) {
+  const parquet_delta_lanes zeros = {0};
+
+  // inclusive prefix sum in log2(8) steps, each adding lanes shifted by 1, 2 and 4 positions
+  *lanes += __builtin_shuffle(zeros, *lanes, (parquet_delta_lanes){0, 8, 9, 10, 11, 12, 13, 14});
+  *lanes += __builtin_shuffle(zeros, *lanes, (parquet_delta_lanes){0, 1, 8, 9, 10, 11, 12, 13});
+  *lanes += __builtin_shuffle(zeros, *lanes, (parquet_delta_lanes){0, 1, 2, 3, 8, 9, 10, 11});
+}
+
+static void parquet_delta_scan_wide(parquet_delta_wide *lanes) {
+  const parquet_delta_wide zeros = {0};
+
+  // inclusive prefix sum in log2(4) steps, each adding lanes shifted by 1 and 2 positions
+  *lanes += __builtin_shuffle(zeros, *lanes, (parquet_delta_wide){0, 4, 5, 6});
+  *lanes += __builtin_shuffle(zeros, *lanes, (parquet_delta_wide){0, 1, 4, 5});
+}
+
+static void parquet_delta_group_32(struct parquet_delta_stream *stream, const char *group, u32 width, u32 *target) {
+  parquet_delta_lanes lanes;
+
+  // unpack the deltas, relative to the minimum delta
+  parquet_rle_unpack(group, (u32 *)&lanes, 1, width);
+
+  // turn them into values continuing from the last one
+  lanes += (u32)stream->min_delta;
+  parquet_delta_scan(&lanes);
+  lanes += (u32)stream->last;
+
+  // store them
+  *(parquet_delta_lanes *)target = lanes;
+  stream->last = lanes[7];
+}
+
+static void parquet_delta_group_64(struct parquet_delta_stream *stream, const char *group, u32 width, u64 *target) {
+  u32 index;
+  u32 narrow[PARQUET_RLE_GROUP_SIZE];
+  parquet_delta_wide lanes[2];
+
+  // unpack the deltas, relative to the minimum delta
+  if (width > PARQUET_RLE_MAX_WIDTH) {
+    parquet_delta_unpack_wide(group, (u64 *)lanes, width);
+  } else {
+    parquet_rle_unpack(group, narrow, 1, width);
+
+    for (index = 0; index < PARQUET_RLE_GROUP_SIZE; index++) {
+      lanes[index / 4][index % 4] = narrow[index];
+    }
+  }
+
+  // turn them into values continuing from the last one
+  lanes[0] += stream->min_delta;
+  lanes[1] += stream->min_delta;
+
+  parquet_delta_scan_wide(&lanes[0]);
+  parquet_delta_scan_wide(&lanes[1]);
+
+  lanes[0] += stream->last;
+  lanes[1] += lanes[0][3];
+
+  // store them
+  *(parquet_delta_wide *)target = lanes[0];
+  *(parquet_delta_wide *)(target + 4) = lanes[1];
+  stream->last = lanes[1][3];
+}
+
+static i64 parquet_delta_miniblock(
+  struct parquet_delta_stream *stream, u32 width, u32 values, struct parquet_vector *vector, u32 *remaining) {
+  u32 index, take;
+  u64 offset, size;
+  const char *group;
+  char *target;
+
+  char padded[PARQUET_DELTA_MAX_WIDTH + PARQUET_RLE_PADDING];
+  u64 output[PARQUET_RLE_GROUP_SIZE];
+
+  // INT32 deltas never need more than 32 bits
+  if (width > (vector->width == sizeof(i32) ? PARQUET_RLE_MAX_WIDTH : PARQUET_DELTA_MAX_WIDTH)) {
+    return PARQUET_ERROR_INVALID_VALUE;
+  }
+
+  // the miniblock must be fully available, even when padded
+  size = (u64)values * width / 8;
+  if (size > stream->size - stream->offset) return PARQUET_ERROR_INVALID_FILE;
+
+  for (offset = stream->offset; *remaining > 0 && values > 0; offset += width) {
+    // whole groups are written in place, the last one through a scratch buffer
+    take = *remaining < PARQUET_RLE_GROUP_SIZE ? *remaining : PARQUET_RLE_GROUP_SIZE;
+
+    group = parquet_delta_group(stream, offset, width, padded);
+    target = take == PARQUET_RLE_GROUP_SIZE ? vector->values + vector->count * vector->width : (char *)output;
+
+    if (vector->width == sizeof(i32)) {
+      parquet_delta_group_32(stream, group, width, (u32 *)target);
+    } else {
+      parquet_delta_group_64(stream, group, width, (u64 *)target);
+    }
+
+    // copy the values of a partial group
+    for (index = 0; take < PARQUET_RLE_GROUP_SIZE && index < take; index++) {
+      if (vector->width == sizeof(i32)) {
+        ((u32 *)vector->values)[vector->count + index] = ((u32 *)output)[index];
+      } else {
+        ((u64 *)vector->values)[vector->count + index] = output[index];
+      }
+    }
+
+    vector->count += take;
+    *remaining -= take;
+    values -= PARQUET_RLE_GROUP_SIZE;
+  }
+
+  // the stream continues after the entire miniblock
+  stream->offset += size;
+  return 0;
+}
+
+static i64 parquet_delta_values(
+  struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count, u32 *total) {
+  i64 result;
+  u32 index, remaining, values, start;
+  const char *widths;
+
+  struct parquet_delta_stream stream;
+
+  // only integer vectors are supported
+  if (vector->data_type != PARQUET_DATA_TYPE_INT32 && vector->data_type != PARQUET_DATA_TYPE_INT64) {
+    return PARQUET_ERROR_INVALID_TYPE;
+  }
+
+  // check the capacity
+  if (count > vector->capacity - vector->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // defaults
+  stream.buffer = buffer;
+  stream.size = buffer_size;
+  stream.offset = 0;
+
+  // read the stream header
+  result = parquet_delta_header(&stream);
+  if (result < 0) return result;
+
+  // the stream must hold all requested values
+  *total = stream.total;
+  if (count > stream.total) return PARQUET_ERROR_INVALID_FILE;
+  if (count == 0) return stream.offset;
+
+  // the first value is stored in the header
+  start = vector->count;
+  remaining = count - 1;
+  values = stream.block_size / stream.miniblocks;
+
+  if (vector->width == sizeof(i32)) {
+    ((u32 *)vector->values)[vector->count++] = stream.last;
+  } else {
+    ((u64 *)vector->values)[vector->count++] = stream.last;
+  }
+
+  while (remaining > 0) {
+    // each block starts with its minimum delta
+    result = parquet_delta_zigzag(&stream, &stream.min_delta);
+    if (result < 0) goto cleanup;
+
+    // followed by the bit widths of its miniblocks
+    result = PARQUET_ERROR_INVALID_FILE;
+    if (stream.miniblocks > stream.size - stream.offset) goto cleanup;
+
+    widths = stream.buffer + stream.offset;
+    stream.offset += stream.miniblocks;
+
+    // unused miniblocks of the last block are not stored at all
+    for (index = 0; index < stream.miniblocks && remaining > 0; index++) {
+      result = parquet_delta_miniblock(&stream, (u8)widths[index], values, vector, &remaining);
+      if (result < 0) goto cleanup;
+    }
+  }
+
+  // success
+  return stream.offset;
+
+cleanup:
+  vector->count = start;
+  return result;
+}
+
+i64 parquet_delta_decode(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count) {
+  u32 total;
+
+  // any prefix of the stream can be decoded
+  return parquet_delta_values(vector, buffer, buffer_size, count, &total);
+}
+
+static i64 parquet_delta_lengths(
+  struct parquet_vector *lengths, const char *buffer, u64 buffer_size, u32 count, u64 *bytes) {
+  i64 result;
+  u32 index, total;
+  const i32 *values;
+
+  // the lengths must be decoded up to the end of their stream, where the next section starts
+  values = (const i32 *)lengths->values + lengths->count;
+  result = parquet_delta_values(lengths, buffer, buffer_size, count, &total);
+
+  if (result < 0) return result;
+  if (count != total) return PARQUET_ERROR_INVALID_FILE;
+
+  // sum them, rejecting negative lengths
+  for (index = 0, *bytes = 0; index < count; index++) {
+    if (values[index] < 0) return PARQUET_ERROR_INVALID_VALUE;
+    *bytes += (u32)values[index];
+  }
+
+  // success
+  return result;
+}
+
+i64 parquet_delta_length_decode(struct parquet_vector *vector,
+                                struct parquet_vector *lengths,
+                                const char *buffer,
+                                u64 buffer_size,
+                                u32 count) {
+  i64 result;
+  u32 index;
+  u64 offset, bytes;
+  const i32 *sizes;
+  struct parquet_binary *values;
+
+  // only byte array vectors are supported
+  if (vector->data_type != PARQUET_DATA_TYPE_BYTE_ARRAY) return PARQUET_ERROR_INVALID_TYPE;
+  if (lengths->data_type != PARQUET_DATA_TYPE_INT32) return PARQUET_ERROR_INVALID_TYPE;
+
+  // check the capacity
+  if (count > vector->capacity - vector->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // decode all lengths in bulk
+  parquet_vector_reset(lengths);
+  result = parquet_delta_lengths(lengths, buffer, buffer_size, count, &bytes);
+  if (result < 0) return result;
+
+  // the concatenated values follow the lengths
+  offset = result;
+  if (bytes > buffer_size - offset) return PARQUET_ERROR_INVALID_FILE;
+
+  sizes = (const i32 *)lengths->values;
+  values = (struct parquet_binary *)vector->values + vector->count;
+
+  // reference each value in place
+  for (index = 0; index < count; index++) {
+    values[index].ptr = buffer + offset;
+    values[index].size = sizes[index];
+    offset += sizes[index];
+  }
+
+  // success
+  vector->count += count;
+  return offset;
+}
+
+i64 parquet_delta_bytes_decode(struct parquet_vector *vector,
+                               struct parquet_vector *lengths,
+                               struct arena_allocator *heap,
+                               const char *buffer,
+                               u64 buffer_size,
+                               u32 count) {
+  i64 result;
+  u32 index, previous;
+  u64 offset, bytes, total;
+  const i32 *prefixes, *suffixes;
+  char *target;
+  struct parquet_binary *values;
+
+  // only byte array vectors are supported
+  if (vector->data_type != PARQUET_DATA_TYPE_BYTE_ARRAY) return PARQUET_ERROR_INVALID_TYPE;
+  if (lengths->data_type != PARQUET_DATA_TYPE_INT32) return PARQUET_ERROR_INVALID_TYPE;
+
+  // check the capacity, lengths hold both prefixes and suffixes
+  if (count > vector->capacity - vector->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+  if (count > lengths->capacity / 2) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // decode the prefix lengths
+  parquet_vector_reset(lengths);
+  result = parquet_delta_lengths(lengths, buffer, buffer_size, count, &total);
+  if (result < 0) return result;
+
+  // followed by the suffix lengths
+  offset = result;
+  result = parquet_delta_lengths(lengths, buffer + offset, buffer_size - offset, count, &bytes);
+  if (result < 0) return result;
+
+  // followed by the concatenated suffixes
+  offset += result;
+  if (bytes > buffer_size - offset) return PARQUET_ERROR_INVALID_FILE;
+
+  prefixes = (const i32 *)lengths->values;
+  suffixes = prefixes + count;
+
+  // each prefix must be shared with the previous value
+  for (index = 0, previous = 0; index < count; index++) {
+    if ((u32)prefixes[index] > previous) return PARQUET_ERROR_INVALID_VALUE;
+    previous = prefixes[index] + suffixes[index];
+  }
+
+  // all values of the batch land in a single contiguous heap block
+  total += bytes;
+  if (total > 0xffffffff) return PARQUET_ERROR_LIMITS_REACHED;
+
+  result = arena_acquire(heap, total, (void **)&target);
+  if (result < 0) return result;
+
+  values = (struct parquet_binary *)vector->values + vector->count;
+
+  for (index = 0; index < count; index++) {
+    // the shared prefix comes from the previous value, which directly precedes the target
+    if (prefixes[index] > 0) {
+      codec_copy_exact(target, values[index - 1].ptr, prefixes[index]);
+    }
+
+    // the suffix comes from the buffer
+    codec_copy_exact(target + prefixes[index], buffer + offset, suffixes[index]);
+
+    values[index].ptr = target;
+    values[index].size = prefixes[index] + suffixes[index];
+
+    offset += suffixes[index];
+    target += values[index].size;
+  }
+
+  // success
+  vector->count += count;
+  return offset;
+}
+
+#if defined(I13C_TESTS)
+
+static u64 parquet_delta_test_varint(char *buffer, u64 value) {
+  u64 size;
+
+  // emit 7 bits at a time, LSB first
+  for (size = 0; value >= 0x80; value >>= 7) {
+    buffer[size++] = (char)(value | 0x80);
+  }
+
+  buffer[size++] = (char)value;
+  return size;
+}
+
+static u64 parquet_delta_test_encode(char *buffer, const i64 *values, u32 count, u32 bits) {
+  u32 block, miniblock, index, width, bit, widths[4];
+  u64 size, relative, deltas[128];
+  i64 delta, min;
+
+  // header with 128 values in a block and 4 miniblocks
+  size = parquet_delta_test_varint(buffer, 128);
+  size += parquet_delta_test_varint(buffer + size, 4);
+  size += parquet_delta_test_varint(buffer + size, count);
+  size += parquet_delta_test_varint(buffer + size, ((u64)values[0] << 1) ^ (u64)(values[0] >> 63));
+
+  for (block = 1; block < count; block += 128) {
+    // compute the deltas in the physical width
+    for (index = 0, min = 0; index < 128; index++) {
+      if (block + index < count && bits == 32) {
+        delta = (i32)((u32)values[block + index] - (u32)values[block + index - 1]);
+      } else if (block + index < count) {
+        delta = (i64)((u64)values[block + index] - (u64)values[block + index - 1]);
+      } else {
+        delta = min;
+      }
+
+      min = index == 0 || delta < min ? delta : min;
+      deltas[index] = delta;
+    }
+
+    // the minimum delta
+    size += parquet_delta_test_varint(buffer + size, ((u64)min << 1) ^ (u64)(min >> 63));
+
+    // the widths of the miniblocks
+    for (miniblock = 0; miniblock < 4; miniblock++) {
+      for (index = 0, widths[miniblock] = 0; index < 32 && block + miniblock * 32 < count; index++) {
+        relative = deltas[miniblock * 32 + index] - min;
+        relative = bits == 32 ? (u32)relative : relative;
+        while (widths[miniblock] < 64 && relative >> widths[miniblock]) widths[miniblock]++;
+      }
+
+      buffer[size++] = (char)widths[miniblock];
+    }
+
+    // the packed miniblocks, only those holding any values
+    for (miniblock = 0; miniblock < 4 && block + miniblock * 32 < count; miniblock++) {
+      width = widths[miniblock];
+
+      for (index = 0; index < 32 * width / 8; index++) {
+        buffer[size + index] = 0;
+      }
+
+      for (bit = 0; bit < 32 * width; bit++) {
+        relative = deltas[miniblock * 32 + bit / width] - min;
+        buffer[size + bit / 8] |= (char)(((relative >> (bit % width)) & 0x01) << (bit % 8));
+      }
+
+      size += 32 * width / 8;
+    }
+  }
+
+  // success
+  return size;
+}
+
+static void can_decode_delta_sequence() {
+  i64 result;
+  i32 *values;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // values 1 to 5, block of 128 values in 4 miniblocks, minimum delta 1, all widths 0
+  const char buffer[] = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 5);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_delta_decode(&vector, buffer, sizeof(buffer), 5);
+  assert(result == sizeof(buffer), "should consume the entire buffer");
+  assert(vector.count == 5, "should decode 5 values");
+
+  // assert the values
+  values = (i32 *)vector.values;
+  assert(values[0] == 1 && values[1] == 2 && values[4] == 5, "values should be 1 to 5");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_delta_int32() {
+  i64 result;
+  u64 size;
+  u32 index;
+  i64 expected[300];
+  char buffer[4096];
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // mixed ascending, descending and wrapping values over 3 blocks
+  for (index = 0; index < 300; index++) {
+    expected[index] = index % 7 == 0 ? (i32)(0x7ffffff0 + index) : (i32)(index * 37) - (i32)(index % 5) * 1000;
+  }
+
+  // encode them
+  size = parquet_delta_test_encode(buffer, expected, 300, 32);
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 300);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_delta_decode(&vector, buffer, size, 300);
+  assert(result == (i64)size, "should consume the entire buffer");
+  assert(vector.count == 300, "should decode 300 values");
+
+  // assert the values
+  for (index = 0; index < 300; index++) {
+    assert(((i32 *)vector.values)[index] == (i32)expected[index], "value should match");
+  }
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_delta_int64() {
+  i64 result;
+  u64 size;
+  u32 index;
+  i64 expected[200];
+  char buffer[4096];
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // timestamps with occasional jumps needing more than 32 bits
+  for (index = 0; index < 200; index++) {
+    expected[index] = 1700000000000000 + (i64)index * 1000 + (index % 9 == 0 ? (i64)index << 36 : 0);
+  }
+
+  // encode them
+  size = parquet_delta_test_encode(buffer, expected, 200, 64);
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT64, 0, 200);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_delta_decode(&vector, buffer, size, 200);
+  assert(result == (i64)size, "should consume the entire buffer");
+
+  // assert the values
+  for (index = 0; index < 200; index++) {
+    assert(((i64 *)vector.values)[index] == expected[index], "value should match");
+  }
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_delta_prefix() {
+  i64 result;
+  u64 size;
+  u32 index;
+  i64 expected[100];
+  char buffer[4096];
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // descending values
+  for (index = 0; index < 100; index++) {
+    expected[index] = 1000 - (i64)index * 3;
+  }
+
+  // encode them
+  size = parquet_delta_test_encode(buffer, expected, 100, 64);
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT64, 0, 100);
+  assert(result == 0, "should initialize vector");
+
+  // decode only a part of the values
+  result = parquet_delta_decode(&vector, buffer, size, 11);
+  assert(result > 0, "should decode 11 values");
+  assert(vector.count == 11, "should hold 11 values");
+  assert(((i64 *)vector.values)[10] == 970, "value 10 should be 970");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_delta_invalid_block_size() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0x64, 0x04, 0x01, 0x02}; // block of 100 values
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 1);
+  assert(result == 0, "should initialize vector");
+
+  // decode the header
+  result = parquet_delta_decode(&vector, buffer, sizeof(buffer), 1);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_delta_truncated_miniblock() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0x80, 0x01, 0x04, 0x03, 0x02, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01}; // width 8, 1 byte
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 3);
+  assert(result == 0, "should initialize vector");
+
+  // decode the values
+  result = parquet_delta_decode(&vector, buffer, sizeof(buffer), 3);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+  assert(vector.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_delta_int32_too_wide() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0x80, 0x01, 0x04, 0x02, 0x02, 0x02, 0x21, 0x00, 0x00, 0x00}; // width 33
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  // decode the values
+  result = parquet_delta_decode(&vector, buffer, sizeof(buffer), 2);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static u64 parquet_delta_test_lengths(char *buffer, const char **values, u32 count) {
+  u32 index;
+  i64 lengths[16];
+
+  // lengths of the zero-terminated values
+  for (index = 0; index < count; index++) {
+    lengths[index] = 0;
+    while (values[index][lengths[index]]) lengths[index]++;
+  }
+
+  return parquet_delta_test_encode(buffer, lengths, count, 32);
+}
+
+static void can_decode_delta_length_byte_array() {
+  i64 result;
+  u64 size;
+  const struct parquet_binary *values;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector, lengths;
+
+  char buffer[256];
+  const char *expected[] = {"Hello", "World", "Foobar", "ABCDEF"};
+
+  // encode the lengths followed by the concatenated values
+  size = parquet_delta_test_lengths(buffer, expected, 4);
+  codec_copy_exact(buffer + size, "HelloWorldFoobarABCDEF", 22);
+
+  // initialize the pool and the vectors
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 4);
+  assert(result == 0, "should initialize vector");
+
+  result = parquet_vector_init(&lengths, &pool, PARQUET_DATA_TYPE_INT32, 0, 4);
+  assert(result == 0, "should initialize lengths");
+
+  // decode all values
+  result = parquet_delta_length_decode(&vector, &lengths, buffer, size + 22, 4);
+  assert(result == (i64)size + 22, "should consume the entire buffer");
+  assert(vector.count == 4, "should decode 4 values");
+
+  // assert the values reference the buffer
+  values = (const struct parquet_binary *)vector.values;
+  assert(values[0].ptr == buffer + size && values[0].size == 5, "value 0 should be Hello");
+  assert(values[2].ptr == buffer + size + 10 && values[2].size == 6, "value 2 should be Foobar");
+  assert(values[3].ptr[0] == 'A' && values[3].size == 6, "value 3 should be ABCDEF");
+
+  // release everything
+  parquet_vector_release(&lengths, &pool);
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_delta_byte_array() {
+  i64 result;
+  u64 size;
+  const struct parquet_binary *values;
+
+  struct malloc_pool pool;
+  struct arena_allocator heap;
+  struct parquet_vector vector, lengths;
+
+  char buffer[256];
+  const char *prefixes[] = {"", "ax", "", "bab"};
+  const char *suffixes[] = {"axis", "le", "babble", "yhood"};
+
+  // encode prefix lengths, suffix lengths and the concatenated suffixes
+  size = parquet_delta_test_lengths(buffer, prefixes, 4);
+  size += parquet_delta_test_lengths(buffer + size, suffixes, 4);
+  codec_copy_exact(buffer + size, "axislebabbleyhood", 17);
+
+  // initialize the pool, the heap and the vectors
+  malloc_init(&pool);
+  arena_init(&heap, &pool, 4096, 4096);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 4);
+  assert(result == 0, "should initialize vector");
+
+  result = parquet_vector_init(&lengths, &pool, PARQUET_DATA_TYPE_INT32, 0, 8);
+  assert(result == 0, "should initialize lengths");
+
+  // decode all values
+  result = parquet_delta_bytes_decode(&vector, &lengths, &heap, buffer, size + 17, 4);
+  assert(result == (i64)size + 17, "should consume the entire buffer");
+  assert(vector.count == 4, "should decode 4 values");
+
+  // assert the values are reconstructed one after another
+  values = (const struct parquet_binary *)vector.values;
+  assert(values[0].size == 4 && values[0].ptr[3] == 's', "value 0 should be axis");
+  assert(values[1].ptr == values[0].ptr + 4 && values[1].size == 4, "value 1 should follow value 0");
+  assert(values[1].ptr[0] == 'a' && values[1].ptr[1] == 'x' && values[1].ptr[3] == 'e', "value 1 should be axle");
+  assert(values[3].ptr == values[2].ptr + 6 && values[3].size == 8, "value 3 should follow value 2");
+  assert(values[3].ptr[2] == 'b' && values[3].ptr[3] == 'y' && values[3].ptr[7] == 'd', "value 3 should be babyhood");
+
+  // release everything
+  parquet_vector_release(&lengths, &pool);
+  parquet_vector_release(&vector, &pool);
+  arena_destroy(&heap);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_delta_byte_array_invalid_prefix() {
+  i64 result;
+  u64 size;
+
+  struct malloc_pool pool;
+  struct arena_allocator heap;
+  struct parquet_vector vector, lengths;
+
+  char buffer[256];
+  const char *prefixes[] = {"", "abc"};
+  const char *suffixes[] = {"ab", "d"};
+
+  // the second prefix is longer than the first value
+  size = parquet_delta_test_lengths(buffer, prefixes, 2);
+  size += parquet_delta_test_lengths(buffer + size, suffixes, 2);
+  codec_copy_exact(buffer + size, "abd", 3);
+
+  // initialize the pool, the heap and the vectors
+  malloc_init(&pool);
+  arena_init(&heap, &pool, 4096, 4096);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  result = parquet_vector_init(&lengths, &pool, PARQUET_DATA_TYPE_INT32, 0, 4);
+  assert(result == 0, "should initialize lengths");
+
+  // decode all values
+  result = parquet_delta_bytes_decode(&vector, &lengths, &heap, buffer, size + 3, 2);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+  assert(vector.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&lengths, &pool);
+  parquet_vector_release(&vector, &pool);
+  arena_destroy(&heap);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_delta_length_truncated_values() {
+  i64 result;
+  u64 size;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector, lengths;
+
+  char buffer[256];
+  const char *expected[] = {"Hello", "World"};
+
+  // encode the lengths, but only a part of the values
+  size = parquet_delta_test_lengths(buffer, expected, 2);
+  codec_copy_exact(buffer + size, "HelloWor", 8);
+
+  // initialize the pool and the vectors
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  result = parquet_vector_init(&lengths, &pool, PARQUET_DATA_TYPE_INT32, 0, 2);
+  assert(result == 0, "should initialize lengths");
+
+  // decode all values
+  result = parquet_delta_length_decode(&vector, &lengths, buffer, size + 8, 2);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+
+  // decoding fewer values than announced cannot locate the values
+  result = parquet_delta_length_decode(&vector, &lengths, buffer, size + 8, 1);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+
+  // release everything
+  parquet_vector_release(&lengths, &pool);
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_delta(struct runner_context *ctx) {
+  test_case(ctx, "can decode delta sequence", can_decode_delta_sequence);
+  test_case(ctx, "can decode delta int32", can_decode_delta_int32);
+  test_case(ctx, "can decode delta int64", can_decode_delta_int64);
+  test_case(ctx, "can decode delta prefix", can_decode_delta_prefix);
+  test_case(ctx, "can detect delta invalid block size", can_detect_delta_invalid_block_size);
+  test_case(ctx, "can detect delta truncated miniblock", can_detect_delta_truncated_miniblock);
+  test_case(ctx, "can detect delta int32 too wide", can_detect_delta_int32_too_wide);
+  test_case(ctx, "can decode delta length byte array", can_decode_delta_length_byte_array);
+  test_case(ctx, "can decode delta byte array", can_decode_delta_byte_array);
+  test_case(ctx, "can detect delta byte array invalid prefix", can_detect_delta_byte_array_invalid_prefix);
+  test_case(ctx, "can detect delta length truncated values", can_detect_delta_length_truncated_values);
+}
+
+#endif
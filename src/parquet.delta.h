@@ -0,0 +1,53 @@
+#pragma once
+
+#include "arena.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_DELTA_BLOCK_MULTIPLE 128    // block sizes are multiples of this many values
+#define PARQUET_DELTA_MINIBLOCK_MULTIPLE 32 // miniblock sizes are multiples of this many values
+
+/// @brief Decodes DELTA_BINARY_PACKED values and appends them to an INT32 or INT64 vector.
+/// @param vector Pointer to the initialized parquet_vector structure.
+/// @param buffer Pointer to the encoded values, starting with the stream header.
+/// @param buffer_size Number of bytes available in the buffer.
+/// @param count Number of values to decode, at most the number announced by the header.
+/// @return The number of consumed bytes, or a negative error code on failure.
+extern i64 parquet_delta_decode(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count);
+
+/// @brief Decodes DELTA_LENGTH_BYTE_ARRAY values and appends them to a BYTE_ARRAY vector.
+/// @param vector Pointer to the initialized parquet_vector structure, values keep referencing the buffer.
+/// @param lengths Pointer to the INT32 scratch vector receiving the lengths, at least count values.
+/// @param buffer Pointer to the encoded lengths followed by the concatenated values.
+/// @param buffer_size Number of bytes available in the buffer.
+/// @param count Number of values to decode, exactly the number announced by the lengths header.
+/// @return The number of consumed bytes, or a negative error code on failure.
+extern i64 parquet_delta_length_decode(struct parquet_vector *vector,
+                                       struct parquet_vector *lengths,
+                                       const char *buffer,
+                                       u64 buffer_size,
+                                       u32 count);
+
+/// @brief Decodes DELTA_BYTE_ARRAY values and appends them to a BYTE_ARRAY vector.
+/// @param vector Pointer to the initialized parquet_vector structure, values reference the heap.
+/// @param lengths Pointer to the INT32 scratch vector receiving prefix and suffix lengths, at least 2 * count values.
+/// @param heap Pointer to the arena_allocator structure receiving all reconstructed values as one block.
+/// @param buffer Pointer to the encoded prefix lengths, suffix lengths and concatenated suffixes.
+/// @param buffer_size Number of bytes available in the buffer.
+/// @param count Number of values to decode, exactly the number announced by the lengths headers.
+/// @return The number of consumed bytes, or a negative error code on failure.
+extern i64 parquet_delta_bytes_decode(struct parquet_vector *vector,
+                                      struct parquet_vector *lengths,
+                                      struct arena_allocator *heap,
+                                      const char *buffer,
+                                      u64 buffer_size,
+                                      u32 count);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet delta decoding test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_delta(struct runner_context *ctx);
+
+#endif
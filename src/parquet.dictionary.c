@@ -0,0 +1,477 @@
+#include "parquet.dictionary.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "parquet.plain.h"
+#include "parquet.rle.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_DICTIONARY_LANES 8 // indices gathered at once
+
+#if defined(__AVX2__)
+
+// lanes matching the operands of the vpgatherdd and vpgatherdq instructions
+typedef i32 parquet_dictionary_v8si __attribute__((vector_size(32), aligned(4)));
+typedef i32 parquet_dictionary_v4si __attribute__((vector_size(16), aligned(4)));
+typedef i64 parquet_dictionary_v4di __attribute__((vector_size(32), aligned(4)));
+
+#endif
+
+i64 parquet_dictionary_init(struct parquet_dictionary *dictionary,
+                            struct malloc_pool *pool,
+                            i32 data_type,
+                            i32 type_length,
+                            const char *buffer,
+                            u64 size,
+                            u32 count) {
+  i64 result;
+
+  // allocate the entries
+  result = parquet_vector_init(&dictionary->values, pool, data_type, type_length, count);
+  if (result < 0) return result;
+
+  // the dictionary page is always PLAIN encoded
+  result = parquet_plain_decode(&dictionary->values, buffer, size, count);
+  if (result < 0) goto cleanup;
+
+  // success
+  return 0;
+
+cleanup:
+  parquet_vector_release(&dictionary->values, pool);
+  return result;
+}
+
+static i64 parquet_dictionary_check(const struct parquet_dictionary *dictionary, const u32 *indices, u32 count) {
+  u32 index, max;
+
+  // find the highest index
+  for (index = 0, max = 0; index < count; index++) {
+    max = indices[index] > max ? indices[index] : max;
+  }
+
+  // and compare it only once
+  if (count > 0 && max >= dictionary->values.count) return PARQUET_ERROR_INVALID_VALUE;
+
+  // success
+  return 0;
+}
+
+i64 parquet_dictionary_indices(const struct parquet_dictionary *dictionary,
+                               struct parquet_rle *rle,
+                               struct parquet_vector *indices,
+                               u32 count) {
+  i64 result;
+  u32 *target;
+
+  // indices are stored as INT32 values
+  if (indices->data_type != PARQUET_DATA_TYPE_INT32) return PARQUET_ERROR_INVALID_TYPE;
+  if (count > indices->capacity - indices->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // decode them after the existing ones
+  target = (u32 *)indices->values + indices->count;
+
+  result = parquet_rle_decode(rle, target, count);
+  if (result < 0) return result;
+
+  // they must point into the dictionary
+  result = parquet_dictionary_check(dictionary, target, count);
+  if (result < 0) return result;
+
+  // success
+  indices->count += count;
+  return 0;
+}
+
+static void parquet_dictionary_gather_4(const char *entries, const u32 *indices, u32 count, char *output) {
+  u32 index;
+
+#if defined(__AVX2__)
+  parquet_dictionary_v8si lanes, zeros, mask;
+#endif
+
+  // defaults
+  index = 0;
+
+#if defined(__AVX2__)
+  // all lanes are gathered
+  zeros = (parquet_dictionary_v8si){0};
+  mask = ~zeros;
+
+  // gather 8 entries with a single vpgatherdd
+  for (; index + PARQUET_DICTIONARY_LANES <= count; index += PARQUET_DICTIONARY_LANES) {
+    lanes = *(const parquet_dictionary_v8si *)(indices + index);
+    *(parquet_dictionary_v8si *)(output + index * 4) =
+      __builtin_ia32_gathersiv8si(zeros, (const int *)entries, lanes, mask, 4);
+  }
+#endif
+
+  // gather the remaining entries one by one
+  for (; index < count; index++) {
+    ((u32 *)output)[index] = ((const u32 *)entries)[indices[index]];
+  }
+}
+
+static void parquet_dictionary_gather_8(const char *entries, const u32 *indices, u32 count, char *output) {
+  u32 index;
+
+#if defined(__AVX2__)
+  parquet_dictionary_v4si lanes;
+  parquet_dictionary_v4di zeros, mask;
+#endif
+
+  // defaults
+  index = 0;
+
+#if defined(__AVX2__)
+  // all lanes are gathered
+  zeros = (parquet_dictionary_v4di){0};
+  mask = ~zeros;
+
+  // gather 8 entries with two vpgatherdq
+  for (; index + PARQUET_DICTIONARY_LANES <= count; index += PARQUET_DICTIONARY_LANES) {
+    lanes = *(const parquet_dictionary_v4si *)(indices + index);
+    *(parquet_dictionary_v4di *)(output + index * 8) =
+      __builtin_ia32_gathersiv4di(zeros, (const long long *)entries, lanes, mask, 8);
+
+    lanes = *(const parquet_dictionary_v4si *)(indices + index + 4);
+    *(parquet_dictionary_v4di *)(output + index * 8 + 32) =
+      __builtin_ia32_gathersiv4di(zeros, (const long long *)entries, lanes, mask, 8);
+  }
+#endif
+
+  // gather the remaining entries one by one
+  for (; index < count; index++) {
+    ((u64 *)output)[index] = ((const u64 *)entries)[indices[index]];
+  }
+}
+
+static void parquet_dictionary_gather_16(const char *entries, const u32 *indices, u32 count, char *output) {
+  u32 index;
+  const u64 *entry;
+
+  // BYTE_ARRAY references are copied, never the bytes they point to
+  for (index = 0; index < count; index++) {
+    entry = (const u64 *)(entries + (u64)indices[index] * 16);
+
+    ((u64 *)output)[2 * index] = entry[0];
+    ((u64 *)output)[2 * index + 1] = entry[1];
+  }
+}
+
+static void parquet_dictionary_gather_n(const char *entries, const u32 *indices, u32 count, char *output, u32 width) {
+  u32 index, offset;
+  const char *entry;
+
+  // any other width is copied byte by byte
+  for (index = 0; index < count; index++) {
+    entry = entries + (u64)indices[index] * width;
+
+    for (offset = 0; offset < width; offset++) {
+      *output++ = entry[offset];
+    }
+  }
+}
+
+i64 parquet_dictionary_gather(const struct parquet_dictionary *dictionary,
+                              const u32 *indices,
+                              u32 count,
+                              struct parquet_vector *output) {
+  char *target;
+  const char *entries;
+
+  // the output must hold the same values as the dictionary
+  if (output->data_type != dictionary->values.data_type) return PARQUET_ERROR_INVALID_TYPE;
+  if (output->width != dictionary->values.width) return PARQUET_ERROR_INVALID_TYPE;
+  if (count > output->capacity - output->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // entries are appended after the existing values
+  entries = dictionary->values.values;
+  target = output->values + (u64)output->count * output->width;
+
+  // dispatch once per call, never per value
+  switch (output->width) {
+    case 4:
+      parquet_dictionary_gather_4(entries, indices, count, target);
+      break;
+    case 8:
+      parquet_dictionary_gather_8(entries, indices, count, target);
+      break;
+    case 16:
+      parquet_dictionary_gather_16(entries, indices, count, target);
+      break;
+    default:
+      parquet_dictionary_gather_n(entries, indices, count, target, output->width);
+      break;
+  }
+
+  // success
+  output->count += count;
+  return 0;
+}
+
+void parquet_dictionary_release(struct parquet_dictionary *dictionary, struct malloc_pool *pool) {
+  parquet_vector_release(&dictionary->values, pool);
+}
+
+#if defined(I13C_TESTS)
+
+static void can_gather_int32_dictionary() {
+  i64 result;
+  u32 index;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector output;
+
+  const i32 entries[] = {100, 200, 300, 400};
+  const u32 indices[] = {3, 0, 1, 2, 2, 1, 0, 3, 1, 1, 3};
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_INT32, 0, (const char *)entries,
+                                   sizeof(entries), 4);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&output, &pool, PARQUET_DATA_TYPE_INT32, 0, 16);
+  assert(result == 0, "should initialize output");
+
+  // gather a full lane group and a tail
+  result = parquet_dictionary_gather(&dictionary, indices, 11, &output);
+  assert(result == 0, "should gather 11 values");
+  assert(output.count == 11, "output should hold 11 values");
+
+  // assert the values
+  for (index = 0; index < 11; index++) {
+    assert(((i32 *)output.values)[index] == entries[indices[index]], "value should match the entry");
+  }
+
+  // release everything
+  parquet_vector_release(&output, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_gather_int64_dictionary() {
+  i64 result;
+  u32 index;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector output;
+
+  const i64 entries[] = {-1, 0x100000000, 7};
+  const u32 indices[] = {1, 2, 0, 0, 1, 2, 2, 1, 0};
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_INT64, 0, (const char *)entries,
+                                   sizeof(entries), 3);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&output, &pool, PARQUET_DATA_TYPE_INT64, 0, 9);
+  assert(result == 0, "should initialize output");
+
+  // gather a full lane group and a tail
+  result = parquet_dictionary_gather(&dictionary, indices, 9, &output);
+  assert(result == 0, "should gather 9 values");
+
+  // assert the values
+  for (index = 0; index < 9; index++) {
+    assert(((i64 *)output.values)[index] == entries[indices[index]], "value should match the entry");
+  }
+
+  // release everything
+  parquet_vector_release(&output, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_gather_byte_array_dictionary() {
+  i64 result;
+  struct parquet_binary *values;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector output;
+
+  const char buffer[] = {0x02, 0x00, 0x00, 0x00, 'p', 'l', 0x02, 0x00, 0x00, 0x00, 'd', 'e'};
+  const u32 indices[] = {1, 1, 0};
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, buffer, sizeof(buffer), 2);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&output, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 3);
+  assert(result == 0, "should initialize output");
+
+  // gather the references
+  result = parquet_dictionary_gather(&dictionary, indices, 3, &output);
+  assert(result == 0, "should gather 3 values");
+
+  // assert the values point into the dictionary page
+  values = (struct parquet_binary *)output.values;
+  assert(values[0].ptr == buffer + 10 && values[0].size == 2, "value 0 should be 'de'");
+  assert(values[1].ptr == buffer + 10 && values[1].size == 2, "value 1 should be 'de'");
+  assert(values[2].ptr == buffer + 4 && values[2].size == 2, "value 2 should be 'pl'");
+
+  // release everything
+  parquet_vector_release(&output, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_gather_int96_dictionary() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector output;
+
+  const char buffer[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+  const u32 indices[] = {1, 0};
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_INT96, 0, buffer, sizeof(buffer), 2);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&output, &pool, PARQUET_DATA_TYPE_INT96, 0, 2);
+  assert(result == 0, "should initialize output");
+
+  // gather the entries
+  result = parquet_dictionary_gather(&dictionary, indices, 2, &output);
+  assert(result == 0, "should gather 2 values");
+
+  // assert the values
+  assert(output.values[0] == 21 && output.values[11] == 32, "value 0 should be the second entry");
+  assert(output.values[12] == 1 && output.values[23] == 12, "value 1 should be the first entry");
+
+  // release everything
+  parquet_vector_release(&output, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_keep_values_dictionary_encoded() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector indices;
+  struct parquet_rle rle;
+
+  const i32 entries[] = {10, 20, 30};
+  const char buffer[] = {0x02, 0x03, 0x24, 0x00, 0x08, 0x01}; // width 2, indices 0,1,2,0,0,0,0,0, then 4 times 1
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_INT32, 0, (const char *)entries,
+                                   sizeof(entries), 3);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&indices, &pool, PARQUET_DATA_TYPE_INT32, 0, 12);
+  assert(result == 0, "should initialize indices");
+
+  // decode the indices only
+  result = parquet_rle_init_indices(&rle, buffer, sizeof(buffer));
+  assert(result == 0, "should initialize decoder");
+
+  result = parquet_dictionary_indices(&dictionary, &rle, &indices, 12);
+  assert(result == 0, "should decode 12 indices");
+
+  // assert the indices
+  assert(indices.count == 12, "should hold 12 indices");
+  assert(((u32 *)indices.values)[1] == 1 && ((u32 *)indices.values)[2] == 2, "should decode bit-packed indices");
+  assert(((u32 *)indices.values)[8] == 1 && ((u32 *)indices.values)[11] == 1, "should decode repeated indices");
+
+  // release everything
+  parquet_vector_release(&indices, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_index_outside_of_dictionary() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector indices;
+  struct parquet_rle rle;
+
+  const i32 entries[] = {10, 20};
+  const char buffer[] = {0x02, 0x04, 0x02}; // width 2, 2 times the index 2
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_INT32, 0, (const char *)entries,
+                                   sizeof(entries), 2);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&indices, &pool, PARQUET_DATA_TYPE_INT32, 0, 2);
+  assert(result == 0, "should initialize indices");
+
+  // decode the indices
+  result = parquet_rle_init_indices(&rle, buffer, sizeof(buffer));
+  assert(result == 0, "should initialize decoder");
+
+  result = parquet_dictionary_indices(&dictionary, &rle, &indices, 2);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+  assert(indices.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&indices, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_gather_type_mismatch() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_dictionary dictionary;
+  struct parquet_vector output;
+
+  const f32 entries[] = {1.0f, 2.0f};
+  const u32 indices[] = {0};
+
+  // initialize the pool and the dictionary
+  malloc_init(&pool);
+
+  result = parquet_dictionary_init(&dictionary, &pool, PARQUET_DATA_TYPE_FLOAT, 0, (const char *)entries,
+                                   sizeof(entries), 2);
+  assert(result == 0, "should initialize dictionary");
+
+  result = parquet_vector_init(&output, &pool, PARQUET_DATA_TYPE_INT32, 0, 1);
+  assert(result == 0, "should initialize output");
+
+  // gather into a vector of another type
+  result = parquet_dictionary_gather(&dictionary, indices, 1, &output);
+  assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
+
+  // release everything
+  parquet_vector_release(&output, &pool);
+  parquet_dictionary_release(&dictionary, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_dictionary(struct runner_context *ctx) {
+  test_case(ctx, "can gather int32 dictionary", can_gather_int32_dictionary);
+  test_case(ctx, "can gather int64 dictionary", can_gather_int64_dictionary);
+  test_case(ctx, "can gather byte array dictionary", can_gather_byte_array_dictionary);
+  test_case(ctx, "can gather int96 dictionary", can_gather_int96_dictionary);
+  test_case(ctx, "can keep values dictionary encoded", can_keep_values_dictionary_encoded);
+  test_case(ctx, "can detect index outside of dictionary", can_detect_index_outside_of_dictionary);
+  test_case(ctx, "can detect gather type mismatch", can_detect_gather_type_mismatch);
+}
+
+#endif
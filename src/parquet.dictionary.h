@@ -0,0 +1,63 @@
+#pragma once
+
+#include "malloc.h"
+#include "parquet.rle.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+struct parquet_dictionary {
+  struct parquet_vector values; // dictionary entries, BYTE_ARRAY entries reference the dictionary page
+};
+
+/// @brief Decodes the PLAIN encoded entries of a dictionary page.
+/// @param dictionary Pointer to the parquet_dictionary structure to initialize.
+/// @param pool Pointer to the malloc_pool structure to allocate from.
+/// @param data_type Physical type of the entries.
+/// @param type_length Length of FIXED_LEN_BYTE_ARRAY entries, ignored for other types.
+/// @param buffer Pointer to the uncompressed dictionary page data, it must outlive the dictionary.
+/// @param size Number of bytes in the buffer.
+/// @param count Number of entries in the dictionary page.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_dictionary_init(struct parquet_dictionary *dictionary,
+                                   struct malloc_pool *pool,
+                                   i32 data_type,
+                                   i32 type_length,
+                                   const char *buffer,
+                                   u64 size,
+                                   u32 count);
+
+/// @brief Decodes and validates dictionary indices, keeping the values dictionary-encoded.
+/// @param dictionary Pointer to the initialized parquet_dictionary structure.
+/// @param rle Pointer to the decoder initialized over the indices.
+/// @param indices Pointer to the INT32 vector receiving the indices.
+/// @param count Number of indices to decode.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_dictionary_indices(const struct parquet_dictionary *dictionary,
+                                      struct parquet_rle *rle,
+                                      struct parquet_vector *indices,
+                                      u32 count);
+
+/// @brief Appends the dictionary entries selected by validated indices to the output vector.
+/// @param dictionary Pointer to the initialized parquet_dictionary structure.
+/// @param indices Pointer to the indices, each lower than the number of entries.
+/// @param count Number of indices.
+/// @param output Pointer to the vector of the same physical type as the dictionary.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_dictionary_gather(const struct parquet_dictionary *dictionary,
+                                     const u32 *indices,
+                                     u32 count,
+                                     struct parquet_vector *output);
+
+/// @brief Releases the memory held by the dictionary.
+/// @param dictionary Pointer to the initialized parquet_dictionary structure.
+/// @param pool Pointer to the malloc_pool structure the dictionary was allocated from.
+extern void parquet_dictionary_release(struct parquet_dictionary *dictionary, struct malloc_pool *pool);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet dictionary test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_dictionary(struct runner_context *ctx);
+
+#endif
@@ -2,6 +2,7 @@
 #include "dom.h"
 #include "malloc.h"
 #include "parquet.base.h"
+#include "parquet.convert.h"
 #include "parquet.parse.h"
 #include "runner.h"
 #include "stdout.h"
@@ -180,6 +181,116 @@ static i64 parquet_dump_text(struct parquet_metadata_iterator *iterator, u32 ind
   return parquet_dump_literal(iterator, index, DOM_TYPE_TEXT);
 }
 
+void parquet_metadata_bound(struct dom_token *token, i32 data_type, const struct parquet_binary *bound) {
+  u32 size;
+  i64 nanoseconds;
+
+  // every bound is a single literal
+  token->op = DOM_OP_LITERAL;
+
+  // plain encoded bounds of the fixed size types are written typed, sizes not matching fall back to hex digits
+  if (data_type == PARQUET_DATA_TYPE_BOOLEAN && bound->size == 1) {
+    token->type = DOM_TYPE_BOOL;
+    token->data = *bound->ptr != 0;
+  } else if (data_type == PARQUET_DATA_TYPE_INT32 && bound->size == sizeof(i32)) {
+    token->type = DOM_TYPE_I32;
+    token->data = (u64) * (const i32 *)bound->ptr;
+  } else if (data_type == PARQUET_DATA_TYPE_INT64 && bound->size == sizeof(i64)) {
+    token->type = DOM_TYPE_I64;
+    token->data = (u64) * (const i64 *)bound->ptr;
+  } else if (data_type == PARQUET_DATA_TYPE_INT96 && bound->size == 12) {
+    parquet_convert_int96(bound->ptr, 1, &nanoseconds);
+    token->type = DOM_TYPE_I64;
+    token->data = (u64)nanoseconds;
+  } else if (data_type == PARQUET_DATA_TYPE_FLOAT && bound->size == sizeof(f32)) {
+    token->type = DOM_TYPE_F32;
+    token->data = *(const u32 *)bound->ptr;
+  } else if (data_type == PARQUET_DATA_TYPE_DOUBLE && bound->size == sizeof(f64)) {
+    token->type = DOM_TYPE_F64;
+    token->data = *(const u64 *)bound->ptr;
+  } else {
+    // the bytes stay in the footer, longer values are cut to what a token can address
+    size = bound->size < 0xffff ? bound->size : 0xffff;
+
+    token->type = data_type == PARQUET_DATA_TYPE_BYTE_ARRAY ? DOM_TYPE_ASCII : DOM_TYPE_BINARY;
+    token->data = ((u64)size << 48) | (u64)bound->ptr;
+  }
+}
+
+static i64 parquet_dump_bound_value(struct parquet_metadata_iterator *iterator, u32 index, i32 data_type) {
+  const struct parquet_binary *bound;
+
+  // check for the capacity, we need only 1 slot
+  if (iterator->tokens.count > iterator->tokens.capacity - 1) {
+    return PARQUET_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  // the same literal as any other command shows
+  bound = (const struct parquet_binary *)iterator->queue.items[index].ctx;
+  parquet_metadata_bound(&iterator->tokens.items[iterator->tokens.count++], data_type, bound);
+
+  // success
+  return 0;
+}
+
+static i64 parquet_dump_bound_boolean(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_BOOLEAN);
+}
+
+static i64 parquet_dump_bound_int32(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_INT32);
+}
+
+static i64 parquet_dump_bound_int64(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_INT64);
+}
+
+static i64 parquet_dump_bound_int96(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_INT96);
+}
+
+static i64 parquet_dump_bound_float(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_FLOAT);
+}
+
+static i64 parquet_dump_bound_double(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_DOUBLE);
+}
+
+static i64 parquet_dump_bound_byte_array(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_BYTE_ARRAY);
+}
+
+static i64 parquet_dump_bound_byte_array_fixed(struct parquet_metadata_iterator *iterator, u32 index) {
+  return parquet_dump_bound_value(iterator, index, PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED);
+}
+
+static const parquet_metadata_iterator_fn PARQUET_DUMP_BOUND_FN[PARQUET_DATA_TYPE_SIZE] = {
+  [PARQUET_DATA_TYPE_BOOLEAN] = parquet_dump_bound_boolean,
+  [PARQUET_DATA_TYPE_INT32] = parquet_dump_bound_int32,
+  [PARQUET_DATA_TYPE_INT64] = parquet_dump_bound_int64,
+  [PARQUET_DATA_TYPE_INT96] = parquet_dump_bound_int96,
+  [PARQUET_DATA_TYPE_FLOAT] = parquet_dump_bound_float,
+  [PARQUET_DATA_TYPE_DOUBLE] = parquet_dump_bound_double,
+  [PARQUET_DATA_TYPE_BYTE_ARRAY] = parquet_dump_bound_byte_array,
+  [PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED] = parquet_dump_bound_byte_array_fixed,
+};
+
+static i64 parquet_dump_bool(struct parquet_metadata_iterator *iterator, u32 index) {
+  // check for the capacity, we need only 1 slot
+  if (iterator->tokens.count > iterator->tokens.capacity - 1) {
+    return PARQUET_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  // booleans are typed, each output decides how to write them
+  iterator->tokens.items[iterator->tokens.count].op = DOM_OP_LITERAL;
+  iterator->tokens.items[iterator->tokens.count].data = *(bool *)iterator->queue.items[index].ctx ? 1 : 0;
+  iterator->tokens.items[iterator->tokens.count++].type = DOM_TYPE_BOOL;
+
+  // success
+  return 0;
+}
+
 static i64 parquet_dump_struct_open(struct parquet_metadata_iterator *iterator, u32 index) {
   // check for the capacity, we need only one slot
   if (iterator->tokens.count > iterator->tokens.capacity - 1) {
@@ -481,11 +592,143 @@ static i64 parquet_dump_encoding_stats(struct parquet_metadata_iterator *iterato
   return 0;
 }
 
+static void parquet_dump_bound(struct parquet_metadata_iterator *iterator,
+                               struct parquet_binary *bound,
+                               const char *name,
+                               i32 data_type) {
+  const char *item_name;
+  parquet_metadata_iterator_fn item_fn;
+  struct dom_token token;
+
+  // the literal tells the name of the value, it is built again when the value is written
+  parquet_metadata_bound(&token, data_type, bound);
+
+  switch (token.type) {
+    case DOM_TYPE_BOOL:
+      item_name = "bool";
+      break;
+    case DOM_TYPE_I32:
+      item_name = "i32";
+      break;
+    case DOM_TYPE_I64:
+      item_name = "i64";
+      break;
+    case DOM_TYPE_F32:
+      item_name = "f32";
+      break;
+    case DOM_TYPE_F64:
+      item_name = "f64";
+      break;
+    case DOM_TYPE_ASCII:
+      item_name = "str";
+      break;
+    default:
+      item_name = "binary";
+      break;
+  }
+
+  // unknown physical types are only bytes
+  if (data_type >= 0 && data_type < PARQUET_DATA_TYPE_SIZE) {
+    item_fn = PARQUET_DUMP_BOUND_FN[data_type];
+  } else {
+    item_fn = parquet_dump_bound_byte_array_fixed;
+  }
+
+  iterator->queue.items[iterator->queue.count].ctx = bound;
+  iterator->queue.items[iterator->queue.count].ctx_args.name = name;
+  iterator->queue.items[iterator->queue.count].ctx_fn = parquet_dump_field;
+  iterator->queue.items[iterator->queue.count].item_args.name = item_name;
+  iterator->queue.items[iterator->queue.count++].item_fn = item_fn;
+}
+
+static i64 parquet_dump_statistics(struct parquet_metadata_iterator *iterator, u32 index) {
+  struct parquet_column_meta *column_meta;
+  struct parquet_column_statistics *statistics;
+
+  // check for the capacity, we need 10 slots in the queue
+  if (iterator->queue.count > iterator->queue.capacity - 10) {
+    return PARQUET_ERROR_CAPACITY_OVERFLOW;
+  }
+
+  // get the value, the bounds are encoded like the values of the column
+  column_meta = (struct parquet_column_meta *)iterator->queue.items[index].ctx;
+  statistics = column_meta->statistics;
+
+  // close-struct
+  iterator->queue.items[iterator->queue.count].ctx = statistics;
+  iterator->queue.items[iterator->queue.count].ctx_args.name = "statistics";
+  iterator->queue.items[iterator->queue.count++].ctx_fn = parquet_dump_struct_close;
+
+  // is_min_value_exact, an absent flag cannot be told from false, so only exact values are marked
+  if (statistics->is_min_value_exact) {
+    iterator->queue.items[iterator->queue.count].ctx = &statistics->is_min_value_exact;
+    iterator->queue.items[iterator->queue.count].ctx_args.name = "is_min_value_exact";
+    iterator->queue.items[iterator->queue.count].ctx_fn = parquet_dump_field;
+    iterator->queue.items[iterator->queue.count].item_args.name = "bool";
+    iterator->queue.items[iterator->queue.count++].item_fn = parquet_dump_bool;
+  }
+
+  // is_max_value_exact, an absent flag cannot be told from false, so only exact values are marked
+  if (statistics->is_max_value_exact) {
+    iterator->queue.items[iterator->queue.count].ctx = &statistics->is_max_value_exact;
+    iterator->queue.items[iterator->queue.count].ctx_args.name = "is_max_value_exact";
+    iterator->queue.items[iterator->queue.count].ctx_fn = parquet_dump_field;
+    iterator->queue.items[iterator->queue.count].item_args.name = "bool";
+    iterator->queue.items[iterator->queue.count++].item_fn = parquet_dump_bool;
+  }
+
+  // min_value
+  if (statistics->min_value.ptr != PARQUET_NULL_VALUE) {
+    parquet_dump_bound(iterator, &statistics->min_value, "min_value", column_meta->data_type);
+  }
+
+  // max_value
+  if (statistics->max_value.ptr != PARQUET_NULL_VALUE) {
+    parquet_dump_bound(iterator, &statistics->max_value, "max_value", column_meta->data_type);
+  }
+
+  // distinct_count
+  if (statistics->distinct_count != PARQUET_UNKNOWN_VALUE) {
+    iterator->queue.items[iterator->queue.count].ctx = &statistics->distinct_count;
+    iterator->queue.items[iterator->queue.count].ctx_args.name = "distinct_count";
+    iterator->queue.items[iterator->queue.count].ctx_fn = parquet_dump_field;
+    iterator->queue.items[iterator->queue.count].item_args.name = "i64";
+    iterator->queue.items[iterator->queue.count++].item_fn = parquet_dump_i64;
+  }
+
+  // null_count
+  if (statistics->null_count != PARQUET_UNKNOWN_VALUE) {
+    iterator->queue.items[iterator->queue.count].ctx = &statistics->null_count;
+    iterator->queue.items[iterator->queue.count].ctx_args.name = "null_count";
+    iterator->queue.items[iterator->queue.count].ctx_fn = parquet_dump_field;
+    iterator->queue.items[iterator->queue.count].item_args.name = "i64";
+    iterator->queue.items[iterator->queue.count++].item_fn = parquet_dump_i64;
+  }
+
+  // min, deprecated
+  if (statistics->min.ptr != PARQUET_NULL_VALUE) {
+    parquet_dump_bound(iterator, &statistics->min, "min", column_meta->data_type);
+  }
+
+  // max, deprecated
+  if (statistics->max.ptr != PARQUET_NULL_VALUE) {
+    parquet_dump_bound(iterator, &statistics->max, "max", column_meta->data_type);
+  }
+
+  // open-struct
+  iterator->queue.items[iterator->queue.count].ctx = statistics;
+  iterator->queue.items[iterator->queue.count].ctx_args.name = "statistics";
+  iterator->queue.items[iterator->queue.count++].ctx_fn = parquet_dump_struct_open;
+
+  // success
+  return 0;
+}
+
 static i64 parquet_dump_column_meta(struct parquet_metadata_iterator *iterator, u32 index) {
   struct parquet_column_meta *column_meta;
 
-  // check for the capacity, we need 13 slots in the queue
-  if (iterator->queue.count > iterator->queue.capacity - 13) {
+  // check for the capacity, we need 14 slots in the queue
+  if (iterator->queue.count > iterator->queue.capacity - 14) {
     return PARQUET_ERROR_CAPACITY_OVERFLOW;
   }
 
@@ -506,6 +749,15 @@ static i64 parquet_dump_column_meta(struct parquet_metadata_iterator *iterator,
     iterator->queue.items[iterator->queue.count++].item_fn = parquet_dump_encoding_stats;
   }
 
+  // statistics
+  if (column_meta->statistics != PARQUET_NULL_VALUE) {
+    iterator->queue.items[iterator->queue.count].ctx = column_meta;
+    iterator->queue.items[iterator->queue.count].ctx_args.name = "statistics";
+    iterator->queue.items[iterator->queue.count].ctx_fn = parquet_dump_field;
+    iterator->queue.items[iterator->queue.count].item_args.name = "struct";
+    iterator->queue.items[iterator->queue.count++].item_fn = parquet_dump_statistics;
+  }
+
   // dictionary_page_offset
   if (column_meta->dictionary_page_offset != PARQUET_UNKNOWN_VALUE) {
     iterator->queue.items[iterator->queue.count].ctx = &column_meta->dictionary_page_offset;
@@ -1633,6 +1885,44 @@ static void can_detect_capacity_overflow_with_field() {
   assert(result == PARQUET_ERROR_CAPACITY_OVERFLOW, "should fail with PARQUET_ERROR_CAPACITY_OVERFLOW");
 }
 
+static void can_build_typed_bound_literals() {
+  struct dom_token token;
+  struct parquet_binary bound;
+  char buffer[DOM_REAL_SIZE];
+
+  const i32 integer = -7;
+  const f64 real = 0.42;
+  const char text[] = "abc";
+
+  // plain encoded integers are decoded
+  bound.ptr = (const char *)&integer;
+  bound.size = sizeof(integer);
+  parquet_metadata_bound(&token, PARQUET_DATA_TYPE_INT32, &bound);
+
+  assert(token.op == DOM_OP_LITERAL, "should build a literal");
+  assert(token.type == DOM_TYPE_I32, "should build an i32 literal");
+  assert((i64)token.data == -7, "should keep the sign");
+
+  // reals keep their bits and read back with the fewest digits
+  bound.ptr = (const char *)&real;
+  bound.size = sizeof(real);
+  parquet_metadata_bound(&token, PARQUET_DATA_TYPE_DOUBLE, &bound);
+
+  assert(token.type == DOM_TYPE_F64, "should build an f64 literal");
+  assert_eq_str(dom_real(&token, buffer), "0.42", "should format the double");
+
+  // texts and sizes not matching the type reference the bytes
+  bound.ptr = text;
+  bound.size = 3;
+  parquet_metadata_bound(&token, PARQUET_DATA_TYPE_BYTE_ARRAY, &bound);
+
+  assert(token.type == DOM_TYPE_ASCII, "should build an ascii literal");
+  assert(token.data == (((u64)3 << 48) | (u64)text), "should reference the text");
+
+  parquet_metadata_bound(&token, PARQUET_DATA_TYPE_DOUBLE, &bound);
+  assert(token.type == DOM_TYPE_BINARY, "should fall back to hex digits");
+}
+
 void parquet_test_cases_iter(struct runner_context *ctx) {
   test_case(ctx, "can iterate through metadata", can_iterate_through_metadata);
   test_case(ctx, "can dump enum with known value", can_dump_enum_with_known_value);
@@ -1657,6 +1947,8 @@ void parquet_test_cases_iter(struct runner_context *ctx) {
   test_case(ctx, "can dumo field with type id", can_dump_field_with_type_id);
   test_case(ctx, "can detect buffer too small with field", can_detect_buffer_too_small_with_field);
   test_case(ctx, "can detect capacity overflow with field", can_detect_capacity_overflow_with_field);
+
+  test_case(ctx, "can build typed bound literals", can_build_typed_bound_literals);
 }
 
 #endif
@@ -60,8 +60,17 @@ extern void parquet_metadata_iter(struct parquet_metadata_iterator *iterator, st
 /// @return Zero on success, or a negative error code.
 extern i64 parquet_metadata_next(struct parquet_metadata_iterator *iterator);
 
+/// @brief Builds the literal every command shows for a plain encoded statistics bound.
+/// @param token Pointer to the dom_token receiving the literal.
+/// @param data_type Physical type of the column the bound belongs to.
+/// @param bound Pointer to the bound, texts and hex digits keep referencing its bytes.
+extern void parquet_metadata_bound(struct dom_token *token, i32 data_type, const struct parquet_binary *bound);
+
+extern const char *const PARQUET_COMPRESSION_NAMES[PARQUET_COMPRESSION_SIZE];
 extern const char *const PARQUET_CONVERTED_TYPE_NAMES[PARQUET_CONVERTED_TYPE_SIZE];
 extern const char *const PARQUET_DATA_TYPE_NAMES[PARQUET_DATA_TYPE_SIZE];
+extern const char *const PARQUET_ENCODING_NAMES[PARQUET_ENCODING_SIZE];
+extern const char *const PARQUET_PAGE_TYPE_NAMES[PARQUET_PAGE_TYPE_SIZE];
 extern const char *const PARQUET_REPETITION_TYPE_NAMES[PARQUET_REPETITION_TYPE_SIZE];
 
 #if defined(I13C_TESTS)
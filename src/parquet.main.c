@@ -1,4 +1,7 @@
 #include "argv.h"
+#include "parquet.bench.h"
+#include "parquet.cat.h"
+#include "parquet.count.h"
 #include "parquet.extract.h"
 #include "parquet.show.h"
 #include "stderr.h"
@@ -12,10 +15,34 @@
 #define CMD_SHOW_SCHEMA_ID CMD_SHOW_ID + 1
 #define CMD_SHOW_SCHEMA "show-schema"
 
-#define CMD_EXTRACT_ID CMD_SHOW_SCHEMA_ID + 1
+#define CMD_SHOW_PAGES_ID CMD_SHOW_SCHEMA_ID + 1
+#define CMD_SHOW_PAGES "show-pages"
+
+#define CMD_SHOW_COLUMNS_ID CMD_SHOW_PAGES_ID + 1
+#define CMD_SHOW_COLUMNS "show-columns"
+
+#define CMD_EXTRACT_ID CMD_SHOW_COLUMNS_ID + 1
 #define CMD_EXTRACT "extract-metadata"
 
-#define CMD_LAST_ID CMD_EXTRACT_ID + 1
+#define CMD_BENCH_RLE_ID CMD_EXTRACT_ID + 1
+#define CMD_BENCH_RLE "bench-rle"
+
+#define CMD_BENCH_SPLIT_ID CMD_BENCH_RLE_ID + 1
+#define CMD_BENCH_SPLIT "bench-split"
+
+#define CMD_BENCH_SNAPPY_ID CMD_BENCH_SPLIT_ID + 1
+#define CMD_BENCH_SNAPPY "bench-snappy"
+
+#define CMD_BENCH_GZIP_ID CMD_BENCH_SNAPPY_ID + 1
+#define CMD_BENCH_GZIP "bench-gzip"
+
+#define CMD_CAT_ID CMD_BENCH_GZIP_ID + 1
+#define CMD_CAT "cat"
+
+#define CMD_COUNT_ID CMD_CAT_ID + 1
+#define CMD_COUNT "count"
+
+#define CMD_LAST_ID CMD_COUNT_ID + 1
 
 i32 parquet_main(u32 argc, const char **argv) {
   i64 result;
@@ -28,13 +55,29 @@ i32 parquet_main(u32 argc, const char **argv) {
   // first, names
   names[CMD_SHOW_ID] = CMD_SHOW;
   names[CMD_SHOW_SCHEMA_ID] = CMD_SHOW_SCHEMA;
+  names[CMD_SHOW_PAGES_ID] = CMD_SHOW_PAGES;
+  names[CMD_SHOW_COLUMNS_ID] = CMD_SHOW_COLUMNS;
   names[CMD_EXTRACT_ID] = CMD_EXTRACT;
+  names[CMD_BENCH_RLE_ID] = CMD_BENCH_RLE;
+  names[CMD_BENCH_SPLIT_ID] = CMD_BENCH_SPLIT;
+  names[CMD_BENCH_SNAPPY_ID] = CMD_BENCH_SNAPPY;
+  names[CMD_BENCH_GZIP_ID] = CMD_BENCH_GZIP;
+  names[CMD_CAT_ID] = CMD_CAT;
+  names[CMD_COUNT_ID] = CMD_COUNT;
   names[CMD_LAST_ID] = NULL;
 
   // then, commands
   commands[CMD_SHOW_ID] = parquet_show;
   commands[CMD_SHOW_SCHEMA_ID] = parquet_show_schema;
+  commands[CMD_SHOW_PAGES_ID] = parquet_show_pages;
+  commands[CMD_SHOW_COLUMNS_ID] = parquet_show_columns;
   commands[CMD_EXTRACT_ID] = parquet_extract;
+  commands[CMD_BENCH_RLE_ID] = parquet_bench_rle;
+  commands[CMD_BENCH_SPLIT_ID] = parquet_bench_split;
+  commands[CMD_BENCH_SNAPPY_ID] = parquet_bench_snappy;
+  commands[CMD_BENCH_GZIP_ID] = parquet_bench_gzip;
+  commands[CMD_CAT_ID] = parquet_cat;
+  commands[CMD_COUNT_ID] = parquet_count;
 
   // match the command
   result = argv_match(argc, argv, names, &selected);
@@ -0,0 +1,639 @@
+#include "parquet.nested.h"
+#include "argv.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.page.h"
+#include "parquet.parse.h"
+#include "parquet.rle.h"
+#include "parquet.schema.open.h"
+#include "runner.h"
+#include "typing.h"
+
+static u64 parquet_nested_offsets_size(const struct parquet_nested *nested) {
+  // count + 1 offsets, padded to keep the validity aligned
+  return (((u64)nested->capacity + 1) * sizeof(u32) + 7) & ~7ull;
+}
+
+static u64 parquet_nested_validity_size(const struct parquet_nested *nested) {
+  // one bit per slot, in whole words to be cleared quickly
+  return ((u64)nested->capacity + 63) / 64 * 8;
+}
+
+static void parquet_nested_clear(struct parquet_nested *nested, struct parquet_nested_level *level) {
+  u64 index, size;
+
+  // only optional nodes have a bitmap
+  if (level->validity == NULL) return;
+
+  // the bits are or-ed in, so they start cleared
+  size = parquet_nested_validity_size(nested) / 8;
+  for (index = 0; index < size; index++) {
+    ((u64 *)level->validity)[index] = 0;
+  }
+}
+
+i64 parquet_nested_init(struct parquet_nested *nested,
+                        struct malloc_pool *pool,
+                        const struct parquet_schema *schema,
+                        char **path,
+                        u32 capacity) {
+  i64 result;
+  u64 index, size;
+  struct parquet_nested_level *level;
+
+  // defaults
+  nested->depth = 0;
+  nested->max_definition = 0;
+  nested->max_repetition = 0;
+  nested->entries = 0;
+  nested->values = 0;
+  nested->capacity = capacity;
+
+  // walk the path from the root down to the leaf
+  for (; *path != NULL; path++) {
+    if (nested->depth >= PARQUET_NESTED_MAX_DEPTH) {
+      result = PARQUET_ERROR_LIMITS_REACHED;
+      goto cleanup;
+    }
+
+    // find the child named by the path
+    for (index = 0; index < schema->children.count; index++) {
+      if (argv_equals(schema->children.elements[index]->name, *path)) break;
+    }
+
+    result = PARQUET_ERROR_INVALID_SCHEMA;
+    if (index == schema->children.count) goto cleanup;
+
+    schema = schema->children.elements[index];
+    level = &nested->levels[nested->depth++];
+
+    // the node lives in the slots of the closest repeated ancestor
+    level->name = schema->name;
+    level->repeated_type = schema->repeated_type;
+    level->space = nested->max_repetition;
+    level->floor = nested->depth > 1 ? nested->levels[nested->depth - 2].floor : 0;
+    level->count = 0;
+    level->nulls = 0;
+    level->offsets = NULL;
+    level->validity = NULL;
+    level->lease.ptr = NULL;
+
+    // a repeated parent opens the slots of its elements
+    if (nested->depth > 1 && nested->levels[nested->depth - 2].repeated_type == PARQUET_REPETITION_TYPE_REPEATED) {
+      level->floor = nested->levels[nested->depth - 2].definition;
+    }
+
+    switch (schema->repeated_type) {
+      case PARQUET_REPETITION_TYPE_REQUIRED:
+        size = 0;
+        break;
+      case PARQUET_REPETITION_TYPE_OPTIONAL:
+        size = parquet_nested_validity_size(nested);
+        nested->max_definition++;
+        break;
+      case PARQUET_REPETITION_TYPE_REPEATED:
+        size = parquet_nested_offsets_size(nested);
+        nested->max_definition++;
+        nested->max_repetition++;
+        break;
+      default:
+        result = PARQUET_ERROR_INVALID_SCHEMA;
+        goto cleanup;
+    }
+
+    level->definition = nested->max_definition;
+    if (size == 0) continue;
+
+    level->lease.size = malloc_fit(size);
+    result = malloc_acquire(pool, &level->lease);
+    if (result < 0) goto cleanup;
+
+    // offsets of repeated nodes and bits of optional ones
+    if (schema->repeated_type == PARQUET_REPETITION_TYPE_REPEATED) {
+      level->offsets = level->lease.ptr;
+      level->offsets[0] = 0;
+    } else {
+      level->validity = level->lease.ptr;
+      parquet_nested_clear(nested, level);
+    }
+  }
+
+  // the path must end at a leaf
+  result = PARQUET_ERROR_INVALID_SCHEMA;
+  if (nested->depth == 0 || schema->children.count > 0) goto cleanup;
+
+  // success
+  return 0;
+
+cleanup:
+  parquet_nested_release(nested, pool);
+  return result;
+}
+
+static void parquet_nested_required(struct parquet_nested_level *level,
+                                    const u32 *repetition,
+                                    const u32 *definition,
+                                    u32 count) {
+  u32 index, slots;
+
+  // every slot holds the node
+  for (index = 0, slots = level->count; index < count; index++) {
+    slots += (repetition[index] <= level->space) & (definition[index] >= level->floor);
+  }
+
+  level->count = slots;
+}
+
+static void parquet_nested_optional(struct parquet_nested_level *level,
+                                    const u32 *repetition,
+                                    const u32 *definition,
+                                    u32 count) {
+  u32 index, slots, present, created, valid;
+
+  // every slot sets its bit when the node is defined
+  for (index = 0, slots = level->count, present = 0; index < count; index++) {
+    created = (repetition[index] <= level->space) & (definition[index] >= level->floor);
+    valid = created & (definition[index] >= level->definition);
+
+    level->validity[slots >> 3] |= (u8)(valid << (slots & 7));
+    present += valid;
+    slots += created;
+  }
+
+  level->nulls += slots - level->count - present;
+  level->count = slots;
+}
+
+static void parquet_nested_repeated(struct parquet_nested_level *level,
+                                    const u32 *repetition,
+                                    const u32 *definition,
+                                    u32 count) {
+  u32 index, slots, elements;
+
+  // the offsets continue from the end of the previous call
+  slots = level->count;
+  elements = level->offsets[slots];
+
+  // every slot opens a list, every element extends the last one
+  for (index = 0; index < count; index++) {
+    level->offsets[slots] = elements;
+    slots += (repetition[index] <= level->space) & (definition[index] >= level->floor);
+    elements += (repetition[index] <= level->space + 1) & (definition[index] >= level->definition);
+  }
+
+  // the end of the last list
+  level->offsets[slots] = elements;
+  level->count = slots;
+}
+
+i64 parquet_nested_assemble(struct parquet_nested *nested, const u32 *repetition, const u32 *definition, u32 count) {
+  u32 index, depth, values, invalid, level;
+  u32 floors[PARQUET_NESTED_MAX_DEPTH + 1];
+
+  // each pair creates at most one slot per level
+  if (count > nested->capacity - nested->entries) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // the definition level at which each repetition level exists
+  for (depth = 0, floors[0] = 0; depth < nested->depth; depth++) {
+    if (nested->levels[depth].repeated_type == PARQUET_REPETITION_TYPE_REPEATED) {
+      floors[nested->levels[depth].space + 1] = nested->levels[depth].definition;
+    }
+  }
+
+  // the first pair must start a record
+  if (nested->entries == 0 && count > 0 && repetition[0] != 0) return PARQUET_ERROR_INVALID_VALUE;
+
+  // validate all pairs before touching any level
+  for (index = 0, values = 0, invalid = 0; index < count; index++) {
+    level = repetition[index] <= nested->max_repetition ? repetition[index] : 0;
+
+    invalid |= repetition[index] > nested->max_repetition;
+    invalid |= definition[index] > nested->max_definition;
+    invalid |= definition[index] < floors[level];
+    values += definition[index] == nested->max_definition;
+  }
+
+  if (invalid) return PARQUET_ERROR_INVALID_VALUE;
+
+  // then one pass per level
+  for (depth = 0; depth < nested->depth; depth++) {
+    switch (nested->levels[depth].repeated_type) {
+      case PARQUET_REPETITION_TYPE_OPTIONAL:
+        parquet_nested_optional(&nested->levels[depth], repetition, definition, count);
+        break;
+      case PARQUET_REPETITION_TYPE_REPEATED:
+        parquet_nested_repeated(&nested->levels[depth], repetition, definition, count);
+        break;
+      default:
+        parquet_nested_required(&nested->levels[depth], repetition, definition, count);
+        break;
+    }
+  }
+
+  // success
+  nested->entries += count;
+  nested->values += values;
+  return 0;
+}
+
+void parquet_nested_reset(struct parquet_nested *nested) {
+  u32 depth;
+
+  for (depth = 0; depth < nested->depth; depth++) {
+    nested->levels[depth].count = 0;
+    nested->levels[depth].nulls = 0;
+
+    // the offsets start over and the bits are cleared
+    if (nested->levels[depth].offsets != NULL) nested->levels[depth].offsets[0] = 0;
+    parquet_nested_clear(nested, &nested->levels[depth]);
+  }
+
+  nested->entries = 0;
+  nested->values = 0;
+}
+
+void parquet_nested_release(struct parquet_nested *nested, struct malloc_pool *pool) {
+  u32 depth;
+
+  for (depth = 0; depth < nested->depth; depth++) {
+    // release the arrays if any
+    if (nested->levels[depth].lease.ptr != NULL) {
+      malloc_release(pool, &nested->levels[depth].lease);
+    }
+
+    nested->levels[depth].offsets = NULL;
+    nested->levels[depth].validity = NULL;
+  }
+}
+
+#if defined(I13C_TESTS)
+
+static void can_assemble_nested_list() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_nested nested;
+  struct parquet_schema root, list, repeated, element;
+  struct parquet_schema *root_children[] = {&list, NULL};
+  struct parquet_schema *list_children[] = {&repeated, NULL};
+  struct parquet_schema *repeated_children[] = {&element, NULL};
+
+  // records [1, null, 2], null, [] and [3]
+  const u32 repetition[] = {0, 1, 1, 0, 0, 0};
+  const u32 definition[] = {3, 2, 3, 0, 1, 3};
+
+  char *path[] = {"values", "list", "element", NULL};
+
+  // optional group values (LIST) { repeated group list { optional int32 element } }
+  root = (struct parquet_schema){.name = "schema", .children = {1, root_children}};
+  list = (struct parquet_schema){
+    .name = "values",
+    .children = {1, list_children},
+    .repeated_type = PARQUET_REPETITION_TYPE_OPTIONAL,
+  };
+  repeated = (struct parquet_schema){
+    .name = "list",
+    .children = {1, repeated_children},
+    .repeated_type = PARQUET_REPETITION_TYPE_REPEATED,
+  };
+  element = (struct parquet_schema){
+    .name = "element",
+    .children = {0, NULL},
+    .repeated_type = PARQUET_REPETITION_TYPE_OPTIONAL,
+  };
+
+  // initialize the pool and the assembly
+  malloc_init(&pool);
+
+  result = parquet_nested_init(&nested, &pool, &root, path, 16);
+  assert(result == 0, "should initialize nested assembly");
+  assert(nested.depth == 3, "should have three levels");
+  assert(nested.max_definition == 3, "should have max definition level 3");
+  assert(nested.max_repetition == 1, "should have max repetition level 1");
+
+  // assemble the records in two calls
+  result = parquet_nested_assemble(&nested, repetition, definition, 4);
+  assert(result == 0, "should assemble the first records");
+
+  result = parquet_nested_assemble(&nested, repetition + 4, definition + 4, 2);
+  assert(result == 0, "should assemble the remaining records");
+
+  // one list per record, one of them null
+  assert(nested.levels[0].count == 4, "should have four lists");
+  assert(nested.levels[0].nulls == 1, "should have one null list");
+  assert(nested.levels[0].validity[0] == 0x0d, "should mark the second list as null");
+
+  // the lists span the elements
+  assert(nested.levels[1].count == 4, "should have four offsets ranges");
+  assert(nested.levels[1].offsets[0] == 0, "first list should start at 0");
+  assert(nested.levels[1].offsets[1] == 3, "second list should start at 3");
+  assert(nested.levels[1].offsets[2] == 3, "third list should start at 3");
+  assert(nested.levels[1].offsets[3] == 3, "fourth list should start at 3");
+  assert(nested.levels[1].offsets[4] == 4, "fourth list should end at 4");
+
+  // one element is null
+  assert(nested.levels[2].count == 4, "should have four elements");
+  assert(nested.levels[2].nulls == 1, "should have one null element");
+  assert(nested.levels[2].validity[0] == 0x0d, "should mark the second element as null");
+  assert(nested.values == 3, "should have three values");
+
+  // release everything
+  parquet_nested_release(&nested, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_assemble_nested_map() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_nested nested;
+  struct parquet_schema root, map, entries, key, value;
+  struct parquet_schema *root_children[] = {&map, NULL};
+  struct parquet_schema *map_children[] = {&entries, NULL};
+  struct parquet_schema *entries_children[] = {&key, &value, NULL};
+
+  // records {a: 1, b: null}, {} and {c: 5}
+  const u32 repetition[] = {0, 1, 0, 0};
+  const u32 definition[] = {2, 1, 0, 2};
+
+  char *path[] = {"attributes", "key_value", "value", NULL};
+
+  // required group attributes (MAP) { repeated group key_value { required key; optional int32 value } }
+  root = (struct parquet_schema){.name = "schema", .children = {1, root_children}};
+  map = (struct parquet_schema){
+    .name = "attributes",
+    .children = {1, map_children},
+    .repeated_type = PARQUET_REPETITION_TYPE_REQUIRED,
+  };
+  entries = (struct parquet_schema){
+    .name = "key_value",
+    .children = {2, entries_children},
+    .repeated_type = PARQUET_REPETITION_TYPE_REPEATED,
+  };
+  key = (struct parquet_schema){
+    .name = "key",
+    .children = {0, NULL},
+    .repeated_type = PARQUET_REPETITION_TYPE_REQUIRED,
+  };
+  value = (struct parquet_schema){
+    .name = "value",
+    .children = {0, NULL},
+    .repeated_type = PARQUET_REPETITION_TYPE_OPTIONAL,
+  };
+
+  // initialize the pool and the assembly
+  malloc_init(&pool);
+
+  result = parquet_nested_init(&nested, &pool, &root, path, 16);
+  assert(result == 0, "should initialize nested assembly");
+  assert(nested.max_definition == 2, "should have max definition level 2");
+
+  // assemble the records
+  result = parquet_nested_assemble(&nested, repetition, definition, 4);
+  assert(result == 0, "should assemble the records");
+
+  // the map itself is never null
+  assert(nested.levels[0].count == 3, "should have three maps");
+  assert(nested.levels[0].validity == NULL, "should have no bitmap for required map");
+
+  // the entries of each map
+  assert(nested.levels[1].offsets[0] == 0, "first map should start at 0");
+  assert(nested.levels[1].offsets[1] == 2, "second map should start at 2");
+  assert(nested.levels[1].offsets[2] == 2, "third map should start at 2");
+  assert(nested.levels[1].offsets[3] == 3, "third map should end at 3");
+
+  // one value is null
+  assert(nested.levels[2].count == 3, "should have three values");
+  assert(nested.levels[2].validity[0] == 0x05, "should mark the second value as null");
+
+  // release everything
+  parquet_nested_release(&nested, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_assemble_nested_lists_of_structs() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_schema schema;
+  struct parquet_nested nested;
+
+  // records [{ids: [x, null]}, null, {ids: null}, {ids: []}], null and []
+  const u32 repetition[] = {0, 2, 1, 1, 1, 0, 0};
+  const u32 definition[] = {6, 5, 2, 3, 4, 0, 1};
+
+  char *path[] = {"bidderrequests", "list", "element", "useridproviders", "list", "element", NULL};
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file with nested lists
+  result = parquet_open(&file, "data/test03.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  result = parquet_open_schema(&file.arena, metadata.schemas, &schema);
+  assert(result == 0, "should open schema");
+
+  // resolve the list nested in the list of structs
+  result = parquet_nested_init(&nested, &pool, &schema, path, 64);
+  assert(result == 0, "should initialize nested assembly");
+  assert(nested.depth == 6, "should have six levels");
+  assert(nested.max_definition == 6, "should have max definition level 6");
+  assert(nested.max_repetition == 2, "should have max repetition level 2");
+
+  // assemble the records
+  result = parquet_nested_assemble(&nested, repetition, definition, 7);
+  assert(result == 0, "should assemble the records");
+
+  // the outer lists
+  assert(nested.levels[0].validity[0] == 0x05, "should mark the second outer list as null");
+  assert(nested.levels[1].offsets[1] == 4, "first outer list should hold four structs");
+  assert(nested.levels[1].offsets[3] == 4, "other outer lists should be empty");
+
+  // the structs and their inner lists
+  assert(nested.levels[2].count == 4, "should have four structs");
+  assert(nested.levels[2].validity[0] == 0x0d, "should mark the second struct as null");
+  assert(nested.levels[3].validity[0] == 0x09, "should mark two inner lists as null");
+  assert(nested.levels[4].offsets[1] == 2, "first inner list should hold two elements");
+  assert(nested.levels[4].offsets[4] == 2, "other inner lists should be empty");
+
+  // the elements
+  assert(nested.levels[5].count == 2, "should have two elements");
+  assert(nested.levels[5].validity[0] == 0x01, "should mark the second element as null");
+  assert(nested.values == 1, "should have one value");
+
+  // release everything
+  parquet_nested_release(&nested, &pool);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_assemble_nested_column_chunk() {
+  i64 result;
+  u64 offset;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct malloc_lease levels;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_schema schema;
+  struct parquet_column_meta *meta;
+  struct parquet_pages pages;
+  struct parquet_page page;
+  struct parquet_rle rle;
+  struct parquet_nested nested;
+
+  u32 *repetition, *definition;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file with nested lists
+  result = parquet_open(&file, "data/test03.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  result = parquet_open_schema(&file.arena, metadata.schemas, &schema);
+  assert(result == 0, "should open schema");
+
+  // the list of identifiers nested in the list of bidder requests
+  meta = metadata.row_groups[0]->columns[10]->meta;
+
+  result = parquet_nested_init(&nested, &pool, &schema, meta->path_in_schema, (u32)meta->num_values);
+  assert(result == 0, "should initialize nested assembly");
+  assert(nested.max_repetition == 2, "should have max repetition level 2");
+
+  // room for both levels of the largest page
+  levels.size = 262144;
+  result = malloc_acquire(&pool, &levels);
+  assert(result == 0, "should allocate levels");
+
+  repetition = levels.ptr;
+  definition = repetition + levels.size / sizeof(u32) / 2;
+
+  result = parquet_pages_init(&pages, &file, meta, TRUE);
+  assert(result == 0, "should read column chunk");
+
+  // decode the levels of every data page
+  while ((result = parquet_pages_next(&pages, &page)) == 1) {
+    if (page.header.type != PARQUET_PAGE_TYPE_DATA_PAGE) continue;
+    assert(page.header.data.num_values <= (i32)(levels.size / sizeof(u32) / 2), "should fit the levels");
+
+    result = parquet_pages_decompress(&pages, &page, &data);
+    assert(result == page.header.uncompressed_page_size, "should decompress the page");
+
+    result = parquet_rle_init_levels(&rle, data, page.header.uncompressed_page_size, 2);
+    assert(result > 0, "should find repetition levels");
+    offset = result;
+
+    result = parquet_rle_decode(&rle, repetition, page.header.data.num_values);
+    assert(result == 0, "should decode repetition levels");
+
+    result = parquet_rle_init_levels(&rle, data + offset, page.header.uncompressed_page_size - offset, 3);
+    assert(result > 0, "should find definition levels");
+
+    result = parquet_rle_decode(&rle, definition, page.header.data.num_values);
+    assert(result == 0, "should decode definition levels");
+
+    result = parquet_nested_assemble(&nested, repetition, definition, page.header.data.num_values);
+    assert(result == 0, "should assemble the page");
+  }
+
+  assert(result == 0, "should reach the end of the chunk");
+
+  // one slot per row, and every level spans the slots of the next one
+  assert(nested.entries == meta->num_values, "should assemble every value");
+  assert(nested.levels[0].count == metadata.row_groups[0]->num_rows, "should have one outer list per row");
+  assert(nested.levels[1].offsets[nested.levels[1].count] == nested.levels[2].count, "should span all structs");
+  assert(nested.levels[4].offsets[nested.levels[4].count] == nested.levels[5].count, "should span all elements");
+  assert(nested.levels[5].count - nested.levels[5].nulls == nested.values, "should count present values");
+
+  // release everything
+  parquet_pages_release(&pages);
+  malloc_release(&pool, &levels);
+  parquet_nested_release(&nested, &pool);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_nested_invalid_levels() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_nested nested;
+  struct parquet_schema root, list, repeated, element;
+  struct parquet_schema *root_children[] = {&list, NULL};
+  struct parquet_schema *list_children[] = {&repeated, NULL};
+  struct parquet_schema *repeated_children[] = {&element, NULL};
+
+  // a continuation of a list which is not defined, and a level above the maximum
+  const u32 repetition[] = {0, 1, 0};
+  const u32 definition[] = {3, 1, 4};
+
+  char *path[] = {"values", "list", "element", NULL};
+  char *missing[] = {"values", "items", NULL};
+
+  // optional group values (LIST) { repeated group list { optional int32 element } }
+  root = (struct parquet_schema){.name = "schema", .children = {1, root_children}};
+  list = (struct parquet_schema){
+    .name = "values",
+    .children = {1, list_children},
+    .repeated_type = PARQUET_REPETITION_TYPE_OPTIONAL,
+  };
+  repeated = (struct parquet_schema){
+    .name = "list",
+    .children = {1, repeated_children},
+    .repeated_type = PARQUET_REPETITION_TYPE_REPEATED,
+  };
+  element = (struct parquet_schema){
+    .name = "element",
+    .children = {0, NULL},
+    .repeated_type = PARQUET_REPETITION_TYPE_OPTIONAL,
+  };
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // the path must exist
+  result = parquet_nested_init(&nested, &pool, &root, missing, 16);
+  assert(result == PARQUET_ERROR_INVALID_SCHEMA, "should fail with PARQUET_ERROR_INVALID_SCHEMA");
+
+  result = parquet_nested_init(&nested, &pool, &root, path, 2);
+  assert(result == 0, "should initialize nested assembly");
+
+  // the levels must be consistent with the schema
+  result = parquet_nested_assemble(&nested, repetition, definition, 2);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+
+  result = parquet_nested_assemble(&nested, repetition + 2, definition + 2, 1);
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+
+  // and fit the capacity
+  result = parquet_nested_assemble(&nested, repetition, definition, 3);
+  assert(result == PARQUET_ERROR_CAPACITY_OVERFLOW, "should fail with PARQUET_ERROR_CAPACITY_OVERFLOW");
+  assert(nested.entries == 0 && nested.levels[0].count == 0, "should not assemble anything");
+
+  // release everything
+  parquet_nested_release(&nested, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_nested(struct runner_context *ctx) {
+  test_case(ctx, "can assemble nested list", can_assemble_nested_list);
+  test_case(ctx, "can assemble nested map", can_assemble_nested_map);
+  test_case(ctx, "can assemble nested lists of structs", can_assemble_nested_lists_of_structs);
+  test_case(ctx, "can assemble nested column chunk", can_assemble_nested_column_chunk);
+  test_case(ctx, "can detect nested invalid levels", can_detect_nested_invalid_levels);
+}
+
+#endif
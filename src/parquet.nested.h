@@ -0,0 +1,72 @@
+#pragma once
+
+#include "malloc.h"
+#include "parquet.schema.open.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_NESTED_MAX_DEPTH 10 // deepest supported path below the root, as deep as the schema
+
+struct parquet_nested_level {
+  const char *name;  // name of the schema node
+  i32 repeated_type; // repetition of the schema node
+  u32 space;         // repetition level of the slots the node lives in
+  u32 floor;         // definition level at which the slots exist
+  u32 definition;    // definition level at which the node is present
+  u32 count;         // number of slots assembled so far
+  u32 nulls;         // number of slots where an optional node is missing
+
+  u32 *offsets;              // repeated nodes only, count + 1 offsets into the slots of the next level
+  u8 *validity;              // optional nodes only, one bit per slot, set when the node is present
+  struct malloc_lease lease; // lease backing the offsets and the validity
+};
+
+struct parquet_nested {
+  u32 depth;          // number of nodes on the path below the root
+  u32 max_definition; // definition level of a present leaf value
+  u32 max_repetition; // number of repeated nodes on the path
+  u32 entries;        // number of level pairs assembled so far
+  u32 values;         // number of present leaf values among them
+  u32 capacity;       // maximum number of level pairs
+
+  struct parquet_nested_level levels[PARQUET_NESTED_MAX_DEPTH]; // nodes from the top-level field to the leaf
+};
+
+/// @brief Resolves the column path in the schema and allocates the arrays of every nesting level.
+/// @param nested Pointer to the parquet_nested structure to initialize.
+/// @param pool Pointer to the malloc_pool structure to allocate from.
+/// @param schema Pointer to the root of the opened schema.
+/// @param path Null-terminated names of the nodes leading from the root to the leaf.
+/// @param capacity Maximum number of level pairs to assemble.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_nested_init(struct parquet_nested *nested,
+                               struct malloc_pool *pool,
+                               const struct parquet_schema *schema,
+                               char **path,
+                               u32 capacity);
+
+/// @brief Appends decoded levels to the offsets and validity bitmaps, one branch-free pass per nesting level.
+/// @param nested Pointer to the initialized parquet_nested structure.
+/// @param repetition Pointer to the repetition levels.
+/// @param definition Pointer to the definition levels.
+/// @param count Number of level pairs.
+/// @return 0 on success, or a negative error code on failure.
+extern i64
+parquet_nested_assemble(struct parquet_nested *nested, const u32 *repetition, const u32 *definition, u32 count);
+
+/// @brief Drops all assembled slots while keeping the allocated memory.
+/// @param nested Pointer to the initialized parquet_nested structure.
+extern void parquet_nested_reset(struct parquet_nested *nested);
+
+/// @brief Releases the memory held by every nesting level.
+/// @param nested Pointer to the initialized parquet_nested structure.
+/// @param pool Pointer to the malloc_pool structure the levels were allocated from.
+extern void parquet_nested_release(struct parquet_nested *nested, struct malloc_pool *pool);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet nested test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_nested(struct runner_context *ctx);
+
+#endif
@@ -0,0 +1,823 @@
+#include "parquet.page.h"
+#include "codec.base.h"
+#include "codec.brotli.h"
+#include "codec.crc.h"
+#include "codec.gzip.h"
+#include "codec.lz4.h"
+#include "codec.snappy.h"
+#include "codec.zstd.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "runner.h"
+#include "sys.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+i64 parquet_pages_init(struct parquet_pages *pages,
+                       struct parquet_file *file,
+                       const struct parquet_column_meta *meta,
+                       bool verify) {
+  i64 result;
+  u64 completed, remaining;
+
+  // defaults
+  pages->file = file;
+  pages->chunk.ptr = NULL;
+  pages->chunk.size = 0;
+  pages->position = 0;
+  pages->index = 0;
+  pages->compression = meta->compression_codec;
+  pages->verify = verify;
+  pages->buffer.ptr = NULL;
+  pages->buffer.size = 0;
+
+  // the chunk must be described
+  if (meta->data_page_offset < 0 || meta->total_compressed_size < 0) return PARQUET_ERROR_INVALID_FILE;
+
+  // the dictionary page, if any, precedes the data pages
+  if (meta->dictionary_page_offset > 0 && meta->dictionary_page_offset < meta->data_page_offset) {
+    pages->offset = meta->dictionary_page_offset;
+  } else {
+    pages->offset = meta->data_page_offset;
+  }
+
+  // the chunk must fit in the file
+  pages->size = meta->total_compressed_size;
+  if (pages->offset + pages->size > file->size) return PARQUET_ERROR_INVALID_FILE;
+
+  // allocate a buffer for the entire chunk
+  pages->chunk.size = malloc_fit(pages->size);
+  result = malloc_acquire(file->pool, &pages->chunk);
+  if (result < 0) return result;
+
+  completed = 0;
+  remaining = pages->size;
+
+  // fill the buffer
+  while (remaining > 0) {
+    // read next part of the chunk
+    result = sys_pread(file->fd, pages->chunk.ptr + completed, remaining, pages->offset + completed);
+    if (result < 0) goto cleanup;
+
+    // check if the read was as expected
+    if (result == 0) {
+      result = PARQUET_ERROR_INVALID_FILE;
+      goto cleanup;
+    }
+
+    // move the completed bytes
+    completed += result;
+    remaining -= result;
+  }
+
+  // success
+  return 0;
+
+cleanup:
+  parquet_pages_release(pages);
+  return result;
+}
+
+i64 parquet_pages_next(struct parquet_pages *pages, struct parquet_page *page) {
+  i64 result;
+  u64 available;
+  const char *buffer;
+
+  // check for the end of the chunk
+  if (pages->position == pages->size) return 0;
+
+  // the header starts where the previous page ended
+  buffer = (const char *)pages->chunk.ptr + pages->position;
+  available = pages->size - pages->position;
+
+  // parse the page header
+  result = parquet_parse_page_header(&page->header, buffer, available);
+  if (result == THRIFT_ERROR_BUFFER_OVERFLOW) return PARQUET_ERROR_INVALID_FILE;
+  if (result < 0) return result;
+
+  // the stored data must follow the header within the chunk
+  if (page->header.compressed_page_size < 0) return PARQUET_ERROR_INVALID_FILE;
+  if ((u64)page->header.compressed_page_size > available - result) return PARQUET_ERROR_INVALID_FILE;
+
+  // fill the page
+  page->index = pages->index;
+  page->offset = pages->offset + pages->position;
+  page->header_size = result;
+  page->data = buffer + result;
+
+  // move to the next page
+  pages->index++;
+  pages->position += result + page->header.compressed_page_size;
+
+  // success
+  return 1;
+}
+
+i64 parquet_pages_verify(const struct parquet_page *page) {
+  // the checksum is optional
+  if (page->header.crc == PARQUET_UNKNOWN_VALUE) return 0;
+
+  // it covers the stored bytes following the header
+  if (codec_crc32(0, page->data, page->header.compressed_page_size) != (u32)page->header.crc) {
+    return PARQUET_ERROR_CHECKSUM_MISMATCH;
+  }
+
+  // success
+  return 1;
+}
+
+static i64 parquet_pages_reserve(struct parquet_pages *pages, u64 size) {
+  i64 result;
+  u64 required;
+
+  // the buffer has slack for wild copies
+  required = size + CODEC_SLACK;
+  if (pages->buffer.size >= required) return 0;
+
+  if (pages->buffer.ptr != NULL) {
+    malloc_release(pages->file->pool, &pages->buffer);
+  }
+
+  // allocate the buffer, forgetting it on failure
+  pages->buffer.size = malloc_fit(required);
+  result = malloc_acquire(pages->file->pool, &pages->buffer);
+  if (result < 0) {
+    pages->buffer.ptr = NULL;
+    pages->buffer.size = 0;
+  }
+
+  return result;
+}
+
+static i64
+parquet_pages_codec(struct parquet_pages *pages, const char *source, u64 source_size, char *target, u64 size) {
+  i64 result;
+
+  // decompress straight into the target
+  switch (pages->compression) {
+    case PARQUET_COMPRESSION_SNAPPY:
+      result = codec_snappy_decompress(source, source_size, target, size);
+      break;
+    case PARQUET_COMPRESSION_GZIP:
+      result = codec_gzip_decompress(source, source_size, target, size, pages->file->pool, pages->verify);
+      break;
+    case PARQUET_COMPRESSION_BROTLI:
+      result = codec_brotli_decompress(source, source_size, target, size, pages->file->pool);
+      break;
+    case PARQUET_COMPRESSION_LZ4:
+      result = codec_lz4_legacy_decompress(source, source_size, target, size);
+      break;
+    case PARQUET_COMPRESSION_LZ4_RAW:
+      result = codec_lz4_decompress(source, source_size, target, size);
+      break;
+    case PARQUET_COMPRESSION_ZSTD:
+      result = codec_zstd_decompress(source, source_size, target, size, pages->file->pool);
+      break;
+    default:
+      return CODEC_ERROR_UNSUPPORTED;
+  }
+
+  // the data must decompress to its announced size
+  if (result < 0) return result;
+  if ((u64)result != size) return PARQUET_ERROR_INVALID_FILE;
+
+  // success
+  return size;
+}
+
+i64 parquet_pages_levels(const struct parquet_page *page, struct parquet_page_levels *levels) {
+  const struct parquet_data_page_header_v2 *header;
+
+  // only V2 pages store their levels apart from the values
+  if (page->header.type != PARQUET_PAGE_TYPE_DATA_PAGE_V2) return PARQUET_ERROR_INVALID_TYPE;
+  header = &page->header.data_v2;
+
+  // both sections must be described
+  if (header->repetition_levels_byte_length < 0) return PARQUET_ERROR_INVALID_FILE;
+  if (header->definition_levels_byte_length < 0) return PARQUET_ERROR_INVALID_FILE;
+
+  // and stored ahead of the values
+  levels->size = (u64)header->repetition_levels_byte_length + (u64)header->definition_levels_byte_length;
+  if (page->header.compressed_page_size < 0) return PARQUET_ERROR_INVALID_FILE;
+  if (page->header.uncompressed_page_size < 0) return PARQUET_ERROR_INVALID_FILE;
+  if (levels->size > (u64)page->header.compressed_page_size) return PARQUET_ERROR_INVALID_FILE;
+  if (levels->size > (u64)page->header.uncompressed_page_size) return PARQUET_ERROR_INVALID_FILE;
+
+  // the repetition levels come first, both without any length prefix
+  levels->repetition = page->data;
+  levels->repetition_size = header->repetition_levels_byte_length;
+  levels->definition = page->data + levels->repetition_size;
+  levels->definition_size = header->definition_levels_byte_length;
+
+  // success
+  return 0;
+}
+
+i64 parquet_pages_values(struct parquet_pages *pages, const struct parquet_page *page, const char **data) {
+  i64 result;
+  u64 size, stored;
+  struct parquet_page_levels levels;
+
+  // the values follow the levels
+  result = parquet_pages_levels(page, &levels);
+  if (result < 0) return result;
+
+  size = page->header.uncompressed_page_size - levels.size;
+  stored = page->header.compressed_page_size - levels.size;
+
+  // values stored as they are are used in place
+  if (pages->compression == PARQUET_COMPRESSION_UNCOMPRESSED || !page->header.data_v2.is_compressed) {
+    if (size != stored) return PARQUET_ERROR_INVALID_FILE;
+
+    *data = page->data + levels.size;
+    return size;
+  }
+
+  // the others are decompressed into the buffer
+  result = parquet_pages_reserve(pages, size);
+  if (result < 0) return result;
+
+  result = parquet_pages_codec(pages, page->data + levels.size, stored, pages->buffer.ptr, size);
+  if (result < 0) return result;
+
+  // success
+  *data = pages->buffer.ptr;
+  return size;
+}
+
+i64 parquet_pages_decompress(struct parquet_pages *pages, const struct parquet_page *page, const char **data) {
+  i64 result;
+  u64 size, offset;
+  char *target;
+  struct parquet_page_levels levels;
+
+  // the uncompressed size must be known
+  if (page->header.uncompressed_page_size < 0) return PARQUET_ERROR_INVALID_FILE;
+  size = page->header.uncompressed_page_size;
+
+  // V2 pages only compress the values behind their levels
+  offset = 0;
+  if (page->header.type == PARQUET_PAGE_TYPE_DATA_PAGE_V2) {
+    result = parquet_pages_levels(page, &levels);
+    if (result < 0) return result;
+
+    offset = levels.size;
+  }
+
+  // uncompressed pages are used in place
+  if (pages->compression == PARQUET_COMPRESSION_UNCOMPRESSED ||
+      (page->header.type == PARQUET_PAGE_TYPE_DATA_PAGE_V2 && !page->header.data_v2.is_compressed)) {
+    if (size != (u64)page->header.compressed_page_size) return PARQUET_ERROR_INVALID_FILE;
+
+    *data = page->data;
+    return size;
+  }
+
+  result = parquet_pages_reserve(pages, size);
+  if (result < 0) return result;
+
+  // the levels are copied as they are, the rest is decompressed after them
+  target = pages->buffer.ptr;
+  codec_copy_exact(target, page->data, offset);
+
+  result = parquet_pages_codec(
+    pages, page->data + offset, page->header.compressed_page_size - offset, target + offset, size - offset);
+  if (result < 0) return result;
+
+  // success
+  *data = pages->buffer.ptr;
+  return size;
+}
+
+void parquet_pages_release(struct parquet_pages *pages) {
+  // release the chunk buffer if any
+  if (pages->chunk.ptr != NULL) {
+    malloc_release(pages->file->pool, &pages->chunk);
+  }
+
+  // and the decompression buffer
+  if (pages->buffer.ptr != NULL) {
+    malloc_release(pages->file->pool, &pages->buffer);
+  }
+}
+
+#if defined(I13C_TESTS)
+
+static void can_iterate_pages_of_column_chunk() {
+  i64 result;
+  i64 values;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_column_meta *meta;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file
+  result = parquet_open(&file, "data/test01.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  // the first column chunk has a dictionary page
+  meta = metadata.row_groups[0]->columns[0]->meta;
+
+  result = parquet_pages_init(&pages, &file, meta, TRUE);
+  assert(result == 0, "should read column chunk");
+  assert(pages.offset == 4, "chunk should start after the magic");
+
+  // the dictionary page comes first
+  result = parquet_pages_next(&pages, &page);
+  assert(result == 1, "should return dictionary page");
+  assert(page.index == 0, "page index should be 0");
+  assert(page.offset == 4, "page offset should be 4");
+  assert(page.header.type == PARQUET_PAGE_TYPE_DICTIONARY_PAGE, "page type should be DICTIONARY_PAGE");
+  assert(page.header.dictionary.num_values == 1, "dictionary should have one value");
+  assert(page.header.dictionary.encoding == PARQUET_ENCODING_PLAIN_DICTIONARY, "encoding should be PLAIN_DICTIONARY");
+
+  // then the data pages follow
+  values = 0;
+
+  while ((result = parquet_pages_next(&pages, &page)) == 1) {
+    assert(page.header.type == PARQUET_PAGE_TYPE_DATA_PAGE, "page type should be DATA_PAGE");
+    assert(page.header.crc == PARQUET_UNKNOWN_VALUE, "page should not have crc");
+    values += page.header.data.num_values;
+  }
+
+  assert(result == 0, "should reach the end of the chunk");
+  assert(values == meta->num_values, "pages should cover all values");
+
+  // release everything
+  parquet_pages_release(&pages);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_chunk_outside_of_file() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_column_meta meta;
+  struct parquet_pages pages;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file
+  result = parquet_open(&file, "data/test01.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  // move the chunk past the end of the file
+  meta = *metadata.row_groups[0]->columns[0]->meta;
+  meta.data_page_offset = file.size - 8;
+  meta.dictionary_page_offset = PARQUET_UNKNOWN_VALUE;
+
+  result = parquet_pages_init(&pages, &file, &meta, TRUE);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+
+  // release everything
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_page_outside_of_chunk() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_column_meta meta;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file
+  result = parquet_open(&file, "data/test01.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  // cut the chunk in the middle of the dictionary page
+  meta = *metadata.row_groups[0]->columns[0]->meta;
+  meta.total_compressed_size = 20;
+
+  result = parquet_pages_init(&pages, &file, &meta, TRUE);
+  assert(result == 0, "should read column chunk");
+
+  result = parquet_pages_next(&pages, &page);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+
+  // release everything
+  parquet_pages_release(&pages);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_snappy_pages() {
+  i64 result;
+  u32 index;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file compressed with snappy
+  result = parquet_open(&file, "data/test05.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  for (index = 0; metadata.row_groups[0]->columns[index]; index++) {
+    result = parquet_pages_init(&pages, &file, metadata.row_groups[0]->columns[index]->meta, TRUE);
+    assert(result == 0, "should read column chunk");
+
+    // every page decompresses to its announced size
+    while ((result = parquet_pages_next(&pages, &page)) == 1) {
+      result = parquet_pages_decompress(&pages, &page, &data);
+      assert(result == page.header.uncompressed_page_size, "should decompress the page");
+
+      // the first dictionary holds a single two-letter country code
+      if (index == 0 && page.index == 0) {
+        assert(*(const u32 *)data == 2, "dictionary value should have 2 bytes");
+      }
+    }
+
+    assert(result == 0, "should reach the end of the chunk");
+    parquet_pages_release(&pages);
+  }
+
+  // release everything
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_zstd_pages() {
+  i64 result;
+  u32 index, count;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file compressed with zstd
+  result = parquet_open(&file, "data/test01.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  for (index = 0, count = 0; metadata.row_groups[0]->columns[index]; index++) {
+    result = parquet_pages_init(&pages, &file, metadata.row_groups[0]->columns[index]->meta, TRUE);
+    assert(result == 0, "should read column chunk");
+
+    // every page decompresses to its announced size
+    while ((result = parquet_pages_next(&pages, &page)) == 1) {
+      result = parquet_pages_decompress(&pages, &page, &data);
+      assert(result == page.header.uncompressed_page_size, "should decompress the page");
+      count++;
+    }
+
+    assert(result == 0, "should reach the end of the chunk");
+    parquet_pages_release(&pages);
+  }
+
+  // at least one page per column
+  assert(count >= index, "should decompress every page");
+
+  // release everything
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_gzip_pages() {
+  i64 result;
+  u32 index, count;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file compressed with gzip
+  result = parquet_open(&file, "data/test03.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  for (index = 0, count = 0; metadata.row_groups[0]->columns[index]; index++) {
+    result = parquet_pages_init(&pages, &file, metadata.row_groups[0]->columns[index]->meta, TRUE);
+    assert(result == 0, "should read column chunk");
+
+    // every page decompresses to its announced size and checksum
+    while ((result = parquet_pages_next(&pages, &page)) == 1) {
+      result = parquet_pages_decompress(&pages, &page, &data);
+      assert(result == page.header.uncompressed_page_size, "should decompress the page");
+      count++;
+    }
+
+    assert(result == 0, "should reach the end of the chunk");
+    parquet_pages_release(&pages);
+  }
+
+  // at least one page per column
+  assert(count >= index, "should decompress every page");
+
+  // release everything
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_verify_page_checksums() {
+  i64 result;
+  u32 index, count;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_pages pages;
+  struct parquet_page page, corrupted;
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open and parse the file with page checksums
+  result = parquet_open(&file, "data/test05.parquet");
+  assert(result == 0, "should open parquet file");
+
+  result = parquet_parse(&file, &metadata);
+  assert(result == 0, "should parse metadata");
+
+  for (index = 0, count = 0; metadata.row_groups[0]->columns[index]; index++) {
+    result = parquet_pages_init(&pages, &file, metadata.row_groups[0]->columns[index]->meta, TRUE);
+    assert(result == 0, "should read column chunk");
+
+    // every page matches its checksum
+    while ((result = parquet_pages_next(&pages, &page)) == 1) {
+      result = parquet_pages_verify(&page);
+      assert(result == 1, "should verify the page");
+
+      // while a flipped bit does not
+      corrupted = page;
+      corrupted.header.crc ^= 0x01;
+
+      result = parquet_pages_verify(&corrupted);
+      assert(result == PARQUET_ERROR_CHECKSUM_MISMATCH, "should fail with PARQUET_ERROR_CHECKSUM_MISMATCH");
+      count++;
+    }
+
+    assert(result == 0, "should reach the end of the chunk");
+    parquet_pages_release(&pages);
+  }
+
+  // at least one page per column
+  assert(count >= index, "should verify every page");
+
+  // release everything
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_decompress_v2_page_values() {
+  i64 result;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_pages pages;
+  struct parquet_page page;
+  struct parquet_page_levels levels;
+
+  // RLE definition levels of 4 values, then values 1 to 4 compressed as a snappy literal
+  const u8 stored[] = {
+    0x08, 0x01,                                                             // definition levels
+    0x10, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, // snappy literal
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  };
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // a snappy chunk without its own buffer
+  pages = (struct parquet_pages){.file = &file, .compression = PARQUET_COMPRESSION_SNAPPY, .verify = 1};
+
+  page.data = (const char *)stored;
+  page.header.type = PARQUET_PAGE_TYPE_DATA_PAGE_V2;
+  page.header.compressed_page_size = 20;
+  page.header.uncompressed_page_size = 18;
+  page.header.data_v2.num_values = 4;
+  page.header.data_v2.repetition_levels_byte_length = 0;
+  page.header.data_v2.definition_levels_byte_length = 2;
+  page.header.data_v2.is_compressed = TRUE;
+
+  // the levels are found in place
+  result = parquet_pages_levels(&page, &levels);
+  assert(result == 0, "should locate the levels");
+  assert(levels.repetition_size == 0, "should have no repetition levels");
+  assert(levels.definition == page.data && levels.definition_size == 2, "should point at the definition levels");
+
+  // the values alone are decompressed
+  result = parquet_pages_values(&pages, &page, &data);
+  assert(result == 16, "should decompress 16 bytes of values");
+  assert(((const i32 *)data)[0] == 1 && ((const i32 *)data)[3] == 4, "should decompress the values");
+
+  // the whole page keeps the levels ahead of the values
+  result = parquet_pages_decompress(&pages, &page, &data);
+  assert(result == 18, "should decompress 18 bytes");
+  assert(data[0] == 0x08 && data[1] == 0x01, "should copy the levels");
+  assert(*(const i32 *)(data + 2) == 1 && *(const i32 *)(data + 14) == 4, "should decompress the values");
+
+  // release everything
+  parquet_pages_release(&pages);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_use_uncompressed_v2_page_in_place() {
+  i64 result;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // RLE definition levels of 2 values, then values 1 and 2 stored as they are
+  const u8 stored[] = {0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // a snappy chunk whose page opted out of compression
+  pages = (struct parquet_pages){.file = &file, .compression = PARQUET_COMPRESSION_SNAPPY, .verify = 1};
+
+  page.data = (const char *)stored;
+  page.header.type = PARQUET_PAGE_TYPE_DATA_PAGE_V2;
+  page.header.compressed_page_size = 10;
+  page.header.uncompressed_page_size = 10;
+  page.header.data_v2.num_values = 2;
+  page.header.data_v2.repetition_levels_byte_length = 0;
+  page.header.data_v2.definition_levels_byte_length = 2;
+  page.header.data_v2.is_compressed = FALSE;
+
+  // the values are used in place
+  result = parquet_pages_values(&pages, &page, &data);
+  assert(result == 8, "should return 8 bytes of values");
+  assert(data == page.data + 2, "should point into the page");
+
+  // and so is the whole page
+  result = parquet_pages_decompress(&pages, &page, &data);
+  assert(result == 10, "should return 10 bytes");
+  assert(data == page.data, "should point at the page");
+  assert(pages.buffer.ptr == NULL, "should not allocate any buffer");
+
+  // release everything
+  parquet_pages_release(&pages);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_v2_page_invalid_levels() {
+  i64 result;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_pages pages;
+  struct parquet_page page;
+  struct parquet_page_levels levels;
+
+  const u8 stored[] = {0x04, 0x01, 0x01, 0x00};
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  pages = (struct parquet_pages){.file = &file, .compression = PARQUET_COMPRESSION_SNAPPY, .verify = 1};
+
+  // the levels claim more than the page holds
+  page.data = (const char *)stored;
+  page.header.type = PARQUET_PAGE_TYPE_DATA_PAGE_V2;
+  page.header.compressed_page_size = 4;
+  page.header.uncompressed_page_size = 4;
+  page.header.data_v2.repetition_levels_byte_length = 3;
+  page.header.data_v2.definition_levels_byte_length = 2;
+  page.header.data_v2.is_compressed = TRUE;
+
+  result = parquet_pages_levels(&page, &levels);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+
+  result = parquet_pages_decompress(&pages, &page, &data);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+
+  // V1 pages keep their levels within the compressed data
+  page.header.type = PARQUET_PAGE_TYPE_DATA_PAGE;
+
+  result = parquet_pages_values(&pages, &page, &data);
+  assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
+
+  // release everything
+  parquet_pages_release(&pages);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+static void can_skip_gzip_checksums() {
+  i64 result;
+  const char *data;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // values 1 to 4 compressed as a gzip member whose CRC-32 was altered
+  const u8 stored[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x63, 0x64, 0x60, 0x60, 0x60, 0x02,
+    0x62, 0x66, 0x20, 0x66, 0x01, 0x62, 0x00, 0xee, 0xd4, 0x05, 0xaf, 0x10, 0x00, 0x00, 0x00,
+  };
+
+  // initialize the pool and the file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // a gzip chunk verifying its members
+  pages = (struct parquet_pages){.file = &file, .compression = PARQUET_COMPRESSION_GZIP, .verify = 1};
+
+  page.data = (const char *)stored;
+  page.header.type = PARQUET_PAGE_TYPE_DATA_PAGE;
+  page.header.compressed_page_size = 31;
+  page.header.uncompressed_page_size = 16;
+
+  // the altered checksum is detected
+  result = parquet_pages_decompress(&pages, &page, &data);
+  assert(result == CODEC_ERROR_CHECKSUM_MISMATCH, "should detect the checksum mismatch");
+
+  // and ignored once verification is off
+  pages.verify = 0;
+  result = parquet_pages_decompress(&pages, &page, &data);
+  assert(result == 16, "should decompress 16 bytes");
+  assert(((const i32 *)data)[0] == 1 && ((const i32 *)data)[3] == 4, "should decompress the values");
+
+  // release everything
+  parquet_pages_release(&pages);
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_page(struct runner_context *ctx) {
+  test_case(ctx, "can iterate pages of column chunk", can_iterate_pages_of_column_chunk);
+  test_case(ctx, "can detect chunk outside of file", can_detect_chunk_outside_of_file);
+  test_case(ctx, "can detect page outside of chunk", can_detect_page_outside_of_chunk);
+  test_case(ctx, "can decompress snappy pages", can_decompress_snappy_pages);
+  test_case(ctx, "can decompress zstd pages", can_decompress_zstd_pages);
+  test_case(ctx, "can decompress gzip pages", can_decompress_gzip_pages);
+  test_case(ctx, "can skip gzip checksums", can_skip_gzip_checksums);
+  test_case(ctx, "can verify page checksums", can_verify_page_checksums);
+  test_case(ctx, "can decompress v2 page values", can_decompress_v2_page_values);
+  test_case(ctx, "can use uncompressed v2 page in place", can_use_uncompressed_v2_page_in_place);
+  test_case(ctx, "can detect v2 page invalid levels", can_detect_v2_page_invalid_levels);
+}
+
+#endif
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "runner.h"
+#include "typing.h"
+
+struct parquet_pages {
+  struct parquet_file *file; // file owning the column chunk
+  struct malloc_lease chunk; // buffer holding the entire column chunk
+
+  u64 offset;   // file offset of the column chunk
+  u64 size;     // size of the column chunk in bytes
+  u64 position; // position of the next page header in the chunk
+  u32 index;    // index of the next page
+
+  i32 compression;            // compression codec of the column chunk
+  bool verify;                // whether page CRCs and gzip members are checked by their readers
+  struct malloc_lease buffer; // buffer receiving decompressed pages, reused by all pages
+};
+
+struct parquet_page {
+  u32 index;       // zero-based index of the page in the column chunk
+  u64 offset;      // file offset of the page header
+  u32 header_size; // size of the page header in bytes
+
+  struct parquet_page_header header; // parsed page header
+  const char *data;                  // stored page data, compressed_page_size bytes
+};
+
+struct parquet_page_levels {
+  const char *repetition; // repetition levels, without a length prefix
+  u32 repetition_size;    // number of bytes of the repetition levels
+  const char *definition; // definition levels, without a length prefix
+  u32 definition_size;    // number of bytes of the definition levels
+  u64 size;               // number of bytes of both sections, stored ahead of the values
+};
+
+/// @brief Reads the column chunk described by the metadata and prepares page iteration.
+/// @param pages Pointer to the parquet_pages structure to initialize.
+/// @param file Pointer to the opened parquet_file structure.
+/// @param meta Pointer to the metadata of the column chunk.
+/// @param verify Whether readers check page CRCs with parquet_pages_verify and gzip members after decompression.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_pages_init(struct parquet_pages *pages,
+                              struct parquet_file *file,
+                              const struct parquet_column_meta *meta,
+                              bool verify);
+
+/// @brief Returns the next page of the column chunk, the page data stays valid until the release.
+/// @param pages Pointer to the initialized parquet_pages structure.
+/// @param page Pointer to the parquet_page structure to populate.
+/// @return 1 if a page was returned, 0 at the end of the chunk, or a negative error code.
+extern i64 parquet_pages_next(struct parquet_pages *pages, struct parquet_page *page);
+
+/// @brief Compares the stored page data with the optional CRC-32 of its header.
+/// @param page Pointer to the page returned by the iterator.
+/// @return 1 if the checksum matches, 0 if the page has none, or PARQUET_ERROR_CHECKSUM_MISMATCH.
+extern i64 parquet_pages_verify(const struct parquet_page *page);
+
+/// @brief Decompresses the page data into the buffer feeding the decoders.
+/// @param pages Pointer to the initialized parquet_pages structure.
+/// @param page Pointer to the page returned by the iterator.
+/// @param data Pointer receiving the uncompressed page data, valid until the next decompression or the release.
+/// @return The number of uncompressed bytes, or a negative error code on failure.
+extern i64 parquet_pages_decompress(struct parquet_pages *pages, const struct parquet_page *page, const char **data);
+
+/// @brief Locates the levels of a V2 data page, always stored uncompressed, directly in the page data.
+/// @param page Pointer to the page returned by the iterator.
+/// @param levels Pointer to the parquet_page_levels structure to populate, valid until the release.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_pages_levels(const struct parquet_page *page, struct parquet_page_levels *levels);
+
+/// @brief Decompresses only the values of a V2 data page, so scans may decode the levels first and skip the values.
+/// @param pages Pointer to the initialized parquet_pages structure.
+/// @param page Pointer to the page returned by the iterator.
+/// @param data Pointer receiving the uncompressed values, valid until the next decompression or the release.
+/// @return The number of uncompressed bytes, or a negative error code on failure.
+extern i64 parquet_pages_values(struct parquet_pages *pages, const struct parquet_page *page, const char **data);
+
+/// @brief Releases the column chunk and the decompression buffers.
+/// @param pages Pointer to the parquet_pages structure.
+extern void parquet_pages_release(struct parquet_pages *pages);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet page test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_page(struct runner_context *ctx);
+
+#endif
@@ -6,39 +6,114 @@
 #include "thrift.base.h"
 #include "typing.h"
 
+// computes the offset of the member in the target structure
+#define PARQUET_OFFSET(type, member) ((u32)__builtin_offsetof(type, member))
+
 // forward declarations
-struct parquet_parse_context;
+struct parquet_parse_field;
 
-/// @brief Function type for reading a target structure from the buffer
-/// @param ctx Pointer to the parsing context
+struct parquet_parse_context {
+  struct arena_allocator *arena; // arena allocator for metadata
+};
+
+/// @brief Function type for reading a single value into its target location.
+/// @param ctx Pointer to the parsing context.
+/// @param field Pointer to the descriptor of the field being read.
+/// @param target Pointer to the location where the value is stored.
 /// @param buffer Pointer to the buffer containing the data.
 /// @param buffer_size Size of the buffer.
 /// @return The number of bytes read from the buffer, or a negative error code.
-typedef i64 (*parquet_read_fn)(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size);
+typedef i64 (*parquet_read_fn)(
+  struct parquet_parse_context *ctx, const struct parquet_parse_field *field, void *target, const char *buffer,
+  u64 buffer_size);
+
+struct parquet_parse_descriptor {
+  u32 size;                                 // size of the target structure
+  u32 fields_size;                          // number of field slots, indexed by the field id
+  const void *defaults;                     // template copied over the target before decoding
+  const struct parquet_parse_field *fields; // fields indexed by the field id
+};
 
-struct parquet_parse_context {
-  struct arena_allocator *arena; // arena allocator for metadata
+struct parquet_parse_field {
+  u32 offset;                                        // offset of the value in the target structure
+  u32 size;                                          // size of the value kept inline in list elements
+  enum thrift_type type;                             // expected thrift type of the value
+  parquet_read_fn read_fn;                           // reader of the value, NULL ignores the field
+  const struct parquet_parse_field *item;            // element of the list
+  const struct parquet_parse_descriptor *descriptor; // descriptor of the nested structure
+};
 
-  void *target;              // pointer to the target structure to fill
-  u64 target_size;           // size of the target structure
-  parquet_read_fn target_fn; // function to read the target structure
+static i64 parquet_read_fields(
+  struct parquet_parse_context *ctx, const struct parquet_parse_descriptor *descriptor, void *target,
+  const char *buffer, u64 buffer_size) {
 
-  void *ptrs[16];         // pointers to the fields in the target structure
-  thrift_read_fn *fields; // array of thrift read functions for the fields
-  u64 fields_size;        // number of fields in the target structure
-};
+  i64 result, read;
+  u32 index;
+  enum thrift_type type;
+  const struct parquet_parse_field *field;
+  struct thrift_struct_header header;
+
+  // apply the defaults, the unseen fields keep them
+  for (index = 0; index < descriptor->size; index++) {
+    ((char *)target)[index] = ((const char *)descriptor->defaults)[index];
+  }
+
+  // default
+  read = 0;
+  header.field = 0;
+
+  while (TRUE) {
+    // read the next struct header
+    result = thrift_read_struct_header(&header, buffer, buffer_size);
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+
+    // check if we reached the end of the struct
+    if (header.type == THRIFT_TYPE_STOP) {
+      break;
+    }
+
+    // find the field in the descriptor, unknown fields are ignored
+    field = header.field < descriptor->fields_size ? descriptor->fields + header.field : NULL;
+
+    // bool fields keep their value in the type, both types are described as BOOL_TRUE
+    type = header.type == THRIFT_TYPE_BOOL_FALSE ? THRIFT_TYPE_BOOL_TRUE : header.type;
+
+    if (field == NULL || field->read_fn == NULL) {
+      result = thrift_ignore_field(NULL, header.field, header.type, buffer, buffer_size);
+    } else if (field->type != type) {
+      result = PARQUET_ERROR_INVALID_TYPE;
+    } else if (type == THRIFT_TYPE_BOOL_TRUE) {
+      *(bool *)((char *)target + field->offset) = header.type == THRIFT_TYPE_BOOL_TRUE;
+      result = 0;
+    } else {
+      result = field->read_fn(ctx, field, (char *)target + field->offset, buffer, buffer_size);
+    }
+
+    // perhaps reading failed
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+  }
+
+  // success
+  return read;
+}
 
 static i64 parquet_read_i32_positive(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+  struct parquet_parse_context *, const struct parquet_parse_field *, void *target, const char *buffer,
+  u64 buffer_size) {
   i32 value;
   i64 result;
 
-  // check if the field type is correct
-  if (field_type != THRIFT_TYPE_I32) {
-    return PARQUET_ERROR_INVALID_TYPE;
-  }
-
-  // read i32 as the parquet version
+  // read i32 value
   result = thrift_read_i32(&value, buffer, buffer_size);
   if (result < 0) return result;
 
@@ -46,22 +121,18 @@ static i64 parquet_read_i32_positive(
   if (value < 0) return PARQUET_ERROR_INVALID_VALUE;
 
   // value is OK, field will be found
-  *(i32 *)ctx->ptrs[field_id] = value;
+  *(i32 *)target = value;
 
   // success
   return result;
 }
 
 static i64 parquet_read_i64_positive(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+  struct parquet_parse_context *, const struct parquet_parse_field *, void *target, const char *buffer,
+  u64 buffer_size) {
   i64 value, result;
 
-  // check if the field type is correct
-  if (field_type != THRIFT_TYPE_I64) {
-    return PARQUET_ERROR_INVALID_TYPE;
-  }
-
-  // read i64 as the number of rows
+  // read i64 value
   result = thrift_read_i64(&value, buffer, buffer_size);
   if (result < 0) return result;
 
@@ -69,24 +140,66 @@ static i64 parquet_read_i64_positive(
   if (value < 0) return PARQUET_ERROR_INVALID_VALUE;
 
   // value is OK, field will be found
-  *(i64 *)ctx->ptrs[field_id] = value;
+  *(i64 *)target = value;
+
+  // success
+  return result;
+}
+
+static i64 parquet_read_crc(
+  struct parquet_parse_context *, const struct parquet_parse_field *, void *target, const char *buffer,
+  u64 buffer_size) {
+  i32 value;
+  i64 result;
+
+  // read i32 value
+  result = thrift_read_i32(&value, buffer, buffer_size);
+  if (result < 0) return result;
+
+  // keep all 32 bits as unsigned, so -1 can mark a missing value
+  *(i64 *)target = (i64)(u32)value;
 
   // success
   return result;
 }
 
+static i64 parquet_read_bool(
+  struct parquet_parse_context *, const struct parquet_parse_field *, void *target, const char *buffer,
+  u64 buffer_size) {
+
+  // only list elements carry the bool as a byte, struct fields are handled by the caller
+  return thrift_read_bool((bool *)target, buffer, buffer_size);
+}
+
+static i64 parquet_read_binary(
+  struct parquet_parse_context *, const struct parquet_parse_field *, void *target, const char *buffer,
+  u64 buffer_size) {
+  i64 result;
+  u32 size;
+
+  // read the size of the value
+  result = thrift_read_binary_header(&size, buffer, buffer_size);
+  if (result < 0) return result;
+
+  // check if the content is available
+  if (buffer_size - result < size) return THRIFT_ERROR_BUFFER_OVERFLOW;
+
+  // reference the content in the buffer, no copy is made
+  ((struct parquet_binary *)target)->ptr = buffer + result;
+  ((struct parquet_binary *)target)->size = size;
+
+  // success
+  return result + size;
+}
+
 static i64 parquet_read_string(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+  struct parquet_parse_context *ctx, const struct parquet_parse_field *, void *target, const char *buffer,
+  u64 buffer_size) {
   char *value;
   i64 result, read;
   u32 size;
   u64 cursor;
 
-  // check if the field type is correct
-  if (field_type != THRIFT_TYPE_BINARY) {
-    return PARQUET_ERROR_INVALID_TYPE;
-  }
-
   // read the size of the value string
   result = thrift_read_binary_header(&size, buffer, buffer_size);
   if (result < 0) return result;
@@ -108,7 +221,7 @@ static i64 parquet_read_string(
   if (result < 0) goto cleanup;
 
   // value is OK, field will be found
-  *(char **)ctx->ptrs[field_id] = value;
+  *(char **)target = value;
 
   // success
   return read + result;
@@ -122,9 +235,10 @@ cleanup:
 }
 
 static i64 parquet_read_list(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
-  struct parquet_parse_context context;
+  struct parquet_parse_context *ctx, const struct parquet_parse_field *field, void *target, const char *buffer,
+  u64 buffer_size) {
   struct thrift_list_header header;
+  const struct parquet_parse_field *item;
 
   void *ptr;
   void **ptrs;
@@ -132,15 +246,14 @@ static i64 parquet_read_list(
   u32 index;
   u64 cursor;
 
-  // check if the field type is correct
-  if (field_type != THRIFT_TYPE_LIST) {
-    return PARQUET_ERROR_INVALID_TYPE;
-  }
-
-  // read the size of the schemas list
+  // read the size and the type of the list
   result = thrift_read_list_header(&header, buffer, buffer_size);
   if (result < 0) return result;
 
+  // check if the element type is correct
+  item = field->item;
+  if (header.type != item->type) return PARQUET_ERROR_INVALID_TYPE;
+
   // move the buffer pointer and size
   read = result;
   buffer += result;
@@ -156,28 +269,22 @@ static i64 parquet_read_list(
   // null-terminate the array
   ptrs[header.size] = NULL;
 
-  // allocate memory for the array
-  if (ctx->target_size > 0) {
-    result = arena_acquire(ctx->arena, header.size * ctx->target_size, &ptr);
+  // allocate memory for the inline elements
+  if (item->size > 0) {
+    result = arena_acquire(ctx->arena, header.size * item->size, &ptr);
     if (result < 0) goto cleanup;
 
-    // fill out the array of schema elements
+    // point each pointer at its element
     for (index = 0; index < header.size; index++) {
       ptrs[index] = ptr;
-      ptr += ctx->target_size;
+      ptr += item->size;
     }
   }
 
-  // initialize nested context
-  context.arena = ctx->arena;
-
-  // parse each schema element
+  // parse each element
   for (index = 0; index < header.size; index++) {
-    // set the target for the nested context
-    context.target = ctx->target_size > 0 ? ptrs[index] : &ptrs[index];
-
-    // read the next schema element
-    result = ctx->target_fn(&context, buffer, buffer_size);
+    // read the next element, either inline or behind the pointer
+    result = item->read_fn(ctx, item, item->size > 0 ? ptrs[index] : &ptrs[index], buffer, buffer_size);
     if (result < 0) goto cleanup;
 
     // move the buffer pointer and size
@@ -187,7 +294,7 @@ static i64 parquet_read_list(
   }
 
   // value is OK, field will be found
-  *(void **)ctx->ptrs[field_id] = ptrs;
+  *(void **)target = ptrs;
 
   // success
   return read;
@@ -201,42 +308,28 @@ cleanup:
 }
 
 static i64 parquet_read_struct(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
-  struct parquet_parse_context context;
-  i64 result, read;
+  struct parquet_parse_context *ctx, const struct parquet_parse_field *field, void *target, const char *buffer,
+  u64 buffer_size) {
+  i64 result;
   void *data;
   u64 cursor;
 
-  // check if the field type is correct
-  if (field_type != THRIFT_TYPE_STRUCT) {
-    return PARQUET_ERROR_INVALID_TYPE;
-  }
-
   // remember the cursor
   cursor = ctx->arena->cursor;
 
   // allocate memory for the struct
-  result = arena_acquire(ctx->arena, ctx->target_size, &data);
+  result = arena_acquire(ctx->arena, field->descriptor->size, &data);
   if (result < 0) return result;
 
-  // context
-  context.target = data;
-  context.arena = ctx->arena;
-
-  // read the next schema element
-  result = ctx->target_fn(&context, buffer, buffer_size);
+  // read the struct content
+  result = parquet_read_fields(ctx, field->descriptor, data, buffer, buffer_size);
   if (result < 0) goto cleanup;
 
-  // move the buffer pointer and size
-  read = result;
-  buffer += result;
-  buffer_size -= result;
-
   // value is OK, field will be found
-  *(void **)ctx->ptrs[field_id] = data;
+  *(void **)target = data;
 
   // success
-  return read;
+  return result;
 
 cleanup:
   // revert the arena to the previous state
@@ -246,437 +339,514 @@ cleanup:
   return result;
 }
 
-static i64 parquet_parse_schema_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  struct parquet_schema_element *schema;
-  struct parquet_parse_context context;
-
-  const u32 FIELDS_SLOTS = 7;
-  thrift_read_fn fields[FIELDS_SLOTS];
-
-  // prepare the mapping of fields
-  fields[1] = (thrift_read_fn)parquet_read_i32_positive; // data_type
-  fields[2] = (thrift_read_fn)parquet_read_i32_positive; // type_length
-  fields[3] = (thrift_read_fn)parquet_read_i32_positive; // repetition_type
-  fields[4] = (thrift_read_fn)parquet_read_string;       // schema_name
-  fields[5] = (thrift_read_fn)parquet_read_i32_positive; // num_children
-  fields[6] = (thrift_read_fn)parquet_read_i32_positive; // converted_type
-
-  // schema
-  schema = (struct parquet_schema_element *)ctx->target;
-  schema->data_type = PARQUET_DATA_TYPE_NONE;
-  schema->type_length = PARQUET_UNKNOWN_VALUE;
-  schema->repetition_type = PARQUET_REPETITION_TYPE_NONE;
-  schema->name = PARQUET_NULL_VALUE;
-  schema->num_children = PARQUET_UNKNOWN_VALUE;
-  schema->converted_type = PARQUET_UNKNOWN_VALUE;
+static i64 parquet_read_struct_inline(
+  struct parquet_parse_context *ctx, const struct parquet_parse_field *field, void *target, const char *buffer,
+  u64 buffer_size) {
 
-  // context
-  context.target = schema;
-  context.arena = ctx->arena;
+  // the memory is already provided by the list
+  return parquet_read_fields(ctx, field->descriptor, target, buffer, buffer_size);
+}
 
-  // targets
-  context.ptrs[1] = &schema->data_type;
-  context.ptrs[2] = &schema->type_length;
-  context.ptrs[3] = &schema->repetition_type;
-  context.ptrs[4] = &schema->name;
-  context.ptrs[5] = &schema->num_children;
-  context.ptrs[6] = &schema->converted_type;
+static i64 parquet_read_row_group_counts(
+  struct parquet_parse_context *ctx, const struct parquet_parse_field *field, void *target, const char *buffer,
+  u64 buffer_size) {
+  struct thrift_list_header header;
+  struct parquet_row_group row_group;
+  struct parquet_row_group_counts *counts;
+  const struct parquet_parse_field *item;
 
-  // default
-  read = 0;
+  i64 result, read;
+  u32 index;
 
-  // delegate content reading to the thrift function
-  result = thrift_read_struct_content(&context, fields, FIELDS_SLOTS, buffer, buffer_size);
+  // read the size and the type of the list
+  result = thrift_read_list_header(&header, buffer, buffer_size);
   if (result < 0) return result;
 
+  // check if the element type is correct
+  item = field->item;
+  if (header.type != item->type) return PARQUET_ERROR_INVALID_TYPE;
+
   // move the buffer pointer and size
-  read += result;
+  read = result;
   buffer += result;
   buffer_size -= result;
 
-  // success
-  return read;
-}
-
-static i64 parquet_read_string_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
+  // the elements are reduced as they come, nothing is kept
+  counts = target;
 
-  // ptr 0 is the target for the string
-  ctx->ptrs[0] = ctx->target;
-
-  // call the string reader at ptr 0
-  return parquet_read_string(ctx, 0, THRIFT_TYPE_BINARY, buffer, buffer_size);
-}
-
-static i64 parquet_read_list_string(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
-
-  // fill up the context
-  ctx->target_size = 0;
-  ctx->target_fn = (parquet_read_fn)parquet_read_string_element;
+  for (index = 0; index < header.size; index++) {
+    // read the next element into the reused row group
+    result = item->read_fn(ctx, item, &row_group, buffer, buffer_size);
+    if (result < 0) return result;
 
-  // call generic list reader
-  return parquet_read_list(ctx, field_id, field_type, buffer, buffer_size);
-}
+    // the number of rows is required
+    if (row_group.num_rows == PARQUET_UNKNOWN_VALUE) return PARQUET_ERROR_INVALID_VALUE;
 
-static i64 parquet_read_i32_positive_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
+    counts->count += 1;
+    counts->num_rows += row_group.num_rows;
 
-  // ptr 0 is the target for the i32
-  ctx->ptrs[0] = ctx->target;
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+  }
 
-  // call the i32 reader at ptr 0
-  return parquet_read_i32_positive(ctx, 0, THRIFT_TYPE_I32, buffer, buffer_size);
+  // success
+  return read;
 }
 
-static i64 parquet_read_list_i32_positive(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+// represents an element of lists holding positive i32 values inline
+static const struct parquet_parse_field PARQUET_I32_POSITIVE_ITEM = {
+  .size = sizeof(i32), .type = THRIFT_TYPE_I32, .read_fn = parquet_read_i32_positive};
+
+// represents an element of lists holding pointers to strings
+static const struct parquet_parse_field PARQUET_STRING_ITEM = {
+  .size = 0, .type = THRIFT_TYPE_BINARY, .read_fn = parquet_read_string};
+
+static const struct parquet_schema_element PARQUET_SCHEMA_ELEMENT_DEFAULTS = {
+  .data_type = PARQUET_DATA_TYPE_NONE,
+  .type_length = PARQUET_UNKNOWN_VALUE,
+  .repetition_type = PARQUET_REPETITION_TYPE_NONE,
+  .name = PARQUET_NULL_VALUE,
+  .num_children = PARQUET_UNKNOWN_VALUE,
+  .converted_type = PARQUET_UNKNOWN_VALUE,
+};
 
-  // fill up the context
-  ctx->target_size = sizeof(i32);
-  ctx->target_fn = (parquet_read_fn)parquet_read_i32_positive_element;
+static const struct parquet_parse_field PARQUET_SCHEMA_ELEMENT_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_schema_element, data_type), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_schema_element, type_length), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_schema_element, repetition_type), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_schema_element, name), 0, THRIFT_TYPE_BINARY, parquet_read_string},
+  [5] = {PARQUET_OFFSET(struct parquet_schema_element, num_children), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [6] = {PARQUET_OFFSET(struct parquet_schema_element, converted_type), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+};
 
-  // call generic list reader
-  return parquet_read_list(ctx, field_id, field_type, buffer, buffer_size);
-}
+static const struct parquet_parse_descriptor PARQUET_SCHEMA_ELEMENT_DESCRIPTOR = {
+  .size = sizeof(struct parquet_schema_element),
+  .fields_size = sizeof(PARQUET_SCHEMA_ELEMENT_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_SCHEMA_ELEMENT_DEFAULTS,
+  .fields = PARQUET_SCHEMA_ELEMENT_FIELDS,
+};
 
-static i64 parquet_parse_schemas(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+static const struct parquet_parse_field PARQUET_SCHEMA_ELEMENT_ITEM = {
+  .size = sizeof(struct parquet_schema_element),
+  .type = THRIFT_TYPE_STRUCT,
+  .read_fn = parquet_read_struct_inline,
+  .descriptor = &PARQUET_SCHEMA_ELEMENT_DESCRIPTOR,
+};
 
-  // fill up the context
-  ctx->target_size = sizeof(struct parquet_schema_element);
-  ctx->target_fn = (parquet_read_fn)parquet_parse_schema_element;
+static const struct parquet_page_encoding_stats PARQUET_ENCODING_STATS_DEFAULTS = {
+  .page_type = PARQUET_PAGE_TYPE_NONE,
+  .encoding = PARQUET_ENCODING_NONE,
+  .count = PARQUET_UNKNOWN_VALUE,
+};
 
-  // call generic list reader
-  return parquet_read_list(ctx, field_id, field_type, buffer, buffer_size);
-}
+static const struct parquet_parse_field PARQUET_ENCODING_STATS_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_page_encoding_stats, page_type), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_page_encoding_stats, encoding), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_page_encoding_stats, count), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+};
 
-static i64
-parquet_parse_encoding_stats_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  struct parquet_page_encoding_stats *element;
-  struct parquet_parse_context context;
+static const struct parquet_parse_descriptor PARQUET_ENCODING_STATS_DESCRIPTOR = {
+  .size = sizeof(struct parquet_page_encoding_stats),
+  .fields_size = sizeof(PARQUET_ENCODING_STATS_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_ENCODING_STATS_DEFAULTS,
+  .fields = PARQUET_ENCODING_STATS_FIELDS,
+};
 
-  const u32 FIELDS_SLOTS = 4;
-  thrift_read_fn fields[FIELDS_SLOTS];
+static const struct parquet_parse_field PARQUET_ENCODING_STATS_ITEM = {
+  .size = sizeof(struct parquet_page_encoding_stats),
+  .type = THRIFT_TYPE_STRUCT,
+  .read_fn = parquet_read_struct_inline,
+  .descriptor = &PARQUET_ENCODING_STATS_DESCRIPTOR,
+};
 
-  // prepare the mapping of fields
-  fields[1] = (thrift_read_fn)parquet_read_i32_positive; // page_type
-  fields[2] = (thrift_read_fn)parquet_read_i32_positive; // encoding
-  fields[3] = (thrift_read_fn)parquet_read_i32_positive; // count
+// statistics are kept inline in page headers, so their defaults are shared by all of them
+#define PARQUET_COLUMN_STATISTICS_DEFAULTS                                                                             \
+  {                                                                                                                    \
+    .max = {PARQUET_NULL_VALUE, 0},                                                                                    \
+    .min = {PARQUET_NULL_VALUE, 0},                                                                                    \
+    .null_count = PARQUET_UNKNOWN_VALUE,                                                                               \
+    .distinct_count = PARQUET_UNKNOWN_VALUE,                                                                           \
+    .max_value = {PARQUET_NULL_VALUE, 0},                                                                              \
+    .min_value = {PARQUET_NULL_VALUE, 0},                                                                              \
+    .is_max_value_exact = FALSE,                                                                                       \
+    .is_min_value_exact = FALSE,                                                                                       \
+  }
 
-  // page_encoding_stats
-  element = (struct parquet_page_encoding_stats *)ctx->target;
-  element->page_type = PARQUET_PAGE_TYPE_NONE;
-  element->encoding = PARQUET_ENCODING_NONE;
-  element->count = PARQUET_UNKNOWN_VALUE;
+static const struct parquet_column_statistics PARQUET_COLUMN_STATISTICS_DEFAULTS_VALUE =
+  PARQUET_COLUMN_STATISTICS_DEFAULTS;
+
+static const struct parquet_parse_field PARQUET_COLUMN_STATISTICS_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_column_statistics, max), 0, THRIFT_TYPE_BINARY, parquet_read_binary},
+  [2] = {PARQUET_OFFSET(struct parquet_column_statistics, min), 0, THRIFT_TYPE_BINARY, parquet_read_binary},
+  [3] = {PARQUET_OFFSET(struct parquet_column_statistics, null_count), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_column_statistics, distinct_count), 0, THRIFT_TYPE_I64,
+         parquet_read_i64_positive},
+  [5] = {PARQUET_OFFSET(struct parquet_column_statistics, max_value), 0, THRIFT_TYPE_BINARY, parquet_read_binary},
+  [6] = {PARQUET_OFFSET(struct parquet_column_statistics, min_value), 0, THRIFT_TYPE_BINARY, parquet_read_binary},
+  [7] = {PARQUET_OFFSET(struct parquet_column_statistics, is_max_value_exact), 0, THRIFT_TYPE_BOOL_TRUE,
+         parquet_read_bool},
+  [8] = {PARQUET_OFFSET(struct parquet_column_statistics, is_min_value_exact), 0, THRIFT_TYPE_BOOL_TRUE,
+         parquet_read_bool},
+};
 
-  // context
-  context.target = element;
-  context.arena = ctx->arena;
+static const struct parquet_parse_descriptor PARQUET_COLUMN_STATISTICS_DESCRIPTOR = {
+  .size = sizeof(struct parquet_column_statistics),
+  .fields_size = sizeof(PARQUET_COLUMN_STATISTICS_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_COLUMN_STATISTICS_DEFAULTS_VALUE,
+  .fields = PARQUET_COLUMN_STATISTICS_FIELDS,
+};
 
-  // targets
-  context.ptrs[1] = &element->page_type;
-  context.ptrs[2] = &element->encoding;
-  context.ptrs[3] = &element->count;
+static const struct parquet_column_meta PARQUET_COLUMN_META_DEFAULTS = {
+  .data_type = PARQUET_DATA_TYPE_NONE,
+  .encodings = PARQUET_NULL_VALUE,
+  .path_in_schema = PARQUET_NULL_VALUE,
+  .compression_codec = PARQUET_COMPRESSION_NONE,
+  .num_values = PARQUET_UNKNOWN_VALUE,
+  .total_uncompressed_size = PARQUET_UNKNOWN_VALUE,
+  .total_compressed_size = PARQUET_UNKNOWN_VALUE,
+  .data_page_offset = PARQUET_UNKNOWN_VALUE,
+  .index_page_offset = PARQUET_UNKNOWN_VALUE,
+  .dictionary_page_offset = PARQUET_UNKNOWN_VALUE,
+  .statistics = PARQUET_NULL_VALUE,
+  .encoding_stats = PARQUET_NULL_VALUE,
+};
 
-  // default
-  read = 0;
+// key_value_metadata (8) is ignored, min and max statistics reference the footer
+static const struct parquet_parse_field PARQUET_COLUMN_META_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_column_meta, data_type), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_column_meta, encodings), 0, THRIFT_TYPE_LIST, parquet_read_list,
+         &PARQUET_I32_POSITIVE_ITEM},
+  [3] = {PARQUET_OFFSET(struct parquet_column_meta, path_in_schema), 0, THRIFT_TYPE_LIST, parquet_read_list,
+         &PARQUET_STRING_ITEM},
+  [4] = {PARQUET_OFFSET(struct parquet_column_meta, compression_codec), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [5] = {PARQUET_OFFSET(struct parquet_column_meta, num_values), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [6] = {PARQUET_OFFSET(struct parquet_column_meta, total_uncompressed_size), 0, THRIFT_TYPE_I64,
+         parquet_read_i64_positive},
+  [7] = {PARQUET_OFFSET(struct parquet_column_meta, total_compressed_size), 0, THRIFT_TYPE_I64,
+         parquet_read_i64_positive},
+  [9] = {PARQUET_OFFSET(struct parquet_column_meta, data_page_offset), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [10] = {PARQUET_OFFSET(struct parquet_column_meta, index_page_offset), 0, THRIFT_TYPE_I64,
+          parquet_read_i64_positive},
+  [11] = {PARQUET_OFFSET(struct parquet_column_meta, dictionary_page_offset), 0, THRIFT_TYPE_I64,
+          parquet_read_i64_positive},
+  [12] = {PARQUET_OFFSET(struct parquet_column_meta, statistics), 0, THRIFT_TYPE_STRUCT, parquet_read_struct, NULL,
+          &PARQUET_COLUMN_STATISTICS_DESCRIPTOR},
+  [13] = {PARQUET_OFFSET(struct parquet_column_meta, encoding_stats), 0, THRIFT_TYPE_LIST, parquet_read_list,
+          &PARQUET_ENCODING_STATS_ITEM},
+};
 
-  // delegate content reading to the thrift function
-  result = thrift_read_struct_content(&context, fields, FIELDS_SLOTS, buffer, buffer_size);
-  if (result < 0) return result;
+static const struct parquet_parse_descriptor PARQUET_COLUMN_META_DESCRIPTOR = {
+  .size = sizeof(struct parquet_column_meta),
+  .fields_size = sizeof(PARQUET_COLUMN_META_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_COLUMN_META_DEFAULTS,
+  .fields = PARQUET_COLUMN_META_FIELDS,
+};
 
-  // move the buffer pointer and size
-  read += result;
-  buffer += result;
-  buffer_size -= result;
+static const struct parquet_column_chunk PARQUET_COLUMN_CHUNK_DEFAULTS = {
+  .file_path = PARQUET_NULL_VALUE,
+  .file_offset = PARQUET_UNKNOWN_VALUE,
+  .meta = PARQUET_NULL_VALUE,
+};
 
-  // success
-  return read;
-}
+static const struct parquet_parse_field PARQUET_COLUMN_CHUNK_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_column_chunk, file_path), 0, THRIFT_TYPE_BINARY, parquet_read_string},
+  [2] = {PARQUET_OFFSET(struct parquet_column_chunk, file_offset), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_column_chunk, meta), 0, THRIFT_TYPE_STRUCT, parquet_read_struct, NULL,
+         &PARQUET_COLUMN_META_DESCRIPTOR},
+};
 
-static i64 parquet_parse_encoding_stats(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+static const struct parquet_parse_descriptor PARQUET_COLUMN_CHUNK_DESCRIPTOR = {
+  .size = sizeof(struct parquet_column_chunk),
+  .fields_size = sizeof(PARQUET_COLUMN_CHUNK_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_COLUMN_CHUNK_DEFAULTS,
+  .fields = PARQUET_COLUMN_CHUNK_FIELDS,
+};
 
-  // fill up the context
-  ctx->target_size = sizeof(struct parquet_page_encoding_stats);
-  ctx->target_fn = (parquet_read_fn)parquet_parse_encoding_stats_element;
+static const struct parquet_parse_field PARQUET_COLUMN_CHUNK_ITEM = {
+  .size = sizeof(struct parquet_column_chunk),
+  .type = THRIFT_TYPE_STRUCT,
+  .read_fn = parquet_read_struct_inline,
+  .descriptor = &PARQUET_COLUMN_CHUNK_DESCRIPTOR,
+};
 
-  // call generic list reader
-  return parquet_read_list(ctx, field_id, field_type, buffer, buffer_size);
-}
+static const struct parquet_row_group PARQUET_ROW_GROUP_DEFAULTS = {
+  .columns = PARQUET_NULL_VALUE,
+  .total_byte_size = PARQUET_UNKNOWN_VALUE,
+  .num_rows = PARQUET_UNKNOWN_VALUE,
+  .file_offset = PARQUET_UNKNOWN_VALUE,
+  .total_compressed_size = PARQUET_UNKNOWN_VALUE,
+};
 
-static i64 parquet_parse_column_meta_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  struct parquet_column_meta *meta;
-  struct parquet_parse_context context;
-
-  const u32 FIELDS_SLOTS = 14;
-  thrift_read_fn fields[FIELDS_SLOTS];
-
-  // prepare the mapping of fields
-  fields[1] = (thrift_read_fn)parquet_read_i32_positive;      // data_type
-  fields[2] = (thrift_read_fn)parquet_read_list_i32_positive; // encodings
-  fields[3] = (thrift_read_fn)parquet_read_list_string;       // path_in_schema
-  fields[4] = (thrift_read_fn)parquet_read_i32_positive;      // compression_codec
-  fields[5] = (thrift_read_fn)parquet_read_i64_positive;      // num_values
-  fields[6] = (thrift_read_fn)parquet_read_i64_positive;      // total_uncompressed_size
-  fields[7] = (thrift_read_fn)parquet_read_i64_positive;      // total_compressed_size
-  fields[8] = (thrift_read_fn)thrift_ignore_field;            // key_value_metadata
-  fields[9] = (thrift_read_fn)parquet_read_i64_positive;      // data_page_offset
-  fields[10] = (thrift_read_fn)parquet_read_i64_positive;     // index_page_offset
-  fields[11] = (thrift_read_fn)parquet_read_i64_positive;     // dictionary_page_offset
-  fields[12] = (thrift_read_fn)thrift_ignore_field;           // statistics
-  fields[13] = (thrift_read_fn)parquet_parse_encoding_stats;  // encoding_stats
-
-  // meta
-  meta = (struct parquet_column_meta *)ctx->target;
-  meta->data_type = PARQUET_DATA_TYPE_NONE;
-  meta->encodings = PARQUET_NULL_VALUE;
-  meta->path_in_schema = PARQUET_NULL_VALUE;
-  meta->compression_codec = PARQUET_COMPRESSION_NONE;
-  meta->num_values = PARQUET_UNKNOWN_VALUE;
-  meta->total_uncompressed_size = PARQUET_UNKNOWN_VALUE;
-  meta->total_compressed_size = PARQUET_UNKNOWN_VALUE;
-  meta->data_page_offset = PARQUET_UNKNOWN_VALUE;
-  meta->index_page_offset = PARQUET_UNKNOWN_VALUE;
-  meta->dictionary_page_offset = PARQUET_UNKNOWN_VALUE;
-  meta->statistics = PARQUET_NULL_VALUE;
-  meta->encoding_stats = PARQUET_NULL_VALUE;
+// sorting_columns (4) and ordinal (7) are ignored
+static const struct parquet_parse_field PARQUET_ROW_GROUP_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_row_group, columns), 0, THRIFT_TYPE_LIST, parquet_read_list,
+         &PARQUET_COLUMN_CHUNK_ITEM},
+  [2] = {PARQUET_OFFSET(struct parquet_row_group, total_byte_size), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_row_group, num_rows), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [5] = {PARQUET_OFFSET(struct parquet_row_group, file_offset), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [6] = {PARQUET_OFFSET(struct parquet_row_group, total_compressed_size), 0, THRIFT_TYPE_I64,
+         parquet_read_i64_positive},
+};
 
-  // context
-  context.target = meta;
-  context.arena = ctx->arena;
-
-  // targets
-  context.ptrs[1] = &meta->data_type;
-  context.ptrs[2] = &meta->encodings;
-  context.ptrs[3] = &meta->path_in_schema;
-  context.ptrs[4] = &meta->compression_codec;
-  context.ptrs[5] = &meta->num_values;
-  context.ptrs[6] = &meta->total_uncompressed_size;
-  context.ptrs[7] = &meta->total_compressed_size;
-  context.ptrs[9] = &meta->data_page_offset;
-  context.ptrs[10] = &meta->index_page_offset;
-  context.ptrs[11] = &meta->dictionary_page_offset;
-  context.ptrs[12] = &meta->statistics;
-  context.ptrs[13] = &meta->encoding_stats;
+static const struct parquet_parse_descriptor PARQUET_ROW_GROUP_DESCRIPTOR = {
+  .size = sizeof(struct parquet_row_group),
+  .fields_size = sizeof(PARQUET_ROW_GROUP_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_ROW_GROUP_DEFAULTS,
+  .fields = PARQUET_ROW_GROUP_FIELDS,
+};
 
-  // default
-  read = 0;
+static const struct parquet_parse_field PARQUET_ROW_GROUP_ITEM = {
+  .size = sizeof(struct parquet_row_group),
+  .type = THRIFT_TYPE_STRUCT,
+  .read_fn = parquet_read_struct_inline,
+  .descriptor = &PARQUET_ROW_GROUP_DESCRIPTOR,
+};
 
-  // delegate content reading to the thrift function
-  result = thrift_read_struct_content(&context, fields, FIELDS_SLOTS, buffer, buffer_size);
-  if (result < 0) return result;
+static const struct parquet_metadata PARQUET_METADATA_DEFAULTS = {
+  .version = PARQUET_UNKNOWN_VALUE,
+  .schemas = PARQUET_NULL_VALUE,
+  .num_rows = PARQUET_UNKNOWN_VALUE,
+  .row_groups = PARQUET_NULL_VALUE,
+  .created_by = PARQUET_NULL_VALUE,
+};
 
-  // move the buffer pointer and size
-  read += result;
-  buffer += result;
-  buffer_size -= result;
+// key_value_metadata (5) is ignored
+static const struct parquet_parse_field PARQUET_METADATA_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_metadata, version), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_metadata, schemas), 0, THRIFT_TYPE_LIST, parquet_read_list,
+         &PARQUET_SCHEMA_ELEMENT_ITEM},
+  [3] = {PARQUET_OFFSET(struct parquet_metadata, num_rows), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_metadata, row_groups), 0, THRIFT_TYPE_LIST, parquet_read_list,
+         &PARQUET_ROW_GROUP_ITEM},
+  [6] = {PARQUET_OFFSET(struct parquet_metadata, created_by), 0, THRIFT_TYPE_BINARY, parquet_read_string},
+};
 
-  // success
-  return read;
-}
+static const struct parquet_parse_descriptor PARQUET_METADATA_DESCRIPTOR = {
+  .size = sizeof(struct parquet_metadata),
+  .fields_size = sizeof(PARQUET_METADATA_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_METADATA_DEFAULTS,
+  .fields = PARQUET_METADATA_FIELDS,
+};
 
-static i64 parquet_parse_column_meta(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+// only the number of rows is read, the column chunks are skipped
+static const struct parquet_parse_field PARQUET_ROW_GROUP_COUNTS_FIELDS[] = {
+  [3] = {PARQUET_OFFSET(struct parquet_row_group, num_rows), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+};
 
-  // fill up the context
-  ctx->target_size = sizeof(struct parquet_column_meta);
-  ctx->target_fn = (parquet_read_fn)parquet_parse_column_meta_element;
+static const struct parquet_parse_descriptor PARQUET_ROW_GROUP_COUNTS_DESCRIPTOR = {
+  .size = sizeof(struct parquet_row_group),
+  .fields_size = sizeof(PARQUET_ROW_GROUP_COUNTS_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_ROW_GROUP_DEFAULTS,
+  .fields = PARQUET_ROW_GROUP_COUNTS_FIELDS,
+};
 
-  // call generic struct reader
-  return parquet_read_struct(ctx, field_id, field_type, buffer, buffer_size);
-}
+static const struct parquet_parse_field PARQUET_ROW_GROUP_COUNTS_ITEM = {
+  .size = sizeof(struct parquet_row_group),
+  .type = THRIFT_TYPE_STRUCT,
+  .read_fn = parquet_read_struct_inline,
+  .descriptor = &PARQUET_ROW_GROUP_COUNTS_DESCRIPTOR,
+};
 
-static i64 parquet_parse_column_chunk_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  struct parquet_column_chunk *column_chunk;
-  struct parquet_parse_context context;
+static const struct parquet_row_counts PARQUET_ROW_COUNTS_DEFAULTS = {
+  .num_rows = PARQUET_UNKNOWN_VALUE,
+  .row_groups = {0, 0},
+};
 
-  const u32 FIELDS_SLOTS = 4;
-  thrift_read_fn fields[FIELDS_SLOTS];
+// the schema, the key_value_metadata and created_by are skipped
+static const struct parquet_parse_field PARQUET_ROW_COUNTS_FIELDS[] = {
+  [3] = {PARQUET_OFFSET(struct parquet_row_counts, num_rows), 0, THRIFT_TYPE_I64, parquet_read_i64_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_row_counts, row_groups), 0, THRIFT_TYPE_LIST, parquet_read_row_group_counts,
+         &PARQUET_ROW_GROUP_COUNTS_ITEM},
+};
 
-  // prepare the mapping of fields
-  fields[1] = (thrift_read_fn)parquet_read_string;       // file_path
-  fields[2] = (thrift_read_fn)parquet_read_i64_positive; // file_offset
-  fields[3] = (thrift_read_fn)parquet_parse_column_meta; // meta
+static const struct parquet_parse_descriptor PARQUET_ROW_COUNTS_DESCRIPTOR = {
+  .size = sizeof(struct parquet_row_counts),
+  .fields_size = sizeof(PARQUET_ROW_COUNTS_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_ROW_COUNTS_DEFAULTS,
+  .fields = PARQUET_ROW_COUNTS_FIELDS,
+};
 
-  // column_chunk
-  column_chunk = (struct parquet_column_chunk *)ctx->target;
-  column_chunk->file_path = PARQUET_NULL_VALUE;
-  column_chunk->file_offset = PARQUET_UNKNOWN_VALUE;
-  column_chunk->meta = PARQUET_NULL_VALUE;
+static const struct parquet_data_page_header PARQUET_DATA_PAGE_HEADER_DEFAULTS = {
+  .num_values = PARQUET_UNKNOWN_VALUE,
+  .encoding = PARQUET_ENCODING_NONE,
+  .definition_level_encoding = PARQUET_ENCODING_NONE,
+  .repetition_level_encoding = PARQUET_ENCODING_NONE,
+  .statistics = PARQUET_COLUMN_STATISTICS_DEFAULTS,
+};
 
-  // context
-  context.target = column_chunk;
-  context.arena = ctx->arena;
+static const struct parquet_parse_field PARQUET_DATA_PAGE_HEADER_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_data_page_header, num_values), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_data_page_header, encoding), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_data_page_header, definition_level_encoding), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_data_page_header, repetition_level_encoding), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [5] = {PARQUET_OFFSET(struct parquet_data_page_header, statistics), 0, THRIFT_TYPE_STRUCT, parquet_read_struct_inline,
+         NULL, &PARQUET_COLUMN_STATISTICS_DESCRIPTOR},
+};
 
-  // targets
-  context.ptrs[1] = &column_chunk->file_path;
-  context.ptrs[2] = &column_chunk->file_offset;
-  context.ptrs[3] = &column_chunk->meta;
+static const struct parquet_parse_descriptor PARQUET_DATA_PAGE_HEADER_DESCRIPTOR = {
+  .size = sizeof(struct parquet_data_page_header),
+  .fields_size = sizeof(PARQUET_DATA_PAGE_HEADER_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_DATA_PAGE_HEADER_DEFAULTS,
+  .fields = PARQUET_DATA_PAGE_HEADER_FIELDS,
+};
 
-  // default
-  read = 0;
+static const struct parquet_dictionary_page_header PARQUET_DICTIONARY_PAGE_HEADER_DEFAULTS = {
+  .num_values = PARQUET_UNKNOWN_VALUE,
+  .encoding = PARQUET_ENCODING_NONE,
+  .is_sorted = FALSE,
+};
 
-  // delegate content reading to the thrift function
-  result = thrift_read_struct_content(&context, fields, FIELDS_SLOTS, buffer, buffer_size);
-  if (result < 0) return result;
+static const struct parquet_parse_field PARQUET_DICTIONARY_PAGE_HEADER_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_dictionary_page_header, num_values), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_dictionary_page_header, encoding), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_dictionary_page_header, is_sorted), 0, THRIFT_TYPE_BOOL_TRUE,
+         parquet_read_bool},
+};
 
-  // move the buffer pointer and size
-  read += result;
-  buffer += result;
-  buffer_size -= result;
+static const struct parquet_parse_descriptor PARQUET_DICTIONARY_PAGE_HEADER_DESCRIPTOR = {
+  .size = sizeof(struct parquet_dictionary_page_header),
+  .fields_size = sizeof(PARQUET_DICTIONARY_PAGE_HEADER_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_DICTIONARY_PAGE_HEADER_DEFAULTS,
+  .fields = PARQUET_DICTIONARY_PAGE_HEADER_FIELDS,
+};
 
-  // success
-  return read;
-}
+static const struct parquet_data_page_header_v2 PARQUET_DATA_PAGE_HEADER_V2_DEFAULTS = {
+  .num_values = PARQUET_UNKNOWN_VALUE,
+  .num_nulls = PARQUET_UNKNOWN_VALUE,
+  .num_rows = PARQUET_UNKNOWN_VALUE,
+  .encoding = PARQUET_ENCODING_NONE,
+  .definition_levels_byte_length = PARQUET_UNKNOWN_VALUE,
+  .repetition_levels_byte_length = PARQUET_UNKNOWN_VALUE,
+  .is_compressed = TRUE,
+  .statistics = PARQUET_COLUMN_STATISTICS_DEFAULTS,
+};
 
-static i64 parquet_parse_column_chunks(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
+static const struct parquet_parse_field PARQUET_DATA_PAGE_HEADER_V2_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, num_values), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, num_nulls), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, num_rows), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, encoding), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [5] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, definition_levels_byte_length), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [6] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, repetition_levels_byte_length), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [7] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, is_compressed), 0, THRIFT_TYPE_BOOL_TRUE,
+         parquet_read_bool},
+  [8] = {PARQUET_OFFSET(struct parquet_data_page_header_v2, statistics), 0, THRIFT_TYPE_STRUCT,
+         parquet_read_struct_inline, NULL, &PARQUET_COLUMN_STATISTICS_DESCRIPTOR},
+};
 
-  // fill up the context
-  ctx->target_size = sizeof(struct parquet_column_chunk);
-  ctx->target_fn = (parquet_read_fn)parquet_parse_column_chunk_element;
+static const struct parquet_parse_descriptor PARQUET_DATA_PAGE_HEADER_V2_DESCRIPTOR = {
+  .size = sizeof(struct parquet_data_page_header_v2),
+  .fields_size = sizeof(PARQUET_DATA_PAGE_HEADER_V2_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_DATA_PAGE_HEADER_V2_DEFAULTS,
+  .fields = PARQUET_DATA_PAGE_HEADER_V2_FIELDS,
+};
 
-  // call generic list reader
-  return parquet_read_list(ctx, field_id, field_type, buffer, buffer_size);
-}
+static const struct parquet_page_header PARQUET_PAGE_HEADER_DEFAULTS = {
+  .type = PARQUET_PAGE_TYPE_NONE,
+  .uncompressed_page_size = PARQUET_UNKNOWN_VALUE,
+  .compressed_page_size = PARQUET_UNKNOWN_VALUE,
+  .crc = PARQUET_UNKNOWN_VALUE,
+  .data =
+    {
+      .num_values = PARQUET_UNKNOWN_VALUE,
+      .encoding = PARQUET_ENCODING_NONE,
+      .definition_level_encoding = PARQUET_ENCODING_NONE,
+      .repetition_level_encoding = PARQUET_ENCODING_NONE,
+      .statistics = PARQUET_COLUMN_STATISTICS_DEFAULTS,
+    },
+  .dictionary =
+    {
+      .num_values = PARQUET_UNKNOWN_VALUE,
+      .encoding = PARQUET_ENCODING_NONE,
+      .is_sorted = FALSE,
+    },
+  .data_v2 =
+    {
+      .num_values = PARQUET_UNKNOWN_VALUE,
+      .num_nulls = PARQUET_UNKNOWN_VALUE,
+      .num_rows = PARQUET_UNKNOWN_VALUE,
+      .encoding = PARQUET_ENCODING_NONE,
+      .definition_levels_byte_length = PARQUET_UNKNOWN_VALUE,
+      .repetition_levels_byte_length = PARQUET_UNKNOWN_VALUE,
+      .is_compressed = TRUE,
+      .statistics = PARQUET_COLUMN_STATISTICS_DEFAULTS,
+    },
+};
 
-static i64 parquet_parse_row_group_element(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  struct parquet_row_group *row_group;
-  struct parquet_parse_context context;
-
-  const u32 FIELDS_SLOTS = 8;
-  thrift_read_fn fields[FIELDS_SLOTS];
-
-  // prepare the mapping of fields
-  fields[1] = (thrift_read_fn)parquet_parse_column_chunks; // columns
-  fields[2] = (thrift_read_fn)parquet_read_i64_positive;   // total_byte_size
-  fields[3] = (thrift_read_fn)parquet_read_i64_positive;   // num_rows
-  fields[4] = (thrift_read_fn)thrift_ignore_field;         // sorting_columns
-  fields[5] = (thrift_read_fn)parquet_read_i64_positive;   // file_offset
-  fields[6] = (thrift_read_fn)parquet_read_i64_positive;   // total_compressed_size
-  fields[7] = (thrift_read_fn)thrift_ignore_field;         // ordinal
-
-  // row_group
-  row_group = (struct parquet_row_group *)ctx->target;
-  row_group->columns = PARQUET_NULL_VALUE;
-  row_group->total_byte_size = PARQUET_UNKNOWN_VALUE;
-  row_group->num_rows = PARQUET_UNKNOWN_VALUE;
-  row_group->file_offset = PARQUET_UNKNOWN_VALUE;
-  row_group->total_compressed_size = PARQUET_UNKNOWN_VALUE;
+// index_page_header (6) is ignored, it has no fields
+static const struct parquet_parse_field PARQUET_PAGE_HEADER_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_page_header, type), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_page_header, uncompressed_page_size), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [3] = {PARQUET_OFFSET(struct parquet_page_header, compressed_page_size), 0, THRIFT_TYPE_I32,
+         parquet_read_i32_positive},
+  [4] = {PARQUET_OFFSET(struct parquet_page_header, crc), 0, THRIFT_TYPE_I32, parquet_read_crc},
+  [5] = {PARQUET_OFFSET(struct parquet_page_header, data), 0, THRIFT_TYPE_STRUCT, parquet_read_struct_inline, NULL,
+         &PARQUET_DATA_PAGE_HEADER_DESCRIPTOR},
+  [7] = {PARQUET_OFFSET(struct parquet_page_header, dictionary), 0, THRIFT_TYPE_STRUCT, parquet_read_struct_inline,
+         NULL, &PARQUET_DICTIONARY_PAGE_HEADER_DESCRIPTOR},
+  [8] = {PARQUET_OFFSET(struct parquet_page_header, data_v2), 0, THRIFT_TYPE_STRUCT, parquet_read_struct_inline,
+         NULL, &PARQUET_DATA_PAGE_HEADER_V2_DESCRIPTOR},
+};
 
-  // context
-  context.target = row_group;
-  context.arena = ctx->arena;
+static const struct parquet_parse_descriptor PARQUET_PAGE_HEADER_DESCRIPTOR = {
+  .size = sizeof(struct parquet_page_header),
+  .fields_size = sizeof(PARQUET_PAGE_HEADER_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_PAGE_HEADER_DEFAULTS,
+  .fields = PARQUET_PAGE_HEADER_FIELDS,
+};
 
-  // targets
-  context.ptrs[1] = &row_group->columns;
-  context.ptrs[2] = &row_group->total_byte_size;
-  context.ptrs[3] = &row_group->num_rows;
-  context.ptrs[5] = &row_group->file_offset;
-  context.ptrs[6] = &row_group->total_compressed_size;
+i64 parquet_parse(struct parquet_file *file, struct parquet_metadata *metadata) {
+  i64 result;
+  struct parquet_parse_context ctx;
 
-  // default
-  read = 0;
+  // initialize the context
+  ctx.arena = &file->arena;
 
-  // delegate content reading to the thrift function
-  result = thrift_read_struct_content(&context, fields, FIELDS_SLOTS, buffer, buffer_size);
+  // parse the footer as the root structure
+  result = parquet_read_fields(&ctx, &PARQUET_METADATA_DESCRIPTOR, metadata, file->footer.start, file->footer.size);
   if (result < 0) return result;
 
-  // move the buffer pointer and size
-  read += result;
-  buffer += result;
-  buffer_size -= result;
-
-  // success
-  return read;
-}
-
-static i64 parquet_parse_row_groups(
-  struct parquet_parse_context *ctx, i16 field_id, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
-
-  // fill up the context
-  ctx->target_size = sizeof(struct parquet_row_group);
-  ctx->target_fn = (parquet_read_fn)parquet_parse_row_group_element;
-
-  // call generic list reader
-  return parquet_read_list(ctx, field_id, field_type, buffer, buffer_size);
+  return 0;
 }
 
-static i64 parquet_parse_footer(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  struct parquet_metadata *metadata;
-
-  const u32 FIELDS_SLOTS = 7;
-  thrift_read_fn fields[FIELDS_SLOTS];
-
-  // prepare the mapping of fields
-  fields[1] = (thrift_read_fn)parquet_read_i32_positive; // version
-  fields[2] = (thrift_read_fn)parquet_parse_schemas;     // schemas
-  fields[3] = (thrift_read_fn)parquet_read_i64_positive; // num_rows
-  fields[4] = (thrift_read_fn)parquet_parse_row_groups;  // row_groups
-  fields[5] = (thrift_read_fn)thrift_ignore_field;       // ignored
-  fields[6] = (thrift_read_fn)parquet_read_string;       // created_by
-
-  // behind target we have metadata
-  metadata = (struct parquet_metadata *)ctx->target;
-  metadata->version = PARQUET_UNKNOWN_VALUE;
-  metadata->schemas = PARQUET_NULL_VALUE;
-  metadata->num_rows = PARQUET_UNKNOWN_VALUE;
-  metadata->row_groups = PARQUET_NULL_VALUE;
-  metadata->created_by = PARQUET_NULL_VALUE;
-
-  // targets
-  ctx->ptrs[1] = &metadata->version;
-  ctx->ptrs[2] = &metadata->schemas;
-  ctx->ptrs[3] = &metadata->num_rows;
-  ctx->ptrs[4] = &metadata->row_groups;
-  ctx->ptrs[6] = &metadata->created_by;
+i64 parquet_parse_counts(struct parquet_file *file, struct parquet_row_counts *counts) {
+  i64 result;
+  struct parquet_parse_context ctx;
 
-  // default
-  read = 0;
+  // counts are reduced inline, nothing is allocated
+  ctx.arena = NULL;
 
-  // delegate content reading to the thrift function
-  result = thrift_read_struct_content(ctx, fields, FIELDS_SLOTS, buffer, buffer_size);
+  // parse the footer as the root structure
+  result = parquet_read_fields(&ctx, &PARQUET_ROW_COUNTS_DESCRIPTOR, counts, file->footer.start, file->footer.size);
   if (result < 0) return result;
 
-  // move the buffer pointer and size
-  read += result;
-  buffer += result;
-  buffer_size -= result;
+  // the number of rows is required
+  if (counts->num_rows == PARQUET_UNKNOWN_VALUE) return PARQUET_ERROR_INVALID_VALUE;
 
-  // success
-  return read;
+  return 0;
 }
 
-i64 parquet_parse(struct parquet_file *file, struct parquet_metadata *metadata) {
-  i64 result;
-  char *buffer;
-  u64 buffer_size;
-
+i64 parquet_parse_page_header(struct parquet_page_header *header, const char *buffer, u64 buffer_size) {
   struct parquet_parse_context ctx;
 
-  // initialize the context
-  ctx.target = metadata;
-  ctx.arena = &file->arena;
+  // page headers are kept inline, nothing is allocated
+  ctx.arena = NULL;
 
-  // initialize
-  buffer = file->footer.start;
-  buffer_size = file->footer.size;
-
-  // parse the footer as the root structure
-  result = parquet_parse_footer(&ctx, buffer, buffer_size);
-  if (result < 0) return result;
-
-  // move the buffer pointer and size
-  buffer += result;
-  buffer_size -= result;
-
-  return 0;
+  // parse the page header as the root structure
+  return parquet_read_fields(&ctx, &PARQUET_PAGE_HEADER_DESCRIPTOR, header, buffer, buffer_size);
 }
 
 #if defined(I13C_TESTS)
@@ -690,10 +860,9 @@ static void can_read_i32_positive() {
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_i32_positive(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  result = parquet_read_i32_positive(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 1, "should read one byte");
@@ -705,14 +874,17 @@ static void can_detect_i32_positive_invalid_type() {
   i32 value;
 
   i64 result;
-  const char buffer[] = {0x02}; // zig-zag encoding of version 1
+  const char buffer[] = {0x14, 0x02, 0x00}; // field 1 as i16 instead of i32
+
+  const i32 defaults = 0;
+  const struct parquet_parse_field fields[] = {[1] = {0, 0, THRIFT_TYPE_I32, parquet_read_i32_positive}};
+  const struct parquet_parse_descriptor descriptor = {sizeof(i32), 2, &defaults, fields};
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
-  // read the value from the buffer
-  result = parquet_read_i32_positive(&ctx, 1, THRIFT_TYPE_I16, buffer, sizeof(buffer));
+  // read the struct from the buffer
+  result = parquet_read_fields(&ctx, &descriptor, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -728,10 +900,9 @@ static void can_detect_i32_positive_invalid_value() {
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_i32_positive(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  result = parquet_read_i32_positive(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
@@ -747,10 +918,9 @@ static void can_propagate_i32_positive_buffer_overflow() {
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_i32_positive(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  result = parquet_read_i32_positive(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -766,10 +936,9 @@ static void can_read_i64_positive() {
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_i64_positive(&ctx, 1, THRIFT_TYPE_I64, buffer, sizeof(buffer));
+  result = parquet_read_i64_positive(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 3, "should read three bytes");
@@ -781,14 +950,17 @@ static void can_detect_i64_positive_invalid_type() {
   i64 value;
 
   i64 result;
-  const char buffer[] = {0xf2, 0x94, 0x12};
+  const char buffer[] = {0x15, 0xf2, 0x94, 0x12, 0x00}; // field 1 as i32 instead of i64
+
+  const i64 defaults = 0;
+  const struct parquet_parse_field fields[] = {[1] = {0, 0, THRIFT_TYPE_I64, parquet_read_i64_positive}};
+  const struct parquet_parse_descriptor descriptor = {sizeof(i64), 2, &defaults, fields};
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
-  // read the version from the buffer
-  result = parquet_read_i64_positive(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  // read the struct from the buffer
+  result = parquet_read_fields(&ctx, &descriptor, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -804,10 +976,9 @@ static void can_detect_i64_positive_invalid_value() {
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_i64_positive(&ctx, 1, THRIFT_TYPE_I64, buffer, sizeof(buffer));
+  result = parquet_read_i64_positive(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
@@ -823,10 +994,9 @@ static void can_propagate_i64_positive_buffer_overflow() {
 
   // defaults
   value = 0;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_i64_positive(&ctx, 1, THRIFT_TYPE_I64, buffer, sizeof(buffer));
+  result = parquet_read_i64_positive(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -852,10 +1022,9 @@ static void can_read_string() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_string(&ctx, 1, THRIFT_TYPE_BINARY, buffer, sizeof(buffer));
+  result = parquet_read_string(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 5, "should read five bytes");
@@ -878,7 +1047,11 @@ static void can_detect_string_invalid_type() {
   char *value;
 
   i64 result;
-  const char buffer[] = {0x05, 'i', '1', '3', 'c'};
+  const char buffer[] = {0x19, 0x05, 'i', '1', '3', 'c', 0x00}; // field 1 as list instead of binary
+
+  const char *defaults = NULL;
+  const struct parquet_parse_field fields[] = {[1] = {0, 0, THRIFT_TYPE_BINARY, parquet_read_string}};
+  const struct parquet_parse_descriptor descriptor = {sizeof(char *), 2, &defaults, fields};
 
   // defaults
   value = NULL;
@@ -889,10 +1062,9 @@ static void can_detect_string_invalid_type() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &value;
 
-  // read the value from the buffer
-  result = parquet_read_string(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  // read the struct from the buffer
+  result = parquet_read_fields(&ctx, &descriptor, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -929,10 +1101,9 @@ static void can_detect_string_arena_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_string(&ctx, 1, THRIFT_TYPE_BINARY, buffer, sizeof(buffer));
+  result = parquet_read_string(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == ARENA_ERROR_OUT_OF_MEMORY, "should fail with ARENA_ERROR_OUT_OF_MEMORY");
@@ -963,10 +1134,9 @@ static void can_propagate_string_buffer_overflow_01() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_string(&ctx, 1, THRIFT_TYPE_BINARY, buffer, sizeof(buffer));
+  result = parquet_read_string(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -997,10 +1167,9 @@ static void can_propagate_string_buffer_overflow_02() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &value;
 
   // read the value from the buffer
-  result = parquet_read_string(&ctx, 1, THRIFT_TYPE_BINARY, buffer, sizeof(buffer));
+  result = parquet_read_string(&ctx, NULL, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -1012,13 +1181,12 @@ static void can_propagate_string_buffer_overflow_02() {
   malloc_destroy(&pool);
 }
 
-static i64 can_read_list_item(struct parquet_parse_context *ctx, const char *buffer, u64 buffer_size) {
-  // hide the target pointer behind 0
-  ctx->ptrs[0] = ctx->target;
+// represents a list of i64 values kept inline
+static const struct parquet_parse_field PARQUET_TEST_I64_ITEM = {
+  .size = sizeof(i64), .type = THRIFT_TYPE_I64, .read_fn = parquet_read_i64_positive};
 
-  // delegate reading to known function
-  return parquet_read_i64_positive(ctx, 0, THRIFT_TYPE_I64, buffer, buffer_size);
-}
+static const struct parquet_parse_field PARQUET_TEST_I64_LIST = {
+  .type = THRIFT_TYPE_LIST, .read_fn = parquet_read_list, .item = &PARQUET_TEST_I64_ITEM};
 
 static void can_read_list() {
   struct malloc_pool pool;
@@ -1039,12 +1207,9 @@ static void can_read_list() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
-  ctx.target_size = 8;
-  ctx.target_fn = (parquet_read_fn)can_read_list_item;
 
   // read the value from the buffer
-  result = parquet_read_list(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I64_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 6, "should read six bytes");
@@ -1074,10 +1239,9 @@ static void can_detect_list_invalid_type() {
   i64 **values;
 
   i64 result;
-  const char buffer[] = {0x46, 0x02, 0x04, 0x06, 0xf2, 0x14};
+  const char buffer[] = {0x45, 0x02, 0x04, 0x06, 0xf2, 0x14}; // i32 elements instead of i64
 
   // defaults
-  ctx.ptrs[1] = &values;
   values = NULL;
 
   // arena
@@ -1086,11 +1250,9 @@ static void can_detect_list_invalid_type() {
 
   // context
   ctx.arena = &arena;
-  ctx.target_size = 8;
-  ctx.target_fn = (parquet_read_fn)can_read_list_item;
 
   // read the value from the buffer
-  result = parquet_read_list(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I64_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -1126,12 +1288,9 @@ static void can_detect_list_arena_overflow_01() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
-  ctx.target_size = 8;
-  ctx.target_fn = (parquet_read_fn)can_read_list_item;
 
   // read the value from the buffer
-  result = parquet_read_list(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I64_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == ARENA_ERROR_OUT_OF_MEMORY, "should fail with ARENA_ERROR_OUT_OF_MEMORY");
@@ -1167,12 +1326,9 @@ static void can_detect_list_buffer_overflow_02() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
-  ctx.target_size = 8;
-  ctx.target_fn = (parquet_read_fn)can_read_list_item;
 
   // read the value from the buffer
-  result = parquet_read_list(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer) - 1);
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I64_LIST, &values, buffer, sizeof(buffer) - 1);
 
   // assert the result
   assert(result == ARENA_ERROR_OUT_OF_MEMORY, "should fail with ARENA_ERROR_OUT_OF_MEMORY");
@@ -1203,12 +1359,9 @@ static void can_propagate_list_buffer_overflow_01() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
-  ctx.target_size = 8;
-  ctx.target_fn = (parquet_read_fn)can_read_list_item;
 
   // read the value from the buffer
-  result = parquet_read_list(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I64_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -1239,12 +1392,9 @@ static void can_propagate_list_buffer_overflow_02() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
-  ctx.target_size = 8;
-  ctx.target_fn = (parquet_read_fn)can_read_list_item;
 
   // read the value from the buffer
-  result = parquet_read_list(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer) - 1);
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I64_LIST, &values, buffer, sizeof(buffer) - 1);
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -1256,24 +1406,40 @@ static void can_propagate_list_buffer_overflow_02() {
   malloc_destroy(&pool);
 }
 
-static i64 can_read_struct_item(struct parquet_parse_context *, const char *, u64 buffer_size) {
-  return buffer_size ? 1 : THRIFT_ERROR_BUFFER_OVERFLOW;
-}
+struct parquet_test_sample {
+  i32 len;
+  char *name;
+};
 
-static void can_read_struct() {
-  struct sample {
-    i32 len;
-    char **name;
-  };
+static const struct parquet_test_sample PARQUET_TEST_SAMPLE_DEFAULTS = {
+  .len = PARQUET_UNKNOWN_VALUE,
+  .name = PARQUET_NULL_VALUE,
+};
+
+static const struct parquet_parse_field PARQUET_TEST_SAMPLE_FIELDS[] = {
+  [1] = {PARQUET_OFFSET(struct parquet_test_sample, len), 0, THRIFT_TYPE_I32, parquet_read_i32_positive},
+  [2] = {PARQUET_OFFSET(struct parquet_test_sample, name), 0, THRIFT_TYPE_BINARY, parquet_read_string},
+};
 
+static const struct parquet_parse_descriptor PARQUET_TEST_SAMPLE_DESCRIPTOR = {
+  .size = sizeof(struct parquet_test_sample),
+  .fields_size = sizeof(PARQUET_TEST_SAMPLE_FIELDS) / sizeof(struct parquet_parse_field),
+  .defaults = &PARQUET_TEST_SAMPLE_DEFAULTS,
+  .fields = PARQUET_TEST_SAMPLE_FIELDS,
+};
+
+static const struct parquet_parse_field PARQUET_TEST_SAMPLE_STRUCT = {
+  .type = THRIFT_TYPE_STRUCT, .read_fn = parquet_read_struct, .descriptor = &PARQUET_TEST_SAMPLE_DESCRIPTOR};
+
+static void can_read_struct() {
   struct malloc_pool pool;
   struct arena_allocator arena;
 
   struct parquet_parse_context ctx;
-  struct sample *value;
+  struct parquet_test_sample *value;
 
   i64 result;
-  const char buffer[] = {0x01};
+  const char buffer[] = {0x00};
 
   // defaults
   value = NULL;
@@ -1284,17 +1450,16 @@ static void can_read_struct() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[0] = &value;
-  ctx.target_size = sizeof(struct sample);
-  ctx.target_fn = (parquet_read_fn)can_read_struct_item;
 
   // read the value from the buffer
-  result = parquet_read_struct(&ctx, 0, THRIFT_TYPE_STRUCT, buffer, sizeof(buffer));
+  result = parquet_read_struct(&ctx, &PARQUET_TEST_SAMPLE_STRUCT, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 1, "should read one byte");
   assert(value != NULL, "should allocate value");
   assert((u64)value % 8 == 0, "should be aligned to 8 bytes");
+  assert(value->len == PARQUET_UNKNOWN_VALUE, "should apply default len");
+  assert(value->name == PARQUET_NULL_VALUE, "should apply default name");
   assert(arena_occupied(&arena) == 16, "should occupy 16 bytes");
 
   // release
@@ -1307,10 +1472,14 @@ static void can_detect_struct_invalid_type() {
   struct arena_allocator arena;
 
   struct parquet_parse_context ctx;
-  struct sample *value;
+  struct parquet_test_sample *value;
 
   i64 result;
-  const char buffer[] = {0x01};
+  const char buffer[] = {0x19, 0x00, 0x00}; // field 1 as list instead of struct
+
+  const struct parquet_test_sample *defaults = NULL;
+  const struct parquet_parse_field fields[] = {[1] = PARQUET_TEST_SAMPLE_STRUCT};
+  const struct parquet_parse_descriptor descriptor = {sizeof(void *), 2, &defaults, fields};
 
   // defaults
   value = NULL;
@@ -1321,12 +1490,9 @@ static void can_detect_struct_invalid_type() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[0] = &value;
-  ctx.target_size = sizeof(value);
-  ctx.target_fn = (parquet_read_fn)can_read_struct_item;
 
-  // read the value from the buffer
-  result = parquet_read_struct(&ctx, 0, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  // read the struct from the buffer
+  result = parquet_read_fields(&ctx, &descriptor, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -1343,12 +1509,12 @@ static void can_detect_struct_buffer_overflow() {
   struct arena_allocator arena;
 
   struct parquet_parse_context ctx;
-  struct sample *value;
+  struct parquet_test_sample *value;
 
   void *ptr;
   i64 result;
   u64 cursor;
-  const char buffer[] = {0x01};
+  const char buffer[] = {0x00};
 
   // defaults
   value = NULL;
@@ -1362,12 +1528,9 @@ static void can_detect_struct_buffer_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[0] = &value;
-  ctx.target_size = sizeof(value);
-  ctx.target_fn = (parquet_read_fn)can_read_struct_item;
 
   // read the value from the buffer
-  result = parquet_read_struct(&ctx, 0, THRIFT_TYPE_STRUCT, buffer, sizeof(buffer));
+  result = parquet_read_struct(&ctx, &PARQUET_TEST_SAMPLE_STRUCT, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == ARENA_ERROR_OUT_OF_MEMORY, "should fail with ARENA_ERROR_OUT_OF_MEMORY");
@@ -1384,7 +1547,7 @@ static void can_propagate_struct_buffer_overflow() {
   struct arena_allocator arena;
 
   struct parquet_parse_context ctx;
-  struct sample *value;
+  struct parquet_test_sample *value;
 
   i64 result;
   const char buffer[] = {};
@@ -1398,12 +1561,9 @@ static void can_propagate_struct_buffer_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[0] = &value;
-  ctx.target_size = sizeof(value);
-  ctx.target_fn = (parquet_read_fn)can_read_struct_item;
 
   // read the value from the buffer
-  result = parquet_read_struct(&ctx, 0, THRIFT_TYPE_STRUCT, buffer, sizeof(buffer));
+  result = parquet_read_struct(&ctx, &PARQUET_TEST_SAMPLE_STRUCT, &value, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -1415,6 +1575,225 @@ static void can_propagate_struct_buffer_overflow() {
   malloc_destroy(&pool);
 }
 
+static void can_read_fields_with_defaults() {
+  struct malloc_pool pool;
+  struct arena_allocator arena;
+
+  struct parquet_parse_context ctx;
+  struct parquet_test_sample value;
+
+  i64 result;
+  const char buffer[] = {0x28, 0x04, 'i', '1', '3', 'c', 0x15, 0x02, 0x00}; // field 2, field 3 and stop
+
+  // arena
+  malloc_init(&pool);
+  arena_init(&arena, &pool, 4096, 4096);
+
+  // context
+  ctx.arena = &arena;
+
+  // read the struct from the buffer
+  result = parquet_read_fields(&ctx, &PARQUET_TEST_SAMPLE_DESCRIPTOR, &value, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == 9, "should read nine bytes");
+  assert(value.len == PARQUET_UNKNOWN_VALUE, "should keep default len");
+  assert_eq_str(value.name, "i13c", "should read name 'i13c'");
+
+  // release
+  arena_destroy(&arena);
+  malloc_destroy(&pool);
+}
+
+static void can_read_schema_element_descriptor() {
+  struct malloc_pool pool;
+  struct arena_allocator arena;
+
+  struct parquet_parse_context ctx;
+  struct parquet_schema_element value;
+
+  i64 result;
+  const char buffer[] = {0x15, 0x02, 0x38, 0x02, 'i', 'd', 0x00}; // data_type=INT32, name="id"
+
+  // arena
+  malloc_init(&pool);
+  arena_init(&arena, &pool, 4096, 4096);
+
+  // context
+  ctx.arena = &arena;
+
+  // read the struct from the buffer
+  result = parquet_read_fields(&ctx, &PARQUET_SCHEMA_ELEMENT_DESCRIPTOR, &value, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == 7, "should read seven bytes");
+  assert(value.data_type == PARQUET_DATA_TYPE_INT32, "should read data type INT32");
+  assert_eq_str(value.name, "id", "should read name 'id'");
+  assert(value.repetition_type == PARQUET_REPETITION_TYPE_NONE, "should keep default repetition type");
+  assert(value.num_children == PARQUET_UNKNOWN_VALUE, "should keep default num children");
+
+  // release
+  arena_destroy(&arena);
+  malloc_destroy(&pool);
+}
+
+static void can_read_page_header_descriptor() {
+  struct parquet_page_header value;
+
+  i64 result;
+  const char buffer[] = {
+    0x15, 0x00,             // type=DATA_PAGE
+    0x15, 0xc8, 0x01,       // uncompressed_page_size=100
+    0x15, 0x64,             // compressed_page_size=50
+    0x15, 0x01,             // crc=-1
+    0x1c,                   // data_page_header
+    0x15, 0x06,             // num_values=3
+    0x15, 0x00,             // encoding=PLAIN
+    0x15, 0x06,             // definition_level_encoding=RLE
+    0x15, 0x06,             // repetition_level_encoding=RLE
+    0x1c,                   // statistics
+    0x36, 0x02,             // null_count=1
+    0x28, 0x01, 'z',        // max_value="z"
+    0x18, 0x01, 'a',        // min_value="a"
+    0x11,                   // is_max_value_exact=true
+    0x12,                   // is_min_value_exact=false
+    0x00, 0x00, 0x00};      // stops
+
+  // read the page header from the buffer
+  result = parquet_parse_page_header(&value, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == sizeof(buffer), "should read the entire buffer");
+  assert(value.type == PARQUET_PAGE_TYPE_DATA_PAGE, "should read type DATA_PAGE");
+  assert(value.uncompressed_page_size == 100, "should read uncompressed size 100");
+  assert(value.compressed_page_size == 50, "should read compressed size 50");
+  assert(value.crc == 0xffffffff, "should read crc as unsigned");
+
+  // assert the data page header
+  assert(value.data.num_values == 3, "should read 3 values");
+  assert(value.data.encoding == PARQUET_ENCODING_PLAIN, "should read encoding PLAIN");
+  assert(value.data.definition_level_encoding == PARQUET_ENCODING_RLE, "should read definition encoding RLE");
+  assert(value.data.repetition_level_encoding == PARQUET_ENCODING_RLE, "should read repetition encoding RLE");
+
+  // assert the statistics
+  assert(value.data.statistics.null_count == 1, "should read null count 1");
+  assert(value.data.statistics.distinct_count == PARQUET_UNKNOWN_VALUE, "should keep default distinct count");
+  assert(value.data.statistics.max_value.size == 1, "should read max value size");
+  assert(value.data.statistics.max_value.ptr == buffer + 23, "should reference max value in the buffer");
+  assert(value.data.statistics.min_value.ptr == buffer + 26, "should reference min value in the buffer");
+  assert(value.data.statistics.max.ptr == NULL, "should keep default max");
+  assert(value.data.statistics.is_max_value_exact == TRUE, "should read exact max");
+  assert(value.data.statistics.is_min_value_exact == FALSE, "should read inexact min");
+
+  // assert the other headers keep defaults
+  assert(value.dictionary.num_values == PARQUET_UNKNOWN_VALUE, "should keep default dictionary");
+  assert(value.data_v2.is_compressed == TRUE, "should keep default compression flag");
+}
+
+static void can_detect_page_header_buffer_overflow() {
+  struct parquet_page_header value;
+
+  i64 result;
+  // statistics claim a 5-byte max_value, but only one byte follows
+  const char buffer[] = {0x15, 0x00, 0x15, 0xc8, 0x01, 0x15, 0x64, 0x2c, 0x15, 0x06, 0x4c, 0x58, 0x05, 'a'};
+
+  // read the page header from the truncated buffer
+  result = parquet_parse_page_header(&value, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
+}
+
+static void can_read_column_meta_statistics() {
+  struct malloc_pool pool;
+  struct arena_allocator arena;
+
+  struct parquet_parse_context ctx;
+  struct parquet_column_meta value;
+
+  i64 result;
+  const char buffer[] = {
+    0x15, 0x02,               // data_type=INT32
+    0xbc,                     // statistics
+    0x36, 0x00,               // null_count=0
+    0x28, 0x04, 42, 0, 0, 0,  // max_value=42
+    0x18, 0x04, 7, 0, 0, 0,   // min_value=7
+    0x00, 0x00};              // stops
+
+  // arena
+  malloc_init(&pool);
+  arena_init(&arena, &pool, 4096, 4096);
+
+  // context
+  ctx.arena = &arena;
+
+  // read the column meta from the buffer
+  result = parquet_read_fields(&ctx, &PARQUET_COLUMN_META_DESCRIPTOR, &value, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == sizeof(buffer), "should read the entire buffer");
+  assert(value.data_type == PARQUET_DATA_TYPE_INT32, "should read data type INT32");
+  assert(value.statistics != NULL, "should read statistics from field 12");
+
+  // the bounds are not copied, they reference the footer
+  assert(value.statistics->null_count == 0, "should read null count 0");
+  assert(value.statistics->max_value.ptr == buffer + 7, "should reference max value in the buffer");
+  assert(value.statistics->max_value.size == 4, "should read max value size");
+  assert(value.statistics->min_value.ptr == buffer + 13, "should reference min value in the buffer");
+  assert(value.statistics->min_value.size == 4, "should read min value size");
+  assert(value.statistics->max.ptr == NULL, "should keep default max");
+  assert(value.statistics->min.ptr == NULL, "should keep default min");
+
+  // release
+  arena_destroy(&arena);
+  malloc_destroy(&pool);
+}
+
+static void can_read_column_meta_deprecated_bounds() {
+  struct malloc_pool pool;
+  struct arena_allocator arena;
+
+  struct parquet_parse_context ctx;
+  struct parquet_column_meta value;
+
+  i64 result;
+  const char buffer[] = {
+    0x15, 0x02,               // data_type=INT32
+    0xbc,                     // statistics
+    0x18, 0x04, 42, 0, 0, 0,  // max=42
+    0x18, 0x04, 7, 0, 0, 0,   // min=7
+    0x00, 0x00};              // stops
+
+  // arena
+  malloc_init(&pool);
+  arena_init(&arena, &pool, 4096, 4096);
+
+  // context
+  ctx.arena = &arena;
+
+  // read the column meta from the buffer
+  result = parquet_read_fields(&ctx, &PARQUET_COLUMN_META_DESCRIPTOR, &value, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == sizeof(buffer), "should read the entire buffer");
+  assert(value.statistics != NULL, "should read statistics from field 12");
+
+  // writers predating min_value and max_value only fill the deprecated fields
+  assert(value.statistics->max_value.ptr == NULL, "should keep default max value");
+  assert(value.statistics->min_value.ptr == NULL, "should keep default min value");
+  assert(value.statistics->max.ptr == buffer + 5, "should reference max in the buffer");
+  assert(value.statistics->min.ptr == buffer + 11, "should reference min in the buffer");
+  assert(value.statistics->null_count == PARQUET_UNKNOWN_VALUE, "should keep default null count");
+
+  // release
+  arena_destroy(&arena);
+  malloc_destroy(&pool);
+}
+
+// represents a list of strings as the field
+static const struct parquet_parse_field PARQUET_TEST_STRING_LIST = {
+  .type = THRIFT_TYPE_LIST, .read_fn = parquet_read_list, .item = &PARQUET_STRING_ITEM};
+
 static void can_read_list_strings() {
   struct malloc_pool pool;
   struct arena_allocator arena;
@@ -1426,7 +1805,6 @@ static void can_read_list_strings() {
   const char buffer[] = {0x28, 0x03, 'a', 'b', 'c', 0x04, 'i', '1', '3', 'c'};
 
   // defaults
-  ctx.ptrs[1] = &values;
   values = NULL;
 
   // arena
@@ -1437,7 +1815,7 @@ static void can_read_list_strings() {
   ctx.arena = &arena;
 
   // read the value from the buffer
-  result = parquet_read_list_string(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_STRING_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 10, "should read ten bytes");
@@ -1466,7 +1844,7 @@ static void can_detect_list_strings_invalid_type() {
   char **values;
 
   i64 result;
-  const char buffer[] = {0x28, 0x03, 'a', 'b', 'c', 0x04, 'i', '1', '3', 'c'};
+  const char buffer[] = {0x25, 0x03, 'a', 'b', 'c', 0x04, 'i', '1', '3', 'c'}; // i32 elements instead of binary
 
   // defaults
   values = NULL;
@@ -1477,10 +1855,9 @@ static void can_detect_list_strings_invalid_type() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_string(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_STRING_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -1516,10 +1893,9 @@ static void can_detect_list_strings_buffer_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_string(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_STRING_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == ARENA_ERROR_OUT_OF_MEMORY, "should fail with PARQUET_ERROR_BUFFER_OVERFLOW");
@@ -1550,10 +1926,9 @@ static void can_propagate_list_strings_buffer_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_string(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_STRING_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -1565,6 +1940,10 @@ static void can_propagate_list_strings_buffer_overflow() {
   malloc_destroy(&pool);
 }
 
+// represents a list of positive i32 values as the field
+static const struct parquet_parse_field PARQUET_TEST_I32_LIST = {
+  .type = THRIFT_TYPE_LIST, .read_fn = parquet_read_list, .item = &PARQUET_I32_POSITIVE_ITEM};
+
 static void can_read_list_i32_positive() {
   struct malloc_pool pool;
   struct arena_allocator arena;
@@ -1573,7 +1952,7 @@ static void can_read_list_i32_positive() {
   i32 **values;
 
   i64 result;
-  const char buffer[] = {0x46, 0x02, 0x04, 0x06, 0xf2, 0x14};
+  const char buffer[] = {0x45, 0x02, 0x04, 0x06, 0xf2, 0x14};
 
   // defaults
   values = NULL;
@@ -1584,10 +1963,9 @@ static void can_read_list_i32_positive() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_i32_positive(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I32_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == 6, "should read six bytes");
@@ -1622,7 +2000,7 @@ static void can_detect_list_i32_positive_invalid_type() {
   i32 **values;
 
   i64 result;
-  const char buffer[] = {0x46, 0x02, 0x04, 0x06, 0xf2, 0x14};
+  const char buffer[] = {0x46, 0x02, 0x04, 0x06, 0xf2, 0x14}; // i64 elements instead of i32
 
   // defaults
   values = NULL;
@@ -1633,10 +2011,9 @@ static void can_detect_list_i32_positive_invalid_type() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_i32_positive(&ctx, 1, THRIFT_TYPE_I32, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I32_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
@@ -1658,7 +2035,7 @@ static void can_detect_list_i32_positive_buffer_overflow() {
 
   i64 result;
   u64 cursor;
-  const char buffer[] = {0x46, 0x02, 0x04, 0x06, 0xf2, 0x14};
+  const char buffer[] = {0x45, 0x02, 0x04, 0x06, 0xf2, 0x14};
 
   // defaults
   values = NULL;
@@ -1672,10 +2049,9 @@ static void can_detect_list_i32_positive_buffer_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_i32_positive(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I32_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == ARENA_ERROR_OUT_OF_MEMORY, "should fail with ARENA_ERROR_OUT_OF_MEMORY");
@@ -1695,7 +2071,7 @@ static void can_propagate_list_i32_positive_buffer_overflow() {
   i32 **values;
 
   i64 result;
-  const char buffer[] = {0x46, 0x02, 0x04, 0x06, 0xf2};
+  const char buffer[] = {0x45, 0x02, 0x04, 0x06, 0xf2};
 
   // defaults
   values = NULL;
@@ -1706,10 +2082,9 @@ static void can_propagate_list_i32_positive_buffer_overflow() {
 
   // context
   ctx.arena = &arena;
-  ctx.ptrs[1] = &values;
 
   // read the value from the buffer
-  result = parquet_read_list_i32_positive(&ctx, 1, THRIFT_TYPE_LIST, buffer, sizeof(buffer));
+  result = parquet_read_list(&ctx, &PARQUET_TEST_I32_LIST, &values, buffer, sizeof(buffer));
 
   // assert the result
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
@@ -1721,6 +2096,89 @@ static void can_propagate_list_i32_positive_buffer_overflow() {
   malloc_destroy(&pool);
 }
 
+static void can_parse_row_counts() {
+  struct parquet_file file;
+  struct parquet_row_counts counts;
+
+  i64 result;
+  char buffer[] = {
+    0x15, 0x02,             // version=1
+    0x19, 0x1c,             // schemas, one struct
+    0x48, 0x01, 'a', 0x00,  // name="a"
+    0x16, 0x0e,             // num_rows=7
+    0x19, 0x2c,             // row_groups, two structs
+    0x19, 0x0c,             // columns, empty
+    0x16, 0x64,             // total_byte_size=50
+    0x16, 0x06, 0x00,       // num_rows=3
+    0x36, 0x08, 0x00,       // num_rows=4
+    0x28, 0x01, 'x',        // created_by="x"
+    0x00};                  // stop
+
+  // only the footer is needed
+  file.footer.start = buffer;
+  file.footer.size = sizeof(buffer);
+
+  // parse the counts from the footer
+  result = parquet_parse_counts(&file, &counts);
+
+  // assert the result
+  assert(result == 0, "should parse counts");
+  assert(counts.num_rows == 7, "should read 7 rows");
+  assert(counts.row_groups.count == 2, "should count 2 row groups");
+  assert(counts.row_groups.num_rows == 7, "should sum 7 rows");
+}
+
+static void can_detect_row_counts_missing_rows() {
+  struct parquet_file file;
+  struct parquet_row_counts counts;
+
+  i64 result;
+  char buffer[] = {
+    0x36, 0x02,             // num_rows=1
+    0x19, 0x1c, 0x00,       // row_groups, one struct without num_rows
+    0x00};                  // stop
+
+  // only the footer is needed
+  file.footer.start = buffer;
+  file.footer.size = sizeof(buffer);
+
+  // parse the counts from the footer
+  result = parquet_parse_counts(&file, &counts);
+
+  // assert the result
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+}
+
+static void can_parse_row_counts_of_file() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_row_counts counts;
+
+  // initialize memory and parquet file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // open the file with many columns
+  result = parquet_open(&file, "data/test02.parquet");
+  assert(result == 0, "should open parquet file");
+
+  // parse the counts from the footer
+  result = parquet_parse_counts(&file, &counts);
+
+  // assert the result
+  assert(result == 0, "should parse counts");
+  assert(counts.num_rows == 1, "should read 1 row");
+  assert(counts.row_groups.count == 1, "should count 1 row group");
+  assert(counts.row_groups.num_rows == 1, "should sum 1 row");
+  assert(file.arena.head == NULL, "should not allocate anything");
+
+  // release
+  parquet_close(&file);
+  malloc_destroy(&pool);
+}
+
 void parquet_test_cases_parse(struct runner_context *ctx) {
   // i32 cases
   test_case(ctx, "can read i32 positive", can_read_i32_positive);
@@ -1755,6 +2213,14 @@ void parquet_test_cases_parse(struct runner_context *ctx) {
   test_case(ctx, "can detect struct buffer overflow", can_detect_struct_buffer_overflow);
   test_case(ctx, "can propagate struct buffer overflow", can_propagate_struct_buffer_overflow);
 
+  // descriptor cases
+  test_case(ctx, "can read fields with defaults", can_read_fields_with_defaults);
+  test_case(ctx, "can read schema element descriptor", can_read_schema_element_descriptor);
+  test_case(ctx, "can read page header descriptor", can_read_page_header_descriptor);
+  test_case(ctx, "can detect page header buffer overflow", can_detect_page_header_buffer_overflow);
+  test_case(ctx, "can read column meta statistics", can_read_column_meta_statistics);
+  test_case(ctx, "can read column meta deprecated bounds", can_read_column_meta_deprecated_bounds);
+
   // list of strings cases
   test_case(ctx, "can read list strings", can_read_list_strings);
   test_case(ctx, "can detect list strings invalid type", can_detect_list_strings_invalid_type);
@@ -1766,6 +2232,11 @@ void parquet_test_cases_parse(struct runner_context *ctx) {
   test_case(ctx, "can detect list i32 positive invalid type", can_detect_list_i32_positive_invalid_type);
   test_case(ctx, "can detect list i32 positive buffer overflow", can_detect_list_i32_positive_buffer_overflow);
   test_case(ctx, "can propagate list i32 positive buffer overflow", can_propagate_list_i32_positive_buffer_overflow);
+
+  // row count cases
+  test_case(ctx, "can parse row counts", can_parse_row_counts);
+  test_case(ctx, "can detect row counts missing rows", can_detect_row_counts_missing_rows);
+  test_case(ctx, "can parse row counts of file", can_parse_row_counts_of_file);
 }
 
 #endif
@@ -98,15 +98,20 @@ struct parquet_schema_element {
   i32 converted_type;  // 6, common types used by frameworks using parquet
 };
 
+struct parquet_binary {
+  const char *ptr; // pointer to the bytes in the parsed buffer, NULL if not set
+  u32 size;        // number of bytes
+};
+
 struct parquet_column_statistics {
-  u8 *max;                 // 1, maximum value in the column
-  u8 *min;                 // 2, minimum value in the column
-  i64 null_count;          // 3, number of null values in the column
-  i64 distinct_count;      // 4, number of distinct values in the column
-  u8 *max_value;           // 5, maximum value in the column as a byte array
-  u8 *min_value;           // 6, minimum value in the column as a byte array
-  bool is_max_value_exact; // 7, whether the max value is exact
-  bool is_min_value_exact; // 8, whether the min value is exact
+  struct parquet_binary max;       // 1, maximum value in the column, deprecated
+  struct parquet_binary min;       // 2, minimum value in the column, deprecated
+  i64 null_count;                  // 3, number of null values in the column
+  i64 distinct_count;              // 4, number of distinct values in the column
+  struct parquet_binary max_value; // 5, maximum value in the column as a byte array
+  struct parquet_binary min_value; // 6, minimum value in the column as a byte array
+  bool is_max_value_exact;         // 7, whether the max value is exact
+  bool is_min_value_exact;         // 8, whether the min value is exact
 };
 
 struct parquet_page_encoding_stats {
@@ -152,12 +157,70 @@ struct parquet_metadata {
   char *created_by;                        // 6, null-terminated created by string
 };
 
+struct parquet_data_page_header {
+  i32 num_values;                              // 1, number of values in the page, including nulls
+  i32 encoding;                                // 2, encoding of the values
+  i32 definition_level_encoding;               // 3, encoding of the definition levels
+  i32 repetition_level_encoding;               // 4, encoding of the repetition levels
+  struct parquet_column_statistics statistics; // 5, optional statistics of the page
+};
+
+struct parquet_dictionary_page_header {
+  i32 num_values; // 1, number of values in the dictionary
+  i32 encoding;   // 2, encoding of the dictionary
+  bool is_sorted; // 3, whether the entries are sorted
+};
+
+struct parquet_data_page_header_v2 {
+  i32 num_values;                              // 1, number of values in the page, including nulls
+  i32 num_nulls;                               // 2, number of nulls in the page
+  i32 num_rows;                                // 3, number of rows in the page
+  i32 encoding;                                // 4, encoding of the values
+  i32 definition_levels_byte_length;           // 5, uncompressed size of the definition levels
+  i32 repetition_levels_byte_length;           // 6, uncompressed size of the repetition levels
+  bool is_compressed;                          // 7, whether the values are compressed
+  struct parquet_column_statistics statistics; // 8, optional statistics of the page
+};
+
+struct parquet_page_header {
+  i32 type;                                         // 1, type of the page
+  i32 uncompressed_page_size;                       // 2, size of the page after decompression
+  i32 compressed_page_size;                         // 3, size of the page as stored in the file
+  i64 crc;                                          // 4, unsigned crc32 of the stored page, -1 if not present
+  struct parquet_data_page_header data;             // 5, set for DATA_PAGE
+  struct parquet_dictionary_page_header dictionary; // 7, set for DICTIONARY_PAGE
+  struct parquet_data_page_header_v2 data_v2;       // 8, set for DATA_PAGE_V2
+};
+
+struct parquet_row_group_counts {
+  u64 count;    // number of row groups
+  i64 num_rows; // rows summed over the row groups
+};
+
+struct parquet_row_counts {
+  i64 num_rows;                               // 3, number of rows declared by the file
+  struct parquet_row_group_counts row_groups; // 4, row groups reduced to their counts
+};
+
 /// @brief Parses the footer of a parquet file.
 /// @param file Pointer to the parquet_file structure.
 /// @param metadata Pointer to the parquet_metadata structure to fill.
 /// @return 0 on success, or a negative error code on failure.
 extern i64 parquet_parse(struct parquet_file *file, struct parquet_metadata *metadata);
 
+/// @brief Parses only the row counts of the footer, every other field is skipped and nothing is allocated.
+/// @param file Pointer to the opened parquet_file structure.
+/// @param counts Pointer to the parquet_row_counts structure to fill.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_parse_counts(struct parquet_file *file, struct parquet_row_counts *counts);
+
+/// @brief Parses a page header, the nested headers and statistics are kept inline.
+/// @param header Pointer to the parquet_page_header structure to fill.
+/// @param buffer Pointer to the buffer starting at the page header.
+/// @param buffer_size Size of the buffer.
+/// @return The size of the page header in bytes, or a negative error code on failure.
+extern i64 parquet_parse_page_header(struct parquet_page_header *header, const char *buffer, u64 buffer_size);
+
 #if defined(I13C_TESTS)
 
 /// @brief Registers parquet test cases.
@@ -0,0 +1,368 @@
+#include "parquet.plain.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_PLAIN_BYTES 0x0101010101010101ull // lowest bit of every byte
+#define PARQUET_PLAIN_BITS 0x8040201008040201ull  // n-th bit of the n-th byte
+#define PARQUET_PLAIN_CARRY 0x7f7f7f7f7f7f7f7full // moves any set bit of a byte into its highest bit
+
+static i64
+parquet_plain_decode_booleans(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count) {
+  u32 index;
+  u64 size, spread;
+  bool *target;
+
+  // booleans are bit-packed, LSB first
+  size = ((u64)count + 7) / 8;
+  if (size > buffer_size) return PARQUET_ERROR_INVALID_FILE;
+
+  // booleans are appended after existing values
+  target = (bool *)vector->values + vector->count;
+
+  // expand 8 bits into 8 bytes at a time
+  for (index = 0; index + 8 <= count; index += 8) {
+    spread = ((u8)buffer[index / 8] * PARQUET_PLAIN_BYTES) & PARQUET_PLAIN_BITS;
+    *(u64 *)(target + index) = ((spread + PARQUET_PLAIN_CARRY) >> 7) & PARQUET_PLAIN_BYTES;
+  }
+
+  // the remaining bits one by one
+  for (; index < count; index++) {
+    target[index] = ((u8)buffer[index / 8] >> (index % 8)) & 0x01;
+  }
+
+  // success
+  vector->count += count;
+  return size;
+}
+
+static i64
+parquet_plain_decode_byte_arrays(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count) {
+  u32 index, size;
+  u64 offset;
+  struct parquet_binary *target;
+
+  // references are appended after existing values
+  offset = 0;
+  target = (struct parquet_binary *)vector->values + vector->count;
+
+  for (index = 0; index < count; index++) {
+    // each value is prefixed with its 4-byte little-endian length
+    if (buffer_size - offset < sizeof(u32)) return PARQUET_ERROR_INVALID_FILE;
+    size = *(const u32 *)(buffer + offset);
+    offset += sizeof(u32);
+
+    // the value must be fully available
+    if (buffer_size - offset < size) return PARQUET_ERROR_INVALID_FILE;
+
+    // reference the value in the buffer
+    target[index].ptr = buffer + offset;
+    target[index].size = size;
+    offset += size;
+  }
+
+  // success
+  vector->count += count;
+  return offset;
+}
+
+static i64 parquet_plain_decode_fixed(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count) {
+  i64 result;
+  u64 size;
+
+  // fixed-width values are stored exactly as the vector lays them out
+  size = (u64)count * vector->width;
+  if (size > buffer_size) return PARQUET_ERROR_INVALID_FILE;
+
+  // copy them in bulk
+  result = parquet_vector_append(vector, buffer, count);
+  if (result < 0) return result;
+
+  // success
+  return size;
+}
+
+i64 parquet_plain_decode(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count) {
+  // check the capacity
+  if (count > vector->capacity - vector->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // dispatch once per call, never per value
+  switch (vector->data_type) {
+    case PARQUET_DATA_TYPE_BOOLEAN:
+      return parquet_plain_decode_booleans(vector, buffer, buffer_size, count);
+    case PARQUET_DATA_TYPE_BYTE_ARRAY:
+      return parquet_plain_decode_byte_arrays(vector, buffer, buffer_size, count);
+    default:
+      return parquet_plain_decode_fixed(vector, buffer, buffer_size, count);
+  }
+}
+
+#if defined(I13C_TESTS)
+
+static void can_decode_plain_booleans() {
+  i64 result;
+  bool *values;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0xa5, 0x05}; // 1,0,1,0,0,1,0,1 and 1,0,1
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BOOLEAN, 0, 16);
+  assert(result == 0, "should initialize vector");
+
+  // decode 11 values spanning two bytes
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 11);
+  assert(result == 2, "should consume two bytes");
+  assert(vector.count == 11, "should decode 11 values");
+
+  // assert the values
+  values = (bool *)vector.values;
+  assert(values[0] == 1 && values[1] == 0 && values[2] == 1 && values[3] == 0, "should decode first nibble");
+  assert(values[4] == 0 && values[5] == 1 && values[6] == 0 && values[7] == 1, "should decode second nibble");
+  assert(values[8] == 1 && values[9] == 0 && values[10] == 1, "should decode remaining bits");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_plain_int32() {
+  i64 result;
+  i32 *values;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 3);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 3);
+  assert(result == 12, "should consume twelve bytes");
+  assert(vector.count == 3, "should decode 3 values");
+
+  // assert the values
+  values = (i32 *)vector.values;
+  assert(values[0] == 1, "value 0 should be 1");
+  assert(values[1] == -1, "value 1 should be -1");
+  assert(values[2] == 256, "value 2 should be 256");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_plain_int96() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT96, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 2);
+  assert(result == 24, "should consume 24 bytes");
+
+  // assert the values keep their layout
+  assert(vector.values[0] == 1, "first byte should be 1");
+  assert(vector.values[12] == 13, "second value should start with 13");
+  assert(vector.values[23] == 24, "last byte should be 24");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_plain_double() {
+  i64 result;
+  f64 *values;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0, 0, 0, 0, 0, 0, 0xf0, 0x3f, 0, 0, 0, 0, 0, 0, 0x04, 0xc0}; // 1.0 and -2.5
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_DOUBLE, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 2);
+  assert(result == 16, "should consume 16 bytes");
+
+  // assert the values
+  values = (f64 *)vector.values;
+  assert(values[0] == 1.0, "value 0 should be 1.0");
+  assert(values[1] == -2.5, "value 1 should be -2.5");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_plain_byte_arrays() {
+  i64 result;
+  struct parquet_binary *values;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {
+    0x04, 0x00, 0x00, 0x00, 'i', '1', '3', 'c', // 'i13c'
+    0x00, 0x00, 0x00, 0x00,                     // ''
+    0x01, 0x00, 0x00, 0x00, 'x'};               // 'x'
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 4);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 3);
+  assert(result == sizeof(buffer), "should consume the entire buffer");
+  assert(vector.count == 3, "should decode 3 values");
+
+  // assert the values reference the buffer
+  values = (struct parquet_binary *)vector.values;
+  assert(values[0].ptr == buffer + 4 && values[0].size == 4, "value 0 should be 'i13c'");
+  assert(values[1].ptr == buffer + 12 && values[1].size == 0, "value 1 should be empty");
+  assert(values[2].ptr == buffer + 16 && values[2].size == 1, "value 2 should be 'x'");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_plain_fixed_byte_arrays() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {'a', 'b', 'c', 'd', 'e', 'f'};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED, 3, 2);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 2);
+  assert(result == 6, "should consume 6 bytes");
+
+  // assert the values
+  assert(vector.values[0] == 'a', "value 0 should start with 'a'");
+  assert(vector.values[3] == 'd', "value 1 should start with 'd'");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_plain_fixed_truncated() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  // decode more values than available
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 2);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+  assert(vector.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_plain_byte_array_truncated() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0x04, 0x00, 0x00, 0x00, 'i', '1', '3'};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 1);
+  assert(result == 0, "should initialize vector");
+
+  // decode a value longer than available
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 1);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+  assert(vector.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_plain_capacity_overflow() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const char buffer[] = {0xff, 0xff};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BOOLEAN, 0, 8);
+  assert(result == 0, "should initialize vector");
+
+  // decode more values than the vector holds
+  result = parquet_plain_decode(&vector, buffer, sizeof(buffer), 9);
+  assert(result == PARQUET_ERROR_CAPACITY_OVERFLOW, "should fail with PARQUET_ERROR_CAPACITY_OVERFLOW");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_plain(struct runner_context *ctx) {
+  test_case(ctx, "can decode plain booleans", can_decode_plain_booleans);
+  test_case(ctx, "can decode plain int32", can_decode_plain_int32);
+  test_case(ctx, "can decode plain int96", can_decode_plain_int96);
+  test_case(ctx, "can decode plain double", can_decode_plain_double);
+  test_case(ctx, "can decode plain byte arrays", can_decode_plain_byte_arrays);
+  test_case(ctx, "can decode plain fixed byte arrays", can_decode_plain_fixed_byte_arrays);
+  test_case(ctx, "can detect plain fixed truncated", can_detect_plain_fixed_truncated);
+  test_case(ctx, "can detect plain byte array truncated", can_detect_plain_byte_array_truncated);
+  test_case(ctx, "can detect plain capacity overflow", can_detect_plain_capacity_overflow);
+}
+
+#endif
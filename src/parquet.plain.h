@@ -0,0 +1,21 @@
+#pragma once
+
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+/// @brief Decodes PLAIN encoded values of the vector's physical type and appends them to the vector.
+/// @param vector Pointer to the initialized parquet_vector structure.
+/// @param buffer Pointer to the encoded values, BYTE_ARRAY values keep referencing it.
+/// @param buffer_size Number of bytes available in the buffer.
+/// @param count Number of values to decode.
+/// @return The number of consumed bytes, or a negative error code on failure.
+extern i64 parquet_plain_decode(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet plain decoding test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_plain(struct runner_context *ctx);
+
+#endif
@@ -0,0 +1,549 @@
+#include "parquet.rle.h"
+#include "parquet.base.h"
+#include "runner.h"
+#include "typing.h"
+
+// eight 32-bit lanes, lowered to a single AVX2 register when available
+typedef u32 parquet_rle_lanes __attribute__((vector_size(32), aligned(4)));
+
+// four 64-bit lanes for values spanning more than 4 bytes
+typedef u64 parquet_rle_wide __attribute__((vector_size(32), aligned(4)));
+typedef u32 parquet_rle_half __attribute__((vector_size(16), aligned(4)));
+
+// unpacks groups of bit-packed values of a single width
+typedef void (*parquet_rle_unpack_fn)(const char *buffer, u32 *values, u32 groups);
+
+#define PARQUET_RLE_LOAD32(buffer, index, width) (*(const u32 *)((buffer) + (index) * (width) / 8))
+#define PARQUET_RLE_LOAD64(buffer, index, width) (*(const u64 *)((buffer) + (index) * (width) / 8))
+
+static inline __attribute__((always_inline)) void
+parquet_rle_unpack_group(const char *buffer, u32 *values, const u32 width) {
+  u32 index;
+  parquet_rle_lanes words, shifts;
+  parquet_rle_wide wide, offsets;
+
+  const u32 mask = width == 32 ? 0xffffffffu : (1u << width) - 1;
+
+  // values up to 25 bits never span more than 4 bytes, so all lanes are shifted at once
+  if (width <= 25) {
+    words = (parquet_rle_lanes){
+      PARQUET_RLE_LOAD32(buffer, 0, width), PARQUET_RLE_LOAD32(buffer, 1, width),
+      PARQUET_RLE_LOAD32(buffer, 2, width), PARQUET_RLE_LOAD32(buffer, 3, width),
+      PARQUET_RLE_LOAD32(buffer, 4, width), PARQUET_RLE_LOAD32(buffer, 5, width),
+      PARQUET_RLE_LOAD32(buffer, 6, width), PARQUET_RLE_LOAD32(buffer, 7, width),
+    };
+
+    shifts = (parquet_rle_lanes){
+      0 * width % 8, 1 * width % 8, 2 * width % 8, 3 * width % 8,
+      4 * width % 8, 5 * width % 8, 6 * width % 8, 7 * width % 8,
+    };
+
+    *(parquet_rle_lanes *)values = (words >> shifts) & mask;
+    return;
+  }
+
+  // wider values need a 64-bit window each, so a group takes two halves of 4 lanes
+  for (index = 0; index < PARQUET_RLE_GROUP_SIZE; index += 4) {
+    wide = (parquet_rle_wide){
+      PARQUET_RLE_LOAD64(buffer, index + 0, width),
+      PARQUET_RLE_LOAD64(buffer, index + 1, width),
+      PARQUET_RLE_LOAD64(buffer, index + 2, width),
+      PARQUET_RLE_LOAD64(buffer, index + 3, width),
+    };
+
+    offsets = (parquet_rle_wide){
+      (index + 0) * width % 8,
+      (index + 1) * width % 8,
+      (index + 2) * width % 8,
+      (index + 3) * width % 8,
+    };
+
+    *(parquet_rle_half *)(values + index) = __builtin_convertvector((wide >> offsets) & mask, parquet_rle_half);
+  }
+}
+
+// generates a kernel with the width known at compile time
+#define PARQUET_RLE_KERNEL(width)                                                                                      \
+  static void parquet_rle_unpack_##width(const char *buffer, u32 *values, u32 groups) {                                \
+    while (groups-- > 0) {                                                                                             \
+      parquet_rle_unpack_group(buffer, values, width);                                                                 \
+      buffer += width;                                                                                                 \
+      values += PARQUET_RLE_GROUP_SIZE;                                                                                \
+    }                                                                                                                  \
+  }
+
+static void parquet_rle_unpack_0(const char *buffer, u32 *values, u32 groups) {
+  parquet_rle_lanes zeros = {0};
+
+  // zero-width values occupy no bytes at all
+  (void)buffer;
+
+  while (groups-- > 0) {
+    *(parquet_rle_lanes *)values = zeros;
+    values += PARQUET_RLE_GROUP_SIZE;
+  }
+}
+
+PARQUET_RLE_KERNEL(1)
+PARQUET_RLE_KERNEL(2)
+PARQUET_RLE_KERNEL(3)
+PARQUET_RLE_KERNEL(4)
+PARQUET_RLE_KERNEL(5)
+PARQUET_RLE_KERNEL(6)
+PARQUET_RLE_KERNEL(7)
+PARQUET_RLE_KERNEL(8)
+PARQUET_RLE_KERNEL(9)
+PARQUET_RLE_KERNEL(10)
+PARQUET_RLE_KERNEL(11)
+PARQUET_RLE_KERNEL(12)
+PARQUET_RLE_KERNEL(13)
+PARQUET_RLE_KERNEL(14)
+PARQUET_RLE_KERNEL(15)
+PARQUET_RLE_KERNEL(16)
+PARQUET_RLE_KERNEL(17)
+PARQUET_RLE_KERNEL(18)
+PARQUET_RLE_KERNEL(19)
+PARQUET_RLE_KERNEL(20)
+PARQUET_RLE_KERNEL(21)
+PARQUET_RLE_KERNEL(22)
+PARQUET_RLE_KERNEL(23)
+PARQUET_RLE_KERNEL(24)
+PARQUET_RLE_KERNEL(25)
+PARQUET_RLE_KERNEL(26)
+PARQUET_RLE_KERNEL(27)
+PARQUET_RLE_KERNEL(28)
+PARQUET_RLE_KERNEL(29)
+PARQUET_RLE_KERNEL(30)
+PARQUET_RLE_KERNEL(31)
+PARQUET_RLE_KERNEL(32)
+
+static const parquet_rle_unpack_fn PARQUET_RLE_UNPACK[PARQUET_RLE_MAX_WIDTH + 1] = {
+  parquet_rle_unpack_0,  parquet_rle_unpack_1,  parquet_rle_unpack_2,  parquet_rle_unpack_3,  parquet_rle_unpack_4,
+  parquet_rle_unpack_5,  parquet_rle_unpack_6,  parquet_rle_unpack_7,  parquet_rle_unpack_8,  parquet_rle_unpack_9,
+  parquet_rle_unpack_10, parquet_rle_unpack_11, parquet_rle_unpack_12, parquet_rle_unpack_13, parquet_rle_unpack_14,
+  parquet_rle_unpack_15, parquet_rle_unpack_16, parquet_rle_unpack_17, parquet_rle_unpack_18, parquet_rle_unpack_19,
+  parquet_rle_unpack_20, parquet_rle_unpack_21, parquet_rle_unpack_22, parquet_rle_unpack_23, parquet_rle_unpack_24,
+  parquet_rle_unpack_25, parquet_rle_unpack_26, parquet_rle_unpack_27, parquet_rle_unpack_28, parquet_rle_unpack_29,
+  parquet_rle_unpack_30, parquet_rle_unpack_31, parquet_rle_unpack_32,
+};
+
+void parquet_rle_unpack(const char *buffer, u32 *values, u32 groups, u32 width) {
+  PARQUET_RLE_UNPACK[width](buffer, values, groups);
+}
+
+static void parquet_rle_fill(u32 *values, u32 value, u32 count) {
+  parquet_rle_lanes lanes;
+
+  // broadcast the value into all lanes
+  lanes = (parquet_rle_lanes){0} + value;
+
+  // store 8 values at a time
+  while (count >= PARQUET_RLE_GROUP_SIZE) {
+    *(parquet_rle_lanes *)values = lanes;
+    values += PARQUET_RLE_GROUP_SIZE;
+    count -= PARQUET_RLE_GROUP_SIZE;
+  }
+
+  // and the remaining tail
+  while (count-- > 0) {
+    *values++ = value;
+  }
+}
+
+static i64 parquet_rle_header(struct parquet_rle *rle) {
+  u8 byte;
+  u32 header, shift, index, bytes;
+
+  // defaults
+  header = 0;
+  shift = 0;
+
+  do {
+    // the header is a ULEB128 varint
+    if (rle->offset == rle->size) return PARQUET_ERROR_INVALID_FILE;
+    if (shift > 28) return PARQUET_ERROR_INVALID_VALUE;
+
+    byte = rle->buffer[rle->offset++];
+    header |= (u32)(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+
+  // the lowest bit distinguishes bit-packed runs
+  if (header & 0x01) {
+    rle->groups = header >> 1;
+
+    // all groups must be available
+    if ((u64)rle->groups * rle->width > rle->size - rle->offset) return PARQUET_ERROR_INVALID_FILE;
+    return 0;
+  }
+
+  // the repeated value is stored in the fewest whole bytes
+  rle->repeated = header >> 1;
+  rle->value = 0;
+  bytes = (rle->width + 7) / 8;
+
+  // the value must be available
+  if (bytes > rle->size - rle->offset) return PARQUET_ERROR_INVALID_FILE;
+
+  // and it is stored little-endian
+  for (index = 0; index < bytes; index++) {
+    rle->value |= (u32)(u8)rle->buffer[rle->offset++] << (index * 8);
+  }
+
+  // success
+  return 0;
+}
+
+i64 parquet_rle_init(struct parquet_rle *rle, const char *buffer, u64 size, u32 width) {
+  // the width must fit the output values
+  if (width > PARQUET_RLE_MAX_WIDTH) return PARQUET_ERROR_INVALID_VALUE;
+
+  // defaults
+  rle->buffer = buffer;
+  rle->size = size;
+  rle->offset = 0;
+  rle->width = width;
+  rle->repeated = 0;
+  rle->value = 0;
+  rle->groups = 0;
+  rle->pending = 0;
+
+  // success
+  return 0;
+}
+
+i64 parquet_rle_init_levels(struct parquet_rle *rle, const char *buffer, u64 size, u32 width) {
+  i64 result;
+  u32 length;
+
+  // the levels are prefixed with their 4-byte little-endian length
+  if (size < PARQUET_RLE_LEVELS_SIZE) return PARQUET_ERROR_INVALID_FILE;
+  length = *(const u32 *)buffer;
+
+  // the levels must be available
+  if (length > size - PARQUET_RLE_LEVELS_SIZE) return PARQUET_ERROR_INVALID_FILE;
+
+  // initialize the decoder right after the prefix
+  result = parquet_rle_init(rle, buffer + PARQUET_RLE_LEVELS_SIZE, length, width);
+  if (result < 0) return result;
+
+  // success
+  return PARQUET_RLE_LEVELS_SIZE + length;
+}
+
+i64 parquet_rle_init_indices(struct parquet_rle *rle, const char *buffer, u64 size) {
+  // the indices are prefixed with their 1-byte bit width
+  if (size < 1) return PARQUET_ERROR_INVALID_FILE;
+
+  // initialize the decoder right after the prefix
+  return parquet_rle_init(rle, buffer + 1, size - 1, (u8)buffer[0]);
+}
+
+i64 parquet_rle_decode(struct parquet_rle *rle, u32 *values, u32 count) {
+  i64 result;
+  u32 index, take;
+  u64 available;
+  char padded[PARQUET_RLE_MAX_WIDTH + PARQUET_RLE_PADDING];
+
+  while (count > 0) {
+    // continue the current RLE run
+    if (rle->repeated > 0) {
+      take = rle->repeated < count ? rle->repeated : count;
+      parquet_rle_fill(values, rle->value, take);
+
+      values += take;
+      count -= take;
+      rle->repeated -= take;
+      continue;
+    }
+
+    // drain the partially consumed group
+    if (rle->pending > 0) {
+      take = rle->pending < count ? rle->pending : count;
+
+      for (index = 0; index < take; index++) {
+        values[index] = rle->group[PARQUET_RLE_GROUP_SIZE - rle->pending + index];
+      }
+
+      values += take;
+      count -= take;
+      rle->pending -= take;
+      continue;
+    }
+
+    if (rle->groups > 0) {
+      // whole groups are unpacked straight into the output
+      take = rle->groups < count / PARQUET_RLE_GROUP_SIZE ? rle->groups : count / PARQUET_RLE_GROUP_SIZE;
+
+      // but only those followed by enough readable bytes
+      if (rle->width > 0) {
+        available = rle->size - rle->offset;
+        available = available > PARQUET_RLE_PADDING ? (available - PARQUET_RLE_PADDING) / rle->width : 0;
+        take = take < available ? take : available;
+      }
+
+      if (take > 0) {
+        PARQUET_RLE_UNPACK[rle->width](rle->buffer + rle->offset, values, take);
+
+        values += take * PARQUET_RLE_GROUP_SIZE;
+        count -= take * PARQUET_RLE_GROUP_SIZE;
+        rle->offset += take * rle->width;
+        rle->groups -= take;
+        continue;
+      }
+
+      // otherwise a single group is unpacked through a padded copy
+      for (index = 0; index < sizeof(padded); index++) {
+        padded[index] = index < rle->width ? rle->buffer[rle->offset + index] : 0;
+      }
+
+      PARQUET_RLE_UNPACK[rle->width](padded, rle->group, 1);
+
+      rle->offset += rle->width;
+      rle->groups -= 1;
+      rle->pending = PARQUET_RLE_GROUP_SIZE;
+      continue;
+    }
+
+    // start the next run
+    result = parquet_rle_header(rle);
+    if (result < 0) return result;
+  }
+
+  // success
+  return 0;
+}
+
+#if defined(I13C_TESTS)
+
+static u64 parquet_rle_test_pack(char *buffer, const u32 *values, u32 count, u32 width) {
+  u32 index, bit;
+  u64 size;
+
+  // the header announces bit-packed groups
+  size = 0;
+  buffer[size++] = (char)(((count / PARQUET_RLE_GROUP_SIZE) << 1) | 1);
+
+  // clear the packed bytes
+  for (index = 0; index < count * width / 8; index++) {
+    buffer[size + index] = 0;
+  }
+
+  // pack every bit, LSB first
+  for (index = 0; index < count * width; index++) {
+    bit = (values[index / width] >> (index % width)) & 0x01;
+    buffer[size + index / 8] |= (char)(bit << (index % 8));
+  }
+
+  // success
+  return size + count * width / 8;
+}
+
+static void can_decode_rle_run() {
+  i64 result;
+  u32 index, values[10];
+
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x14, 0x05}; // 10 times the value 5
+
+  // initialize the decoder
+  result = parquet_rle_init(&rle, buffer, sizeof(buffer), 3);
+  assert(result == 0, "should initialize decoder");
+
+  // decode the entire run
+  result = parquet_rle_decode(&rle, values, 10);
+  assert(result == 0, "should decode 10 values");
+
+  // assert the values
+  for (index = 0; index < 10; index++) {
+    assert(values[index] == 5, "value should be 5");
+  }
+}
+
+static void can_decode_bit_packed_run() {
+  i64 result;
+  u32 index, values[8];
+
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x03, 0x88, 0xc6, 0xfa}; // values 0 to 7 packed in 3 bits
+
+  // initialize the decoder
+  result = parquet_rle_init(&rle, buffer, sizeof(buffer), 3);
+  assert(result == 0, "should initialize decoder");
+
+  // decode the entire group
+  result = parquet_rle_decode(&rle, values, 8);
+  assert(result == 0, "should decode 8 values");
+
+  // assert the values
+  for (index = 0; index < 8; index++) {
+    assert(values[index] == index, "value should match its index");
+  }
+}
+
+static void can_decode_mixed_runs_across_calls() {
+  i64 result;
+  u32 values[16];
+
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x03, 0x88, 0xc6, 0xfa, 0x08, 0x06}; // values 0 to 7, then 4 times the value 6
+
+  // initialize the decoder
+  result = parquet_rle_init(&rle, buffer, sizeof(buffer), 3);
+  assert(result == 0, "should initialize decoder");
+
+  // decode part of the group
+  result = parquet_rle_decode(&rle, values, 3);
+  assert(result == 0, "should decode 3 values");
+  assert(values[0] == 0 && values[2] == 2, "should decode the beginning of the group");
+
+  // decode the rest of the group and part of the run
+  result = parquet_rle_decode(&rle, values, 7);
+  assert(result == 0, "should decode 7 values");
+  assert(values[0] == 3 && values[4] == 7, "should decode the rest of the group");
+  assert(values[5] == 6 && values[6] == 6, "should decode the beginning of the run");
+
+  // decode the rest of the run
+  result = parquet_rle_decode(&rle, values, 2);
+  assert(result == 0, "should decode 2 values");
+  assert(values[0] == 6 && values[1] == 6, "should decode the rest of the run");
+
+  // nothing more is available
+  result = parquet_rle_decode(&rle, values, 1);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+}
+
+static void can_decode_every_bit_width() {
+  i64 result;
+  u64 size;
+  u32 index, width, seed, mask;
+  u32 expected[64], values[64];
+  char buffer[1 + 64 * 4];
+
+  struct parquet_rle rle;
+
+  // pseudo-random values
+  seed = 0x13c13c13;
+
+  for (width = 0; width <= PARQUET_RLE_MAX_WIDTH; width++) {
+    mask = width == 32 ? 0xffffffffu : (1u << width) - 1;
+
+    // generate values fitting the width
+    for (index = 0; index < 64; index++) {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      expected[index] = seed & mask;
+    }
+
+    // pack them into 8 groups
+    size = parquet_rle_test_pack(buffer, expected, 64, width);
+
+    // initialize the decoder
+    result = parquet_rle_init(&rle, buffer, size, width);
+    assert(result == 0, "should initialize decoder");
+
+    // decode all groups, the last ones through the padded copy
+    result = parquet_rle_decode(&rle, values, 64);
+    assert(result == 0, "should decode 64 values");
+    assert(rle.offset == size, "should consume all groups");
+
+    // assert the values
+    for (index = 0; index < 64; index++) {
+      assert(values[index] == expected[index], "value should match the packed one");
+    }
+  }
+}
+
+static void can_decode_levels() {
+  i64 result;
+  u32 values[4];
+
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x02, 0x00, 0x00, 0x00, 0x08, 0x01, 0xff}; // length 2, 4 times the value 1
+
+  // initialize the decoder
+  result = parquet_rle_init_levels(&rle, buffer, sizeof(buffer), 1);
+  assert(result == 6, "should occupy 6 bytes");
+
+  // decode the levels
+  result = parquet_rle_decode(&rle, values, 4);
+  assert(result == 0, "should decode 4 values");
+  assert(values[0] == 1 && values[3] == 1, "levels should be 1");
+}
+
+static void can_decode_indices() {
+  i64 result;
+  u32 values[3];
+
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x09, 0x06, 0x2c, 0x01}; // width 9, 3 times the index 300
+
+  // initialize the decoder
+  result = parquet_rle_init_indices(&rle, buffer, sizeof(buffer));
+  assert(result == 0, "should initialize decoder");
+  assert(rle.width == 9, "width should be 9");
+
+  // decode the indices
+  result = parquet_rle_decode(&rle, values, 3);
+  assert(result == 0, "should decode 3 values");
+  assert(values[0] == 300 && values[2] == 300, "indices should be 300");
+}
+
+static void can_detect_truncated_bit_packed_run() {
+  i64 result;
+  u32 values[16];
+
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x05, 0x88, 0xc6, 0xfa}; // 2 groups announced, 1 available
+
+  // initialize the decoder
+  result = parquet_rle_init(&rle, buffer, sizeof(buffer), 3);
+  assert(result == 0, "should initialize decoder");
+
+  // decode both groups
+  result = parquet_rle_decode(&rle, values, 16);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+}
+
+static void can_detect_truncated_levels() {
+  i64 result;
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x08, 0x00, 0x00, 0x00, 0x08, 0x01}; // length 8, 2 available
+
+  // initialize the decoder
+  result = parquet_rle_init_levels(&rle, buffer, sizeof(buffer), 1);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+}
+
+static void can_detect_invalid_width() {
+  i64 result;
+  struct parquet_rle rle;
+
+  const char buffer[] = {0x21, 0x02, 0x00}; // width 33
+
+  // initialize the decoder
+  result = parquet_rle_init_indices(&rle, buffer, sizeof(buffer));
+  assert(result == PARQUET_ERROR_INVALID_VALUE, "should fail with PARQUET_ERROR_INVALID_VALUE");
+}
+
+void parquet_test_cases_rle(struct runner_context *ctx) {
+  test_case(ctx, "can decode rle run", can_decode_rle_run);
+  test_case(ctx, "can decode bit-packed run", can_decode_bit_packed_run);
+  test_case(ctx, "can decode mixed runs across calls", can_decode_mixed_runs_across_calls);
+  test_case(ctx, "can decode every bit width", can_decode_every_bit_width);
+  test_case(ctx, "can decode levels", can_decode_levels);
+  test_case(ctx, "can decode indices", can_decode_indices);
+  test_case(ctx, "can detect truncated bit-packed run", can_detect_truncated_bit_packed_run);
+  test_case(ctx, "can detect truncated levels", can_detect_truncated_levels);
+  test_case(ctx, "can detect invalid width", can_detect_invalid_width);
+}
+
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_RLE_GROUP_SIZE 8  // number of values in a bit-packed group
+#define PARQUET_RLE_MAX_WIDTH 32  // widest supported bit width
+#define PARQUET_RLE_LEVELS_SIZE 4 // size of the little-endian length prefix of levels
+#define PARQUET_RLE_PADDING 8     // readable bytes an unpack kernel may touch past its last group
+
+struct parquet_rle {
+  const char *buffer; // encoded runs
+  u64 size;           // number of bytes in the buffer
+  u64 offset;         // position of the next unread byte
+
+  u32 width;    // bit width of every value
+  u32 repeated; // remaining values of the current RLE run
+  u32 value;    // value repeated by the current RLE run
+  u32 groups;   // remaining groups of the current bit-packed run
+  u32 pending;  // remaining values of the partially consumed group
+
+  u32 group[PARQUET_RLE_GROUP_SIZE]; // unpacked values of the partially consumed group
+};
+
+/// @brief Initializes a decoder over RLE/bit-packing hybrid encoded values.
+/// @param rle Pointer to the parquet_rle structure to initialize.
+/// @param buffer Pointer to the encoded runs.
+/// @param size Number of bytes in the buffer.
+/// @param width Bit width of every value, up to 32.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_rle_init(struct parquet_rle *rle, const char *buffer, u64 size, u32 width);
+
+/// @brief Initializes a decoder over definition or repetition levels prefixed with their length.
+/// @param rle Pointer to the parquet_rle structure to initialize.
+/// @param buffer Pointer to the length prefix followed by the encoded runs.
+/// @param size Number of bytes available in the buffer.
+/// @param width Bit width of the levels, derived from the maximum level.
+/// @return The number of bytes occupied by the levels, or a negative error code on failure.
+extern i64 parquet_rle_init_levels(struct parquet_rle *rle, const char *buffer, u64 size, u32 width);
+
+/// @brief Initializes a decoder over dictionary indices prefixed with their bit width.
+/// @param rle Pointer to the parquet_rle structure to initialize.
+/// @param buffer Pointer to the bit width followed by the encoded runs.
+/// @param size Number of bytes available in the buffer.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_rle_init_indices(struct parquet_rle *rle, const char *buffer, u64 size);
+
+/// @brief Decodes the next values, continuing where the previous call stopped.
+/// @param rle Pointer to the initialized parquet_rle structure.
+/// @param values Pointer to the output values.
+/// @param count Number of values to decode.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_rle_decode(struct parquet_rle *rle, u32 *values, u32 count);
+
+/// @brief Unpacks groups of 8 bit-packed values with the kernel specialised for the width.
+/// @param buffer Pointer to the packed groups, followed by at least PARQUET_RLE_PADDING readable bytes.
+/// @param values Pointer to the output values, 8 for each group.
+/// @param groups Number of groups to unpack.
+/// @param width Bit width of every value, up to 32.
+extern void parquet_rle_unpack(const char *buffer, u32 *values, u32 groups, u32 width);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet RLE test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_rle(struct runner_context *ctx);
+
+#endif
@@ -1,10 +1,13 @@
+#include "argv.h"
 #include "dom.h"
 #include "malloc.h"
 #include "parquet.base.h"
 #include "parquet.iter.h"
+#include "parquet.page.h"
 #include "parquet.parse.h"
 #include "parquet.schema.open.h"
 #include "parquet.schema.out.h"
+#include "stderr.h"
 #include "stdout.h"
 #include "typing.h"
 
@@ -13,10 +16,20 @@
 #define PRODUCED(res) ((u32)((res) & 0xFFFFFFFFu))
 #define CONSUMED(res) ((u32)(((res) >> 32) & 0xFFFFFFFFu))
 
+static enum dom_style parquet_show_style(u32 argc, const char **argv) {
+  // plain text unless any JSON flavour was requested
+  if (argv_flag(argc, argv, "--json")) return DOM_STYLE_JSON;
+  if (argv_flag(argc, argv, "--ndjson")) return DOM_STYLE_NDJSON;
+
+  return DOM_STYLE_TEXT;
+}
+
 i32 parquet_show(u32 argc, const char **argv) {
   i64 result;
   u32 tokens;
   u32 written;
+  enum dom_style style;
+  const char *path;
 
   struct parquet_file file;
   struct malloc_pool pool;
@@ -25,19 +38,21 @@ i32 parquet_show(u32 argc, const char **argv) {
   struct parquet_metadata metadata;
   struct parquet_metadata_iterator iterator;
 
-  // check for required arguments
+  // the path is the first argument which is not a flag, flags may come before it
   result = PARQUET_INVALID_ARGUMENTS;
-  if (argc < 1) goto cleanup;
+  path = argv_operand(argc, argv);
+  if (path == NULL) goto cleanup;
 
   // default
   result = 0;
+  style = parquet_show_style(argc, argv);
 
   // initialize memory and parquet file
   malloc_init(&pool);
   parquet_init(&file, &pool);
 
   // try to open parquet file
-  result = parquet_open(&file, argv[0]);
+  result = parquet_open(&file, path);
   if (result < 0) goto cleanup_memory;
 
   // try to parse metadata
@@ -50,7 +65,7 @@ i32 parquet_show(u32 argc, const char **argv) {
   if (result < 0) goto cleanup_file;
 
   // initialize DOM and parquet iterator
-  dom_init(&dom, &output);
+  dom_init_style(&dom, &output, style);
   parquet_metadata_iter(&iterator, &metadata);
 
   do {
@@ -85,6 +100,11 @@ i32 parquet_show(u32 argc, const char **argv) {
   result = stdout_flush(&dom.format);
   if (result < 0) goto cleanup_buffer;
 
+  // a single JSON document is not terminated by the renderer
+  if (style == DOM_STYLE_JSON) {
+    writef("\n");
+  }
+
   // success
   result = 0;
 
@@ -183,4 +203,329 @@ cleanup:
   return result;
 }
 
+static const char *parquet_show_name(i32 value, i32 size, const char *const *names) {
+  // unknown values have no name
+  if (value < 0 || value >= size || names[value] == NULL) return "UNKNOWN";
+
+  return names[value];
+}
+
+static void parquet_show_bound(const char *name,
+                               i32 data_type,
+                               const struct parquet_binary *value,
+                               const struct parquet_binary *deprecated) {
+  struct dom_token token;
+  char buffer[DOM_REAL_SIZE];
+
+  // prefer the new min/max fields over the deprecated ones
+  if (value->ptr == NULL) value = deprecated;
+  if (value->ptr == NULL) return;
+
+  // the same literal show-metadata writes, kept on a single line
+  parquet_metadata_bound(&token, data_type, value);
+
+  switch (token.type) {
+    case DOM_TYPE_BOOL:
+      writef(", %s=%s", name, token.data ? "true" : "false");
+      break;
+
+    case DOM_TYPE_I32:
+    case DOM_TYPE_I64:
+      writef(", %s=%d", name, (i64)token.data);
+      break;
+
+    case DOM_TYPE_F32:
+    case DOM_TYPE_F64:
+      writef(", %s=%s", name, dom_real(&token, buffer));
+      break;
+
+    case DOM_TYPE_ASCII:
+      writef(", %s=%a", name, token.data & 0xffffffffffff, token.data >> 48);
+      break;
+
+    default:
+      writef(", %s=%b", name, token.data & 0xffffffffffff, token.data >> 48);
+      break;
+  }
+}
+
+static void parquet_show_statistics(const struct parquet_column_statistics *statistics, i32 data_type) {
+  // counts are optional
+  if (statistics->null_count != PARQUET_UNKNOWN_VALUE) {
+    writef(", null-count=%d", statistics->null_count);
+  }
+
+  if (statistics->distinct_count != PARQUET_UNKNOWN_VALUE) {
+    writef(", distinct-count=%d", statistics->distinct_count);
+  }
+
+  parquet_show_bound("min", data_type, &statistics->min_value, &statistics->min);
+  parquet_show_bound("max", data_type, &statistics->max_value, &statistics->max);
+}
+
+static void parquet_show_page(const struct parquet_page *page, i32 data_type) {
+  const struct parquet_page_header *header;
+
+  // common part of every page
+  header = &page->header;
+  writef("  page=%d, offset=%d, type=%s",
+         (i64)page->index,
+         page->offset,
+         parquet_show_name(header->type, PARQUET_PAGE_TYPE_SIZE, PARQUET_PAGE_TYPE_NAMES));
+
+  writef(", header-size=%d, compressed-size=%d, uncompressed-size=%d",
+         (i64)page->header_size,
+         (i64)header->compressed_page_size,
+         (i64)header->uncompressed_page_size);
+
+  // type specific part
+  switch (header->type) {
+    case PARQUET_PAGE_TYPE_DATA_PAGE:
+      writef(", values=%d, encoding=%s",
+             (i64)header->data.num_values,
+             parquet_show_name(header->data.encoding, PARQUET_ENCODING_SIZE, PARQUET_ENCODING_NAMES));
+      writef(", definition-encoding=%s, repetition-encoding=%s",
+             parquet_show_name(header->data.definition_level_encoding, PARQUET_ENCODING_SIZE, PARQUET_ENCODING_NAMES),
+             parquet_show_name(header->data.repetition_level_encoding, PARQUET_ENCODING_SIZE, PARQUET_ENCODING_NAMES));
+      parquet_show_statistics(&header->data.statistics, data_type);
+      break;
+
+    case PARQUET_PAGE_TYPE_DICTIONARY_PAGE:
+      writef(", values=%d, encoding=%s, sorted=%s",
+             (i64)header->dictionary.num_values,
+             parquet_show_name(header->dictionary.encoding, PARQUET_ENCODING_SIZE, PARQUET_ENCODING_NAMES),
+             header->dictionary.is_sorted ? "true" : "false");
+      break;
+
+    case PARQUET_PAGE_TYPE_DATA_PAGE_V2:
+      writef(", values=%d, nulls=%d, rows=%d, encoding=%s",
+             (i64)header->data_v2.num_values,
+             (i64)header->data_v2.num_nulls,
+             (i64)header->data_v2.num_rows,
+             parquet_show_name(header->data_v2.encoding, PARQUET_ENCODING_SIZE, PARQUET_ENCODING_NAMES));
+      writef(", definition-size=%d, repetition-size=%d, compressed=%s",
+             (i64)header->data_v2.definition_levels_byte_length,
+             (i64)header->data_v2.repetition_levels_byte_length,
+             header->data_v2.is_compressed ? "true" : "false");
+      parquet_show_statistics(&header->data_v2.statistics, data_type);
+      break;
+  }
+
+  // checksum is optional
+  if (header->crc != PARQUET_UNKNOWN_VALUE) {
+    writef(", crc=%x", header->crc);
+  }
+
+  writef("\n");
+}
+
+void parquet_show_mismatch(const char *file,
+                           u32 row_group,
+                           u32 column,
+                           const struct parquet_column_meta *meta,
+                           const struct parquet_page *page) {
+  char **path;
+
+  // tell which page of which chunk is corrupted
+  errorf("Page checksum mismatch; file=%s, row-group=%d, column=%d, path=", file, (i64)row_group, (i64)column);
+  for (path = meta->path_in_schema; *path != NULL; path++) {
+    errorf(path == meta->path_in_schema ? "%s" : ".%s", *path);
+  }
+
+  errorf(", page=%d, offset=%d, crc=%x\n", (i64)page->index, (i64)page->offset, page->header.crc);
+}
+
+i32 parquet_show_pages(u32 argc, const char **argv) {
+  i64 result;
+  u32 row_group, column;
+  u32 verified, missing, mismatched;
+  bool verify;
+  char **path;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_column_meta *meta;
+  struct parquet_pages pages;
+  struct parquet_page page;
+
+  // check for required arguments
+  result = PARQUET_INVALID_ARGUMENTS;
+  if (argc < 1) goto cleanup;
+
+  // page checksums are only verified on request
+  verify = argv_flag(argc - 1, argv + 1, "--verify-crc");
+  verified = missing = mismatched = 0;
+
+  // initialize memory and parquet file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // try to open parquet file
+  result = parquet_open(&file, argv[0]);
+  if (result < 0) goto cleanup_memory;
+
+  // try to parse metadata
+  result = parquet_parse(&file, &metadata);
+  if (result < 0) goto cleanup_file;
+
+  // row groups and their columns are required, a footer without them is malformed
+  result = PARQUET_ERROR_INVALID_FILE;
+  if (metadata.row_groups == PARQUET_NULL_VALUE) goto cleanup_file;
+
+  for (row_group = 0; metadata.row_groups[row_group] != NULL; row_group++) {
+    result = PARQUET_ERROR_INVALID_FILE;
+    if (metadata.row_groups[row_group]->columns == PARQUET_NULL_VALUE) goto cleanup_file;
+
+    for (column = 0; metadata.row_groups[row_group]->columns[column] != NULL; column++) {
+      // chunks stored in external files are not supported
+      result = PARQUET_ERROR_INVALID_FILE;
+      meta = metadata.row_groups[row_group]->columns[column]->meta;
+      if (meta == NULL) goto cleanup_file;
+
+      // describe the column chunk
+      writef("row-group=%d, column=%d, path=", (i64)row_group, (i64)column);
+      for (path = meta->path_in_schema; *path != NULL; path++) {
+        writef(path == meta->path_in_schema ? "%s" : ".%s", *path);
+      }
+
+      writef(", codec=%s, values=%d\n",
+             parquet_show_name(meta->compression_codec, PARQUET_COMPRESSION_SIZE, PARQUET_COMPRESSION_NAMES),
+             meta->num_values);
+
+      // read the whole column chunk, nothing is decompressed
+      result = parquet_pages_init(&pages, &file, meta, FALSE);
+      if (result < 0) goto cleanup_file;
+
+      // and describe each of its pages
+      while ((result = parquet_pages_next(&pages, &page)) == 1) {
+        parquet_show_page(&page, meta->data_type);
+        if (!verify) continue;
+
+        // a mismatch is reported and the scan goes on
+        result = parquet_pages_verify(&page);
+        if (result == PARQUET_ERROR_CHECKSUM_MISMATCH) {
+          parquet_show_mismatch(argv[0], row_group, column, meta, &page);
+          mismatched++;
+        } else {
+          verified += result == 1;
+          missing += result == 0;
+        }
+      }
+
+      parquet_pages_release(&pages);
+      if (result < 0) goto cleanup_file;
+    }
+  }
+
+  // summarize the checksums
+  if (verify) {
+    writef("verified=%d, missing=%d, mismatched=%d\n", (i64)verified, (i64)missing, (i64)mismatched);
+
+    result = PARQUET_ERROR_CHECKSUM_MISMATCH;
+    if (mismatched > 0) goto cleanup_file;
+  }
+
+  // success
+  result = 0;
+
+cleanup_file:
+  parquet_close(&file);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+
+cleanup:
+  return result;
+}
+
+static void parquet_show_column(u32 row_group, u32 column, const struct parquet_column_meta *meta) {
+  char **path;
+  const struct parquet_column_statistics *statistics;
+
+  writef("row-group=%d, column=%d, path=", (i64)row_group, (i64)column);
+  for (path = meta->path_in_schema; *path != NULL; path++) {
+    writef(path == meta->path_in_schema ? "%s" : ".%s", *path);
+  }
+
+  writef(", type=%s, values=%d, size=%d",
+         parquet_show_name(meta->data_type, PARQUET_DATA_TYPE_SIZE, PARQUET_DATA_TYPE_NAMES),
+         meta->num_values,
+         meta->total_compressed_size);
+
+  // every part of the statistics is optional
+  statistics = meta->statistics;
+  if (statistics != NULL && statistics->null_count != PARQUET_UNKNOWN_VALUE) {
+    writef(", nulls=%d", statistics->null_count);
+  }
+
+  if (statistics != NULL && statistics->distinct_count != PARQUET_UNKNOWN_VALUE) {
+    writef(", distinct=%d", statistics->distinct_count);
+  }
+
+  if (statistics != NULL) {
+    parquet_show_bound("min", meta->data_type, &statistics->min_value, &statistics->min);
+    parquet_show_bound("max", meta->data_type, &statistics->max_value, &statistics->max);
+  }
+
+  writef("\n");
+}
+
+i32 parquet_show_columns(u32 argc, const char **argv) {
+  i64 result;
+  u32 row_group, column;
+
+  struct malloc_pool pool;
+  struct parquet_file file;
+  struct parquet_metadata metadata;
+  struct parquet_column_meta *meta;
+
+  // check for required arguments
+  result = PARQUET_INVALID_ARGUMENTS;
+  if (argc < 1) goto cleanup;
+
+  // initialize memory and parquet file
+  malloc_init(&pool);
+  parquet_init(&file, &pool);
+
+  // try to open parquet file
+  result = parquet_open(&file, argv[0]);
+  if (result < 0) goto cleanup_memory;
+
+  // try to parse metadata, the statistics reference the footer
+  result = parquet_parse(&file, &metadata);
+  if (result < 0) goto cleanup_file;
+
+  // row groups and their columns are required, a footer without them is malformed
+  result = PARQUET_ERROR_INVALID_FILE;
+  if (metadata.row_groups == PARQUET_NULL_VALUE) goto cleanup_file;
+
+  for (row_group = 0; metadata.row_groups[row_group] != NULL; row_group++) {
+    result = PARQUET_ERROR_INVALID_FILE;
+    if (metadata.row_groups[row_group]->columns == PARQUET_NULL_VALUE) goto cleanup_file;
+
+    for (column = 0; metadata.row_groups[row_group]->columns[column] != NULL; column++) {
+      // chunks stored in external files are not supported
+      result = PARQUET_ERROR_INVALID_FILE;
+      meta = metadata.row_groups[row_group]->columns[column]->meta;
+      if (meta == NULL) goto cleanup_file;
+
+      // describe the column chunk in a single line
+      parquet_show_column(row_group, column, meta);
+    }
+  }
+
+  // success
+  result = 0;
+
+cleanup_file:
+  parquet_close(&file);
+
+cleanup_memory:
+  malloc_destroy(&pool);
+
+cleanup:
+  return result;
+}
+
 #endif
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "parquet.page.h"
+#include "parquet.parse.h"
 #include "typing.h"
 
 /// @brief Shows the content of a Parquet file.
@@ -13,3 +15,27 @@ extern i32 parquet_show(u32 argc, const char **argv);
 /// @param argv Array of command-line argument strings.
 /// @return 0 on success, or a negative error code on failure.
 extern i32 parquet_show_schema(u32 argc, const char **argv);
+
+/// @brief Shows the page headers of every column chunk of a Parquet file.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_show_pages(u32 argc, const char **argv);
+
+/// @brief Shows a single line of statistics for every column chunk of a Parquet file.
+/// @param argc Number of command-line arguments.
+/// @param argv Array of command-line argument strings.
+/// @return 0 on success, or a negative error code on failure.
+extern i32 parquet_show_columns(u32 argc, const char **argv);
+
+/// @brief Reports a page failing its checksum on stderr, naming the file, row group, column and page.
+/// @param file Path of the Parquet file.
+/// @param row_group Index of the row group.
+/// @param column Index of the column chunk in the row group.
+/// @param meta Pointer to the metadata of the column chunk.
+/// @param page Pointer to the failed page.
+extern void parquet_show_mismatch(const char *file,
+                                  u32 row_group,
+                                  u32 column,
+                                  const struct parquet_column_meta *meta,
+                                  const struct parquet_page *page);
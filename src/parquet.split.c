@@ -0,0 +1,267 @@
+#include "parquet.split.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+// sixteen bytes, loaded and stored without any alignment requirement
+typedef u8 parquet_split_bytes __attribute__((vector_size(16), aligned(1)));
+
+static void parquet_split_transpose(const char *buffer, u64 stride, u32 width, char *target) {
+  u32 index, round, half;
+  parquet_split_bytes planes[PARQUET_SPLIT_MAX_WIDTH], next[PARQUET_SPLIT_MAX_WIDTH];
+
+  // load the same 16 positions of every byte stream
+  for (index = 0; index < width; index++) {
+    planes[index] = *(const parquet_split_bytes *)(buffer + index * stride);
+  }
+
+  // each round interleaves bytes of the first half of the planes with the second half,
+  // after log2(width) rounds every plane holds whole values in their original order
+  for (round = 1, half = width / 2; round < width; round *= 2) {
+    for (index = 0; index < half; index++) {
+      next[2 * index] = __builtin_shuffle(planes[index], planes[index + half],
+                                          (parquet_split_bytes){0, 16, 1, 17, 2, 18, 3, 19,
+                                                                4, 20, 5, 21, 6, 22, 7, 23});
+      next[2 * index + 1] = __builtin_shuffle(planes[index], planes[index + half],
+                                              (parquet_split_bytes){8, 24, 9, 25, 10, 26, 11, 27,
+                                                                    12, 28, 13, 29, 14, 30, 15, 31});
+    }
+
+    for (index = 0; index < width; index++) {
+      planes[index] = next[index];
+    }
+  }
+
+  // store the values
+  for (index = 0; index < width; index++) {
+    *(parquet_split_bytes *)(target + index * sizeof(parquet_split_bytes)) = planes[index];
+  }
+}
+
+i64 parquet_split_decode(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count) {
+  u32 index, offset;
+  u64 size;
+  char *target;
+
+  // only fixed-width types are supported
+  switch (vector->data_type) {
+    case PARQUET_DATA_TYPE_INT32:
+    case PARQUET_DATA_TYPE_INT64:
+    case PARQUET_DATA_TYPE_FLOAT:
+    case PARQUET_DATA_TYPE_DOUBLE:
+    case PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED:
+      break;
+    default:
+      return PARQUET_ERROR_INVALID_TYPE;
+  }
+
+  // check the capacity
+  if (count > vector->capacity - vector->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // every stream must be fully available
+  size = (u64)count * vector->width;
+  if (size > buffer_size) return PARQUET_ERROR_INVALID_FILE;
+
+  // values are appended after existing values
+  target = vector->values + (u64)vector->count * vector->width;
+  index = 0;
+
+  // power-of-two widths are transposed 16 values at a time
+  if ((vector->width & (vector->width - 1)) == 0 && vector->width <= PARQUET_SPLIT_MAX_WIDTH) {
+    for (; index + PARQUET_SPLIT_BLOCK <= count; index += PARQUET_SPLIT_BLOCK) {
+      parquet_split_transpose(buffer + index, count, vector->width, target + (u64)index * vector->width);
+    }
+  }
+
+  // the remaining values byte by byte
+  for (; index < count; index++) {
+    for (offset = 0; offset < vector->width; offset++) {
+      target[(u64)index * vector->width + offset] = buffer[(u64)offset * count + index];
+    }
+  }
+
+  // success
+  vector->count += count;
+  return size;
+}
+
+#if defined(I13C_TESTS)
+
+static void parquet_split_test_encode(char *buffer, const char *values, u32 width, u32 count) {
+  u32 index, offset;
+
+  // scatter byte n of every value into stream n
+  for (index = 0; index < count; index++) {
+    for (offset = 0; offset < width; offset++) {
+      buffer[offset * count + index] = values[index * width + offset];
+    }
+  }
+}
+
+static void can_decode_split_floats() {
+  i64 result;
+  u32 index;
+  f32 expected[37];
+  char buffer[37 * sizeof(f32)];
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // two full blocks and a tail
+  for (index = 0; index < 37; index++) {
+    expected[index] = (f32)index * 1.5f - 20.25f;
+  }
+
+  parquet_split_test_encode(buffer, (const char *)expected, sizeof(f32), 37);
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_FLOAT, 0, 37);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_split_decode(&vector, buffer, sizeof(buffer), 37);
+  assert(result == sizeof(buffer), "should consume the entire buffer");
+  assert(vector.count == 37, "should decode 37 values");
+
+  // assert the values
+  for (index = 0; index < 37; index++) {
+    assert(((f32 *)vector.values)[index] == expected[index], "value should match");
+  }
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_split_doubles() {
+  i64 result;
+  u32 index;
+  f64 expected[50];
+  char buffer[50 * sizeof(f64)];
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // three full blocks and a tail
+  for (index = 0; index < 50; index++) {
+    expected[index] = (f64)index * 1000.125 - 3.5;
+  }
+
+  parquet_split_test_encode(buffer, (const char *)expected, sizeof(f64), 50);
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_DOUBLE, 0, 50);
+  assert(result == 0, "should initialize vector");
+
+  // decode all values
+  result = parquet_split_decode(&vector, buffer, sizeof(buffer), 50);
+  assert(result == sizeof(buffer), "should consume the entire buffer");
+
+  // assert the values
+  for (index = 0; index < 50; index++) {
+    assert(((f64 *)vector.values)[index] == expected[index], "value should match");
+  }
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_decode_split_fixed() {
+  i64 result;
+  u32 index, width;
+  char expected[20 * 16], buffer[20 * 16];
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  for (width = 1; width <= 16; width++) {
+    // distinct bytes for every position of every value
+    for (index = 0; index < 20 * width; index++) {
+      expected[index] = (char)(index * 7 + width);
+    }
+
+    parquet_split_test_encode(buffer, expected, width, 20);
+
+    // initialize the pool and the vector
+    malloc_init(&pool);
+
+    result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED, width, 20);
+    assert(result == 0, "should initialize vector");
+
+    // decode all values
+    result = parquet_split_decode(&vector, buffer, 20 * width, 20);
+    assert(result == 20 * width, "should consume the entire buffer");
+
+    // assert the bytes
+    for (index = 0; index < 20 * width; index++) {
+      assert(vector.values[index] == expected[index], "byte should match");
+    }
+
+    // release everything
+    parquet_vector_release(&vector, &pool);
+    malloc_destroy(&pool);
+  }
+}
+
+static void can_detect_split_truncated_streams() {
+  i64 result;
+  char buffer[15] = {0};
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_FLOAT, 0, 4);
+  assert(result == 0, "should initialize vector");
+
+  // 4 floats need 16 bytes
+  result = parquet_split_decode(&vector, buffer, sizeof(buffer), 4);
+  assert(result == PARQUET_ERROR_INVALID_FILE, "should fail with PARQUET_ERROR_INVALID_FILE");
+  assert(vector.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_split_invalid_type() {
+  i64 result;
+  char buffer[16] = {0};
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_BYTE_ARRAY, 0, 1);
+  assert(result == 0, "should initialize vector");
+
+  // byte arrays have no fixed width
+  result = parquet_split_decode(&vector, buffer, sizeof(buffer), 1);
+  assert(result == PARQUET_ERROR_INVALID_TYPE, "should fail with PARQUET_ERROR_INVALID_TYPE");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_split(struct runner_context *ctx) {
+  test_case(ctx, "can decode split floats", can_decode_split_floats);
+  test_case(ctx, "can decode split doubles", can_decode_split_doubles);
+  test_case(ctx, "can decode split fixed", can_decode_split_fixed);
+  test_case(ctx, "can detect split truncated streams", can_detect_split_truncated_streams);
+  test_case(ctx, "can detect split invalid type", can_detect_split_invalid_type);
+}
+
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "parquet.vector.h"
+#include "runner.h"
+#include "typing.h"
+
+#define PARQUET_SPLIT_BLOCK 16     // values transposed at once by the vector kernels
+#define PARQUET_SPLIT_MAX_WIDTH 16 // widest value handled by the vector kernels
+
+/// @brief Decodes BYTE_STREAM_SPLIT values and appends them to a fixed-width vector.
+/// @param vector Pointer to the initialized parquet_vector structure.
+/// @param buffer Pointer to the byte streams, one stream of count bytes for each byte of a value.
+/// @param buffer_size Number of bytes available in the buffer.
+/// @param count Number of values to decode, exactly the number of values in the streams.
+/// @return The number of consumed bytes, or a negative error code on failure.
+extern i64 parquet_split_decode(struct parquet_vector *vector, const char *buffer, u64 buffer_size, u32 count);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet byte stream split test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_split(struct runner_context *ctx);
+
+#endif
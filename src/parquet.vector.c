@@ -0,0 +1,187 @@
+#include "parquet.vector.h"
+#include "malloc.h"
+#include "parquet.base.h"
+#include "parquet.parse.h"
+#include "runner.h"
+#include "typing.h"
+
+i64 parquet_vector_width(i32 data_type, i32 type_length) {
+  switch (data_type) {
+    case PARQUET_DATA_TYPE_BOOLEAN:
+      return sizeof(bool);
+    case PARQUET_DATA_TYPE_INT32:
+      return sizeof(i32);
+    case PARQUET_DATA_TYPE_INT64:
+      return sizeof(i64);
+    case PARQUET_DATA_TYPE_INT96:
+      return 12;
+    case PARQUET_DATA_TYPE_FLOAT:
+      return sizeof(f32);
+    case PARQUET_DATA_TYPE_DOUBLE:
+      return sizeof(f64);
+    case PARQUET_DATA_TYPE_BYTE_ARRAY:
+      return sizeof(struct parquet_binary);
+    case PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED:
+      return type_length > 0 ? type_length : PARQUET_ERROR_INVALID_VALUE;
+    default:
+      return PARQUET_ERROR_INVALID_TYPE;
+  }
+}
+
+i64 parquet_vector_init(struct parquet_vector *vector,
+                        struct malloc_pool *pool,
+                        i32 data_type,
+                        i32 type_length,
+                        u32 capacity) {
+  i64 result;
+
+  // determine the size of a single value
+  result = parquet_vector_width(data_type, type_length);
+  if (result < 0) return result;
+
+  // defaults
+  vector->data_type = data_type;
+  vector->width = result;
+  vector->count = 0;
+  vector->capacity = capacity;
+  vector->values = NULL;
+  vector->lease.ptr = NULL;
+
+  // allocate the values
+  vector->lease.size = malloc_fit((u64)capacity * vector->width);
+  result = malloc_acquire(pool, &vector->lease);
+  if (result < 0) return result;
+
+  // success
+  vector->values = vector->lease.ptr;
+  return 0;
+}
+
+i64 parquet_vector_append(struct parquet_vector *vector, const char *buffer, u32 count) {
+  u64 size;
+  char *target;
+
+  // check the capacity
+  if (count > vector->capacity - vector->count) return PARQUET_ERROR_CAPACITY_OVERFLOW;
+
+  // determine what to copy
+  size = (u64)count * vector->width;
+  target = vector->values + (u64)vector->count * vector->width;
+
+  // copy 8 bytes at a time
+  while (size >= 8) {
+    *(u64 *)target = *(const u64 *)buffer;
+    target += 8;
+    buffer += 8;
+    size -= 8;
+  }
+
+  // and the remaining tail
+  while (size > 0) {
+    *target++ = *buffer++;
+    size--;
+  }
+
+  // success
+  vector->count += count;
+  return 0;
+}
+
+void parquet_vector_reset(struct parquet_vector *vector) {
+  vector->count = 0;
+}
+
+void parquet_vector_release(struct parquet_vector *vector, struct malloc_pool *pool) {
+  // release the values if any
+  if (vector->lease.ptr != NULL) {
+    malloc_release(pool, &vector->lease);
+  }
+
+  vector->values = NULL;
+}
+
+#if defined(I13C_TESTS)
+
+static void can_determine_vector_widths() {
+  // fixed-width types
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_BOOLEAN, 0) == 1, "boolean should take 1 byte");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_INT32, 0) == 4, "int32 should take 4 bytes");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_INT64, 0) == 8, "int64 should take 8 bytes");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_INT96, 0) == 12, "int96 should take 12 bytes");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_FLOAT, 0) == 4, "float should take 4 bytes");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_DOUBLE, 0) == 8, "double should take 8 bytes");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED, 16) == 16, "fixed array should take its length");
+
+  // variable-width types are referenced
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_BYTE_ARRAY, 0) == sizeof(struct parquet_binary),
+         "byte array should take a reference");
+
+  // invalid types
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_BYTE_ARRAY_FIXED, 0) == PARQUET_ERROR_INVALID_VALUE,
+         "fixed array should require its length");
+  assert(parquet_vector_width(PARQUET_DATA_TYPE_SIZE, 0) == PARQUET_ERROR_INVALID_TYPE, "should reject unknown type");
+}
+
+static void can_append_to_vector() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const i32 values[] = {1, 2, 3, 4, 5};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT32, 0, 8);
+  assert(result == 0, "should initialize vector");
+
+  // append values twice
+  result = parquet_vector_append(&vector, (const char *)values, 5);
+  assert(result == 0, "should append 5 values");
+
+  result = parquet_vector_append(&vector, (const char *)values, 3);
+  assert(result == 0, "should append 3 values");
+
+  // assert the values
+  assert(vector.count == 8, "should hold 8 values");
+  assert(((i32 *)vector.values)[4] == 5, "value 4 should be 5");
+  assert(((i32 *)vector.values)[5] == 1, "value 5 should be 1");
+  assert(((i32 *)vector.values)[7] == 3, "value 7 should be 3");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+static void can_detect_vector_capacity_overflow() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct parquet_vector vector;
+
+  const i64 values[] = {1, 2, 3};
+
+  // initialize the pool and the vector
+  malloc_init(&pool);
+
+  result = parquet_vector_init(&vector, &pool, PARQUET_DATA_TYPE_INT64, 0, 2);
+  assert(result == 0, "should initialize vector");
+
+  // append more values than it can hold
+  result = parquet_vector_append(&vector, (const char *)values, 3);
+  assert(result == PARQUET_ERROR_CAPACITY_OVERFLOW, "should fail with PARQUET_ERROR_CAPACITY_OVERFLOW");
+  assert(vector.count == 0, "should not change count");
+
+  // release everything
+  parquet_vector_release(&vector, &pool);
+  malloc_destroy(&pool);
+}
+
+void parquet_test_cases_vector(struct runner_context *ctx) {
+  test_case(ctx, "can determine vector widths", can_determine_vector_widths);
+  test_case(ctx, "can append to vector", can_append_to_vector);
+  test_case(ctx, "can detect vector capacity overflow", can_detect_vector_capacity_overflow);
+}
+
+#endif
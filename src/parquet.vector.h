@@ -0,0 +1,59 @@
+#pragma once
+
+#include "malloc.h"
+#include "parquet.parse.h"
+#include "runner.h"
+#include "typing.h"
+
+struct parquet_vector {
+  i32 data_type; // physical type of the values
+  u32 width;     // size of a single value in bytes
+  u32 count;     // number of values in the vector
+  u32 capacity;  // maximum number of values the vector can hold
+
+  char *values;              // values laid out one after another, width bytes each
+  struct malloc_lease lease; // lease backing the values
+};
+
+/// @brief Returns the size of a single value of the physical type in the vector.
+/// @param data_type Physical type of the values.
+/// @param type_length Length of FIXED_LEN_BYTE_ARRAY values, ignored for other types.
+/// @return The size in bytes, or a negative error code if the type is not supported.
+extern i64 parquet_vector_width(i32 data_type, i32 type_length);
+
+/// @brief Allocates a vector holding up to capacity values of the physical type.
+/// @param vector Pointer to the parquet_vector structure to initialize.
+/// @param pool Pointer to the malloc_pool structure to allocate from.
+/// @param data_type Physical type of the values.
+/// @param type_length Length of FIXED_LEN_BYTE_ARRAY values, ignored for other types.
+/// @param capacity Maximum number of values.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_vector_init(struct parquet_vector *vector,
+                               struct malloc_pool *pool,
+                               i32 data_type,
+                               i32 type_length,
+                               u32 capacity);
+
+/// @brief Appends values already in their vector layout, copying them in bulk.
+/// @param vector Pointer to the initialized parquet_vector structure.
+/// @param buffer Pointer to the values to copy.
+/// @param count Number of values to copy.
+/// @return 0 on success, or a negative error code on failure.
+extern i64 parquet_vector_append(struct parquet_vector *vector, const char *buffer, u32 count);
+
+/// @brief Drops all values while keeping the allocated memory.
+/// @param vector Pointer to the initialized parquet_vector structure.
+extern void parquet_vector_reset(struct parquet_vector *vector);
+
+/// @brief Releases the memory held by the vector.
+/// @param vector Pointer to the initialized parquet_vector structure.
+/// @param pool Pointer to the malloc_pool structure the vector was allocated from.
+extern void parquet_vector_release(struct parquet_vector *vector, struct malloc_pool *pool);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers parquet vector test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void parquet_test_cases_vector(struct runner_context *ctx);
+
+#endif
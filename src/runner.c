@@ -1,19 +1,41 @@
 #include "runner.h"
 #include "arena.h"
+#include "codec.base.h"
+#include "codec.brotli.h"
+#include "codec.crc.h"
+#include "codec.gzip.h"
+#include "codec.lz4.h"
+#include "codec.snappy.h"
+#include "codec.zstd.h"
 #include "dom.h"
 #include "error.h"
 #include "format.base.h"
+#include "format.real.h"
 #include "malloc.h"
 #include "parquet.base.h"
+#include "parquet.batch.h"
+#include "parquet.convert.h"
+#include "parquet.csv.h"
+#include "parquet.delta.h"
+#include "parquet.dictionary.h"
 #include "parquet.iter.h"
+#include "parquet.nested.h"
+#include "parquet.page.h"
 #include "parquet.parse.h"
+#include "parquet.plain.h"
+#include "parquet.rle.h"
 #include "parquet.schema.open.h"
 #include "parquet.schema.out.h"
+#include "parquet.split.h"
+#include "parquet.vector.h"
 #include "stdout.h"
 #include "sys.h"
 #include "thrift.base.h"
 #include "thrift.dom.h"
 #include "thrift.iter.h"
+#include "thrift.path.h"
+#include "thrift.stream.h"
+#include "thrift.tape.h"
 #include "typing.h"
 
 #if defined(I13C_TESTS)
@@ -80,20 +102,42 @@ i32 runner_execute() {
 
   // register test cases
   arena_test_cases(&ctx);
+  codec_test_cases_base(&ctx);
+  codec_test_cases_brotli(&ctx);
+  codec_test_cases_crc(&ctx);
+  codec_test_cases_gzip(&ctx);
+  codec_test_cases_lz4(&ctx);
+  codec_test_cases_snappy(&ctx);
+  codec_test_cases_zstd(&ctx);
   dom_test_cases(&ctx);
   error_test_cases(&ctx);
   malloc_test_cases(&ctx);
   parquet_test_cases_base(&ctx);
+  parquet_test_cases_batch(&ctx);
+  parquet_test_cases_convert(&ctx);
+  parquet_test_cases_csv(&ctx);
+  parquet_test_cases_delta(&ctx);
+  parquet_test_cases_dictionary(&ctx);
   parquet_test_cases_iter(&ctx);
+  parquet_test_cases_nested(&ctx);
+  parquet_test_cases_page(&ctx);
   parquet_test_cases_parse(&ctx);
+  parquet_test_cases_plain(&ctx);
+  parquet_test_cases_rle(&ctx);
   parquet_test_cases_schema_open(&ctx);
   parquet_test_cases_schema_out(&ctx);
+  parquet_test_cases_split(&ctx);
+  parquet_test_cases_vector(&ctx);
   runner_test_cases(&ctx);
   format_test_cases_base(&ctx);
+  format_test_cases_real(&ctx);
 
   thrift_test_cases_base(&ctx);
   thrift_test_cases_dom(&ctx);
   thrift_test_cases_iter(&ctx);
+  thrift_test_cases_path(&ctx);
+  thrift_test_cases_stream(&ctx);
+  thrift_test_cases_tape(&ctx);
 
   // execute all registered test cases
   for (index = 0; index < ctx.offset; index++) {
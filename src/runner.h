@@ -10,8 +10,8 @@ struct runner_entry {
 };
 
 struct runner_context {
-  u64 offset;                       // holds number of occupied entries
-  struct runner_entry entries[256]; // holds only 256 entries for now
+  u64 offset;                        // holds number of occupied entries
+  struct runner_entry entries[1024]; // holds only 1024 entries for now
 };
 
 /// @brief Appends a test case to the runner context.
@@ -10,6 +10,8 @@
 #define MAP_PRIVATE 0x02
 #define MAP_ANONYMOUS 0x20
 
+#define CLOCK_MONOTONIC 1
+
 typedef struct {
   u64 st_dev;
   u64 st_ino;
@@ -31,6 +33,11 @@ typedef struct {
   i64 __unused[3];
 } file_stat;
 
+typedef struct {
+  i64 tv_sec;
+  i64 tv_nsec;
+} time_spec;
+
 /// @brief Reads data from a file descriptor.
 /// @param fd File descriptor to read from.
 /// @param buf Buffer to store read data.
@@ -86,6 +93,16 @@ extern i64 sys_munmap(void *addr, u64 length);
 /// @return Number of bytes read on success, or negative error code.
 extern i64 sys_pread(i32 fd, char *buf, u64 count, u64 offset);
 
+/// @brief Retrieves the time of the specified clock.
+/// @param clock Clock identifier (e.g., CLOCK_MONOTONIC).
+/// @param time Pointer to a struct where the time will be stored.
+/// @return 0 on success, or negative error code.
+extern i64 sys_clock_gettime(i32 clock, time_spec *time);
+
+/// @brief Retrieves the monotonic time in microseconds, e.g. to measure elapsed time.
+/// @return Microseconds since an unspecified starting point.
+extern u64 sys_clock_micros();
+
 /// @brief Exits the program with the given status code.
 /// @param status Exit status code.
 extern void sys_exit(i32 status);
@@ -1,5 +1,5 @@
     section .text
-    global sys_read, sys_write, sys_open, sys_close, sys_fstat, sys_mmap, sys_munmap, sys_pread, sys_exit
+    global sys_read, sys_write, sys_open, sys_close, sys_fstat, sys_mmap, sys_munmap, sys_pread, sys_clock_gettime, sys_clock_micros, sys_exit
 
 ; reads data from the file descriptor
 ; rdi - file descriptor (0 for stdin)
@@ -82,6 +82,33 @@ sys_pread:
     syscall
     ret
 
+; retrieves the time of the specified clock
+; rdi - clock identifier (1 for CLOCK_MONOTONIC)
+; rsi - pointer to a struct timespec where the time will be stored
+; returns 0 on success, or negative on error
+sys_clock_gettime:
+    mov rax, 228
+    syscall
+    ret
+
+; retrieves the monotonic time in microseconds
+; the monotonic clock cannot fail with a valid pointer, so no error is reported
+; rax - returns microseconds since an unspecified starting point
+sys_clock_micros:
+    sub rsp, 16
+    mov edi, 1
+    mov rsi, rsp
+    mov rax, 228
+    syscall
+    mov rax, [rsp + 8]
+    xor edx, edx
+    mov ecx, 1000
+    div rcx
+    imul rcx, [rsp], 1000000
+    add rax, rcx
+    add rsp, 16
+    ret
+
 ; exits the program with the given exit code
 ; edi - exit code (0 for success, non-zero for error)
 ; rax - returns 0 if no error, or negative value indicating an error
@@ -2,111 +2,90 @@
 #include "runner.h"
 #include "typing.h"
 
-/// @brief Thrift ignore field function type.
-/// @param buffer Pointer to the buffer containing the data.
-/// @param buffer_size Size of the buffer.
-/// @return The number of bytes read from the buffer, or a negative error code.
-typedef i64 (*thrift_ignore_field_fn)(const char *buffer, u64 buffer_size);
-
-// forward declarations of ignore functions
-static i64 thrift_ignore_field_bool_true(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_bool_false(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_bool(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_i8(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_i16(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_i32(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_i64(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_binary(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_list(const char *buffer, u64 buffer_size);
-static i64 thrift_ignore_field_struct(const char *buffer, u64 buffer_size);
-
-// represents a mapping between types and ignore functions used for struct fields
-static const thrift_ignore_field_fn THRIFT_IGNORE_STRUCT_FN[THRIFT_TYPE_SIZE] = {
-  [THRIFT_TYPE_STOP] = NULL,
-  [THRIFT_TYPE_BOOL_TRUE] = thrift_ignore_field_bool_true,
-  [THRIFT_TYPE_BOOL_FALSE] = thrift_ignore_field_bool_false,
-  [THRIFT_TYPE_I8] = thrift_ignore_field_i8,
-  [THRIFT_TYPE_I16] = thrift_ignore_field_i16,
-  [THRIFT_TYPE_I32] = thrift_ignore_field_i32,
-  [THRIFT_TYPE_I64] = thrift_ignore_field_i64,
-  [THRIFT_TYPE_DOUBLE] = NULL,
-  [THRIFT_TYPE_BINARY] = thrift_ignore_field_binary,
-  [THRIFT_TYPE_LIST] = thrift_ignore_field_list,
-  [THRIFT_TYPE_SET] = NULL,
-  [THRIFT_TYPE_MAP] = NULL,
-  [THRIFT_TYPE_STRUCT] = thrift_ignore_field_struct,
-  [THRIFT_TYPE_UUID] = NULL};
-
-// represents a mapping between types and ignore functions used for list elements
-static const thrift_ignore_field_fn THRIFT_IGNORE_LIST_FN[THRIFT_TYPE_SIZE] = {
-  [THRIFT_TYPE_STOP] = NULL,
-  [THRIFT_TYPE_BOOL_TRUE] = thrift_ignore_field_bool,
-  [THRIFT_TYPE_BOOL_FALSE] = thrift_ignore_field_bool,
-  [THRIFT_TYPE_I8] = thrift_ignore_field_i8,
-  [THRIFT_TYPE_I16] = thrift_ignore_field_i16,
-  [THRIFT_TYPE_I32] = thrift_ignore_field_i32,
-  [THRIFT_TYPE_I64] = thrift_ignore_field_i64,
-  [THRIFT_TYPE_DOUBLE] = NULL,
-  [THRIFT_TYPE_BINARY] = thrift_ignore_field_binary,
-  [THRIFT_TYPE_LIST] = thrift_ignore_field_list,
-  [THRIFT_TYPE_SET] = NULL,
-  [THRIFT_TYPE_MAP] = NULL,
-  [THRIFT_TYPE_STRUCT] = thrift_ignore_field_struct,
-  [THRIFT_TYPE_UUID] = NULL};
-
-static i64 thrift_ignore_field_bool_true(const char *, u64) {
-  return 0;
-}
-
-static i64 thrift_ignore_field_bool_false(const char *, u64) {
-  return 0;
-}
-
-static i64 thrift_ignore_field_bool(const char *buffer, u64 buffer_size) {
-  return thrift_read_bool(NULL, buffer, buffer_size);
-}
-
-static i64 thrift_ignore_field_i8(const char *buffer, u64 buffer_size) {
-  return thrift_read_i8(NULL, buffer, buffer_size);
-}
-
-static i64 thrift_ignore_field_i16(const char *buffer, u64 buffer_size) {
-  return thrift_read_i16(NULL, buffer, buffer_size);
-}
-
-static i64 thrift_ignore_field_i32(const char *buffer, u64 buffer_size) {
-  return thrift_read_i32(NULL, buffer, buffer_size);
-}
-
-static i64 thrift_ignore_field_i64(const char *buffer, u64 buffer_size) {
-  return thrift_read_i64(NULL, buffer, buffer_size);
-}
-
-static i64 thrift_ignore_field_binary(const char *buffer, u64 buffer_size) {
-  i64 result, read;
-  u32 size;
+// forward declarations, lists and structs skip their elements recursively
+static i64 thrift_ignore_struct(const char *buffer, u64 buffer_size);
+static i64 thrift_ignore_list(const char *buffer, u64 buffer_size);
+
+// skips a varint without decoding it, the last of its bytes must fit into the remaining bits
+static inline __attribute__((always_inline)) i64 thrift_ignore_varint(const char *buffer,
+                                                                      u64 buffer_size,
+                                                                      u32 limit,
+                                                                      u8 overflow) {
+  u64 index;
+
+  // look for the byte without the continuation bit
+  for (index = 0; index < buffer_size && index < limit; index++) {
+    if (buffer[index] & 0x80) continue;
+
+    // check for the last byte overflow
+    if (index == limit - 1 && (buffer[index] & overflow)) return THRIFT_ERROR_BITS_OVERFLOW;
+
+    // success
+    return index + 1;
+  }
 
-  // default
-  read = 0;
+  // the varint is truncated or too long
+  return THRIFT_ERROR_BUFFER_OVERFLOW;
+}
 
-  // read the size of the binary data to learn how many bytes to read
-  result = thrift_read_binary_header(&size, buffer, buffer_size);
-  if (result < 0) return result;
+static inline __attribute__((always_inline)) i64 thrift_ignore_binary(const char *buffer, u64 buffer_size) {
+  i64 result;
+  u32 size;
 
-  // move the buffer pointer and size
-  read += result;
-  buffer += result;
-  buffer_size -= result;
+  // short sizes fit into a single byte, the longer ones are decoded
+  if (buffer_size > 0 && (*buffer & 0x80) == 0) {
+    size = *buffer;
+    result = 1;
+  } else {
+    result = thrift_read_binary_header(&size, buffer, buffer_size);
+    if (result < 0) return result;
+  }
 
-  // read the binary content, it will be ignored
-  result = thrift_read_binary_content(NULL, size, buffer, buffer_size);
-  if (result < 0) return result;
+  // check if the binary content is within the buffer
+  if (buffer_size - result < size) return THRIFT_ERROR_BUFFER_OVERFLOW;
 
   // success
-  return read + result;
+  return result + size;
 }
 
-static i64 thrift_ignore_field_struct(const char *buffer, u64 buffer_size) {
+static inline __attribute__((always_inline)) i64 thrift_ignore_value(enum thrift_type type,
+                                                                     bool element,
+                                                                     const char *buffer,
+                                                                     u64 buffer_size) {
+  switch (type) {
+    case THRIFT_TYPE_BOOL_TRUE:
+    case THRIFT_TYPE_BOOL_FALSE:
+      // struct fields keep their value in the type, list elements take a byte
+      return element ? thrift_read_bool(NULL, buffer, buffer_size) : 0;
+
+    case THRIFT_TYPE_I8:
+      return thrift_read_i8(NULL, buffer, buffer_size);
+
+    case THRIFT_TYPE_I16:
+      return thrift_read_i16(NULL, buffer, buffer_size);
+
+    case THRIFT_TYPE_I32:
+      return thrift_ignore_varint(buffer, buffer_size, 5, 0xf0);
+
+    case THRIFT_TYPE_I64:
+      return thrift_ignore_varint(buffer, buffer_size, 10, 0xfe);
+
+    case THRIFT_TYPE_BINARY:
+      return thrift_ignore_binary(buffer, buffer_size);
+
+    case THRIFT_TYPE_LIST:
+      return thrift_ignore_list(buffer, buffer_size);
+
+    case THRIFT_TYPE_STRUCT:
+      return thrift_ignore_struct(buffer, buffer_size);
+
+    default:
+      return THRIFT_ERROR_INVALID_VALUE;
+  }
+}
+
+static i64 thrift_ignore_struct(const char *buffer, u64 buffer_size) {
+  u8 next;
   i64 result, read;
   struct thrift_struct_header header;
 
@@ -115,9 +94,24 @@ static i64 thrift_ignore_field_struct(const char *buffer, u64 buffer_size) {
   header.field = 0;
 
   while (TRUE) {
-    // read the next struct header of the footer
-    result = thrift_read_struct_header(&header, buffer, buffer_size);
-    if (result < 0) return result;
+    // check if the buffer is large enough
+    if (buffer_size == 0) return THRIFT_ERROR_BUFFER_OVERFLOW;
+
+    // the short notation with a known type is decoded in place
+    next = *buffer;
+
+    if ((next & 0xf0) != 0 && (next & 0x0f) != THRIFT_TYPE_STOP && (next & 0x0f) < THRIFT_TYPE_SIZE) {
+      header.field += next >> 4;
+      header.type = next & 0x0f;
+
+      // if the field index is too large (32767), return an error
+      if (header.field > 0x7fff) return THRIFT_ERROR_BITS_OVERFLOW;
+
+      result = 1;
+    } else {
+      result = thrift_read_struct_header(&header, buffer, buffer_size);
+      if (result < 0) return result;
+    }
 
     // move the buffer pointer and size
     read += result;
@@ -129,8 +123,8 @@ static i64 thrift_ignore_field_struct(const char *buffer, u64 buffer_size) {
       break;
     }
 
-    // call the ignore function
-    result = thrift_ignore_field(NULL, header.field, header.type, buffer, buffer_size);
+    // skip the value of the field
+    result = thrift_ignore_value(header.type, FALSE, buffer, buffer_size);
     if (result < 0) return result;
 
     // move the buffer pointer and size
@@ -143,33 +137,27 @@ static i64 thrift_ignore_field_struct(const char *buffer, u64 buffer_size) {
   return read;
 }
 
-static i64 thrift_ignore_field_list(const char *buffer, u64 buffer_size) {
+static i64 thrift_ignore_list(const char *buffer, u64 buffer_size) {
   u32 index;
   i64 result, read;
   struct thrift_list_header header;
 
-  // default
-  read = 0;
-  index = 0;
-
   // read the list header containing size and type
   result = thrift_read_list_header(&header, buffer, buffer_size);
   if (result < 0) return result;
 
+  // check if the elements can be skipped at all, even when there are none
+  if (header.type == THRIFT_TYPE_DOUBLE) return THRIFT_ERROR_INVALID_VALUE;
+  if (header.type > THRIFT_TYPE_LIST && header.type != THRIFT_TYPE_STRUCT) return THRIFT_ERROR_INVALID_VALUE;
+
   // move the buffer pointer and size
-  read += result;
+  read = result;
   buffer += result;
   buffer_size -= result;
 
-  // check if the ignore function is out of range
-  if (header.type >= THRIFT_TYPE_SIZE) return THRIFT_ERROR_INVALID_VALUE;
-
-  // check if the ignore function is available
-  if (THRIFT_IGNORE_LIST_FN[header.type] == NULL) return THRIFT_ERROR_INVALID_VALUE;
-
   for (index = 0; index < header.size; index++) {
-    // read the list element content, it will be ignored
-    result = THRIFT_IGNORE_LIST_FN[header.type](buffer, buffer_size);
+    // skip the list element content
+    result = thrift_ignore_value(header.type, TRUE, buffer, buffer_size);
     if (result < 0) return result;
 
     // move the buffer pointer and size
@@ -183,14 +171,7 @@ static i64 thrift_ignore_field_list(const char *buffer, u64 buffer_size) {
 }
 
 i64 thrift_ignore_field(void *, i16, enum thrift_type field_type, const char *buffer, u64 buffer_size) {
-  // check if the field type is out of range
-  if (field_type >= THRIFT_TYPE_SIZE) return THRIFT_ERROR_INVALID_VALUE;
-
-  // check if the ignore function is available
-  if (THRIFT_IGNORE_STRUCT_FN[field_type] == NULL) return THRIFT_ERROR_INVALID_VALUE;
-
-  // success
-  return THRIFT_IGNORE_STRUCT_FN[field_type](buffer, buffer_size);
+  return thrift_ignore_value(field_type, FALSE, buffer, buffer_size);
 }
 
 i64 thrift_read_struct_header(struct thrift_struct_header *target, const char *buffer, u64 buffer_size) {
@@ -459,8 +440,8 @@ i64 thrift_read_u32(u32 *target, const char *buffer, u64 buffer_size) {
     return THRIFT_ERROR_BUFFER_OVERFLOW;
   }
 
-  // check for the last byte overflow
-  if (shift >= 28 && (next & 0xf0)) {
+  // check for the last byte overflow, only the fifth byte has fewer than 7 bits left
+  if (shift > 28 && (next & 0xf0)) {
     return THRIFT_ERROR_BITS_OVERFLOW;
   }
 
@@ -1550,6 +1531,125 @@ static void can_detect_i64_buffer_overflow() {
   assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
 }
 
+static void can_ignore_i32_value_as_read() {
+  u32 index;
+  i32 value;
+  i64 expected, result;
+
+  // empty, truncated, four-byte, five-byte, overflowing and too long varints
+  const char buffers[][6] = {
+    {0x00},
+    {0xff, 0xff},
+    {0x80, 0x80, 0x80, 0x40},
+    {0xff, 0xff, 0xff, 0xff, 0x0f},
+    {0xff, 0xff, 0xff, 0xff, 0x10},
+    {0xff, 0xff, 0xff, 0xff, 0x70},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0x01},
+  };
+  const u64 sizes[] = {0, 2, 4, 5, 5, 5, 6};
+
+  for (index = 0; index < sizeof(sizes) / sizeof(u64); index++) {
+    expected = thrift_read_i32(&value, buffers[index], sizes[index]);
+    result = thrift_ignore_field(NULL, 0, THRIFT_TYPE_I32, buffers[index], sizes[index]);
+
+    // the skip must agree with the decoder
+    assert(result == expected, "should skip as many bytes as decoded");
+  }
+
+  // the valid ones are consumed entirely
+  assert(thrift_ignore_field(NULL, 0, THRIFT_TYPE_I32, buffers[2], 4) == 4, "should skip four bytes");
+  assert(thrift_ignore_field(NULL, 0, THRIFT_TYPE_I32, buffers[3], 5) == 5, "should skip five bytes");
+}
+
+static void can_ignore_i64_value_as_read() {
+  u32 index;
+  i64 value;
+  i64 expected, result;
+
+  // empty, truncated, nine-byte, ten-byte, overflowing and too long varints
+  const char buffers[][11] = {
+    {0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01},
+  };
+  const u64 sizes[] = {0, 9, 9, 10, 10, 10, 11};
+
+  for (index = 0; index < sizeof(sizes) / sizeof(u64); index++) {
+    expected = thrift_read_i64(&value, buffers[index], sizes[index]);
+    result = thrift_ignore_field(NULL, 0, THRIFT_TYPE_I64, buffers[index], sizes[index]);
+
+    // the skip must agree with the decoder
+    assert(result == expected, "should skip as many bytes as decoded");
+  }
+
+  // the valid ones are consumed entirely
+  assert(thrift_ignore_field(NULL, 0, THRIFT_TYPE_I64, buffers[2], 9) == 9, "should skip nine bytes");
+  assert(thrift_ignore_field(NULL, 0, THRIFT_TYPE_I64, buffers[3], 10) == 10, "should skip ten bytes");
+}
+
+static void can_ignore_struct_headers_as_read() {
+  u32 index;
+  i64 expected, result;
+
+  // field ids reaching and overflowing 32767, a truncated value, a stop with a delta and an unknown type
+  const char buffers[][8] = {
+    {0x05, 0xfd, 0xff, 0x01, 0x00, 0x25, 0x00, 0x00},
+    {0x05, 0xfe, 0xff, 0x01, 0x00, 0x25, 0x00, 0x00},
+    {0x15},
+    {0x10},
+    {0x1f, 0x00},
+    {0x00},
+  };
+  const u64 sizes[] = {8, 8, 1, 1, 2, 0};
+
+  for (index = 0; index < sizeof(sizes) / sizeof(u64); index++) {
+    // without callbacks every field is skipped, but the headers are decoded
+    expected = thrift_read_struct_content(NULL, NULL, 0, buffers[index], sizes[index]);
+    result = thrift_ignore_field(NULL, 0, THRIFT_TYPE_STRUCT, buffers[index], sizes[index]);
+
+    // the in-place headers must agree with the decoder
+    assert(result == expected, "should skip as many bytes as decoded");
+  }
+
+  // the last field id still fits, the next one does not
+  assert(thrift_ignore_field(NULL, 0, THRIFT_TYPE_STRUCT, buffers[0], 8) == 8, "should skip eight bytes");
+  assert(thrift_ignore_field(NULL, 0, THRIFT_TYPE_STRUCT, buffers[1], 8) == THRIFT_ERROR_BITS_OVERFLOW,
+         "should fail with THRIFT_ERROR_BITS_OVERFLOW");
+}
+
+static void can_ignore_binary_sizes_as_read() {
+  u32 index, size;
+  i64 expected, result;
+  char buffer[131];
+
+  // sizes of 127 and 128 bytes, the first fits a single byte
+  const char headers[][2] = {{0x7f}, {0x80, 0x01}};
+  const u64 lengths[] = {1, 2};
+
+  for (index = 0; index < 2; index++) {
+    buffer[0] = headers[index][0];
+    buffer[1] = headers[index][1];
+
+    // the reference reads the header and the content
+    expected = thrift_read_binary_header(&size, buffer, sizeof(buffer));
+    assert(expected == (i64)lengths[index], "should read the size");
+    assert(size == 127 + index, "should read 127 or 128");
+
+    // the content is complete
+    result = thrift_ignore_field(NULL, 0, THRIFT_TYPE_BINARY, buffer, lengths[index] + size);
+    assert(result == expected + size, "should skip the header and the content");
+
+    // and one byte short
+    result = thrift_ignore_field(NULL, 0, THRIFT_TYPE_BINARY, buffer, lengths[index] + size - 1);
+    expected = thrift_read_binary_content(NULL, size, buffer + lengths[index], size - 1);
+    assert(result == expected, "should fail as the decoder does");
+  }
+}
+
 void thrift_test_cases_base(struct runner_context *ctx) {
   // list cases
   test_case(ctx, "can read list header short version", can_read_list_header_short_version);
@@ -1655,6 +1755,10 @@ void thrift_test_cases_base(struct runner_context *ctx) {
   test_case(ctx, "can ignore i16 value", can_ignore_i16_value);
   test_case(ctx, "can ignore i32 value", can_ignore_i32_value);
   test_case(ctx, "can ignore i64 value", can_ignore_i64_value);
+  test_case(ctx, "can ignore i32 value as read", can_ignore_i32_value_as_read);
+  test_case(ctx, "can ignore i64 value as read", can_ignore_i64_value_as_read);
+  test_case(ctx, "can ignore struct headers as read", can_ignore_struct_headers_as_read);
+  test_case(ctx, "can ignore binary sizes as read", can_ignore_binary_sizes_as_read);
 }
 
 #endif
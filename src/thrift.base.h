@@ -22,6 +22,18 @@ enum thrift_error {
 
   // indicates that the implementation is invalid
   THRIFT_ERROR_INVALID_IMPLEMENTATION = THRIFT_ERROR_BASE - 0x06,
+
+  // indicates that the tape has no space left for more nodes
+  THRIFT_ERROR_TAPE_OVERFLOW = THRIFT_ERROR_BASE - 0x07,
+
+  // indicates that the requested path does not exist
+  THRIFT_ERROR_NOT_FOUND = THRIFT_ERROR_BASE - 0x08,
+
+  // indicates that the path is malformed or missing
+  THRIFT_ERROR_INVALID_PATH = THRIFT_ERROR_BASE - 0x09,
+
+  // indicates that the message does not fit the stream buffer or the 32-bit tape offsets
+  THRIFT_ERROR_MESSAGE_TOO_LARGE = THRIFT_ERROR_BASE - 0x0a,
 };
 
 enum thrift_type {
@@ -3,7 +3,7 @@
 #include "runner.h"
 #include "thrift.base.h"
 
-#define THRIFT_DOM_STATE_INITIAL_SIZE 16
+#define THRIFT_DOM_STATE_INITIAL_SIZE 64
 
 #define PRODUCED(res) ((u32)((res) & 0xFFFFFFFFu))
 #define CONSUMED(res) ((u32)(((res) >> 32) & 0xFFFFFFFFu))
@@ -92,8 +92,8 @@ static const thrift_iter_literal_fn LITERAL_FN[THRIFT_ITER_TOKEN_SIZE] = {
 
 // type mapping
 static const u8 TYPE_MAPPING[THRIFT_TYPE_SIZE] = {
-  [THRIFT_TYPE_STOP] = DOM_TYPE_NULL,       [THRIFT_TYPE_BOOL_TRUE] = DOM_TYPE_TEXT,
-  [THRIFT_TYPE_BOOL_FALSE] = DOM_TYPE_TEXT, [THRIFT_TYPE_I8] = DOM_TYPE_I8,
+  [THRIFT_TYPE_STOP] = DOM_TYPE_NULL,       [THRIFT_TYPE_BOOL_TRUE] = DOM_TYPE_BOOL,
+  [THRIFT_TYPE_BOOL_FALSE] = DOM_TYPE_BOOL, [THRIFT_TYPE_I8] = DOM_TYPE_I8,
   [THRIFT_TYPE_I16] = DOM_TYPE_I16,         [THRIFT_TYPE_I32] = DOM_TYPE_I32,
   [THRIFT_TYPE_I64] = DOM_TYPE_I64,         [THRIFT_TYPE_DOUBLE] = DOM_TYPE_NULL,
   [THRIFT_TYPE_BINARY] = DOM_TYPE_ASCII,    [THRIFT_TYPE_LIST] = DOM_TYPE_ARRAY,
@@ -136,7 +136,7 @@ static const u8 OUTPUT_IDX_DELTA[THRIFT_DOM_STATE_TYPE_SIZE] = {
 
 static const u8 STATE_IDX_DELTA[THRIFT_DOM_STATE_TYPE_SIZE] = {
   [THRIFT_DOM_STATE_TYPE_INIT] = 1,    [THRIFT_DOM_STATE_TYPE_STRUCT] = 1, [THRIFT_DOM_STATE_TYPE_ARRAY] = 3,
-  [THRIFT_DOM_STATE_TYPE_VALUE] = 0,   [THRIFT_DOM_STATE_TYPE_INDEX] = 0,  [THRIFT_DOM_STATE_TYPE_BINARY] = 1,
+  [THRIFT_DOM_STATE_TYPE_VALUE] = 0,   [THRIFT_DOM_STATE_TYPE_INDEX] = 1,  [THRIFT_DOM_STATE_TYPE_BINARY] = 1,
   [THRIFT_DOM_STATE_TYPE_POINTER] = 1, [THRIFT_DOM_STATE_TYPE_MAYBE] = 0,
 };
 
@@ -387,6 +387,9 @@ static i64 thrift_next_index(struct thrift_dom *iter, const u8 *, const struct t
   // default
   result = 0;
 
+  // the type is needed also when resuming
+  type = iter->state.entries[iter->state.idx - 2].value.value.type;
+
   // check for resuming a literal
   if (iter->state.entries[iter->state.idx - 1].value.index.offset == 0xffffffff) {
     goto complete;
@@ -395,8 +398,15 @@ static i64 thrift_next_index(struct thrift_dom *iter, const u8 *, const struct t
   // mark it as in-progress
   iter->state.entries[iter->state.idx - 1].value.index.offset = 0xffffffff;
 
-  // get the type and the token
-  type = iter->state.entries[iter->state.idx - 2].value.value.type;
+  // binary items are emitted chunk by chunk by the pointer state
+  if (type == THRIFT_TYPE_BINARY) {
+    iter->state.idx++;
+    iter->state.types[iter->state.idx] = THRIFT_DOM_STATE_TYPE_POINTER;
+
+    return 0;
+  }
+
+  // get the token
   token = TOKEN_MAPPING[type];
 
   // emit LITERAL token
@@ -494,7 +504,8 @@ static i64 thrift_next_pointer(struct thrift_dom *iter, const u8 *, const struct
   return 2;
 }
 
-static i64 thrift_next_maybe(struct thrift_dom *iter, const u8 *tokens, const struct thrift_iter_entry *, u64 size) {
+static i64
+thrift_next_maybe(struct thrift_dom *iter, const u8 *tokens, const struct thrift_iter_entry *entries, u64 size) {
 
   // check for size, we expect one entry
   if (size == 0) return THRIFT_ERROR_BUFFER_OVERFLOW;
@@ -502,12 +513,15 @@ static i64 thrift_next_maybe(struct thrift_dom *iter, const u8 *tokens, const st
   // complete the maybe state
   iter->state.idx--;
 
-  // if the token is again BINARY_CHUNK, we have more data to read
-  if (*tokens == THRIFT_ITER_TOKEN_BINARY_CHUNK) return 0;
+  // if the token is again BINARY_CHUNK of the same binary, we have more data to read
+  if (*tokens == THRIFT_ITER_TOKEN_BINARY_CHUNK && entries->value.chunk.offset > 0) return 0;
 
   // complete the pointer state
   iter->state.idx--;
 
+  // binary list items have no value to end
+  if (iter->state.types[iter->state.idx] != THRIFT_DOM_STATE_TYPE_BINARY) return 0;
+
   // emit VALUE_END token
   iter->tokens[iter->idx].op = DOM_OP_VALUE_END;
   iter->tokens[iter->idx].data = 0;
@@ -521,7 +535,7 @@ static i64 thrift_next_maybe(struct thrift_dom *iter, const u8 *tokens, const st
 
 static i64 thrift_literal_bool(struct thrift_dom *iter, const struct thrift_iter_entry *source) {
   // copy bool value
-  iter->tokens[iter->idx].data = source->value.literal.value.v_bool ? (u64) "true" : (u64) "false";
+  iter->tokens[iter->idx].data = source->value.literal.value.v_bool ? 1 : 0;
 
   // success
   return 0;
@@ -727,12 +741,12 @@ static void can_init_iterator_single_page() {
   // assert the initial state of the iterator
   assert(iter.idx == 0, "iterator idx should be 0");
   assert(iter.size > 0, "iterator size should be greater than 0");
-  assert(iter.size == 251, "iterator size should be 251 for 4KB buffer");
+  assert(iter.size == 236, "iterator size should be 236 for 4KB buffer");
 
   assert(iter.tokens != NULL, "tokens should not be NULL");
 
   assert(iter.state.idx == 0, "state idx should be 0");
-  assert(iter.state.size == 16, "state size should be 16");
+  assert(iter.state.size == 64, "state size should be 64");
 
   assert(iter.state.entries != NULL, "state entries should not be NULL");
   assert(iter.state.types != NULL, "state types should not be NULL");
@@ -770,12 +784,12 @@ static void can_init_iterator_double_page() {
   // assert the initial state of the iterator
   assert(iter.idx == 0, "iterator idx should be 0");
   assert(iter.size > 0, "iterator size should be greater than 0");
-  assert(iter.size == 507, "iterator size should be 507 for 8KB buffer");
+  assert(iter.size == 492, "iterator size should be 492 for 8KB buffer");
 
   assert(iter.tokens != NULL, "tokens should not be NULL");
 
   assert(iter.state.idx == 0, "state idx should be 0");
-  assert(iter.state.size == 16, "state size should be 16");
+  assert(iter.state.size == 64, "state size should be 64");
 
   assert(iter.state.entries != NULL, "state entries should not be NULL");
   assert(iter.state.types != NULL, "state types should not be NULL");
@@ -1706,12 +1720,12 @@ static void can_write_struct_with_bool_field_true() {
   assert(iter.tokens[3].data == 0, "token type should be NULL");
 
   assert(iter.tokens[4].op == DOM_OP_VALUE_START, "token op should be DOM_OP_VALUE_START");
-  assert(iter.tokens[4].type == DOM_TYPE_TEXT, "token type should be DOM_TYPE_TEXT");
+  assert(iter.tokens[4].type == DOM_TYPE_BOOL, "token type should be DOM_TYPE_BOOL");
   assert(iter.tokens[4].data == 0, "token data should be NULL");
 
   assert(iter.tokens[5].op == DOM_OP_LITERAL, "token op should be DOM_OP_LITERAL");
-  assert(iter.tokens[5].type == DOM_TYPE_TEXT, "token type should be DOM_TYPE_TEXT");
-  assert(iter.tokens[5].data == (u64) "true", "token data should be 'true'");
+  assert(iter.tokens[5].type == DOM_TYPE_BOOL, "token type should be DOM_TYPE_BOOL");
+  assert(iter.tokens[5].data == 1, "token data should be true");
 
   assert(iter.tokens[6].op == DOM_OP_VALUE_END, "token op should be DOM_OP_VALUE_END");
   assert(iter.tokens[6].data == 0, "token type should be NULL");
@@ -1784,12 +1798,12 @@ static void can_write_struct_with_bool_field_false() {
   assert(iter.tokens[3].data == 0, "token type should be NULL");
 
   assert(iter.tokens[4].op == DOM_OP_VALUE_START, "token op should be DOM_OP_VALUE_START");
-  assert(iter.tokens[4].type == DOM_TYPE_TEXT, "token type should be DOM_TYPE_TEXT");
+  assert(iter.tokens[4].type == DOM_TYPE_BOOL, "token type should be DOM_TYPE_BOOL");
   assert(iter.tokens[4].data == 0, "token data should be NULL");
 
   assert(iter.tokens[5].op == DOM_OP_LITERAL, "token op should be DOM_OP_LITERAL");
-  assert(iter.tokens[5].type == DOM_TYPE_TEXT, "token type should be DOM_TYPE_TEXT");
-  assert(iter.tokens[5].data == (u64) "false", "token data should be 'false'");
+  assert(iter.tokens[5].type == DOM_TYPE_BOOL, "token type should be DOM_TYPE_BOOL");
+  assert(iter.tokens[5].data == 0, "token data should be false");
 
   assert(iter.tokens[6].op == DOM_OP_VALUE_END, "token op should be DOM_OP_VALUE_END");
   assert(iter.tokens[6].data == 0, "token type should be NULL");
@@ -2481,6 +2495,93 @@ static void can_write_struct_with_three_list_items() {
   malloc_destroy(&pool);
 }
 
+static void can_write_struct_with_two_binary_list_items() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_dom iter;
+
+  u8 tokens[7];
+  struct thrift_iter_entry entries[7];
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+
+  assert(result == 0, "should allocate memory");
+  assert(lease.ptr != NULL, "lease ptr should be set");
+
+  // initialize the iterator with the buffer
+  thrift_dom_init(&iter, &lease);
+
+  // data
+  tokens[0] = THRIFT_ITER_TOKEN_STRUCT_FIELD;
+  entries[0].value.field.id = 3;
+  entries[0].value.field.type = THRIFT_TYPE_LIST;
+
+  tokens[1] = THRIFT_ITER_TOKEN_LIST_HEADER;
+  entries[1].value.list.type = THRIFT_TYPE_BINARY;
+  entries[1].value.list.size = 2;
+
+  tokens[2] = THRIFT_ITER_TOKEN_BINARY_CHUNK;
+  entries[2].value.chunk.size = 3;
+  entries[2].value.chunk.offset = 0;
+
+  tokens[3] = THRIFT_ITER_TOKEN_BINARY_CONTENT;
+  entries[3].value.content.ptr = "abc";
+
+  tokens[4] = THRIFT_ITER_TOKEN_BINARY_CHUNK;
+  entries[4].value.chunk.size = 0;
+  entries[4].value.chunk.offset = 0;
+
+  tokens[5] = THRIFT_ITER_TOKEN_BINARY_CONTENT;
+  entries[5].value.content.ptr = "";
+
+  tokens[6] = THRIFT_ITER_TOKEN_STRUCT_FIELD;
+  entries[6].value.field.id = 0;
+  entries[6].value.field.type = THRIFT_TYPE_STOP;
+
+  // iterate over the buffer
+  result = thrift_dom_next(&iter, tokens, entries, 7);
+  assert(PRODUCED(result) == 15, "should produce fifteen tokens");
+  assert(CONSUMED(result) == 7, "should consume seven entries");
+
+  assert(iter.idx == 15, "iterator idx should be 15");
+  assert(iter.state.idx == -1, "state idx should be -1");
+
+  assert(iter.tokens[6].op == DOM_OP_INDEX_START, "token op should be DOM_OP_INDEX_START");
+  assert(iter.tokens[6].data == (u64) "binary", "token data should be 'binary'");
+
+  assert(iter.tokens[7].op == DOM_OP_LITERAL, "token op should be DOM_OP_LITERAL");
+  assert(iter.tokens[7].type == DOM_TYPE_ASCII, "token type should be DOM_TYPE_ASCII");
+  assert(iter.tokens[7].data == PACK(3, (u64) "abc"), "token data should point to 'abc'");
+
+  assert(iter.tokens[8].op == DOM_OP_INDEX_END, "token op should be DOM_OP_INDEX_END");
+  assert(iter.tokens[8].data == 0, "token data should be NULL");
+
+  assert(iter.tokens[9].op == DOM_OP_INDEX_START, "token op should be DOM_OP_INDEX_START");
+  assert(iter.tokens[9].data == (u64) "binary", "token data should be 'binary'");
+
+  assert(iter.tokens[10].op == DOM_OP_LITERAL, "token op should be DOM_OP_LITERAL");
+  assert(iter.tokens[10].type == DOM_TYPE_ASCII, "token type should be DOM_TYPE_ASCII");
+  assert(COUNT(iter.tokens[10].data) == 0, "token data should be empty");
+
+  assert(iter.tokens[11].op == DOM_OP_INDEX_END, "token op should be DOM_OP_INDEX_END");
+  assert(iter.tokens[12].op == DOM_OP_ARRAY_END, "token op should be DOM_OP_ARRAY_END");
+  assert(iter.tokens[13].op == DOM_OP_VALUE_END, "token op should be DOM_OP_VALUE_END");
+  assert(iter.tokens[14].op == DOM_OP_STRUCT_END, "token op should be DOM_OP_STRUCT_END");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
 static void can_detect_outgoing_buffer_overflow() {
   i64 result;
 
@@ -2704,6 +2805,7 @@ void thrift_test_cases_dom(struct runner_context *ctx) {
   test_case(ctx, "can write struct with one list item", can_write_struct_with_one_list_item);
   test_case(ctx, "can write struct with one list nested item", can_write_struct_with_one_list_nested_item);
   test_case(ctx, "can write struct with three list items", can_write_struct_with_three_list_items);
+  test_case(ctx, "can write struct with two binary list items", can_write_struct_with_two_binary_list_items);
 
   test_case(ctx, "can detect outgoing buffer overflow", can_detect_outgoing_buffer_overflow);
   test_case(ctx, "can detect too deep state nesting", can_detect_too_deep_state_nesting);
@@ -199,6 +199,18 @@ static i64 thrift_delegate_binary(struct thrift_iter *iter, const char *buffer,
   result = thrift_read_binary_header(&size, buffer, buffer_size);
   if (result < 0) return result;
 
+  // an empty binary has nothing to wait for, so emit its only chunk directly
+  if (size == 0) {
+    iter->tokens[iter->idx] = THRIFT_ITER_TOKEN_BINARY_CHUNK;
+    iter->entries[iter->idx].value.chunk.size = 0;
+    iter->entries[iter->idx++].value.chunk.offset = 0;
+
+    iter->tokens[iter->idx] = THRIFT_ITER_TOKEN_BINARY_CONTENT;
+    iter->entries[iter->idx++].value.content.ptr = buffer + result;
+
+    return result;
+  }
+
   // increase the state index
   iter->state.idx++;
 
@@ -1302,6 +1314,54 @@ static void can_iterate_over_binary() {
   malloc_destroy(&pool);
 }
 
+static void can_iterate_over_binary_empty() {
+  i64 result;
+  u64 buffer_size;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_iter iter;
+
+  // data
+  const char buffer[] = {0x78, 0x00, 0x00};
+  buffer_size = sizeof(buffer);
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize the iterator with the buffer
+  thrift_iter_init(&iter, &lease);
+
+  // iterate over the buffer
+  result = thrift_iter_next(&iter, buffer, buffer_size);
+  assert(PRODUCED(result) == 4, "should produce four tokens");
+  assert(CONSUMED(result) == 3, "should consume three bytes");
+
+  assert(iter.idx == 4, "iterator idx should be 4");
+  assert(iter.state.idx == -1, "state idx should be -1");
+
+  assert(iter.tokens[1] == THRIFT_ITER_TOKEN_BINARY_CHUNK, "token should be BINARY_CHUNK");
+  assert(iter.entries[1].value.chunk.offset == 0, "chunk offset should be 0");
+  assert(iter.entries[1].value.chunk.size == 0, "chunk size should be 0");
+
+  assert(iter.tokens[2] == THRIFT_ITER_TOKEN_BINARY_CONTENT, "token should be BINARY_CONTENT");
+  assert(iter.entries[2].value.content.ptr == buffer + 2, "content ptr should point to buffer + 2");
+
+  assert(iter.tokens[3] == THRIFT_ITER_TOKEN_STRUCT_FIELD, "token should be STRUCT_FIELD");
+  assert(iter.entries[3].value.field.type == THRIFT_TYPE_STOP, "field type should be THRIFT_TYPE_STOP");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
 static void can_iterate_over_binary_fragmented() {
   i64 result;
   u64 buffer_size;
@@ -1849,6 +1909,7 @@ void thrift_test_cases_iter(struct runner_context *ctx) {
 
   test_case(ctx, "can iterate over binary", can_iterate_over_binary);
   test_case(ctx, "can iterate over binary fragmented", can_iterate_over_binary_fragmented);
+  test_case(ctx, "can iterate over binary empty", can_iterate_over_binary_empty);
 
   test_case(ctx, "can detect list of stops", can_detect_list_of_stops);
   test_case(ctx, "can detect struct of stops", can_detect_struct_of_stops);
@@ -1,12 +1,22 @@
+#include "argv.h"
+#include "dom.h"
 #include "malloc.h"
 #include "stderr.h"
 #include "stdin.h"
 #include "stdout.h"
+#include "sys.h"
 #include "thrift.base.h"
+#include "thrift.dom.h"
+#include "thrift.iter.h"
+#include "thrift.path.h"
+#include "thrift.stream.h"
 #include "typing.h"
 
 #if defined(I13C_THRIFT) || defined(I13C_TESTS)
 
+#define PRODUCED(res) ((u32)((res) & 0xFFFFFFFFu))
+#define CONSUMED(res) ((u32)(((res) >> 32) & 0xFFFFFFFFu))
+
 struct thrift_dump_context {
   u32 indent; // current indentation level
 };
@@ -294,68 +304,389 @@ static i64 thrift_dump_struct(struct thrift_dump_context *ctx, const char *buffe
   return read;
 }
 
-i32 thrift_main() {
-  i64 result, read;
-  const u64 SIZE = 4 * 4096;
+#define THRIFT_STREAM_BUFFER_SIZE (32 * 4096) // size of the stream buffer, it limits the message size
+
+/// @brief Thrift message callback function type.
+/// @param ctx Pointer to the caller context.
+/// @param message Pointer to the complete message.
+/// @return Zero on success, or a negative error code to stop the iteration.
+typedef i64 (*thrift_message_fn)(void *ctx, const struct thrift_stream_message *message);
 
-  char *buffer;
-  u64 buffer_size;
+static i64 thrift_stdin_read(void *, char *buffer, u64 buffer_size) {
+  return stdin_read(buffer, buffer_size);
+}
+
+static i64 thrift_each(struct thrift_stream *stream, enum thrift_stream_mode mode, thrift_message_fn fn, void *ctx) {
+  i64 result;
 
   struct malloc_pool pool;
   struct malloc_lease lease;
-  struct thrift_dump_context ctx;
+  struct thrift_stream_message message;
 
   // new memory pool
   malloc_init(&pool);
 
   // prepare the lease
-  lease.size = SIZE;
+  lease.size = THRIFT_STREAM_BUFFER_SIZE;
 
-  // acquire memory for the input
+  // acquire memory for the stream buffer
   result = malloc_acquire(&pool, &lease);
   if (result < 0) goto clear_memory_init;
 
-  read = 0;
-  buffer = (char *)lease.ptr;
-  buffer_size = lease.size;
+  // initialize the stream over standard input
+  thrift_stream_init(stream, mode, &lease, thrift_stdin_read, NULL);
 
-  // initialize the context
-  ctx.indent = 0;
+  while (TRUE) {
+    // wait for the next complete message
+    result = thrift_stream_next(stream, &message);
+    if (result <= 0) break;
+
+    // process the message, if anyone is interested
+    if (fn) {
+      result = fn(ctx, &message);
+      if (result < 0) break;
+    }
+  }
 
-  do {
-    // read data from standard input
-    result = stdin_read(buffer, buffer_size);
-    if (result < 0) goto clean_memory_alloc;
+  malloc_release(&pool, &lease);
 
-    // advance the read pointer
-    read += result;
-    buffer += result;
-    buffer_size -= result;
-  } while (result > 0 && buffer_size > 0);
+clear_memory_init:
+  malloc_destroy(&pool);
+  return result;
+}
 
-  if (buffer_size == 0) {
-    result = THRIFT_ERROR_BUFFER_OVERFLOW;
-    goto clean_memory_alloc;
+static enum thrift_stream_mode thrift_mode(u32 argc, const char **argv) {
+  return argv_flag(argc, argv, "--framed") ? THRIFT_STREAM_FRAMED : THRIFT_STREAM_CONCATENATED;
+}
+
+static void thrift_separate(const struct thrift_stream_message *message) {
+  // the first message is never separated, so single messages print as before
+  if (message->index > 0) {
+    writef("message=%d, offset=%d, size=%d\n", message->index, message->offset, message->size);
   }
+}
 
-  // rewind the buffer
-  buffer -= read;
-  buffer_size = read;
-  read = 0;
+static i64 thrift_show_message(void *, const struct thrift_stream_message *message) {
+  i64 result;
+  struct thrift_dump_context ctx;
+
+  // initialize the context
+  ctx.indent = 0;
+
+  // separate it from the previous message
+  thrift_separate(message);
 
   // dump the thrift struct
-  result = thrift_dump_struct(&ctx, buffer, buffer_size);
-  if (result < 0) goto clean_memory_alloc;
+  result = thrift_dump_struct(&ctx, message->buffer, message->size);
+  if (result < 0) return result;
 
   // success
   writef("\n");
+  return 0;
+}
+
+struct thrift_render_context {
+  struct malloc_lease iter_buffer; // buffer for the thrift iterator
+  struct malloc_lease dom_buffer;  // buffer for the dom tokens
+  struct malloc_lease output;      // buffer for the rendered output
+  struct dom_state dom;            // renderer state shared by all messages
+};
+
+static i64 thrift_render_tokens(struct dom_state *dom, struct dom_token *tokens, u32 count) {
+  i64 result;
+
+  while (count > 0) {
+    // try to write them
+    result = dom_write(dom, tokens, count);
+    if (result < 0 && result != FORMAT_ERROR_BUFFER_TOO_SMALL) return result;
+
+    // determine new counters
+    tokens += CONSUMED(result);
+    count -= CONSUMED(result);
+
+    // flush partially written data
+    result = stdout_flush(&dom->format);
+    if (result < 0) return result;
+
+    // the pending value may span more than one buffer
+    while ((result = dom_flush(dom)) == FORMAT_ERROR_BUFFER_TOO_SMALL) {
+      result = stdout_flush(&dom->format);
+      if (result < 0) return result;
+    }
+
+    if (result < 0) return result;
+  }
+
+  // success
+  return 0;
+}
+
+static i64 thrift_render_message(void *ctx, const struct thrift_stream_message *message) {
+  u32 offset, index;
+  i64 result;
+  u64 consumed;
+
+  struct thrift_iter iter;
+  struct thrift_dom tokens;
+  struct thrift_render_context *render;
+
+  // default
+  consumed = 0;
+  render = (struct thrift_render_context *)ctx;
+
+  // each message starts with fresh iterators
+  thrift_iter_init(&iter, &render->iter_buffer);
+  thrift_dom_init(&tokens, &render->dom_buffer);
+
+  while (!thrift_iter_done(&iter)) {
+    // tokenize the next part of the message, appending to the leftovers
+    result = thrift_iter_next(&iter, message->buffer + consumed, message->size - consumed);
+    if (result < 0) return result;
+
+    // advance the message
+    consumed += CONSUMED(result);
+    offset = 0;
+
+    while (offset < (u32)iter.idx) {
+      // convert as many tokens as possible into dom tokens
+      tokens.idx = 0;
+      result = thrift_dom_next(&tokens, iter.tokens + offset, iter.entries + offset, iter.idx - offset);
+
+      // the remaining tokens are incomplete and wait for the next part
+      if (result == THRIFT_ERROR_BUFFER_OVERFLOW) break;
+      if (result < 0) return result;
+
+      // advance the iterator tokens
+      offset += CONSUMED(result);
+
+      // render the produced dom tokens
+      result = thrift_render_tokens(&render->dom, tokens.tokens, PRODUCED(result));
+      if (result < 0) return result;
+    }
+
+    // move the leftovers to the beginning
+    for (index = offset; index < (u32)iter.idx; index++) {
+      iter.tokens[index - offset] = iter.tokens[index];
+      iter.entries[index - offset] = iter.entries[index];
+    }
+
+    iter.idx -= offset;
+  }
+
+  // success
+  return 0;
+}
+
+static i32 thrift_render(u32 argc, const char **argv, enum dom_style style) {
+  i64 result, flushed;
+
+  struct malloc_pool pool;
+  struct thrift_stream stream;
+  struct thrift_render_context ctx;
+
+  // new memory pool
+  malloc_init(&pool);
+
+  // prepare the leases
+  ctx.iter_buffer.size = 4096;
+  ctx.dom_buffer.size = 4096;
+  ctx.output.size = 4096;
+
+  // acquire memory for the iterators and the output
+  result = malloc_acquire(&pool, &ctx.iter_buffer);
+  if (result < 0) goto clear_memory_init;
+
+  result = malloc_acquire(&pool, &ctx.dom_buffer);
+  if (result < 0) goto clear_iter_buffer;
+
+  result = malloc_acquire(&pool, &ctx.output);
+  if (result < 0) goto clear_dom_buffer;
+
+  // initialize the renderer
+  dom_init_style(&ctx.dom, &ctx.output, style);
+
+  // a single JSON document wraps all messages
+  if (style == DOM_STYLE_JSON) {
+    writef("[");
+  }
+
+  // render each message of the input
+  result = thrift_each(&stream, thrift_mode(argc, argv), thrift_render_message, &ctx);
+
+  // flush any remaining data, also after a failure, so the array is closed behind it
+  flushed = stdout_flush(&ctx.dom.format);
+  if (result >= 0) result = flushed;
+
+  if (style == DOM_STYLE_JSON) {
+    writef("]\n");
+  }
+
+  if (result < 0) goto clear_output;
+
+  // success
   result = 0;
 
-clean_memory_alloc:
-  malloc_release(&pool, &lease);
+clear_output:
+  malloc_release(&pool, &ctx.output);
+
+clear_dom_buffer:
+  malloc_release(&pool, &ctx.dom_buffer);
+
+clear_iter_buffer:
+  malloc_release(&pool, &ctx.iter_buffer);
 
 clear_memory_init:
   malloc_destroy(&pool);
+  return result;
+}
+
+static i32 thrift_show(u32 argc, const char **argv) {
+  struct thrift_stream stream;
+
+  // JSON flavours are rendered through the dom
+  if (argv_flag(argc, argv, "--json")) return thrift_render(argc, argv, DOM_STYLE_JSON);
+  if (argv_flag(argc, argv, "--ndjson")) return thrift_render(argc, argv, DOM_STYLE_NDJSON);
+
+  // dump each message of the input
+  return thrift_each(&stream, thrift_mode(argc, argv), thrift_show_message, NULL);
+}
+
+static i64 thrift_get_value(
+  void *ctx, const u32 *trail, u32 trail_size, enum thrift_type type, const char *buffer, u64 buffer_size) {
+  u32 index;
+  i64 result;
+
+  // check if the dump function is available
+  if (type >= THRIFT_TYPE_SIZE || THRIFT_DUMP_STRUCT_FN[type] == NULL) return THRIFT_ERROR_INVALID_VALUE;
+
+  // print the concrete path of the value
+  writef("path=");
+
+  for (index = 0; index < trail_size; index++) {
+    writef(index == 0 ? "%d" : ".%d", (i64)trail[index]);
+  }
+
+  writef(", type=%s", thrift_type_to_string(type));
+
+  // nested structs start on their own line
+  if (type == THRIFT_TYPE_STRUCT) {
+    writef("\n");
+  }
+
+  // print the value the same way as the dump does
+  result = THRIFT_DUMP_STRUCT_FN[type]((struct thrift_dump_context *)ctx, buffer, buffer_size);
+  if (result < 0) return result;
+
+  // success
+  writef("\n");
+  return 0;
+}
+
+static i64 thrift_get_message(void *ctx, const struct thrift_stream_message *message) {
+  i64 result;
+  struct thrift_dump_context dump;
+
+  // initialize the context
+  dump.indent = 0;
+
+  // separate it from the previous message
+  thrift_separate(message);
+
+  // walk the struct and print only the matched values
+  result = thrift_path_walk((const struct thrift_path *)ctx, thrift_get_value, &dump, message->buffer, message->size);
+  if (result < 0) return result;
+
+  // success
+  return 0;
+}
+
+static i32 thrift_get(u32 argc, const char **argv) {
+  i64 result;
+
+  struct thrift_path path;
+  struct thrift_stream stream;
+
+  // check for required arguments
+  if (argc < 1) return THRIFT_ERROR_INVALID_PATH;
+
+  // parse the path before touching the input
+  result = thrift_path_parse(&path, argv[0]);
+  if (result < 0) return result;
+
+  // query each message of the input
+  return thrift_each(&stream, thrift_mode(argc - 1, argv + 1), thrift_get_message, &path);
+}
+
+static i32 thrift_count(u32 argc, const char **argv) {
+  i64 result;
+  u64 started, elapsed;
+
+  struct thrift_stream stream;
+
+  // start the clock
+  started = sys_clock_micros();
+
+  // only delimit and validate each message
+  result = thrift_each(&stream, thrift_mode(argc, argv), NULL, NULL);
+  if (result < 0) return result;
+
+  // stop the clock, avoiding division by zero
+  elapsed = sys_clock_micros() - started;
+  elapsed = elapsed > 0 ? elapsed : 1;
+
+  // print the totals and the throughput
+  writef("messages=%d, bytes=%d, elapsed=%dus, messages/s=%d, bytes/s=%d\n", stream.messages, stream.consumed,
+         elapsed, stream.messages * 1000000 / elapsed, stream.consumed * 1000000 / elapsed);
+
+  // success
+  return 0;
+}
+
+#define CMD_SHOW_ID 0
+#define CMD_SHOW "show"
+
+#define CMD_GET_ID CMD_SHOW_ID + 1
+#define CMD_GET "get"
+
+#define CMD_COUNT_ID CMD_GET_ID + 1
+#define CMD_COUNT "count"
+
+#define CMD_LAST_ID CMD_COUNT_ID + 1
+
+i32 thrift_main(u32 argc, const char **argv) {
+  i64 result;
+  u64 selected;
+
+  // prepare commands and their names
+  const char *names[CMD_LAST_ID + 1];
+  argv_match_fn commands[CMD_LAST_ID];
+
+  // first, names
+  names[CMD_SHOW_ID] = CMD_SHOW;
+  names[CMD_GET_ID] = CMD_GET;
+  names[CMD_COUNT_ID] = CMD_COUNT;
+  names[CMD_LAST_ID] = NULL;
+
+  // then, commands
+  commands[CMD_SHOW_ID] = thrift_show;
+  commands[CMD_GET_ID] = thrift_get;
+  commands[CMD_COUNT_ID] = thrift_count;
+
+  // without any command the input is dumped
+  if (argc < 2) {
+    result = thrift_show(0, argv);
+    goto cleanup;
+  }
+
+  // match the command
+  result = argv_match(argc, argv, names, &selected);
+  if (result < 0) goto cleanup;
+
+  // execute the command
+  result = commands[selected](argc - 2, argv + 2);
+  if (result < 0) goto cleanup;
+
+cleanup:
   if (result == 0) return 0;
 
   errorf("Something wrong happened; error=%r\n", result);
@@ -5,7 +5,10 @@
     extern thrift_main
 
 thrift_start:
+    mov rdi, [rsp]
+    lea rsi, [rsp+8]
     call thrift_main
+
     mov edi, eax
     mov rax, 60
     syscall
@@ -0,0 +1,395 @@
+#include "thrift.path.h"
+#include "runner.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+struct thrift_path_walker {
+  const struct thrift_path *path; // path being matched
+  thrift_path_fn fn;              // callback for matched values
+  void *ctx;                      // caller context for the callback
+  u32 trail[THRIFT_PATH_MAX];     // concrete keys of the current position
+};
+
+i64 thrift_path_parse(struct thrift_path *path, const char *text) {
+  u64 value;
+  bool digits;
+
+  // default
+  path->size = 0;
+
+  // empty path is not allowed
+  if (text == NULL || *text == EOS) return THRIFT_ERROR_INVALID_PATH;
+
+  while (TRUE) {
+    // check if there is a space for the next key
+    if (path->size >= THRIFT_PATH_MAX) return THRIFT_ERROR_INVALID_PATH;
+
+    // wildcard key
+    if (*text == '*') {
+      path->keys[path->size++] = THRIFT_PATH_WILDCARD;
+      text++;
+    } else {
+      value = 0;
+      digits = FALSE;
+
+      // accumulate the decimal key
+      while (*text >= '0' && *text <= '9') {
+        value = value * 10 + (u64)(*text - '0');
+        digits = TRUE;
+        text++;
+
+        // the key has to fit below the wildcard
+        if (value >= THRIFT_PATH_WILDCARD) return THRIFT_ERROR_INVALID_PATH;
+      }
+
+      // at least one digit is required
+      if (digits == FALSE) return THRIFT_ERROR_INVALID_PATH;
+
+      path->keys[path->size++] = (u32)value;
+    }
+
+    // check for the end of the path
+    if (*text == EOS) break;
+
+    // keys are separated by dots
+    if (*text != '.') return THRIFT_ERROR_INVALID_PATH;
+    text++;
+  }
+
+  // success
+  return 0;
+}
+
+static i64 thrift_path_skip(enum thrift_type type, bool element, const char *buffer, u64 buffer_size) {
+  // bools in lists take a byte, in structs they are carried by the header
+  if (element && (type == THRIFT_TYPE_BOOL_TRUE || type == THRIFT_TYPE_BOOL_FALSE)) {
+    return thrift_read_bool(NULL, buffer, buffer_size);
+  }
+
+  // everything else is skipped without tokenising
+  return thrift_ignore_field(NULL, 0, type, buffer, buffer_size);
+}
+
+static bool thrift_path_match(const struct thrift_path_walker *walker, u32 depth, u32 key) {
+  return walker->path->keys[depth] == THRIFT_PATH_WILDCARD || walker->path->keys[depth] == key;
+}
+
+static i64 thrift_path_value(
+  struct thrift_path_walker *walker, u32 depth, enum thrift_type type, bool element, const char *buffer,
+  u64 buffer_size);
+
+static i64 thrift_path_struct(struct thrift_path_walker *walker, u32 depth, const char *buffer, u64 buffer_size) {
+  i64 result, read;
+  struct thrift_struct_header header;
+
+  // default
+  read = 0;
+  header.field = 0;
+
+  while (TRUE) {
+    // read the next struct header
+    result = thrift_read_struct_header(&header, buffer, buffer_size);
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+
+    // check if we reached the end of the struct
+    if (header.type == THRIFT_TYPE_STOP) {
+      break;
+    }
+
+    // descend into the matching field, skip the others
+    if (thrift_path_match(walker, depth, header.field)) {
+      walker->trail[depth] = header.field;
+      result = thrift_path_value(walker, depth + 1, header.type, FALSE, buffer, buffer_size);
+    } else {
+      result = thrift_path_skip(header.type, FALSE, buffer, buffer_size);
+    }
+
+    // perhaps the value is invalid
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+  }
+
+  // success
+  return read;
+}
+
+static i64 thrift_path_list(struct thrift_path_walker *walker, u32 depth, const char *buffer, u64 buffer_size) {
+  u32 index;
+  i64 result, read;
+  struct thrift_list_header header;
+
+  // read the list header containing size and type
+  result = thrift_read_list_header(&header, buffer, buffer_size);
+  if (result < 0) return result;
+
+  // move the buffer pointer and size
+  read = result;
+  buffer += result;
+  buffer_size -= result;
+
+  for (index = 0; index < header.size; index++) {
+    // descend into the matching element, skip the others
+    if (thrift_path_match(walker, depth, index)) {
+      walker->trail[depth] = index;
+      result = thrift_path_value(walker, depth + 1, header.type, TRUE, buffer, buffer_size);
+    } else {
+      result = thrift_path_skip(header.type, TRUE, buffer, buffer_size);
+    }
+
+    // perhaps the value is invalid
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+  }
+
+  // success
+  return read;
+}
+
+static i64 thrift_path_value(
+  struct thrift_path_walker *walker, u32 depth, enum thrift_type type, bool element, const char *buffer,
+  u64 buffer_size) {
+
+  i64 result;
+  bool value;
+
+  // the value is not matched yet, so try to descend
+  if (depth < walker->path->size) {
+    switch (type) {
+      case THRIFT_TYPE_STRUCT:
+        return thrift_path_struct(walker, depth, buffer, buffer_size);
+      case THRIFT_TYPE_LIST:
+        return thrift_path_list(walker, depth, buffer, buffer_size);
+      default:
+        return thrift_path_skip(type, element, buffer, buffer_size);
+    }
+  }
+
+  // bools in lists are reported the same way as in structs
+  if (element && (type == THRIFT_TYPE_BOOL_TRUE || type == THRIFT_TYPE_BOOL_FALSE)) {
+    result = thrift_read_bool(&value, buffer, buffer_size);
+    if (result < 0) return result;
+
+    // normalize the type
+    type = value ? THRIFT_TYPE_BOOL_TRUE : THRIFT_TYPE_BOOL_FALSE;
+  }
+
+  // report the matched value
+  result = walker->fn(walker->ctx, walker->trail, depth, type, buffer, buffer_size);
+  if (result < 0) return result;
+
+  // move past the matched value
+  return thrift_path_skip(type, element, buffer, buffer_size);
+}
+
+i64 thrift_path_walk(
+  const struct thrift_path *path, thrift_path_fn fn, void *ctx, const char *buffer, u64 buffer_size) {
+  struct thrift_path_walker walker;
+
+  // initialize the walker
+  walker.path = path;
+  walker.fn = fn;
+  walker.ctx = ctx;
+
+  // the root is always a struct
+  return thrift_path_value(&walker, 0, THRIFT_TYPE_STRUCT, FALSE, buffer, buffer_size);
+}
+
+#if defined(I13C_TESTS)
+
+// represents a struct with i32, list of two structs, bool and list of three bools
+static const char PATH_MESSAGE[] = {0x15, 0x0a, 0x19, 0x2c, 0x18, 0x02, 'a',  'b',  0x36, 0x0e, 0x00,
+                                    0x46, 0x01, 0x00, 0x11, 0x19, 0x31, 0x01, 0x02, 0x01, 0x00};
+
+struct thrift_path_collector {
+  u32 count;             // number of matched values
+  u32 depth;             // depth of the last match
+  u32 trail[4];          // trail of the last match
+  enum thrift_type type; // type of the last match
+  u64 offset;            // offset of the last match
+};
+
+static i64 thrift_path_collect(
+  void *ctx, const u32 *trail, u32 trail_size, enum thrift_type type, const char *buffer, u64) {
+  u32 index;
+  struct thrift_path_collector *collector;
+
+  // remember the last match
+  collector = (struct thrift_path_collector *)ctx;
+  collector->count++;
+  collector->depth = trail_size;
+  collector->type = type;
+  collector->offset = (u64)(buffer - PATH_MESSAGE);
+
+  for (index = 0; index < trail_size && index < 4; index++) {
+    collector->trail[index] = trail[index];
+  }
+
+  // success
+  return 0;
+}
+
+static void can_parse_path_with_wildcard() {
+  i64 result;
+  struct thrift_path path;
+
+  // parse the path
+  result = thrift_path_parse(&path, "4.*.1.3.7");
+
+  // assert the result
+  assert(result == 0, "should parse the path");
+  assert(path.size == 5, "should have five keys");
+  assert(path.keys[0] == 4, "first key should be 4");
+  assert(path.keys[1] == THRIFT_PATH_WILDCARD, "second key should be wildcard");
+  assert(path.keys[4] == 7, "last key should be 7");
+}
+
+static void can_detect_malformed_path() {
+  i64 result;
+  struct thrift_path path;
+
+  // assert the empty path
+  result = thrift_path_parse(&path, "");
+  assert(result == THRIFT_ERROR_INVALID_PATH, "should reject empty path");
+
+  // assert the trailing dot
+  result = thrift_path_parse(&path, "4.");
+  assert(result == THRIFT_ERROR_INVALID_PATH, "should reject trailing dot");
+
+  // assert the unexpected character
+  result = thrift_path_parse(&path, "4.a");
+  assert(result == THRIFT_ERROR_INVALID_PATH, "should reject unexpected character");
+
+  // assert the too long key
+  result = thrift_path_parse(&path, "4294967296");
+  assert(result == THRIFT_ERROR_INVALID_PATH, "should reject too large key");
+
+  // assert the too many keys
+  result = thrift_path_parse(&path, "1.1.1.1.1.1.1.1.1.1.1.1.1.1.1.1.1");
+  assert(result == THRIFT_ERROR_INVALID_PATH, "should reject too many keys");
+}
+
+static void can_walk_to_field_in_list_element() {
+  i64 result;
+  struct thrift_path path;
+  struct thrift_path_collector collector;
+
+  // defaults
+  collector.count = 0;
+
+  // parse and walk the path
+  result = thrift_path_parse(&path, "2.1.4");
+  assert(result == 0, "should parse the path");
+
+  result = thrift_path_walk(&path, thrift_path_collect, &collector, PATH_MESSAGE, sizeof(PATH_MESSAGE));
+
+  // assert the result
+  assert(result == sizeof(PATH_MESSAGE), "should walk the entire message");
+  assert(collector.count == 1, "should match one value");
+  assert(collector.depth == 3, "should match at depth 3");
+  assert(collector.trail[1] == 1, "should match the second element");
+  assert(collector.type == THRIFT_TYPE_I64, "should match i64");
+  assert(collector.offset == 12, "should point at offset 12");
+}
+
+static void can_walk_with_wildcard() {
+  i64 result;
+  struct thrift_path path;
+  struct thrift_path_collector collector;
+
+  // defaults
+  collector.count = 0;
+
+  // parse and walk the path
+  result = thrift_path_parse(&path, "2.*.4");
+  assert(result == 0, "should parse the path");
+
+  result = thrift_path_walk(&path, thrift_path_collect, &collector, PATH_MESSAGE, sizeof(PATH_MESSAGE));
+
+  // assert the result
+  assert(result == sizeof(PATH_MESSAGE), "should walk the entire message");
+  assert(collector.count == 2, "should match two values");
+  assert(collector.trail[1] == 1, "last match should be the second element");
+}
+
+static void can_walk_to_bool_in_list() {
+  i64 result;
+  struct thrift_path path;
+  struct thrift_path_collector collector;
+
+  // defaults
+  collector.count = 0;
+
+  // parse and walk the path
+  result = thrift_path_parse(&path, "4.1");
+  assert(result == 0, "should parse the path");
+
+  result = thrift_path_walk(&path, thrift_path_collect, &collector, PATH_MESSAGE, sizeof(PATH_MESSAGE));
+
+  // assert the result
+  assert(result == sizeof(PATH_MESSAGE), "should walk the entire message");
+  assert(collector.count == 1, "should match one value");
+  assert(collector.type == THRIFT_TYPE_BOOL_FALSE, "should normalize false bool");
+}
+
+static void can_walk_without_match() {
+  i64 result;
+  struct thrift_path path;
+  struct thrift_path_collector collector;
+
+  // defaults
+  collector.count = 0;
+
+  // parse and walk the path
+  result = thrift_path_parse(&path, "1.2.3");
+  assert(result == 0, "should parse the path");
+
+  result = thrift_path_walk(&path, thrift_path_collect, &collector, PATH_MESSAGE, sizeof(PATH_MESSAGE));
+
+  // assert the result
+  assert(result == sizeof(PATH_MESSAGE), "should walk the entire message");
+  assert(collector.count == 0, "should not match anything");
+}
+
+static void can_detect_walk_buffer_overflow() {
+  i64 result;
+  struct thrift_path path;
+  struct thrift_path_collector collector;
+
+  // defaults
+  collector.count = 0;
+
+  // parse and walk the path
+  result = thrift_path_parse(&path, "3");
+  assert(result == 0, "should parse the path");
+
+  result = thrift_path_walk(&path, thrift_path_collect, &collector, PATH_MESSAGE, sizeof(PATH_MESSAGE) - 3);
+
+  // assert the result
+  assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
+  assert(collector.count == 1, "should match before the overflow");
+}
+
+void thrift_test_cases_path(struct runner_context *ctx) {
+  test_case(ctx, "can parse path with wildcard", can_parse_path_with_wildcard);
+  test_case(ctx, "can detect malformed path", can_detect_malformed_path);
+  test_case(ctx, "can walk to field in list element", can_walk_to_field_in_list_element);
+  test_case(ctx, "can walk with wildcard", can_walk_with_wildcard);
+  test_case(ctx, "can walk to bool in list", can_walk_to_bool_in_list);
+  test_case(ctx, "can walk without match", can_walk_without_match);
+  test_case(ctx, "can detect walk buffer overflow", can_detect_walk_buffer_overflow);
+}
+
+#endif
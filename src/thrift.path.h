@@ -0,0 +1,48 @@
+#pragma once
+
+#include "runner.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+#define THRIFT_PATH_MAX 16               // maximum number of keys in the path
+#define THRIFT_PATH_WILDCARD 0xffffffffu // matches any field or any list element
+
+struct thrift_path {
+  u32 size;                  // number of keys in the path
+  u32 keys[THRIFT_PATH_MAX]; // field ids, list indices or wildcards
+};
+
+/// @brief Matched value callback function type.
+/// @param ctx Pointer to the caller context.
+/// @param trail Pointer to the array of concrete keys leading to the value.
+/// @param trail_size Number of keys in the trail.
+/// @param type Type of the value, bools are always reported as BOOL_TRUE or BOOL_FALSE.
+/// @param buffer Pointer to the buffer starting at the value, unused for bools.
+/// @param buffer_size Size of the buffer.
+/// @return Zero on success, or a negative error code to stop the walk.
+typedef i64 (*thrift_path_fn)(
+  void *ctx, const u32 *trail, u32 trail_size, enum thrift_type type, const char *buffer, u64 buffer_size);
+
+/// @brief Parses a textual path like 4.*.1 into keys.
+/// @param path Pointer to the target path.
+/// @param text Null-terminated text of the path.
+/// @return 0 on success, or a negative error code.
+extern i64 thrift_path_parse(struct thrift_path *path, const char *text);
+
+/// @brief Walks a struct and reports each value matching the path, skipping all other subtrees.
+/// @param path Pointer to the parsed path.
+/// @param fn Callback invoked for each matched value.
+/// @param ctx Pointer to the caller context passed to the callback.
+/// @param buffer Pointer to the buffer containing the struct.
+/// @param buffer_size Size of the buffer.
+/// @return The number of bytes read from the buffer, or a negative error code.
+extern i64
+thrift_path_walk(const struct thrift_path *path, thrift_path_fn fn, void *ctx, const char *buffer, u64 buffer_size);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers thrift path test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void thrift_test_cases_path(struct runner_context *ctx);
+
+#endif
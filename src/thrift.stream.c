@@ -0,0 +1,396 @@
+#include "thrift.stream.h"
+#include "malloc.h"
+#include "runner.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+void thrift_stream_init(struct thrift_stream *stream,
+                        enum thrift_stream_mode mode,
+                        struct malloc_lease *buffer,
+                        thrift_stream_read_fn read,
+                        void *read_ctx) {
+  // default values
+  stream->mode = mode;
+  stream->eof = FALSE;
+  stream->offset = 0;
+  stream->size = 0;
+  stream->position = 0;
+  stream->messages = 0;
+  stream->consumed = 0;
+
+  // remember the buffer and its source
+  stream->buffer = buffer;
+  stream->read = read;
+  stream->read_ctx = read_ctx;
+}
+
+static i64 thrift_stream_fill(struct thrift_stream *stream) {
+  u64 index, remaining;
+  char *buffer;
+  i64 result;
+
+  // default
+  buffer = (char *)stream->buffer->ptr;
+  remaining = stream->size - stream->offset;
+
+  // move the unconsumed tail to the beginning of the buffer
+  if (stream->offset > 0) {
+    for (index = 0; index < remaining; index++) {
+      buffer[index] = buffer[stream->offset + index];
+    }
+
+    stream->position += stream->offset;
+    stream->offset = 0;
+    stream->size = remaining;
+  }
+
+  // read as much as the buffer can hold
+  result = stream->read(stream->read_ctx, buffer + stream->size, stream->buffer->size - stream->size);
+  if (result < 0) return result;
+
+  // zero bytes means the input is exhausted
+  stream->eof = result == 0;
+  stream->size += result;
+
+  // success
+  return result;
+}
+
+static i64 thrift_stream_frame(struct thrift_stream *stream, const char *buffer, u64 available, u64 *frame) {
+  u64 size;
+  i64 result;
+
+  // the length prefix must be complete
+  if (available < THRIFT_STREAM_FRAME_SIZE) return THRIFT_ERROR_BUFFER_OVERFLOW;
+
+  // decode the big-endian length
+  size = ((u64)(u8)buffer[0] << 24) | ((u64)(u8)buffer[1] << 16) | ((u64)(u8)buffer[2] << 8) | (u64)(u8)buffer[3];
+
+  // a message which can never fit the buffer is not worth waiting for
+  if (size > stream->buffer->size - THRIFT_STREAM_FRAME_SIZE) return THRIFT_ERROR_MESSAGE_TOO_LARGE;
+
+  // the entire message must be available
+  if (available - THRIFT_STREAM_FRAME_SIZE < size) return THRIFT_ERROR_BUFFER_OVERFLOW;
+
+  // the struct must span exactly the entire frame
+  result = thrift_ignore_field(NULL, 0, THRIFT_TYPE_STRUCT, buffer + THRIFT_STREAM_FRAME_SIZE, size);
+  if (result == THRIFT_ERROR_BUFFER_OVERFLOW) return THRIFT_ERROR_INVALID_VALUE;
+  if (result < 0) return result;
+  if ((u64)result != size) return THRIFT_ERROR_INVALID_VALUE;
+
+  // success
+  *frame = THRIFT_STREAM_FRAME_SIZE;
+  return result;
+}
+
+i64 thrift_stream_next(struct thrift_stream *stream, struct thrift_stream_message *message) {
+  u64 available, frame;
+  const char *buffer;
+  i64 result;
+
+  while (TRUE) {
+    // default
+    frame = 0;
+    buffer = (const char *)stream->buffer->ptr + stream->offset;
+    available = stream->size - stream->offset;
+
+    // try to delimit the next message in the already buffered data
+    if (stream->mode == THRIFT_STREAM_FRAMED) {
+      result = thrift_stream_frame(stream, buffer, available, &frame);
+    } else {
+      result = available > 0 ? thrift_ignore_field(NULL, 0, THRIFT_TYPE_STRUCT, buffer, available)
+                             : THRIFT_ERROR_BUFFER_OVERFLOW;
+    }
+
+    // the message is complete
+    if (result >= 0) break;
+
+    // only incomplete messages may wait for more data
+    if (result != THRIFT_ERROR_BUFFER_OVERFLOW) return result;
+
+    // the input ended either cleanly or in the middle of a message
+    if (stream->eof) return available == 0 ? 0 : THRIFT_ERROR_BUFFER_OVERFLOW;
+
+    // the message does not fit the entire buffer
+    if (stream->offset == 0 && stream->size == stream->buffer->size) return THRIFT_ERROR_MESSAGE_TOO_LARGE;
+
+    // refill the buffer and try again
+    result = thrift_stream_fill(stream);
+    if (result < 0) return result;
+  }
+
+  // populate the message
+  message->index = stream->messages;
+  message->offset = stream->position + stream->offset;
+  message->buffer = buffer + frame;
+  message->size = result;
+
+  // consume the message
+  stream->offset += frame + result;
+  stream->consumed += frame + result;
+  stream->messages++;
+
+  // success
+  return 1;
+}
+
+#if defined(I13C_TESTS)
+
+struct thrift_stream_test_source {
+  const char *data; // pointer to the entire input
+  u64 size;         // size of the entire input
+  u64 offset;       // number of already delivered bytes
+  u64 chunk;        // maximum number of bytes delivered per read
+};
+
+static i64 thrift_stream_test_read(void *ctx, char *buffer, u64 buffer_size) {
+  struct thrift_stream_test_source *source;
+  u64 index, size;
+
+  // default
+  source = (struct thrift_stream_test_source *)ctx;
+  size = source->size - source->offset;
+
+  // deliver at most one chunk
+  if (size > source->chunk) size = source->chunk;
+  if (size > buffer_size) size = buffer_size;
+
+  for (index = 0; index < size; index++) {
+    buffer[index] = source->data[source->offset + index];
+  }
+
+  // success
+  source->offset += size;
+  return size;
+}
+
+// represents three concatenated messages: {1: i32 5}, {1: binary "abc"}, {}
+static const char STREAM_CONCATENATED[] = {0x15, 0x0a, 0x00, 0x18, 0x03, 'a', 'b', 'c', 0x00, 0x00};
+
+// represents the same three messages, each prefixed with its length
+static const char STREAM_FRAMED[] = {0x00, 0x00, 0x00, 0x03, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18,
+                                     0x03, 'a',  'b',  'c',  0x00, 0x00, 0x00, 0x00, 0x01, 0x00};
+
+static void can_iterate_concatenated_messages_across_refills() {
+  i64 result;
+  char data[16];
+
+  struct malloc_lease lease;
+  struct thrift_stream stream;
+  struct thrift_stream_message message;
+  struct thrift_stream_test_source source;
+
+  // prepare the source delivering two bytes at once
+  source.data = STREAM_CONCATENATED;
+  source.size = sizeof(STREAM_CONCATENATED);
+  source.offset = 0;
+  source.chunk = 2;
+
+  // prepare the buffer
+  lease.ptr = data;
+  lease.size = sizeof(data);
+
+  // initialize the stream
+  thrift_stream_init(&stream, THRIFT_STREAM_CONCATENATED, &lease, thrift_stream_test_read, &source);
+
+  // read the first message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the first message");
+  assert(message.index == 0, "should be the first message");
+  assert(message.offset == 0, "should start at 0");
+  assert(message.size == 3, "should span 3 bytes");
+
+  // read the second message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the second message");
+  assert(message.index == 1, "should be the second message");
+  assert(message.offset == 3, "should start at 3");
+  assert(message.size == 6, "should span 6 bytes");
+  assert(message.buffer[2] == 'a', "should point at the message content");
+
+  // read the third message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the third message");
+  assert(message.offset == 9, "should start at 9");
+  assert(message.size == 1, "should span 1 byte");
+
+  // reach the end
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 0, "should report the end of the stream");
+  assert(stream.messages == 3, "should count 3 messages");
+  assert(stream.consumed == sizeof(STREAM_CONCATENATED), "should consume the entire input");
+}
+
+static void can_iterate_framed_messages() {
+  i64 result;
+  char data[16];
+
+  struct malloc_lease lease;
+  struct thrift_stream stream;
+  struct thrift_stream_message message;
+  struct thrift_stream_test_source source;
+
+  // prepare the source delivering three bytes at once
+  source.data = STREAM_FRAMED;
+  source.size = sizeof(STREAM_FRAMED);
+  source.offset = 0;
+  source.chunk = 3;
+
+  // prepare the buffer
+  lease.ptr = data;
+  lease.size = sizeof(data);
+
+  // initialize the stream
+  thrift_stream_init(&stream, THRIFT_STREAM_FRAMED, &lease, thrift_stream_test_read, &source);
+
+  // read the first message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the first message");
+  assert(message.offset == 0, "should start at 0");
+  assert(message.size == 3, "should span 3 bytes");
+  assert(message.buffer[0] == 0x15, "should skip the frame");
+
+  // read the second message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the second message");
+  assert(message.offset == 7, "should start at 7");
+  assert(message.size == 6, "should span 6 bytes");
+
+  // read the third message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the third message");
+  assert(message.offset == 17, "should start at 17");
+  assert(message.size == 1, "should span 1 byte");
+
+  // reach the end
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 0, "should report the end of the stream");
+  assert(stream.consumed == sizeof(STREAM_FRAMED), "should consume the entire input");
+}
+
+static void can_report_end_of_empty_stream() {
+  i64 result;
+  char data[16];
+
+  struct malloc_lease lease;
+  struct thrift_stream stream;
+  struct thrift_stream_message message;
+  struct thrift_stream_test_source source;
+
+  // prepare the empty source
+  source.data = STREAM_CONCATENATED;
+  source.size = 0;
+  source.offset = 0;
+  source.chunk = 4;
+
+  // prepare the buffer
+  lease.ptr = data;
+  lease.size = sizeof(data);
+
+  // initialize the stream
+  thrift_stream_init(&stream, THRIFT_STREAM_CONCATENATED, &lease, thrift_stream_test_read, &source);
+
+  // read the first message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 0, "should report the end of the stream");
+  assert(stream.messages == 0, "should count no messages");
+}
+
+static void can_detect_truncated_message() {
+  i64 result;
+  char data[16];
+
+  struct malloc_lease lease;
+  struct thrift_stream stream;
+  struct thrift_stream_message message;
+  struct thrift_stream_test_source source;
+
+  // prepare the source cut in the middle of the second message
+  source.data = STREAM_CONCATENATED;
+  source.size = 6;
+  source.offset = 0;
+  source.chunk = 4;
+
+  // prepare the buffer
+  lease.ptr = data;
+  lease.size = sizeof(data);
+
+  // initialize the stream
+  thrift_stream_init(&stream, THRIFT_STREAM_CONCATENATED, &lease, thrift_stream_test_read, &source);
+
+  // read the first message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == 1, "should return the first message");
+
+  // read the truncated message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should detect truncated message");
+}
+
+static void can_detect_message_larger_than_buffer() {
+  i64 result;
+  char data[4];
+
+  struct malloc_lease lease;
+  struct thrift_stream stream;
+  struct thrift_stream_message message;
+  struct thrift_stream_test_source source;
+
+  // prepare the source starting with a 6-byte message
+  source.data = STREAM_CONCATENATED + 3;
+  source.size = 6;
+  source.offset = 0;
+  source.chunk = 4;
+
+  // prepare the buffer
+  lease.ptr = data;
+  lease.size = sizeof(data);
+
+  // initialize the stream
+  thrift_stream_init(&stream, THRIFT_STREAM_CONCATENATED, &lease, thrift_stream_test_read, &source);
+
+  // read the message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == THRIFT_ERROR_MESSAGE_TOO_LARGE, "should detect message larger than buffer");
+}
+
+static void can_detect_frame_not_matching_message() {
+  i64 result;
+  char data[16];
+
+  struct malloc_lease lease;
+  struct thrift_stream stream;
+  struct thrift_stream_message message;
+  struct thrift_stream_test_source source;
+
+  // represents a frame of 4 bytes holding only a 3-byte struct
+  const char buffer[] = {0x00, 0x00, 0x00, 0x04, 0x15, 0x0a, 0x00, 0x00};
+
+  // prepare the source
+  source.data = buffer;
+  source.size = sizeof(buffer);
+  source.offset = 0;
+  source.chunk = 8;
+
+  // prepare the buffer
+  lease.ptr = data;
+  lease.size = sizeof(data);
+
+  // initialize the stream
+  thrift_stream_init(&stream, THRIFT_STREAM_FRAMED, &lease, thrift_stream_test_read, &source);
+
+  // read the message
+  result = thrift_stream_next(&stream, &message);
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject the frame");
+}
+
+void thrift_test_cases_stream(struct runner_context *ctx) {
+  test_case(ctx, "can iterate concatenated messages across refills", can_iterate_concatenated_messages_across_refills);
+  test_case(ctx, "can iterate framed messages", can_iterate_framed_messages);
+  test_case(ctx, "can report end of empty stream", can_report_end_of_empty_stream);
+  test_case(ctx, "can detect truncated message", can_detect_truncated_message);
+  test_case(ctx, "can detect message larger than buffer", can_detect_message_larger_than_buffer);
+  test_case(ctx, "can detect frame not matching message", can_detect_frame_not_matching_message);
+}
+
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "malloc.h"
+#include "runner.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+#define THRIFT_STREAM_FRAME_SIZE 4 // size of the big-endian length prefix of framed messages
+
+enum thrift_stream_mode {
+  // messages follow each other without any delimiter
+  THRIFT_STREAM_CONCATENATED = 0,
+
+  // each message is prefixed with its 4-byte big-endian length
+  THRIFT_STREAM_FRAMED = 1,
+};
+
+/// @brief Stream refill function type.
+/// @param ctx Pointer to the caller context.
+/// @param buffer Pointer to the buffer to read data into.
+/// @param buffer_size Number of bytes available in the buffer.
+/// @return The number of bytes read, zero at the end of input, or a negative error code.
+typedef i64 (*thrift_stream_read_fn)(void *ctx, char *buffer, u64 buffer_size);
+
+struct thrift_stream {
+  enum thrift_stream_mode mode; // how messages are delimited
+  bool eof;                     // whether the input was exhausted
+
+  u64 offset;   // position of the first unconsumed byte in the buffer
+  u64 size;     // number of valid bytes in the buffer
+  u64 position; // stream offset of the first byte in the buffer
+
+  u64 messages; // number of returned messages
+  u64 consumed; // number of consumed bytes, including frames
+
+  struct malloc_lease *buffer; // buffer holding the unconsumed data
+  thrift_stream_read_fn read;  // function refilling the buffer
+  void *read_ctx;              // context passed to the refill function
+};
+
+struct thrift_stream_message {
+  u64 index;          // zero-based index of the message in the stream
+  u64 offset;         // stream offset of the message, including its frame
+  const char *buffer; // pointer to the message, valid until the next call
+  u64 size;           // size of the message, excluding its frame
+};
+
+/// @brief Initializes an empty stream over the provided buffer.
+/// @param stream Pointer to the thrift_stream structure to initialize.
+/// @param mode How messages are delimited in the input.
+/// @param buffer Pointer to the malloc_lease structure holding the buffer, it limits the message size.
+/// @param read Function refilling the buffer.
+/// @param read_ctx Pointer to the context passed to the refill function.
+extern void thrift_stream_init(struct thrift_stream *stream,
+                               enum thrift_stream_mode mode,
+                               struct malloc_lease *buffer,
+                               thrift_stream_read_fn read,
+                               void *read_ctx);
+
+/// @brief Returns the next complete and validated message, refilling the buffer when needed.
+/// @param stream Pointer to the initialized stream.
+/// @param message Pointer to the message to populate.
+/// @return 1 if a message was returned, 0 at the end of the stream, or a negative error code.
+extern i64 thrift_stream_next(struct thrift_stream *stream, struct thrift_stream_message *message);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers thrift stream test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void thrift_test_cases_stream(struct runner_context *ctx);
+
+#endif
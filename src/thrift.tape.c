@@ -0,0 +1,763 @@
+#include "thrift.tape.h"
+#include "malloc.h"
+#include "runner.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+// forward declarations of the recursive indexing functions
+static i64 thrift_tape_value(
+  struct thrift_tape *tape, u16 field, u8 type, u8 depth, bool element, const char *origin, const char *buffer,
+  u64 buffer_size);
+
+void thrift_tape_init(struct thrift_tape *tape, struct malloc_lease *buffer) {
+  // default values
+  tape->size = 0;
+  tape->buffer = buffer;
+
+  // the entire buffer is used for nodes
+  tape->nodes = (struct thrift_tape_node *)buffer->ptr;
+  tape->capacity = (u32)(buffer->size / sizeof(struct thrift_tape_node));
+}
+
+static i64 thrift_tape_append(struct thrift_tape *tape, u32 offset, u16 field, u8 type, u8 depth) {
+  struct thrift_tape_node *node;
+
+  // check if there is a space for the next node
+  if (tape->size >= tape->capacity) return THRIFT_ERROR_TAPE_OVERFLOW;
+
+  // fill the node, the next and count are completed later
+  node = tape->nodes + tape->size;
+  node->offset = offset;
+  node->next = tape->size + 1;
+  node->count = 0;
+  node->field = field;
+  node->type = type;
+  node->depth = depth;
+
+  // success
+  return tape->size++;
+}
+
+static i64 thrift_tape_struct(
+  struct thrift_tape *tape, u32 node, u8 depth, const char *origin, const char *buffer, u64 buffer_size) {
+
+  i64 result, read;
+  struct thrift_struct_header header;
+
+  // default
+  read = 0;
+  header.field = 0;
+
+  while (TRUE) {
+    // read the next struct header
+    result = thrift_read_struct_header(&header, buffer, buffer_size);
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+
+    // check if we reached the end of the struct
+    if (header.type == THRIFT_TYPE_STOP) {
+      break;
+    }
+
+    // index the field value, bools are carried by the header
+    result = thrift_tape_value(tape, header.field, header.type, depth + 1, FALSE, origin, buffer, buffer_size);
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+
+    // count the field
+    tape->nodes[node].count++;
+  }
+
+  // success
+  return read;
+}
+
+static i64 thrift_tape_list(
+  struct thrift_tape *tape, u32 node, u8 depth, const char *origin, const char *buffer, u64 buffer_size) {
+
+  u32 index;
+  i64 result, read;
+  struct thrift_list_header header;
+
+  // read the list header containing size and type
+  result = thrift_read_list_header(&header, buffer, buffer_size);
+  if (result < 0) return result;
+
+  // move the buffer pointer and size
+  read = result;
+  buffer += result;
+  buffer_size -= result;
+
+  // the count is known upfront
+  tape->nodes[node].count = header.size;
+
+  for (index = 0; index < header.size; index++) {
+    // index the list element
+    result = thrift_tape_value(tape, 0, header.type, depth + 1, TRUE, origin, buffer, buffer_size);
+    if (result < 0) return result;
+
+    // move the buffer pointer and size
+    read += result;
+    buffer += result;
+    buffer_size -= result;
+  }
+
+  // success
+  return read;
+}
+
+static i64 thrift_tape_value(
+  struct thrift_tape *tape, u16 field, u8 type, u8 depth, bool element, const char *origin, const char *buffer,
+  u64 buffer_size) {
+
+  i64 result;
+  u32 node;
+
+  // check for too nested structures
+  if (depth > THRIFT_TAPE_MAX_DEPTH) return THRIFT_ERROR_TOO_NESTED;
+
+  // append the node for the value
+  result = thrift_tape_append(tape, (u32)(buffer - origin), field, type, depth);
+  if (result < 0) return result;
+
+  // remember the node
+  node = (u32)result;
+
+  switch (type) {
+    case THRIFT_TYPE_STRUCT:
+      result = thrift_tape_struct(tape, node, depth, origin, buffer, buffer_size);
+      break;
+    case THRIFT_TYPE_LIST:
+      result = thrift_tape_list(tape, node, depth, origin, buffer, buffer_size);
+      break;
+    case THRIFT_TYPE_BOOL_TRUE:
+    case THRIFT_TYPE_BOOL_FALSE:
+      result = element ? thrift_read_bool(NULL, buffer, buffer_size) : 0;
+      break;
+    default:
+      result = thrift_ignore_field(NULL, field, type, buffer, buffer_size);
+      break;
+  }
+
+  // perhaps the value is invalid
+  if (result < 0) return result;
+
+  // the subtree is complete
+  tape->nodes[node].next = tape->size;
+
+  // success
+  return result;
+}
+
+i64 thrift_tape_build(struct thrift_tape *tape, const char *buffer, u64 buffer_size) {
+  // start from the scratch
+  tape->size = 0;
+
+  // offsets are stored in 32 bits, so larger messages cannot be indexed
+  if (buffer_size > 0xffffffff) return THRIFT_ERROR_MESSAGE_TOO_LARGE;
+
+  // the root is always a struct without a field
+  return thrift_tape_value(tape, 0, THRIFT_TYPE_STRUCT, 0, FALSE, buffer, buffer, buffer_size);
+}
+
+i64 thrift_tape_load(struct thrift_tape *tape, const char *nodes, u64 nodes_size, u64 buffer_size) {
+  u32 index, size, depth;
+  u32 parents[THRIFT_TAPE_MAX_DEPTH + 1];
+  u32 remaining[THRIFT_TAPE_MAX_DEPTH + 1];
+  struct thrift_tape_node *node, *parent;
+
+  // check if the buffer contains only complete nodes
+  if (nodes_size == 0 || nodes_size % sizeof(struct thrift_tape_node) != 0) return THRIFT_ERROR_INVALID_VALUE;
+
+  // check if the nodes fit the tape
+  if (nodes_size / sizeof(struct thrift_tape_node) > tape->capacity) return THRIFT_ERROR_TAPE_OVERFLOW;
+
+  // the nodes are position independent, so they are copied as they are
+  size = (u32)(nodes_size / sizeof(struct thrift_tape_node));
+
+  for (index = 0; index < nodes_size; index++) {
+    ((char *)tape->nodes)[index] = nodes[index];
+  }
+
+  // the root has to be a struct covering the entire tape
+  node = tape->nodes;
+  if (node->type != THRIFT_TYPE_STRUCT || node->depth != 0 || node->next != size) goto cleanup;
+  if (node->offset >= buffer_size) goto cleanup;
+
+  // the open subtrees are tracked per depth with their children still to come
+  depth = 0;
+  parents[0] = 0;
+  remaining[0] = node->count;
+
+  for (index = 1; index < size; index++) {
+    node = tape->nodes + index;
+
+    // close the subtrees ending before the node, each has to have seen all its children
+    while (tape->nodes[parents[depth]].next == index) {
+      if (remaining[depth] != 0 || depth == 0) goto cleanup;
+      depth--;
+    }
+
+    // the node is the next child of the innermost open subtree
+    parent = tape->nodes + parents[depth];
+    if (remaining[depth] == 0) goto cleanup;
+    remaining[depth]--;
+
+    // the node has to be nested once more and end within its parent
+    if (node->depth != depth + 1) goto cleanup;
+    if (node->next <= index || node->next > parent->next) goto cleanup;
+
+    // only known types are allowed and every value lies within the message
+    if (node->type >= THRIFT_TYPE_SIZE) goto cleanup;
+    if (node->offset >= buffer_size) goto cleanup;
+
+    // scalars have neither children nor subtrees
+    if (node->type != THRIFT_TYPE_STRUCT && node->type != THRIFT_TYPE_LIST) {
+      if (node->count != 0 || node->next != index + 1) goto cleanup;
+      continue;
+    }
+
+    // open the subtree of the struct or the list
+    if (depth + 1 > THRIFT_TAPE_MAX_DEPTH) goto cleanup;
+
+    depth++;
+    parents[depth] = index;
+    remaining[depth] = node->count;
+  }
+
+  // the subtrees still open end with the tape, so they have to be complete
+  while (TRUE) {
+    if (remaining[depth] != 0) goto cleanup;
+    if (depth-- == 0) break;
+  }
+
+  // success
+  tape->size = size;
+  return size;
+
+cleanup:
+  tape->size = 0;
+  return THRIFT_ERROR_INVALID_VALUE;
+}
+
+i64 thrift_tape_child(const struct thrift_tape *tape, u32 node, u32 key) {
+  u32 index, child;
+  const struct thrift_tape_node *parent;
+
+  // check if the node exists
+  if (node >= tape->size) return THRIFT_ERROR_NOT_FOUND;
+
+  // the first child always follows its parent
+  parent = tape->nodes + node;
+  child = node + 1;
+
+  switch (parent->type) {
+    case THRIFT_TYPE_STRUCT:
+      for (index = 0; index < parent->count && child < parent->next; index++) {
+        // fields are kept in the message order
+        if (tape->nodes[child].field == key) return child;
+
+        // jump over the entire field subtree
+        child = tape->nodes[child].next;
+      }
+
+      return THRIFT_ERROR_NOT_FOUND;
+
+    case THRIFT_TYPE_LIST:
+      if (key >= parent->count) return THRIFT_ERROR_NOT_FOUND;
+
+      // elements without subtrees are laid out contiguously
+      if (parent->next - child == parent->count) return child + key;
+
+      // otherwise jump over the preceding subtrees
+      for (index = 0; index < key && child < parent->next; index++) {
+        child = tape->nodes[child].next;
+      }
+
+      // the subtrees never reach beyond their parent
+      if (child >= parent->next) return THRIFT_ERROR_NOT_FOUND;
+
+      return child;
+
+    default:
+      return THRIFT_ERROR_NOT_FOUND;
+  }
+}
+
+i64 thrift_tape_lookup(const struct thrift_tape *tape, const u32 *path, u32 path_size) {
+  i64 result;
+  u32 index;
+
+  // the empty tape has no root
+  if (tape->size == 0) return THRIFT_ERROR_NOT_FOUND;
+
+  // start from the root
+  result = 0;
+
+  for (index = 0; index < path_size; index++) {
+    // descend one level deeper
+    result = thrift_tape_child(tape, (u32)result, path[index]);
+    if (result < 0) return result;
+  }
+
+  // success
+  return result;
+}
+
+#if defined(I13C_TESTS)
+
+// represents a struct with i32, list of two structs, bool and list of three i32
+static const char TAPE_MESSAGE[] = {0x15, 0x0a, 0x19, 0x2c, 0x18, 0x02, 'a',  'b',  0x36, 0x0e, 0x00,
+                                    0x46, 0x01, 0x00, 0x11, 0x19, 0x35, 0x02, 0x04, 0x06, 0x00};
+
+static void can_build_tape_for_nested_message() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize the tape with the buffer
+  thrift_tape_init(&tape, &lease);
+  assert(tape.capacity == 256, "should fit 256 nodes in 4KB buffer");
+
+  // build the tape
+  result = thrift_tape_build(&tape, TAPE_MESSAGE, sizeof(TAPE_MESSAGE));
+
+  // assert the result
+  assert(result == sizeof(TAPE_MESSAGE), "should index the entire message");
+  assert(tape.size == 13, "should create 13 nodes");
+
+  assert(tape.nodes[0].type == THRIFT_TYPE_STRUCT, "root should be a struct");
+  assert(tape.nodes[0].count == 4, "root should have 4 fields");
+  assert(tape.nodes[0].next == 13, "root should cover the entire tape");
+
+  assert(tape.nodes[1].field == 1, "first field should have id 1");
+  assert(tape.nodes[1].offset == 1, "first field should start at 1");
+
+  assert(tape.nodes[2].type == THRIFT_TYPE_LIST, "second field should be a list");
+  assert(tape.nodes[2].count == 2, "second field should have 2 elements");
+  assert(tape.nodes[2].next == 8, "second field should end at node 8");
+
+  assert(tape.nodes[6].offset == 11, "second element should start at 11");
+  assert(tape.nodes[6].depth == 2, "second element should be nested twice");
+
+  assert(tape.nodes[8].type == THRIFT_TYPE_BOOL_TRUE, "third field should be a true bool");
+  assert(tape.nodes[12].offset == 19, "last element should start at 19");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_lookup_field_in_list_element() {
+  i64 result, value;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  const u32 path[] = {2, 1, 4};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, TAPE_MESSAGE, sizeof(TAPE_MESSAGE));
+  assert(result == sizeof(TAPE_MESSAGE), "should index the entire message");
+
+  // lookup the path
+  result = thrift_tape_lookup(&tape, path, 3);
+  assert(result == 7, "should find node 7");
+
+  // read the value directly from the offset
+  result = thrift_read_i64(&value, TAPE_MESSAGE + tape.nodes[7].offset, sizeof(TAPE_MESSAGE) - tape.nodes[7].offset);
+  assert(result == 1, "should read one byte");
+  assert(value == -1, "should read value -1");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_lookup_element_in_scalar_list() {
+  i64 result;
+  i32 value;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  const u32 path[] = {4, 2};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, TAPE_MESSAGE, sizeof(TAPE_MESSAGE));
+  assert(result == sizeof(TAPE_MESSAGE), "should index the entire message");
+
+  // lookup the path
+  result = thrift_tape_lookup(&tape, path, 2);
+  assert(result == 12, "should find node 12");
+
+  // read the value directly from the offset
+  result = thrift_read_i32(&value, TAPE_MESSAGE + tape.nodes[12].offset, 1);
+  assert(result == 1, "should read one byte");
+  assert(value == 3, "should read value 3");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_detect_missing_path() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  const u32 path1[] = {5};
+  const u32 path2[] = {2, 2};
+  const u32 path3[] = {1, 0};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, TAPE_MESSAGE, sizeof(TAPE_MESSAGE));
+  assert(result == sizeof(TAPE_MESSAGE), "should index the entire message");
+
+  // lookup not existing paths
+  result = thrift_tape_lookup(&tape, path1, 1);
+  assert(result == THRIFT_ERROR_NOT_FOUND, "should not find missing field");
+
+  result = thrift_tape_lookup(&tape, path2, 2);
+  assert(result == THRIFT_ERROR_NOT_FOUND, "should not find element out of range");
+
+  result = thrift_tape_lookup(&tape, path3, 2);
+  assert(result == THRIFT_ERROR_NOT_FOUND, "should not descend into a scalar");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_detect_tape_overflow() {
+  i64 result;
+  u32 index;
+  char buffer[308];
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  // field 1 as list of 300 i8 elements
+  buffer[0] = 0x19;
+  buffer[1] = 0xf3;
+  buffer[2] = 0xac;
+  buffer[3] = 0x02;
+
+  for (index = 4; index < 304; index++) {
+    buffer[index] = 0x01;
+  }
+
+  buffer[304] = 0x00;
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, buffer, 305);
+
+  // assert the result
+  assert(result == THRIFT_ERROR_TAPE_OVERFLOW, "should fail with THRIFT_ERROR_TAPE_OVERFLOW");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_detect_too_nested_message() {
+  i64 result;
+  u32 index;
+  char buffer[80];
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  // each byte opens a nested struct as field 1
+  for (index = 0; index < sizeof(buffer); index++) {
+    buffer[index] = 0x1c;
+  }
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, buffer, sizeof(buffer));
+
+  // assert the result
+  assert(result == THRIFT_ERROR_TOO_NESTED, "should fail with THRIFT_ERROR_TOO_NESTED");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_detect_truncated_message() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape without the last byte
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, TAPE_MESSAGE, sizeof(TAPE_MESSAGE) - 1);
+
+  // assert the result
+  assert(result == THRIFT_ERROR_BUFFER_OVERFLOW, "should fail with THRIFT_ERROR_BUFFER_OVERFLOW");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_detect_too_large_message() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease;
+  struct thrift_tape tape;
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease.size = 4096;
+  result = malloc_acquire(&pool, &lease);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the tape claiming a message of 4 GiB, nothing is read
+  thrift_tape_init(&tape, &lease);
+  result = thrift_tape_build(&tape, TAPE_MESSAGE, 0x100000000ull);
+
+  // assert the result
+  assert(result == THRIFT_ERROR_MESSAGE_TOO_LARGE, "should fail with THRIFT_ERROR_MESSAGE_TOO_LARGE");
+  assert(tape.size == 0, "should create no nodes");
+
+  // release the memory
+  malloc_release(&pool, &lease);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_load_cached_tape() {
+  i64 result;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease1, lease2;
+  struct thrift_tape tape1, tape2;
+
+  const u32 path[] = {2, 0, 1};
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease1.size = 4096;
+  result = malloc_acquire(&pool, &lease1);
+  assert(result == 0, "should allocate memory");
+
+  lease2.size = 4096;
+  result = malloc_acquire(&pool, &lease2);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the first tape
+  thrift_tape_init(&tape1, &lease1);
+  result = thrift_tape_build(&tape1, TAPE_MESSAGE, sizeof(TAPE_MESSAGE));
+  assert(result == sizeof(TAPE_MESSAGE), "should index the entire message");
+
+  // load the second tape from the raw nodes
+  thrift_tape_init(&tape2, &lease2);
+  result = thrift_tape_load(
+    &tape2, (const char *)tape1.nodes, tape1.size * sizeof(struct thrift_tape_node), sizeof(TAPE_MESSAGE));
+
+  // assert the result
+  assert(result == 13, "should load 13 nodes");
+  assert(tape2.size == 13, "should have 13 nodes");
+
+  // lookup the path
+  result = thrift_tape_lookup(&tape2, path, 3);
+  assert(result == 4, "should find node 4");
+  assert(tape2.nodes[4].offset == 5, "should point at offset 5");
+
+  // release the memory
+  malloc_release(&pool, &lease1);
+  malloc_release(&pool, &lease2);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+static void can_detect_corrupted_cached_tape() {
+  i64 result;
+  u64 size;
+
+  struct malloc_pool pool;
+  struct malloc_lease lease1, lease2;
+  struct thrift_tape tape1, tape2;
+
+  // initialize the pool
+  malloc_init(&pool);
+
+  // acquire memory
+  lease1.size = 4096;
+  result = malloc_acquire(&pool, &lease1);
+  assert(result == 0, "should allocate memory");
+
+  lease2.size = 4096;
+  result = malloc_acquire(&pool, &lease2);
+  assert(result == 0, "should allocate memory");
+
+  // initialize and build the first tape
+  thrift_tape_init(&tape1, &lease1);
+  result = thrift_tape_build(&tape1, TAPE_MESSAGE, sizeof(TAPE_MESSAGE));
+  assert(result == sizeof(TAPE_MESSAGE), "should index the entire message");
+
+  // load partial node
+  thrift_tape_init(&tape2, &lease2);
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, 7, sizeof(TAPE_MESSAGE));
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject partial node");
+
+  // corrupt the skip pointer
+  size = tape1.size * sizeof(struct thrift_tape_node);
+  tape1.nodes[3].next = 2;
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, size, sizeof(TAPE_MESSAGE));
+
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject backward skip pointer");
+  assert(tape2.size == 0, "should leave the tape empty");
+
+  // overstate the number of list elements, the last one would walk out of the list
+  tape1.nodes[3].next = 6;
+  tape1.nodes[2].count = 3;
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, size, sizeof(TAPE_MESSAGE));
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject wrong children count");
+
+  // let the first element swallow the second one
+  tape1.nodes[2].count = 2;
+  tape1.nodes[3].next = 8;
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, size, sizeof(TAPE_MESSAGE));
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject subtree crossing its sibling");
+
+  // move the field one level deeper
+  tape1.nodes[3].next = 6;
+  tape1.nodes[4].depth = 4;
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, size, sizeof(TAPE_MESSAGE));
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject inconsistent depth");
+
+  // point the value outside of the message
+  tape1.nodes[4].depth = 3;
+  tape1.nodes[4].offset = sizeof(TAPE_MESSAGE);
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, size, sizeof(TAPE_MESSAGE));
+  assert(result == THRIFT_ERROR_INVALID_VALUE, "should reject offset beyond the message");
+
+  // restored nodes load again
+  tape1.nodes[4].offset = 5;
+  result = thrift_tape_load(&tape2, (const char *)tape1.nodes, size, sizeof(TAPE_MESSAGE));
+  assert(result == 13, "should load restored nodes");
+
+  // release the memory
+  malloc_release(&pool, &lease1);
+  malloc_release(&pool, &lease2);
+
+  // destroy the pool
+  malloc_destroy(&pool);
+}
+
+void thrift_test_cases_tape(struct runner_context *ctx) {
+  test_case(ctx, "can build tape for nested message", can_build_tape_for_nested_message);
+  test_case(ctx, "can lookup field in list element", can_lookup_field_in_list_element);
+  test_case(ctx, "can lookup element in scalar list", can_lookup_element_in_scalar_list);
+  test_case(ctx, "can detect missing path", can_detect_missing_path);
+  test_case(ctx, "can detect tape overflow", can_detect_tape_overflow);
+  test_case(ctx, "can detect too nested message", can_detect_too_nested_message);
+  test_case(ctx, "can detect truncated message", can_detect_truncated_message);
+  test_case(ctx, "can detect too large message", can_detect_too_large_message);
+  test_case(ctx, "can load cached tape", can_load_cached_tape);
+  test_case(ctx, "can detect corrupted cached tape", can_detect_corrupted_cached_tape);
+}
+
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "malloc.h"
+#include "runner.h"
+#include "thrift.base.h"
+#include "typing.h"
+
+#define THRIFT_TAPE_MAX_DEPTH 64 // maximum nesting of structs and lists
+
+struct thrift_tape_node {
+  u32 offset; // byte offset of the value in the message
+  u32 next;   // index of the node following the entire subtree
+  u32 count;  // number of children, struct fields or list elements
+  u16 field;  // field id in the parent struct, zero for list elements
+  u8 type;    // thrift type of the value
+  u8 depth;   // nesting level, zero for the root struct
+};
+
+struct thrift_tape {
+  u32 size;     // number of occupied nodes
+  u32 capacity; // number of available nodes
+
+  struct malloc_lease *buffer;    // buffer holding the nodes
+  struct thrift_tape_node *nodes; // array of nodes in the buffer
+};
+
+/// @brief Initializes an empty tape over the provided buffer.
+/// @param tape Pointer to the thrift_tape structure to initialize.
+/// @param buffer Pointer to the malloc_lease structure holding the buffer for nodes.
+extern void thrift_tape_init(struct thrift_tape *tape, struct malloc_lease *buffer);
+
+/// @brief Indexes a compact-protocol struct in a single pass, one node per value in pre-order.
+/// @param tape Pointer to the initialized tape.
+/// @param buffer Pointer to the buffer containing the message.
+/// @param buffer_size Size of the buffer, at most 4 GiB - 1 as offsets are stored in 32 bits.
+/// @return The number of bytes indexed from the buffer, or a negative error code.
+extern i64 thrift_tape_build(struct thrift_tape *tape, const char *buffer, u64 buffer_size);
+
+/// @brief Attaches a previously built tape, e.g. cached on disk, after validating its structure.
+/// @param tape Pointer to the initialized tape.
+/// @param nodes Pointer to the serialized nodes, exactly as they were stored in the tape.
+/// @param nodes_size Size of the serialized nodes in bytes.
+/// @param buffer_size Size of the message the nodes were built from, no offset may reach it.
+/// @return The number of attached nodes, or a negative error code.
+extern i64 thrift_tape_load(struct thrift_tape *tape, const char *nodes, u64 nodes_size, u64 buffer_size);
+
+/// @brief Finds a direct child of a node.
+/// @param tape Pointer to the built tape.
+/// @param node Index of the parent node.
+/// @param key Field id for structs or zero-based element index for lists.
+/// @return The index of the child node, or a negative error code.
+extern i64 thrift_tape_child(const struct thrift_tape *tape, u32 node, u32 key);
+
+/// @brief Finds a node by walking the path from the root struct.
+/// @param tape Pointer to the built tape.
+/// @param path Pointer to the array of keys, field ids or list indices.
+/// @param path_size Number of keys in the path.
+/// @return The index of the found node, or a negative error code.
+extern i64 thrift_tape_lookup(const struct thrift_tape *tape, const u32 *path, u32 path_size);
+
+#if defined(I13C_TESTS)
+
+/// @brief Registers thrift tape test cases.
+/// @param ctx Pointer to the runner_context structure.
+extern void thrift_test_cases_tape(struct runner_context *ctx);
+
+#endif